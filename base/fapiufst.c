@@ -2205,7 +2205,7 @@ gs_fapi_ufst_destroy(gs_fapi_server ** server)
 
     gs_fapi_ufst_release_char_data_inline(r);
     if (r->bInitialized && !r->ufst_is_singleton)
-        gx_UFST_fini();
+        gx_UFST_fini(r->mem);
 
     if (r->param) {
         gs_free(r->mem, r->param, 0, 0, "server_params");
@@ -125,10 +125,10 @@ static void pdf14_debug_mask_stack_state(pdf14_ctx *ctx);
 #endif
 
 /* Buffer stack	data structure */
-gs_private_st_ptrs7(st_pdf14_buf, pdf14_buf, "pdf14_buf",
+gs_private_st_ptrs8(st_pdf14_buf, pdf14_buf, "pdf14_buf",
                     pdf14_buf_enum_ptrs, pdf14_buf_reloc_ptrs,
                     saved, data, backdrop, transfer_fn, mask_stack,
-                    matte, parent_color_info_procs);
+                    matte, parent_color_info_procs, tiles);
 
 gs_private_st_ptrs2(st_pdf14_ctx, pdf14_ctx, "pdf14_ctx",
                     pdf14_ctx_enum_ptrs, pdf14_ctx_reloc_ptrs,
@@ -817,6 +817,9 @@ pdf14_buf_new(gs_int_rect *rect, bool has_tags, bool has_alpha_g,
     result->idle = idle;
     result->mask_id = 0;
     result->num_spots = num_spots;
+    result->tiles = NULL;
+    result->tiles_x = 0;
+    result->tiles_y = 0;
     new_parent_color = gs_alloc_struct(memory, pdf14_parent_color_t, &st_pdf14_clr,
                                                 "pdf14_buf_new");
     if (new_parent_color == NULL) {
@@ -878,6 +881,7 @@ pdf14_buf_free(pdf14_buf *buf)
     gs_free_object(memory, buf->transfer_fn, "pdf14_buf_free");
     gs_free_object(memory, buf->matte, "pdf14_buf_free");
     gs_free_object(memory, buf->data, "pdf14_buf_free");
+    gs_free_object(memory, buf->tiles, "pdf14_buf_free");
 
     while (old_parent_color_info) {
        if (old_parent_color_info->icc_profile != NULL) {
@@ -892,6 +896,105 @@ pdf14_buf_free(pdf14_buf *buf)
     gs_free_object(memory, buf, "pdf14_buf_free");
 }
 
+/*
+ * Clear the color, alpha, shape and alpha_g planes of a newly pushed buffer
+ * to 0.  Large buffers are only marked as needing it: each tile is cleared
+ * by pdf14_buf_touch when first drawn into, so that groups and masks whose
+ * bbox is much bigger than what is painted in them don't pay for clearing
+ * (or, with a lazily committing allocator, even owning) the unpainted part.
+ */
+static void
+pdf14_buf_clear(pdf14_buf *buf)
+{
+    int width = buf->rect.q.x - buf->rect.p.x;
+    int height = buf->rect.q.y - buf->rect.p.y;
+    int tiles_x = (width + PDF14_TILE_SIZE - 1) / PDF14_TILE_SIZE;
+    int tiles_y = (height + PDF14_TILE_SIZE - 1) / PDF14_TILE_SIZE;
+
+    if (tiles_x * tiles_y >= 4) {
+        buf->tiles = gs_alloc_bytes(buf->memory, tiles_x * tiles_y,
+                                    "pdf14_buf_clear");
+        if (buf->tiles != NULL) {
+            memset(buf->tiles, 0, tiles_x * tiles_y);
+            buf->tiles_x = tiles_x;
+            buf->tiles_y = tiles_y;
+            return;
+        }
+    }
+    /* Small buffer, or no memory for the tile map: clear it all now. */
+    memset(buf->data, 0, buf->planestride * (buf->n_chan +
+                                             (buf->has_shape ? 1 : 0) +
+                                             (buf->has_alpha_g ? 1 : 0)));
+}
+
+void
+pdf14_buf_touch(pdf14_buf *buf, int x0, int y0, int x1, int y1)
+{
+    int n_planes, tx0, tx1, ty0, ty1, tx, ty;
+
+    if (buf->tiles == NULL)
+        return;
+    x0 = max(x0, buf->rect.p.x) - buf->rect.p.x;
+    y0 = max(y0, buf->rect.p.y) - buf->rect.p.y;
+    x1 = min(x1, buf->rect.q.x) - buf->rect.p.x;
+    y1 = min(y1, buf->rect.q.y) - buf->rect.p.y;
+    if (x0 >= x1 || y0 >= y1)
+        return;
+    n_planes = buf->n_chan + (buf->has_shape ? 1 : 0) +
+        (buf->has_alpha_g ? 1 : 0);
+    tx0 = x0 / PDF14_TILE_SIZE;
+    tx1 = (x1 - 1) / PDF14_TILE_SIZE;
+    ty0 = y0 / PDF14_TILE_SIZE;
+    ty1 = (y1 - 1) / PDF14_TILE_SIZE;
+    for (ty = ty0; ty <= ty1; ty++) {
+        byte *tile = buf->tiles + ty * buf->tiles_x;
+        int row0 = ty * PDF14_TILE_SIZE;
+        int rows = min(PDF14_TILE_SIZE, buf->rect.q.y - buf->rect.p.y - row0);
+
+        for (tx = tx0; tx <= tx1; tx++) {
+            int col0 = tx * PDF14_TILE_SIZE;
+            /* The last column of tiles takes the row padding with it. */
+            int cols = (tx == buf->tiles_x - 1 ? buf->rowstride - col0 :
+                        PDF14_TILE_SIZE);
+            byte *plane;
+            int i, j;
+
+            if (tile[tx])
+                continue;
+            tile[tx] = 1;
+            plane = buf->data + row0 * buf->rowstride + col0;
+            for (i = 0; i < n_planes; i++, plane += buf->planestride) {
+                byte *row = plane;
+
+                for (j = 0; j < rows; j++, row += buf->rowstride)
+                    memset(row, 0, cols);
+            }
+        }
+    }
+}
+
+/*
+ * Find the next run of touched tiles in row ty of a lazily cleared buffer,
+ * starting the search at tile *ptx0.  On success, return the run as the
+ * tile columns [*ptx0, *ptx1).
+ */
+static bool
+pdf14_buf_next_run(const pdf14_buf *buf, int ty, int *ptx0, int *ptx1)
+{
+    const byte *tile = buf->tiles + ty * buf->tiles_x;
+    int tx = *ptx0;
+
+    while (tx < buf->tiles_x && !tile[tx])
+        tx++;
+    if (tx == buf->tiles_x)
+        return false;
+    *ptx0 = tx;
+    while (tx < buf->tiles_x && tile[tx])
+        tx++;
+    *ptx1 = tx;
+    return true;
+}
+
 static void
 rc_pdf14_maskbuf_free(gs_memory_t * mem, void *ptr_in, client_name_t cname)
 {
@@ -1062,9 +1165,14 @@ pdf14_push_transparency_group(pdf14_ctx	*ctx, gs_int_rect *rect, bool isolated,
     backdrop = pdf14_find_backdrop_buf(ctx);
     if (backdrop == NULL) {
         /* Note, don't clear out tags set by pdf14_buf_new == GS_UNKNOWN_TAG */
-        memset(buf->data, 0, buf->planestride * (buf->n_chan +
-                                                 (buf->has_shape ? 1 : 0) +
-                                                 (buf->has_alpha_g ? 1 : 0)));
+        /* A non-isolated knockout group gets the knockout backdrop copied
+           in below, so it has to be cleared up front. */
+        if (buf->knockout && !buf->isolated)
+            memset(buf->data, 0, buf->planestride * (buf->n_chan +
+                                                     (buf->has_shape ? 1 : 0) +
+                                                     (buf->has_alpha_g ? 1 : 0)));
+        else
+            pdf14_buf_clear(buf);
     } else {
         if (!buf->knockout) {
             if (!cm_back_drop) {
@@ -1151,6 +1259,49 @@ pdf14_push_transparency_group(pdf14_ctx	*ctx, gs_int_rect *rect, bool isolated,
     return 0;
 }
 
+/*
+ * Compose the part of tos inside (x0, y0) - (x1, y1) onto nos.  When tos is
+ * an isolated, lazily cleared group, the tiles that were never touched are
+ * still fully transparent, and composing them would leave nos unchanged, so
+ * only the runs of touched tiles are composed.
+ */
+static void
+pdf14_compose_touched(pdf14_buf *tos, pdf14_buf *nos, pdf14_buf *maskbuf,
+              int x0, int x1, int y0, int y1, int n_chan, bool additive,
+              const pdf14_nonseparable_blending_procs_t * pblend_procs,
+              bool overprint, gx_color_index drawn_comps, gs_memory_t *memory,
+              gx_device *dev)
+{
+    int ty, ty0, ty1, tx0, tx1;
+
+    if (tos->tiles == NULL) {
+        pdf14_compose_group(tos, nos, maskbuf, x0, x1, y0, y1, n_chan,
+                            additive, pblend_procs, overprint, drawn_comps,
+                            memory, dev);
+        return;
+    }
+    ty0 = (y0 - tos->rect.p.y) / PDF14_TILE_SIZE;
+    ty1 = (y1 - 1 - tos->rect.p.y) / PDF14_TILE_SIZE;
+    for (ty = ty0; ty <= ty1; ty++) {
+        int ry0 = max(y0, tos->rect.p.y + ty * PDF14_TILE_SIZE);
+        int ry1 = min(y1, tos->rect.p.y + (ty + 1) * PDF14_TILE_SIZE);
+
+        tx0 = (x0 - tos->rect.p.x) / PDF14_TILE_SIZE;
+        while (pdf14_buf_next_run(tos, ty, &tx0, &tx1)) {
+            int rx0 = max(x0, tos->rect.p.x + tx0 * PDF14_TILE_SIZE);
+            int rx1 = min(x1, tos->rect.p.x + tx1 * PDF14_TILE_SIZE);
+
+            if (rx0 >= x1)
+                break;
+            if (rx0 < rx1)
+                pdf14_compose_group(tos, nos, maskbuf, rx0, rx1, ry0, ry1,
+                                    n_chan, additive, pblend_procs, overprint,
+                                    drawn_comps, memory, dev);
+            tx0 = tx1;
+        }
+    }
+}
+
 static	int
 pdf14_pop_transparency_group(gs_gstate *pgs, pdf14_ctx *ctx,
     const pdf14_nonseparable_blending_procs_t * pblend_procs,
@@ -1211,6 +1362,13 @@ pdf14_pop_transparency_group(gs_gstate *pgs, pdf14_ctx *ctx,
         goto exit;
     if (maskbuf != NULL && maskbuf->data == NULL && maskbuf->alpha == 255)
         goto exit;
+    /* Untouched tiles can only be skipped if tos starts out transparent,
+       and a knockout nos mixes in its own backdrop, so clear the rest. */
+    if (tos->tiles != NULL && (!tos->isolated || nos->knockout)) {
+        pdf14_buf_touch(tos, x0, y0, x1, y1);
+        gs_free_object(tos->memory, tos->tiles, "pdf14_pop_transparency_group");
+        tos->tiles = NULL;
+    }
 
 #if RAW_DUMP
     /* Dump the current buffer to see what we have. */
@@ -1256,7 +1414,7 @@ pdf14_pop_transparency_group(gs_gstate *pgs, pdf14_ctx *ctx,
                             "aCMTrans_Group_ColorConv",ctx->stack->data);
 #endif
              /* compose. never do overprint in this case */
-            pdf14_compose_group(tos, nos, maskbuf, x0, x1, y0, y1, nos->n_chan,
+            pdf14_compose_touched(tos, nos, maskbuf, x0, x1, y0, y1, nos->n_chan,
                  nos->parent_color_info_procs->isadditive,
                  nos->parent_color_info_procs->parent_blending_procs,
                  false, drawn_comps, ctx->memory, dev);
@@ -1264,7 +1422,7 @@ pdf14_pop_transparency_group(gs_gstate *pgs, pdf14_ctx *ctx,
     } else {
         /* Group color spaces are the same.  No color conversions needed */
         if (x0 < x1 && y0 < y1)
-            pdf14_compose_group(tos, nos, maskbuf, x0, x1, y0, y1, nos->n_chan,
+            pdf14_compose_touched(tos, nos, maskbuf, x0, x1, y0, y1, nos->n_chan,
                                 ctx->additive, pblend_procs, overprint,
                                 drawn_comps, ctx->memory, dev);
     }
@@ -1373,7 +1531,7 @@ pdf14_push_transparency_mask(pdf14_ctx *ctx, gs_int_rect *rect,	byte bg_alpha,
             memset(curr_ptr, 255, buf->planestride *(buf->n_chan - 1));
         } else {
             /* Compose mask with opaque background */
-            memset(buf->data, 0, buf->planestride * buf->n_chan);
+            pdf14_buf_clear(buf);
         }
     }
     return 0;
@@ -1398,6 +1556,59 @@ static void pdf14_free_mask_stack(pdf14_ctx *ctx, gs_memory_t *memory)
     ctx->mask_stack = NULL;
 }
 
+/*
+ * Map the w x h soft mask pixels at src, laid out like tos, to the single
+ * plane dst, which has the same rowstride.
+ */
+static void
+pdf14_smask_map(pdf14_ctx *ctx, gx_device *dev, pdf14_buf *tos, int icc_match,
+                gsicc_link_t *icc_link, byte *src, byte *dst, int w, int h,
+                int rowstride, int planestride)
+{
+    /* If the subtype was alpha, then just grab the alpha channel */
+    if (tos->SMask_SubType == TRANSPARENCY_MASK_Alpha) {
+        smask_copy(h, w, rowstride, src + planestride, dst);
+#if RAW_DUMP
+        /* Dump the current buffer to see what we have. */
+        dump_raw_buffer(h, rowstride, tos->n_planes, planestride, rowstride,
+                        "SMask_Pop_Alpha(Mask_Plane1)", src);
+        global_index++;
+#endif
+    } else if (icc_match == 1 || tos->n_chan == 2) {
+#if RAW_DUMP
+        /* Dump the current buffer to see what we have. */
+        dump_raw_buffer(h, rowstride, tos->n_planes, planestride, rowstride,
+                        "SMask_Pop_Lum(Mask_Plane0)", src);
+        global_index++;
+#endif
+        /* There is no need to color convert.  Data is already gray scale.
+           We just need to copy the gray plane.  However it is
+           possible that the soft mask could have a soft mask which
+           would end us up with some alpha blending information
+           (Bug691803). In fact, according to the spec, the alpha
+           blending has to occur.  See FTS test fts_26_2601.pdf
+           for an example of this.  Softmask buffer is intialized
+           with BG values.  It would be nice to keep track if buffer
+           ever has a alpha value not 1 so that we could detect and
+           avoid this blend if not needed. */
+        smask_blend(src, w, h, rowstride, planestride);
+#if RAW_DUMP
+        /* Dump the current buffer to see what we have. */
+        dump_raw_buffer(h, rowstride, tos->n_planes, planestride, rowstride,
+                        "SMask_Pop_Lum_Post_Blend", src);
+        global_index++;
+#endif
+        smask_copy(h, w, rowstride, src, dst);
+    } else if (icc_match == -1) {
+        /* The slow old fashioned way */
+        smask_luminosity_mapping(h, w, tos->n_chan, rowstride, planestride,
+                                 src, dst, ctx->additive, tos->SMask_SubType);
+    } else {
+        smask_icc(dev, h, w, tos->n_chan, rowstride, planestride, src, dst,
+                  icc_link);
+    }
+}
+
 static	int
 pdf14_pop_transparency_mask(pdf14_ctx *ctx, gs_gstate *pgs, gx_device *dev)
 {
@@ -1476,86 +1687,72 @@ pdf14_pop_transparency_mask(pdf14_ctx *ctx, gs_gstate *pgs, gx_device *dev)
                                         "pdf14_pop_transparency_mask");
         if (new_data_buf == NULL)
             return_error(gs_error_VMerror);
-        /* Initialize with 0.  Need to do this since in Smask_Luminosity_Mapping
-           we won't be filling everything during the remap if it had not been
-           written into by the PDF14 fill rect */
-        memset(new_data_buf, 0, tos->planestride);
-        /* If the subtype was alpha, then just grab the alpha channel now
-           and we are all done */
         if (tos->SMask_SubType == TRANSPARENCY_MASK_Alpha) {
             ctx->smask_blend = false;  /* not used in this case */
-            smask_copy(tos->rect.q.y - tos->rect.p.y,
-                       tos->rect.q.x - tos->rect.p.x,
-                       tos->rowstride,
-                       (tos->data)+tos->planestride, new_data_buf);
-#if RAW_DUMP
-            /* Dump the current buffer to see what we have. */
-            dump_raw_buffer(tos->rect.q.y-tos->rect.p.y,
-                        tos->rowstride, tos->n_planes,
-                        tos->planestride, tos->rowstride,
-                        "SMask_Pop_Alpha(Mask_Plane1)",tos->data);
-            global_index++;
-#endif
+            icc_link = NULL;
+        } else if (icc_match == 0 && tos->n_chan != 2) {
+            /* ICC case where we use the CMM */
+            /* Request the ICC link for the transform that we will need to use */
+            rendering_params.black_point_comp = gsBLACKPTCOMP_OFF;
+            rendering_params.graphics_type_tag = GS_IMAGE_TAG;
+            rendering_params.override_icc = false;
+            rendering_params.preserve_black = gsBKPRESNOTSPECIFIED;
+            rendering_params.rendering_intent = gsPERCEPTUAL;
+            rendering_params.cmm = gsCMM_DEFAULT;
+            icc_link = gsicc_get_link_profile(pgs, dev, des_profile,
+                src_profile, &rendering_params, pgs->memory, false);
         } else {
-            if ( icc_match == 1 || tos->n_chan == 2) {
-#if RAW_DUMP
-                /* Dump the current buffer to see what we have. */
-                dump_raw_buffer(tos->rect.q.y-tos->rect.p.y,
-                            tos->rowstride, tos->n_planes,
-                            tos->planestride, tos->rowstride,
-                            "SMask_Pop_Lum(Mask_Plane0)",tos->data);
-                global_index++;
-#endif
-                /* There is no need to color convert.  Data is already gray scale.
-                   We just need to copy the gray plane.  However it is
-                   possible that the soft mask could have a soft mask which
-                   would end us up with some alpha blending information
-                   (Bug691803). In fact, according to the spec, the alpha
-                   blending has to occur.  See FTS test fts_26_2601.pdf
-                   for an example of this.  Softmask buffer is intialized
-                   with BG values.  It would be nice to keep track if buffer
-                   ever has a alpha value not 1 so that we could detect and
-                   avoid this blend if not needed. */
-                smask_blend(tos->data, tos->rect.q.x - tos->rect.p.x,
+            icc_link = NULL;
+            /* The old non-icc mapping works on whole planes. */
+            if (icc_match == -1 && tos->n_chan != 2 && tos->tiles != NULL) {
+                pdf14_buf_touch(tos, tos->rect.p.x, tos->rect.p.y,
+                                tos->rect.q.x, tos->rect.q.y);
+                gs_free_object(tos->memory, tos->tiles,
+                               "pdf14_pop_transparency_mask");
+                tos->tiles = NULL;
+            }
+        }
+        if (tos->tiles == NULL) {
+            /* Initialize with 0.  Need to do this since in Smask_Luminosity_Mapping
+               we won't be filling everything during the remap if it had not been
+               written into by the PDF14 fill rect */
+            memset(new_data_buf, 0, tos->planestride);
+            pdf14_smask_map(ctx, dev, tos, icc_match, icc_link, tos->data,
+                            new_data_buf, tos->rect.q.x - tos->rect.p.x,
                             tos->rect.q.y - tos->rect.p.y, tos->rowstride,
                             tos->planestride);
-#if RAW_DUMP
-                /* Dump the current buffer to see what we have. */
-                dump_raw_buffer(tos->rect.q.y-tos->rect.p.y,
-                            tos->rowstride, tos->n_planes,
-                            tos->planestride, tos->rowstride,
-                            "SMask_Pop_Lum_Post_Blend",tos->data);
-                global_index++;
-#endif
-                smask_copy(tos->rect.q.y - tos->rect.p.y,
-                           tos->rect.q.x - tos->rect.p.x,
-                           tos->rowstride, tos->data, new_data_buf);
-            } else {
-                if ( icc_match == -1 ) {
-                    /* The slow old fashioned way */
-                    smask_luminosity_mapping(tos->rect.q.y - tos->rect.p.y ,
-                        tos->rect.q.x - tos->rect.p.x,tos->n_chan,
-                        tos->rowstride, tos->planestride,
-                        tos->data,  new_data_buf, ctx->additive, tos->SMask_SubType);
-                } else {
-                    /* ICC case where we use the CMM */
-                    /* Request the ICC link for the transform that we will need to use */
-                    rendering_params.black_point_comp = gsBLACKPTCOMP_OFF;
-                    rendering_params.graphics_type_tag = GS_IMAGE_TAG;
-                    rendering_params.override_icc = false;
-                    rendering_params.preserve_black = gsBKPRESNOTSPECIFIED;
-                    rendering_params.rendering_intent = gsPERCEPTUAL;
-                    rendering_params.cmm = gsCMM_DEFAULT;
-                    icc_link = gsicc_get_link_profile(pgs, dev, des_profile,
-                        src_profile, &rendering_params, pgs->memory, false);
-                    smask_icc(dev, tos->rect.q.y - tos->rect.p.y,
-                              tos->rect.q.x - tos->rect.p.x,tos->n_chan,
-                              tos->rowstride, tos->planestride,
-                              tos->data, new_data_buf, icc_link);
-                    /* Release the link */
-                    gsicc_release_link(icc_link);
+        } else {
+            /* Only map the touched tiles.  All the others are still clear,
+               so they map to whatever a clear pixel does. */
+            byte clear[PDF14_MAX_PLANES] = { 0 };
+            byte clear_value;
+            int width = tos->rect.q.x - tos->rect.p.x;
+            int height = tos->rect.q.y - tos->rect.p.y;
+            int ty, tx0, tx1;
+
+            pdf14_smask_map(ctx, dev, tos, icc_match, icc_link, clear,
+                            &clear_value, 1, 1, 1, 1);
+            memset(new_data_buf, clear_value, tos->planestride);
+            for (ty = 0; ty < tos->tiles_y; ty++) {
+                int y = ty * PDF14_TILE_SIZE;
+                int h = min(PDF14_TILE_SIZE, height - y);
+
+                for (tx0 = 0; pdf14_buf_next_run(tos, ty, &tx0, &tx1); tx0 = tx1) {
+                    int x = tx0 * PDF14_TILE_SIZE;
+                    int w = min(tx1 * PDF14_TILE_SIZE, width) - x;
+                    int offset = y * tos->rowstride + x;
+
+                    pdf14_smask_map(ctx, dev, tos, icc_match, icc_link,
+                                    tos->data + offset, new_data_buf + offset,
+                                    w, h, tos->rowstride, tos->planestride);
                 }
             }
+            gs_free_object(tos->memory, tos->tiles, "pdf14_pop_transparency_mask");
+            tos->tiles = NULL;
+        }
+        if (icc_link != NULL) {
+            /* Release the link */
+            gsicc_release_link(icc_link);
         }
         /* Free the old object, NULL test was above */
         gs_free_object(ctx->memory, tos->data, "pdf14_pop_transparency_mask");
@@ -1736,6 +1933,8 @@ pdf14_get_buffer_information(const gx_device * dev,
 #endif
     buf = pdev->ctx->stack;
     rect = buf->rect;
+    /* The pattern code reads or writes the buffer directly. */
+    pdf14_buf_touch(buf, rect.p.x, rect.p.y, rect.q.x, rect.q.y);
     transbuff->dirty = &buf->dirty;
     x1 = min(pdev->width, rect.q.x);
     y1 = min(pdev->height, rect.q.y);
@@ -2263,6 +2462,7 @@ pdf14_discard_trans_layer(gx_device *dev, gs_gstate * pgs)
             gs_free_object(ctx->memory, buf->transfer_fn, "pdf14_discard_trans_layer");
             gs_free_object(ctx->memory, buf->matte, "pdf14_discard_trans_layer");
             gs_free_object(ctx->memory, buf->data, "pdf14_discard_trans_layer");
+            gs_free_object(ctx->memory, buf->tiles, "pdf14_discard_trans_layer");
             gs_free_object(ctx->memory, buf->backdrop, "pdf14_discard_trans_layer");
             /* During the soft mask push, the mask_stack was copied (not moved) from
                the ctx to the tos mask_stack. We are done with this now so it is safe
@@ -2664,6 +2864,7 @@ pdf14_copy_alpha_color(gx_device * dev, const byte * data, int data_x,
     if (y < buf->dirty.p.y) buf->dirty.p.y = y;
     if (x + w > buf->dirty.q.x) buf->dirty.q.x = x + w;
     if (y + h > buf->dirty.q.y) buf->dirty.q.y = y + h;
+    pdf14_buf_touch(buf, x, y, x + w, y + h);
     line = buf->data + (x - buf->rect.p.x) + (y - buf->rect.p.y) * rowstride;
 
     for (j = 0; j < h; ++j, aa_row += aa_raster) {
@@ -4076,6 +4277,7 @@ pdf14_copy_planes(gx_device * dev, const byte * data, int data_x, int raster,
     fake_tos.saved = NULL;
     fake_tos.shape = 0xff;
     fake_tos.SMask_SubType = TRANSPARENCY_MASK_Alpha;
+    fake_tos.tiles = NULL;
     fake_tos.transfer_fn = NULL;
     pdf14_compose_alphaless_group(&fake_tos, buf, x, x+w, y, y+h,
                                   pdev->ctx->memory, dev);
@@ -5138,6 +5340,7 @@ pdf14_mark_fill_rectangle_ko_simple(gx_device *	dev, int x, int y, int w, int h,
     if (y < buf->dirty.p.y) buf->dirty.p.y = y;
     if (x + w > buf->dirty.q.x) buf->dirty.q.x = x + w;
     if (y + h > buf->dirty.q.y) buf->dirty.q.y = y + h;
+    pdf14_buf_touch(buf, x, y, x + w, y + h);
 
     /* composite with backdrop only */
     bline = buf->backdrop + (x - buf->rect.p.x) + (y - buf->rect.p.y) * rowstride;
@@ -125,6 +125,9 @@ struct pdf14_parent_color_s {
 
 typedef struct pdf14_ctx_s pdf14_ctx;
 
+/* Size of the tiles of a lazily cleared buffer, in pixels. */
+#define PDF14_TILE_SIZE 64
+
 struct pdf14_buf_s {
     pdf14_buf *saved;
     byte *backdrop;  /* This is needed for proper non-isolated knockout support */
@@ -153,6 +156,13 @@ struct pdf14_buf_s {
     int matte_num_comps;
     byte *matte;		/* actually floats */
     gs_int_rect dirty;
+    /* If tiles is not NULL, the buffer is cleared lazily: the planes that
+       would have been cleared to 0 on the push are only cleared one
+       PDF14_TILE_SIZE square at a time, when something first touches the
+       tile.  tiles holds one byte per tile, set once the tile is cleared. */
+    byte *tiles;
+    int tiles_x;
+    int tiles_y;
     pdf14_mask_t *mask_stack;
     bool idle;
 
@@ -284,6 +294,10 @@ int pdf14_get_buffer_information(const gx_device * dev,
                                  gx_pattern_trans_t *transbuff, gs_memory_t *mem,
                                  bool free_device);
 
+/* Clear any untouched tiles of a lazily cleared buffer that intersect the
+   given rectangle.  Must be called before the rectangle is read or written. */
+void pdf14_buf_touch(pdf14_buf *buf, int x0, int y0, int x1, int y1);
+
 /* Not static due to call from pattern logic */
 int pdf14_disable_device(gx_device * dev);
 
@@ -115,18 +115,38 @@ gdev_prn_open(gx_device * pdev)
     return code;
 }
 
-/* This is called various places to wait for any pending bg print thread and */
-/* perform its cleanup                                                       */
+/* Return true if each page goes to its own output file */
+static bool
+prn_file_per_page(gx_device_printer *ppdev)
+{
+    gs_parsed_file_name_t parsed;
+    const char *fmt;
+    int code = gx_parse_output_file_name(&parsed, &fmt, ppdev->fname,
+                                         strlen(ppdev->fname), ppdev->memory);
+
+    return (code >= 0 && fmt) || ppdev->ReopenPerPage;
+}
+
+/* Wait for one background page to finish, then close and unlink its files */
+/* and free the device and its private allocator. 'next' is the page that   */
+/* followed it, if that is still in flight.                                 */
 static void
-prn_finish_bg_print(gx_device_printer *ppdev)
+prn_finish_bg_page(gx_device_printer *ppdev, gx_device *bgdev, gx_device *next)
 {
-    /* if we have a a bg printing device that was created, then wait for its	*/
-    /* semaphore (it may already have been signalled, but that's OK.) then	*/
-    /* close and unlink the files and free the device and its private allocator	*/
-    if (ppdev->bg_print.device != NULL) {
-        int closecode;
-        gx_device_printer *bgppdev = (gx_device_printer *)ppdev->bg_print.device;
-        gx_semaphore_wait(ppdev->bg_print.sema);
+    gx_device_printer *bgppdev = (gx_device_printer *)bgdev;
+    bg_print_t bg_print;
+    int closecode;
+
+    /* wait for the page's semaphore (it may already have been signalled, but */
+    /* that's OK.) and take a copy of its state before the device is freed    */
+    gx_semaphore_wait(bgppdev->bg_print.sema);
+    bg_print = bgppdev->bg_print;
+    if (ppdev->bg_print.return_code == 0)
+        ppdev->bg_print.return_code = bg_print.return_code;
+    if (bg_print.own_file) {
+        /* The page had its own output file, and the printer device has moved on */
+        closecode = gdev_prn_close_printer(bgdev);
+    } else {
         /* If numcopies > 1, then the bg_print->device will have closed and reopened
          * the output file, so the pointer in the original device is now stale,
          * so copy it back.
@@ -134,31 +154,71 @@ prn_finish_bg_print(gx_device_printer *ppdev)
          */
         ppdev->file = bgppdev->file;
         closecode = gdev_prn_close_printer((gx_device *)ppdev);
+    }
+    if (ppdev->bg_print.return_code == 0)
+        ppdev->bg_print.return_code = closecode;	/* return code here iff there wasn't another error */
+    teardown_device_and_mem_for_thread(bgdev, bg_print.thread_id, true);
+    if (bg_print.ocfile) {
+        closecode = bg_print.oio_procs->fclose(bg_print.ocfile, bg_print.ocfname, true);
         if (ppdev->bg_print.return_code == 0)
-            ppdev->bg_print.return_code = closecode;	/* return code here iff there wasn't another error */
-        teardown_device_and_mem_for_thread(ppdev->bg_print.device,
-                                           ppdev->bg_print.thread_id, true);
-        ppdev->bg_print.device = NULL;
-        if (ppdev->bg_print.ocfile) {
-            closecode = ppdev->bg_print.oio_procs->fclose(ppdev->bg_print.ocfile, ppdev->bg_print.ocfname, true);
-            if (ppdev->bg_print.return_code == 0)
-               ppdev->bg_print.return_code = closecode;
-        }
-        if (ppdev->bg_print.ocfname) {
-            gs_free_object(ppdev->memory->non_gc_memory, ppdev->bg_print.ocfname, "prn_finish_bg_print(ocfname)");
-        }
-        if (ppdev->bg_print.obfile) {
-            closecode = ppdev->bg_print.oio_procs->fclose(ppdev->bg_print.obfile, ppdev->bg_print.obfname, true);
-            if (ppdev->bg_print.return_code == 0)
-               ppdev->bg_print.return_code = closecode;
-        }
-        if (ppdev->bg_print.obfname) {
-            gs_free_object(ppdev->memory->non_gc_memory, ppdev->bg_print.obfname, "prn_finish_bg_print(obfname)");
+           ppdev->bg_print.return_code = closecode;
+    }
+    if (bg_print.ocfname) {
+        gs_free_object(ppdev->memory->non_gc_memory, bg_print.ocfname, "prn_finish_bg_print(ocfname)");
+    }
+    if (bg_print.obfile) {
+        closecode = bg_print.oio_procs->fclose(bg_print.obfile, bg_print.obfname, true);
+        if (ppdev->bg_print.return_code == 0)
+           ppdev->bg_print.return_code = closecode;
+    }
+    if (bg_print.obfname) {
+        gs_free_object(ppdev->memory->non_gc_memory, bg_print.obfname, "prn_finish_bg_print(obfname)");
+    }
+    gx_semaphore_free(bg_print.sema);
+    gx_semaphore_free(bg_print.wait_for);
+    /* If the next page is waiting on our 'order' it will free it when it finishes */
+    if (next == NULL || ((gx_device_printer *)next)->bg_print.wait_for != bg_print.order)
+        gx_semaphore_free(bg_print.order);
+}
+
+/* Finish background pages, oldest first, until no more than 'max_pages' */
+/* are still in flight, using no more than 'max_memory' between them.   */
+static void
+prn_finish_bg_print_pages(gx_device_printer *ppdev, int max_pages, int64_t max_memory)
+{
+    for (;;) {
+        gx_device *oldest = ppdev->bg_print.device;
+        gx_device *next = NULL;
+        int count = 0;
+        int64_t memory_used = 0;
+
+        if (oldest == NULL)
+            break;
+        for (;;) {
+            count++;
+            memory_used += ((gx_device_printer *)oldest)->bg_print.memory_used;
+            if (((gx_device_printer *)oldest)->bg_print.prev == NULL)
+                break;
+            next = oldest;
+            oldest = ((gx_device_printer *)oldest)->bg_print.prev;
         }
-        ppdev->bg_print.ocfile = ppdev->bg_print.obfile =
-          ppdev->bg_print.ocfname = ppdev->bg_print.obfname = NULL;
+        if (count <= max_pages && memory_used <= max_memory)
+            break;
+        prn_finish_bg_page(ppdev, oldest, next);
+        if (next == NULL)
+            ppdev->bg_print.device = NULL;
+        else
+            ((gx_device_printer *)next)->bg_print.prev = NULL;
     }
 }
+
+/* This is called various places to wait for any pending bg print threads and */
+/* perform their cleanup                                                      */
+static void
+prn_finish_bg_print(gx_device_printer *ppdev)
+{
+    prn_finish_bg_print_pages(ppdev, 0, max_int64_t);
+}
 /* Generic closing for the printer device. */
 /* Specific devices may wish to extend this. */
 int
@@ -168,10 +228,6 @@ gdev_prn_close(gx_device * pdev)
     int code = 0;
 
     prn_finish_bg_print(ppdev);
-    if (ppdev->bg_print.sema != NULL) {
-        gx_semaphore_free(ppdev->bg_print.sema);
-        ppdev->bg_print.sema = NULL;		/* prevent double free */
-    }
     gdev_prn_free_memory(pdev);
     if (ppdev->file != NULL) {
         code = gx_device_close_output_file(pdev, ppdev->fname, ppdev->file);
@@ -270,7 +326,7 @@ open_c:
     ppdev->buf = base;
     ppdev->buffer_space = space;
     pclist_dev->common.is_printer = 1;
-    clist_init_io_procs(pclist_dev, ppdev->BLS_force_memory);
+    clist_init_io_procs(pclist_dev, ppdev->BLS_force_memory, ppdev->BLC_lz4);
     clist_init_params(pclist_dev, base, space, target,
                       ppdev->printer_procs.buf_procs,
                       space_params->band,
@@ -326,6 +382,10 @@ gdev_prn_tear_down(gx_device *pdev, byte **the_memory)
     bool was_command_list;
 
     if (PRINTER_IS_CLIST(ppdev)) {
+        /* Pages printing in the background render on the device's threads, */
+        /* which are stopped when the command list device is closed.        */
+        prn_finish_bg_print(ppdev);
+
         /* Close cmd list device & point to the storage */
         (*gs_clist_device_procs.close_device)( (gx_device *)pcldev );
         *the_memory = ppdev->buf;
@@ -333,8 +393,6 @@ gdev_prn_tear_down(gx_device *pdev, byte **the_memory)
         ppdev->buffer_space = 0;
         was_command_list = true;
 
-        prn_finish_bg_print(ppdev);
-
         gs_free_object(pcldev->memory->non_gc_memory, pcldev->cache_chunk, "free tile cache for clist");
         pcldev->cache_chunk = 0;
 
@@ -662,13 +720,19 @@ gdev_prn_get_param(gx_device *dev, char *Param, void *list)
     if (strcmp(Param, "BGPrint") == 0) {
         return param_write_bool(plist, "BGPrint", &ppdev->bg_print_requested);
     }
+    if (strcmp(Param, "BGPrintPages") == 0) {
+        return param_write_int(plist, "BGPrintPages", &ppdev->bg_print_pages_requested);
+    }
+    if (strcmp(Param, "BGPrintMemory") == 0) {
+        return param_write_long(plist, "BGPrintMemory", &ppdev->bg_print_memory_requested);
+    }
     if (strcmp(Param, "ReopenPerPage") == 0) {
         return param_write_bool(plist, "ReopenPerPage", &ppdev->ReopenPerPage);
     }
     if (strcmp(Param, "BandListStorage") == 0) {
         gs_param_string bls;
         /* Force the default to 'memory' if clist file I/O is not included in this build */
-        if (clist_io_procs_file_global == NULL)
+        if (ppdev->memory->gs_lib_ctx->clist_io_procs_file == NULL)
             ppdev->BLS_force_memory = true;
         if (ppdev->BLS_force_memory) {
             bls.data = (byte *)"memory";
@@ -681,6 +745,12 @@ gdev_prn_get_param(gx_device *dev, char *Param, void *list)
         }
         return param_write_string(plist, "BandListStorage", &bls);
     }
+    if (strcmp(Param, "BandListCompressor") == 0) {
+        gs_param_string blc;
+
+        param_string_from_string(blc, (ppdev->BLC_lz4 ? "lz4" : "default"));
+        return param_write_string(plist, "BandListCompressor", &blc);
+    }
     if (strcmp(Param, "OutputFile") == 0) {
         gs_param_string ofns;
 
@@ -714,6 +784,7 @@ gdev_prn_get_params(gx_device * pdev, gs_param_list * plist)
     int code = gx_default_get_params(pdev, plist);
     gs_param_string ofns;
     gs_param_string bls;
+    gs_param_string blc;
     gs_param_string saved_pages;
     bool pageneutralcolor = false;
 
@@ -727,13 +798,15 @@ gdev_prn_get_params(gx_device * pdev, gs_param_list * plist)
         (code = param_write_int(plist, "NumRenderingThreads", &ppdev->num_render_threads_requested)) < 0 ||
         (code = param_write_bool(plist, "OpenOutputFile", &ppdev->OpenOutputFile)) < 0 ||
         (code = param_write_bool(plist, "BGPrint", &ppdev->bg_print_requested)) < 0 ||
+        (code = param_write_int(plist, "BGPrintPages", &ppdev->bg_print_pages_requested)) < 0 ||
+        (code = param_write_long(plist, "BGPrintMemory", &ppdev->bg_print_memory_requested)) < 0 ||
         (code = param_write_bool(plist, "ReopenPerPage", &ppdev->ReopenPerPage)) < 0 ||
         (code = param_write_bool(plist, "pageneutralcolor", &pageneutralcolor)) < 0
         )
         return code;
 
     /* Force the default to 'memory' if clist file I/O is not included in this build */
-    if (clist_io_procs_file_global == NULL)
+    if (ppdev->memory->gs_lib_ctx->clist_io_procs_file == NULL)
         ppdev->BLS_force_memory = true;
     if (ppdev->BLS_force_memory) {
         bls.data = (byte *)"memory";
@@ -746,6 +819,9 @@ gdev_prn_get_params(gx_device * pdev, gs_param_list * plist)
     }
     if( (code = param_write_string(plist, "BandListStorage", &bls)) < 0 )
         return code;
+    param_string_from_string(blc, (ppdev->BLC_lz4 ? "lz4" : "default"));
+    if( (code = param_write_string(plist, "BandListCompressor", &blc)) < 0 )
+        return code;
 
     ofns.data = (const byte *)ppdev->fname,
         ofns.size = strlen(ppdev->fname),
@@ -785,6 +861,8 @@ gdev_prn_put_params(gx_device * pdev, gs_param_list * plist)
     bool rpp = ppdev->ReopenPerPage;
     bool old_page_uses_transparency = ppdev->page_uses_transparency;
     bool bg_print_requested = ppdev->bg_print_requested;
+    int bg_print_pages = ppdev->bg_print_pages_requested;
+    long bg_print_memory = ppdev->bg_print_memory_requested;
     bool duplex;
     int duplex_set = -1;
     int width = pdev->width;
@@ -793,6 +871,7 @@ gdev_prn_put_params(gx_device * pdev, gs_param_list * plist)
     gdev_prn_space_params save_sp;
     gs_param_string ofs;
     gs_param_string bls;
+    gs_param_string blc;
     gs_param_dict mdict;
     gs_param_string saved_pages;
     bool pageneutralcolor = false;
@@ -838,7 +917,7 @@ gdev_prn_put_params(gx_device * pdev, gs_param_list * plist)
         case 0:
             /* Only accept 'file' if the file procs are include in the build */
             if ((bls.size > 1) && (bls.data[0] == 'm' ||
-                 (clist_io_procs_file_global != NULL && bls.data[0] == 'f')))
+                 (ppdev->memory->gs_lib_ctx->clist_io_procs_file != NULL && bls.data[0] == 'f')))
                 break;
             /* fall through */
         default:
@@ -849,6 +928,21 @@ gdev_prn_put_params(gx_device * pdev, gs_param_list * plist)
             bls.data = 0;
             break;
     }
+    switch (code = param_read_string(plist, (param_name = "BandListCompressor"), &blc)) {
+        case 0:
+            /* (default) is the compressor chosen for the build */
+            if ((blc.size > 1) && (blc.data[0] == 'd' || blc.data[0] == 'l'))
+                break;
+            code = gs_note_error(gs_error_rangecheck);
+            /* fall through */
+        default:
+            ecode = code;
+            param_signal_error(plist, param_name, ecode);
+            /* fall through */
+        case 1:
+            blc.data = 0;
+            break;
+    }
 
     switch (code = param_read_string(plist, (param_name = "OutputFile"), &ofs)) {
         case 0:
@@ -907,6 +1001,28 @@ gdev_prn_put_params(gx_device * pdev, gs_param_list * plist)
         case 1:
             break;
     }
+    switch (code = param_read_int(plist, (param_name = "BGPrintPages"), &bg_print_pages)) {
+        case 0:
+            if (bg_print_pages >= 1)
+                break;
+            code = gs_error_rangecheck;
+        default:
+            ecode = code;
+            param_signal_error(plist, param_name, ecode);
+        case 1:
+            ;
+    }
+    switch (code = param_read_long(plist, (param_name = "BGPrintMemory"), &bg_print_memory)) {
+        case 0:
+            if (bg_print_memory >= 0)
+                break;
+            code = gs_error_rangecheck;
+        default:
+            ecode = code;
+            param_signal_error(plist, param_name, ecode);
+        case 1:
+            ;
+    }
 
     switch (code = param_read_string(plist, (param_name = "saved-pages"),
                                                         &saved_pages)) {
@@ -942,9 +1058,15 @@ gdev_prn_put_params(gx_device * pdev, gs_param_list * plist)
 
     if (ppdev->bg_print_requested && !bg_print_requested) {
         prn_finish_bg_print(ppdev);
+    } else if (bg_print_pages < ppdev->bg_print_pages_requested ||
+               bg_print_memory < ppdev->bg_print_memory_requested) {
+        /* Don't leave more pages in flight than now allowed */
+        prn_finish_bg_print_pages(ppdev, bg_print_pages - 1, bg_print_memory);
     }
 
     ppdev->bg_print_requested = bg_print_requested;
+    ppdev->bg_print_pages_requested = bg_print_pages;
+    ppdev->bg_print_memory_requested = bg_print_memory;
     if (duplex_set >= 0) {
         ppdev->Duplex = duplex;
         ppdev->Duplex_set = duplex_set;
@@ -953,6 +1075,9 @@ gdev_prn_put_params(gx_device * pdev, gs_param_list * plist)
     if (bls.data != 0) {
         ppdev->BLS_force_memory = (bls.data[0] == 'm');
     }
+    if (blc.data != 0) {
+        ppdev->BLC_lz4 = (blc.data[0] == 'l');
+    }
 
     /* If necessary, free and reallocate the printer memory. */
     /* Formerly, would not reallocate if device is not open: */
@@ -1019,7 +1144,11 @@ gdev_prn_output_page_aux(gx_device * pdev, int num_copies, int flush, bool seeka
     int outcode = 0, errcode = 0, endcode, closecode = 0;
     int code;
 
-    prn_finish_bg_print(ppdev);		/* finish any previous background printing */
+    /* finish any previous background printing, or enough of it to make room */
+    /* for this page if more than one page may be in flight                 */
+    prn_finish_bg_print_pages(ppdev, ppdev->bg_print_requested ?
+                                     ppdev->bg_print_pages_requested - 1 : 0,
+                              ppdev->bg_print_memory_requested);
 
     if (num_copies > 0 && ppdev->saved_pages_list != NULL) {
         /* We are putting pages on a list */
@@ -1033,12 +1162,12 @@ gdev_prn_output_page_aux(gx_device * pdev, int num_copies, int flush, bool seeka
         if (num_copies > 0) {
             int threads_enabled = 0;
             int print_foreground = 1;		/* default to foreground printing */
+            gx_device *ndev = NULL;		/* device for background printing */
 
             if (bg_print_ok && PRINTER_IS_CLIST(ppdev) &&
                 (ppdev->bg_print_requested || ppdev->num_render_threads_requested > 0)) {
                 threads_enabled = clist_enable_multi_thread_render(pdev);
             }
-            /* NB: we leave the semaphore allocated until foreground printing or close */
             /* If there was an error, abort on this page -- no good way to handle this */
             /* but it means that the error will be reported AFTER another page was     */
             /* interpreted and written to clist files. FIXME: ???                      */
@@ -1048,14 +1177,34 @@ gdev_prn_output_page_aux(gx_device * pdev, int num_copies, int flush, bool seeka
             }
             /* Use 'while' instead of 'if' to avoid nesting */
             while (ppdev->bg_print_requested && threads_enabled) {
-                gx_device *ndev;
                 gx_device_printer *npdev;
                 gx_device_clist_reader *crdev = (gx_device_clist_reader *)ppdev;
+                bool pipelined = ppdev->bg_print_pages_requested > 1;
+                int nthreads = min(ppdev->num_render_threads_requested, crdev->nbands);
+                clist_render_pool_t *pool;
+                int64_t charge;
+                int size;
 
                 if ((code = clist_close_writer_and_init_reader((gx_device_clist *)ppdev)) < 0)
                     /* should not happen -- do foreground print */
                     break;
 
+                /* Charge the page with the band buffers it renders into (its own, */
+                /* and each thread's with its reorder slots) and with the command  */
+                /* list if that is kept in memory, then make room for it. A page   */
+                /* that is over the budget on its own is still printed, alone.     */
+                charge = (int64_t)crdev->data_size *
+                            (1 + nthreads * (1 + CLIST_RENDER_SLOTS_PER_THREAD));
+                if (crdev->page_info.io_procs != ppdev->memory->gs_lib_ctx->clist_io_procs_file) {
+                    if ((size = clist_data_size((gx_device_clist *)ppdev, 0)) > 0)
+                        charge += size;
+                    if ((size = clist_data_size((gx_device_clist *)ppdev, 1)) > 0)
+                        charge += size;
+                }
+                if (pipelined)
+                    prn_finish_bg_print_pages(ppdev, ppdev->bg_print_pages_requested - 1,
+                                              ppdev->bg_print_memory_requested - charge);
+
                 /* We need to hang onto references to these files, so we can ensure the main file data
                  * gets freed with the correct allocator.
                  */
@@ -1076,35 +1225,69 @@ gdev_prn_output_page_aux(gx_device * pdev, int num_copies, int flush, bool seeka
                 ppdev->bg_print.oio_procs = crdev->page_info.io_procs;
                 crdev->page_info.cfile = crdev->page_info.bfile = NULL;
 
-                if (ppdev->bg_print.sema == NULL)
-                {
-                    ppdev->bg_print.sema = gx_semaphore_label(gx_semaphore_alloc(ppdev->memory->non_gc_memory), "BGPrint");
-                    if (ppdev->bg_print.sema == NULL)
-                        break;			/* couldn't create the semaphore */
-                }
-
                 ndev = setup_device_and_mem_for_thread(pdev->memory->thread_safe_memory, pdev, true, NULL);
                 if (ndev == NULL) {
                     break;
                 }
-                ppdev->bg_print.device = ndev;
-                ppdev->bg_print.num_copies = num_copies;
                 npdev = (gx_device_printer *)ndev;
                 npdev->bg_print_requested = 0;
                 npdev->num_render_threads_requested = ppdev->num_render_threads_requested;
+                /* The rest of the page's state lives in its own device */
+                npdev->bg_print.num_copies = num_copies;
+                npdev->bg_print.memory_used = charge;
+                npdev->bg_print.sema = gx_semaphore_label(gx_semaphore_alloc(ppdev->memory->non_gc_memory), "BGPrint");
+                if (npdev->bg_print.sema == NULL)
+                    break;			/* couldn't create the semaphore */
+                /* All the pages in flight render on the printer device's threads */
+                if (ppdev->num_render_threads_requested > 0 &&
+                    clist_lend_render_pool(pdev, ndev) < 0)
+                    break;
+                if (pipelined) {
+                    if (prn_file_per_page(ppdev)) {
+                        /* Pages can be written concurrently, each to its own file */
+                        npdev->bg_print.own_file = true;
+                    } else {
+                        /* Pages share the output file so must be written in order. */
+                        /* Unless the device seeks in the file, the page is spooled */
+                        /* so only the writing waits for the pages before it.       */
+                        npdev->bg_print.order = gx_semaphore_label(gx_semaphore_alloc(ppdev->memory->non_gc_memory), "BGPrint order");
+                        if (npdev->bg_print.order == NULL)
+                            break;
+                        if (ppdev->bg_print.device != NULL)
+                            npdev->bg_print.wait_for = ((gx_device_printer *)ppdev->bg_print.device)->bg_print.order;
+                        npdev->bg_print.spool = !seekable;
+                    }
+                }
 
                 /* Now start the thread to print the page */
                 if ((code = gp_thread_start(prn_print_page_in_background,
-                                            (void *)&(ppdev->bg_print),
-                                            &(ppdev->bg_print.thread_id))) < 0) {
+                                            (void *)ndev,
+                                            &(npdev->bg_print.thread_id))) < 0) {
                     /* Did not start cleanly - clean up is in print_foreground block below */
                     break;
                 }
-                gp_thread_label(ppdev->bg_print.thread_id, "BG print thread");
-                /* Page was succesfully started in bg_print mode */
+                gp_thread_label(npdev->bg_print.thread_id, "BG print thread");
+                /* Page was succesfully started in bg_print mode. Hand the clist */
+                /* files over to the page, and link it in as the newest page.   */
+                npdev->bg_print.ocfname = ppdev->bg_print.ocfname;
+                npdev->bg_print.obfname = ppdev->bg_print.obfname;
+                npdev->bg_print.ocfile = ppdev->bg_print.ocfile;
+                npdev->bg_print.obfile = ppdev->bg_print.obfile;
+                npdev->bg_print.oio_procs = ppdev->bg_print.oio_procs;
+                ppdev->bg_print.ocfile = ppdev->bg_print.obfile =
+                  ppdev->bg_print.ocfname = ppdev->bg_print.obfname = NULL;
+                npdev->bg_print.prev = ppdev->bg_print.device;
+                ppdev->bg_print.device = ndev;
+                ndev = NULL;
+                if (npdev->bg_print.own_file)
+                    ppdev->file = NULL;		/* the next page opens a new one */
                 print_foreground = 0;
-                /* Now we need to set up the next page so it will use new clist files */
-                if ((code = clist_open(pdev)) < 0) 	/* this should do it */
+                /* Now we need to set up the next page so it will use new clist files, */
+                /* keeping the threads that the pages in flight are rendering on.     */
+                pool = ((gx_device_clist_common *)pdev)->render_pool;
+                code = clist_open(pdev);	/* this should do it */
+                ((gx_device_clist_common *)pdev)->render_pool = pool;
+                if (code < 0)
                     /* OOPS! can't proceed with the next page */
                     return code;	/* probably ioerror */
                 break;				/* exit the while loop */
@@ -1116,13 +1299,16 @@ gdev_prn_output_page_aux(gx_device * pdev, int num_copies, int flush, bool seeka
                  ppdev->bg_print.ocfname = ppdev->bg_print.obfname = NULL;
 
                 /* either bg_print was not requested or was not able to start */
-                if (ppdev->bg_print.sema != NULL && ppdev->bg_print.device != NULL) {
-                    /* There was a problem. Teardown the device and its allocator, but */
-                    /* leave the semaphore for possible later use.                     */
-                    teardown_device_and_mem_for_thread(ppdev->bg_print.device,
-                                                       ppdev->bg_print.thread_id, true);
-                    ppdev->bg_print.device = NULL;
+                if (ndev != NULL) {
+                    /* There was a problem. Teardown the device and its allocator. */
+                    gx_device_printer *npdev = (gx_device_printer *)ndev;
+
+                    gx_semaphore_free(npdev->bg_print.sema);
+                    gx_semaphore_free(npdev->bg_print.order);
+                    teardown_device_and_mem_for_thread(ndev, npdev->bg_print.thread_id, true);
                 }
+                /* Any earlier pages must be out before this one */
+                prn_finish_bg_print(ppdev);
                 /* Here's where we actually let the device's print_page_copies work */
                 /* Print the accumulated page description. */
                 outcode = (*ppdev->printer_procs.print_page_copies)(ppdev, ppdev->file,
@@ -1229,24 +1415,58 @@ gx_default_print_page_copies(gx_device_printer * pdev, FILE * prn_stream,
 /*
  * Print a page in the background. When printing is complete,
  * post the return code and signal the foreground (semaphore).
- * This is the procedure that is run in the background thread.
+ * This is the procedure that is run in the background thread,
+ * 'data' is the page's own printer/clist device.
  */
 static void
 prn_print_page_in_background(void *data)
 {
-    bg_print_t *bg_print = (bg_print_t *)data;
+    gx_device_printer *ppdev = (gx_device_printer *)data;
+    bg_print_t *bg_print = &ppdev->bg_print;
     int code, errcode = 0;
     int num_copies = bg_print->num_copies;
-    gx_device_printer *ppdev = (gx_device_printer *)bg_print->device;
+    FILE *file = ppdev->file;
+    FILE *spool = NULL;
+    char fname[gp_file_name_sizeof];
+    byte buf[8192];
+    size_t count;
+
+    /* If the previous page is still being written to the same file, render */
+    /* this one to a spool file meanwhile, if we can, otherwise just wait.   */
+    if (bg_print->wait_for != NULL && bg_print->spool)
+        spool = gp_open_scratch_file_rm(ppdev->memory, gp_scratch_file_name_prefix,
+                                        fname, "w+b");
+    if (spool != NULL)
+        ppdev->file = spool;
+    else if (bg_print->wait_for != NULL)
+        gx_semaphore_wait(bg_print->wait_for);
 
     code = (*ppdev->printer_procs.print_page_copies)(ppdev, ppdev->file,
                                                           num_copies);
     fflush(ppdev->file);
-
     errcode = (ferror(ppdev->file) ? gs_note_error(gs_error_ioerror) : 0);
+
+    if (spool != NULL) {
+        /* Now copy the page out, after the pages before it */
+        ppdev->file = file;
+        gx_semaphore_wait(bg_print->wait_for);
+        rewind(spool);
+        while (errcode == 0 && (count = fread(buf, 1, sizeof(buf), spool)) > 0) {
+            if (fwrite(buf, 1, count, file) != count)
+                errcode = gs_note_error(gs_error_ioerror);
+        }
+        if (errcode == 0 && ferror(spool))
+            errcode = gs_note_error(gs_error_ioerror);
+        fclose(spool);
+        fflush(file);
+        if (errcode == 0 && ferror(file))
+            errcode = gs_note_error(gs_error_ioerror);
+    }
     bg_print->return_code = code < 0 ? code : errcode;
 
-    /* Finally, release the foreground that may be waiting */
+    /* Finally, release the next page and the foreground that may be waiting */
+    if (bg_print->order != NULL)
+        gx_semaphore_signal(bg_print->order);
     gx_semaphore_signal(bg_print->sema);
 }
 /* ---------------- Driver services ---------------- */
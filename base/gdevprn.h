@@ -46,6 +46,13 @@
 #define PRN_MIN_MEMORY_LEFT MIN_MEMORY_LEFT	/* see gxdevice.h */
 #define PRN_MIN_BUFFER_SPACE MIN_BUFFER_SPACE	/* see gxdevice.h */
 
+/*
+ * Define the default limit on the memory used by the pages in flight when
+ * BGPrintPages > 1: the command lists kept in memory plus the band buffers
+ * used to render them. (BGPrintMemory changes it.)
+ */
+#define PRN_BG_PRINT_MEMORY (256L * 1024 * 1024)
+
 /* Define the abstract type for a printer device. */
 #ifndef gx_device_printer_DEFINED
 #  define gx_device_printer_DEFINED
@@ -125,6 +132,11 @@ typedef struct gx_printer_device_procs_s {
 
 #define prn_fname_sizeof gp_file_name_sizeof
 
+/* In the printer device itself, 'device' is the newest page being printed */
+/* in the background, and 'return_code' collects the first error from any  */
+/* of them. The rest of the state for each page is kept in the bg_print of  */
+/* that page's own device, which links to the page before it (if that one  */
+/* is still in flight) through 'prev'.                                      */
 typedef struct bg_print_s {
     gx_semaphore_t *sema;		/* used by foreground to wait */
     gx_device *device;			/* printer/clist device for bg printing */
@@ -136,6 +148,12 @@ typedef struct bg_print_s {
     char *obfname;	                /* block file name */
     clist_file_ptr obfile;	/* block file, normally 0 */
     const clist_io_procs_t *oio_procs;
+    gx_device *prev;			/* device of the previous page, if still in flight */
+    gx_semaphore_t *order;		/* signalled when the page is written, for the next page */
+    gx_semaphore_t *wait_for;		/* 'order' of the previous page, when they share a file */
+    bool own_file;			/* true if the page closes its own output file */
+    bool spool;				/* render to a spool file while waiting for 'wait_for' */
+    int64_t memory_used;		/* clist and band memory charged to the page */
 } bg_print_t;
 
 #define gx_prn_device_common\
@@ -160,6 +178,8 @@ typedef struct bg_print_s {
         gs_memory_t *bandlist_memory;	/* allocator for bandlist files */\
         uint clist_disable_mask;	/* mask of clist options to disable */\
         bool bg_print_requested;	/* request background printing of page from clist */\
+        int bg_print_pages_requested;	/* max pages to have in flight in the background */\
+        long bg_print_memory_requested;	/* max memory for the pages in flight */\
         bg_print_t bg_print;            /* background printing data shared with thread */\
         int num_render_threads_requested;	/* for multiple band rendering threads */\
         gx_saved_pages_list *saved_pages_list;	/* list when we are saving pages instead of printing */\
@@ -334,6 +354,8 @@ extern const gx_device_procs prn_bg_procs;
         0,		/* *bandlist_memory */\
         0,		/* clist_disable_mask */\
         0/*false*/,	/* bg_print_requested */\
+        1,		/* bg_print_pages_requested */\
+        PRN_BG_PRINT_MEMORY,	/* bg_print_memory_requested */\
         {  0/*sema*/, 0/*device*/, 0/*thread_id*/, 0/*num_copies*/, 0/*return_code*/ }, /* bg_print */\
         0, 		/* num_render_threads_requested */\
         0,              /* saved_pages_list */\
@@ -252,6 +252,21 @@ int gp_fpread(char *buf, uint count, int64_t offset, FILE *f);
 /* Write to a specified offset within a FILE from a buffer */
 int gp_fpwrite(char *buf, uint count, int64_t offset, FILE *f);
 
+/*
+ * Map the first 'size' bytes of a FILE read-only into memory, or return
+ * NULL if that is not possible (or not supported on this platform), in
+ * which case the caller should fall back to gp_fpread.  Data written
+ * with gp_fpwrite before the call is visible through the mapping.  The
+ * mapping stays valid until gp_funmap, even if the FILE is closed.
+ */
+const void *gp_fmap(FILE *f, int64_t size);
+
+/* Release a mapping made by gp_fmap. */
+void gp_funmap(const void *base, int64_t size);
+
+/* Hint that a range of a mapping will be read soon.  May do nothing. */
+void gp_fmap_willneed(const void *base, int64_t offset, int64_t len);
+
 /* Force given file into binary mode (no eol translations, etc) */
 /* if 2nd param true, text mode if 2nd param false */
 int gp_setmode_binary(FILE * pfile, bool mode);
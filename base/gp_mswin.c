@@ -812,6 +812,42 @@ int gp_fpwrite(char *buf, uint count, int64_t offset, FILE *f)
     return ret;
 }
 
+/* Map the start of a FILE read-only into memory */
+const void *gp_fmap(FILE *f, int64_t size)
+{
+#ifdef METRO
+    return NULL;
+#else
+    HANDLE hnd = (HANDLE)_get_osfhandle(fileno(f));
+    HANDLE mapping;
+    void *base;
+
+    if (hnd == INVALID_HANDLE_VALUE || size <= 0 ||
+        (uint64_t)size > (SIZE_T)-1)
+        return NULL;
+    mapping = CreateFileMapping(hnd, NULL, PAGE_READONLY,
+                                (DWORD)(size >> 32), (DWORD)size, NULL);
+    if (mapping == NULL)
+        return NULL;
+    base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, (SIZE_T)size);
+    /* The view keeps the mapping object alive until it is unmapped. */
+    CloseHandle(mapping);
+    return base;
+#endif
+}
+
+void gp_funmap(const void *base, int64_t size)
+{
+#ifndef METRO
+    UnmapViewOfFile(base);
+#endif
+}
+
+void gp_fmap_willneed(const void *base, int64_t offset, int64_t len)
+{
+    /* Windows reads ahead on its own; there is no portable hint. */
+}
+
 /* ------ Font enumeration ------ */
 
  /* This is used to query the native os for a list of font names and
@@ -99,6 +99,18 @@ gp_monitor_leave(gp_monitor * mon)
     return 0;
 }
 
+/* There is only one thread, so the process wide monitor does nothing. */
+
+void
+gp_global_lock(void)
+{
+}
+
+void
+gp_global_unlock(void)
+{
+}
+
 /* Thread creation */
 
 int
@@ -137,8 +137,11 @@ gp_semaphore_signal(gp_semaphore * sema)
     scode = pthread_mutex_lock(&sem->mutex);
     if (scode != 0)
         return SEM_ERROR_CODE(scode);
-    if (sem->count++ == 0)
-        scode = pthread_cond_signal(&sem->cond);
+    /* Wake a waiter for every post, not just when the count leaves 0: */
+    /* with several waiters, a second post may come before the first  */
+    /* waiter has taken the count back down.                          */
+    sem->count++;
+    scode = pthread_cond_signal(&sem->cond);
     scode2 = pthread_mutex_unlock(&sem->mutex);
     if (scode == 0)
         scode = scode2;
@@ -170,24 +173,14 @@ gp_monitor_sizeof(void)
     return sizeof(gp_pthread_recursive_t);
 }
 
-int
-gp_monitor_open(gp_monitor * mona)
+static int
+gp_monitor_init(gp_monitor * mona)
 {
     pthread_mutex_t *mon;
     int scode;
     pthread_mutexattr_t attr;
     pthread_mutexattr_t *attrp = NULL;
 
-#ifdef MEMENTO_SQUEEZE_BUILD
-    eprintf("Can't create monitors when memory squeezing with forks\n");
-    Memento_bt();
-    return_error(gs_error_VMerror);
-#endif
-
-    if (!mona)
-        return -1;		/* monitors are not movable */
-
-
 #ifdef GS_RECURSIVE_MUTEXATTR
     attrp = &attr;
     scode = pthread_mutexattr_init(attrp);
@@ -210,6 +203,21 @@ done:
     return SEM_ERROR_CODE(scode);
 }
 
+int
+gp_monitor_open(gp_monitor * mona)
+{
+#ifdef MEMENTO_SQUEEZE_BUILD
+    eprintf("Can't create monitors when memory squeezing with forks\n");
+    Memento_bt();
+    return_error(gs_error_VMerror);
+#endif
+
+    if (!mona)
+        return -1;		/* monitors are not movable */
+
+    return gp_monitor_init(mona);
+}
+
 int
 gp_monitor_close(gp_monitor * mona)
 {
@@ -275,6 +283,30 @@ gp_monitor_leave(gp_monitor * mona)
     return SEM_ERROR_CODE(scode);
 }
 
+/* The process wide monitor, opened on first use. */
+
+static pthread_once_t global_lock_once = PTHREAD_ONCE_INIT;
+static gp_pthread_recursive_t global_lock;
+
+static void
+gp_global_lock_init(void)
+{
+    (void)gp_monitor_init((gp_monitor *)&global_lock);
+}
+
+void
+gp_global_lock(void)
+{
+    pthread_once(&global_lock_once, gp_global_lock_init);
+    (void)gp_monitor_enter((gp_monitor *)&global_lock);
+}
+
+void
+gp_global_unlock(void)
+{
+    (void)gp_monitor_leave((gp_monitor *)&global_lock);
+}
+
 /* --------- Thread primitives ---------- */
 
 /*
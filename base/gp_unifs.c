@@ -33,6 +33,11 @@
 #include "unistd_.h"
 #include <stdlib.h>             /* for mkstemp/mktemp */
 
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0 && !defined(GS_NO_FILESYSTEM)
+#  include <sys/mman.h>
+#  define GP_CAN_MMAP 1
+#endif
+
 #if !defined(HAVE_FSEEKO)
 #define ftello ftell
 #define fseeko fseek
@@ -246,6 +251,42 @@ int gp_fpwrite(char *buf, uint count, int64_t offset, FILE *f)
 #endif
 }
 
+const void *gp_fmap(FILE *f, int64_t size)
+{
+#ifdef GP_CAN_MMAP
+    void *base;
+
+    if (size <= 0 || (uint64_t)size > (size_t)-1)
+        return NULL;
+    base = mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, fileno(f), 0);
+    return (base == MAP_FAILED ? NULL : base);
+#else
+    return NULL;
+#endif
+}
+
+void gp_funmap(const void *base, int64_t size)
+{
+#ifdef GP_CAN_MMAP
+    munmap((void *)base, (size_t)size);
+#endif
+}
+
+void gp_fmap_willneed(const void *base, int64_t offset, int64_t len)
+{
+#if defined(GP_CAN_MMAP) && defined(POSIX_MADV_WILLNEED)
+    long page_size = sysconf(_SC_PAGESIZE);
+    int64_t start;
+
+    if (page_size <= 0)
+        return;
+    /* The advice must start on a page boundary. */
+    start = offset & ~(int64_t)(page_size - 1);
+    posix_madvise((char *)base + start, (size_t)(offset + len - start),
+                  POSIX_MADV_WILLNEED);
+#endif
+}
+
 /* Set a file into binary or text mode. */
 int
 gp_setmode_binary(FILE * pfile, bool mode)
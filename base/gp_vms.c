@@ -303,6 +303,19 @@ int gp_fpwrite(char *buf, uint count, int64_t offset, FILE *f)
     return -1;
 }
 
+const void *gp_fmap(FILE *f, int64_t size)
+{
+    return NULL;
+}
+
+void gp_funmap(const void *base, int64_t size)
+{
+}
+
+void gp_fmap_willneed(const void *base, int64_t offset, int64_t len)
+{
+}
+
 /* Set a file into binary or text mode. */
 int
 gp_setmode_binary(FILE * pfile, bool binary)
@@ -182,6 +182,32 @@ gp_monitor_leave(
     return 0;
 }
 
+/* The process wide monitor, opened by whichever thread gets there first. */
+
+static win32_monitor global_lock;
+static volatile LONG global_lock_state = 0; /* 0 closed, 1 opening, 2 open */
+
+void
+gp_global_lock(void)
+{
+    if (global_lock_state != 2) {
+        if (InterlockedCompareExchange(&global_lock_state, 1, 0) == 0) {
+            gp_monitor_open((gp_monitor *)&global_lock);
+            InterlockedExchange(&global_lock_state, 2);
+        } else {
+            while (global_lock_state != 2)
+                Sleep(0);
+        }
+    }
+    EnterCriticalSection(&global_lock.lock);
+}
+
+void
+gp_global_unlock(void)
+{
+    LeaveCriticalSection(&global_lock.lock);
+}
+
 /* --------- Thread primitives ---------- */
 
 typedef struct gp_thread_creation_closure_s {
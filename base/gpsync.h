@@ -83,6 +83,15 @@ void gp_monitor_label(gp_monitor * mon, const char *name);
 #define gp_monitor_label(A,B) do {} while (0)
 #endif
 
+/*
+ * There is also a single process wide monitor, which needs no allocation
+ * and no opening.  It is for the few places that have to touch state
+ * shared by every instance in the process, such as libraries that keep no
+ * context of their own.  The same thread may enter it recursively.
+ */
+void gp_global_lock(void);
+void gp_global_unlock(void);
+
 /*
  * A new thread starts by calling a procedure, passing it a void * that
  * allows it to gain access to whatever data it needs.
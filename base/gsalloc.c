@@ -1787,6 +1787,8 @@ i_status(gs_memory_t * mem, gs_memory_status_t * pstat)
     pstat->allocated = imem->allocated +
         imem->previous_status.allocated;
     pstat->max_used = 0;		/* unknown for this allocator */
+    pstat->parent_calls = 0;
+    pstat->retained = 0;
     pstat->is_thread_safe = false;	/* this allocator is not thread safe */
 }
 
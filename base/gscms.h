@@ -36,6 +36,12 @@
 #define DEV_NEUTRAL_8 5
 #define DEV_NEUTRAL_16 5
 
+/* Default entries in the per link memo of single color transforms */
+#ifndef ICC_COLOR_MEMO_SIZE
+#  define ICC_COLOR_MEMO_SIZE 256
+#endif
+#define ICC_COLOR_MEMO_MAX 65536
+
 /* Define the preferred size of the output by the CMS */
 /* This can be different than the size of gx_color_value
    which can range between 8 and 16.  Here we can only
@@ -286,6 +292,8 @@ struct cmm_dev_profile_s {
         bool sim_overprint;     /* Indicates we want to do overprint blending */
         gsicc_namelist_t *spotnames;  /* If our device profiles are devn */
         bool prebandthreshold;     /* Used to indicate use of HT pre-clist */
+        int color_memo_size;       /* Entries in each link's single color memo */
+        bool image_grid;           /* Convert 8 bit images through a sampled grid */
         gs_memory_t *memory;
         rc_header rc;
 };
@@ -440,6 +448,12 @@ typedef struct gsicc_hashlink_s {
     int64_t rend_hash;
 } gsicc_hashlink_t;
 
+/* Memo of recent single color transforms, see gsicc_cache.c */
+typedef struct gsicc_color_memo_s gsicc_color_memo_t;
+
+/* Sampled grid of a link for 8 bit image data, see gsicc_cache.c */
+typedef struct gsicc_image_lut_s gsicc_image_lut_t;
+
 struct gsicc_link_s {
     void *link_handle;		/* the CMS decides what this is */
     gs_memory_t *memory;
@@ -447,26 +461,34 @@ struct gsicc_link_s {
     gsicc_hashlink_t hashcode;
     struct gsicc_link_cache_s *icc_link_cache;
     int ref_count;
-    gsicc_link_t *next;
     gx_monitor_t *lock;		/* lock used while changing contents */
     bool includes_softproof;
     bool includes_devlink;
     bool is_identity;  /* Used for noting that this is an identity profile */
     bool valid;		/* true once link is completely built and usable */
+    bool referenced;	/* used since the eviction sweep last passed it */
     bool is_monitored;
     gscms_procs_t orig_procs;  /* procs to use after monitoring */
     gsicc_colorbuffer_t data_cs; /* needed for begin_monitor after end_monitor */
     int num_input;  /* Need so we can monitor properly */
     int num_output; /* Need so we can monitor properly */
+    int color_memo_size;	/* entries in color_memo, 0 for none */
+    gsicc_color_memo_t *color_memo;	/* one per thread, made on first use */
+    bool image_grid;		/* 8 bit images may use image_lut, set before valid */
+    gsicc_image_lut_t *image_lut;	/* built once enough image data is seen */
+    int image_lut_pixels;	/* pixels seen so far, -1 if no lut possible */
 };
 
-/* ICC Cache. The size of the cache is limited by max_memory_size.
- * Links are added if there is sufficient memory and if the number
- * of links does not exceed a (soft) limit.
+/* ICC Cache. Links are added if there is sufficient memory and if the
+ * number of links does not exceed a (soft) limit.  The links are held
+ * in an open addressed hash table keyed on the link hash code, with
+ * unused links evicted by a clock sweep over the table.
  */
 
 typedef struct gsicc_link_cache_s {
-    gsicc_link_t *head;
+    gsicc_link_t **table;	/* linear probing, non_gc_memory */
+    uint table_size;		/* power of 2, at least twice num_links */
+    uint hand;			/* clock hand for eviction */
     int num_links;
     rc_header rc;
     gs_memory_t *memory;
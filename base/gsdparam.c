@@ -89,6 +89,8 @@ int gx_default_get_param(gx_device *dev, char *Param, void *list)
     bool usefastcolor = false;  /* set for unmanaged color */
     bool sim_overprint = false;  /* By default do not simulate overprinting */
     bool prebandthreshold = true, temp_bool = false;
+    int color_memo_size = ICC_COLOR_MEMO_SIZE;
+    bool image_grid = false;
 
     if(strcmp(Param, "OutputDevice") == 0){
         gs_param_string dns;
@@ -342,6 +344,8 @@ int gx_default_get_param(gx_device *dev, char *Param, void *list)
         usefastcolor = dev_profile->usefastcolor;
         sim_overprint = dev_profile->sim_overprint;
         prebandthreshold = dev_profile->prebandthreshold;
+        color_memo_size = dev_profile->color_memo_size;
+        image_grid = dev_profile->image_grid;
         /* With respect to Output profiles that have non-standard colorants,
            we rely upon the default profile to give us the colorants if they do
            exist. */
@@ -386,6 +390,12 @@ int gx_default_get_param(gx_device *dev, char *Param, void *list)
     if (strcmp(Param, "PreBandThreshold") == 0) {
         return param_write_bool(plist, "PreBandThreshold", &prebandthreshold);
     }
+    if (strcmp(Param, "ICCColorCacheSize") == 0) {
+        return param_write_int(plist, "ICCColorCacheSize", &color_memo_size);
+    }
+    if (strcmp(Param, "ICCImageGrid") == 0) {
+        return param_write_bool(plist, "ICCImageGrid", &image_grid);
+    }
     if (strcmp(Param, "PostRenderProfile") == 0) {
         return param_write_string(plist, "PostRenderProfile", &(postren_profile));
     }
@@ -508,6 +518,8 @@ gx_default_get_params(gx_device * dev, gs_param_list * plist)
     bool usefastcolor = false;  /* set for unmanaged color */
     bool sim_overprint = false;  /* By default do not simulate overprinting */
     bool prebandthreshold = true, temp_bool;
+    int color_memo_size = ICC_COLOR_MEMO_SIZE;
+    bool image_grid = false;
     int k;
     int color_accuracy = MAX_COLOR_ACCURACY;
     gs_param_float_array msa, ibba, hwra, ma;
@@ -621,6 +633,8 @@ gx_default_get_params(gx_device * dev, gs_param_list * plist)
         usefastcolor = dev_profile->usefastcolor;
         sim_overprint = dev_profile->sim_overprint;
         prebandthreshold = dev_profile->prebandthreshold;
+        color_memo_size = dev_profile->color_memo_size;
+        image_grid = dev_profile->image_grid;
         /* With respect to Output profiles that have non-standard colorants,
            we rely upon the default profile to give us the colorants if they do
            exist. */
@@ -681,6 +695,8 @@ gx_default_get_params(gx_device * dev, gs_param_list * plist)
         (code = param_write_bool(plist, "UseFastColor", &usefastcolor)) < 0 ||
         (code = param_write_bool(plist, "SimulateOverprint", &sim_overprint)) < 0 ||
         (code = param_write_bool(plist, "PreBandThreshold", &prebandthreshold)) < 0 ||
+        (code = param_write_int(plist, "ICCColorCacheSize", &color_memo_size)) < 0 ||
+        (code = param_write_bool(plist, "ICCImageGrid", &image_grid)) < 0 ||
         (code = param_write_string(plist,"OutputICCProfile", &(profile_array[0]))) < 0 ||
         (code = param_write_string(plist,"GraphicICCProfile", &(profile_array[1]))) < 0 ||
         (code = param_write_string(plist,"ImageICCProfile", &(profile_array[2]))) < 0 ||
@@ -1121,6 +1137,60 @@ gx_default_put_prebandthreshold(bool prebandthreshold, gx_device * dev)
     return code;
 }
 
+static int
+gx_default_put_colormemosize(int color_memo_size, gx_device * dev)
+{
+    int code = 0;
+    cmm_dev_profile_t *profile_struct;
+
+    /* See gx_default_put_prebandthreshold for why get_profile may be NULL */
+    if (dev_proc(dev, get_profile) == NULL) {
+        if (dev->icc_struct == NULL) {
+            dev->icc_struct = gsicc_new_device_profile_array(dev->memory);
+            if (dev->icc_struct == NULL)
+                return_error(gs_error_VMerror);
+        }
+        dev->icc_struct->color_memo_size = color_memo_size;
+    } else {
+        code = dev_proc(dev, get_profile)(dev,  &profile_struct);
+        if (profile_struct == NULL) {
+            dev->icc_struct = gsicc_new_device_profile_array(dev->memory);
+            profile_struct =  dev->icc_struct;
+            if (profile_struct == NULL)
+                return_error(gs_error_VMerror);
+        }
+        profile_struct->color_memo_size = color_memo_size;
+    }
+    return code;
+}
+
+static int
+gx_default_put_imagegrid(bool image_grid, gx_device * dev)
+{
+    int code = 0;
+    cmm_dev_profile_t *profile_struct;
+
+    /* See gx_default_put_prebandthreshold for why get_profile may be NULL */
+    if (dev_proc(dev, get_profile) == NULL) {
+        if (dev->icc_struct == NULL) {
+            dev->icc_struct = gsicc_new_device_profile_array(dev->memory);
+            if (dev->icc_struct == NULL)
+                return_error(gs_error_VMerror);
+        }
+        dev->icc_struct->image_grid = image_grid;
+    } else {
+        code = dev_proc(dev, get_profile)(dev,  &profile_struct);
+        if (profile_struct == NULL) {
+            dev->icc_struct = gsicc_new_device_profile_array(dev->memory);
+            profile_struct =  dev->icc_struct;
+            if (profile_struct == NULL)
+                return_error(gs_error_VMerror);
+        }
+        profile_struct->image_grid = image_grid;
+    }
+    return code;
+}
+
 static int
 gx_default_put_usefastcolor(bool fastcolor, gx_device * dev)
 {
@@ -1423,6 +1493,8 @@ gx_default_put_params(gx_device * dev, gs_param_list * plist)
     bool usefastcolor = false;
     bool sim_overprint = false;
     bool prebandthreshold = false;
+    int color_memo_size = ICC_COLOR_MEMO_SIZE;
+    bool image_grid = false;
     bool use_antidropout = dev->color_info.use_antidropout_downscaler;
     bool temp_bool;
     int  profile_types[NUM_DEVICE_PROFILES] = {gsDEFAULTPROFILE,
@@ -1441,6 +1513,8 @@ gx_default_put_params(gx_device * dev, gs_param_list * plist)
         devicegraytok = dev->icc_struct->devicegraytok;
         usefastcolor = dev->icc_struct->usefastcolor;
         prebandthreshold = dev->icc_struct->prebandthreshold;
+        color_memo_size = dev->icc_struct->color_memo_size;
+        image_grid = dev->icc_struct->image_grid;
         sim_overprint = dev->icc_struct->sim_overprint;
     } else {
         for (k = 0; k < NUM_DEVICE_PROFILES; k++) {
@@ -1760,6 +1834,26 @@ nce:
         ecode = code;
         param_signal_error(plist, param_name, ecode);
     }
+    switch (code = param_read_int(plist, (param_name = "ICCColorCacheSize"),
+                                                        &color_memo_size)) {
+        case 0:
+            if (color_memo_size < 0 || color_memo_size > ICC_COLOR_MEMO_MAX)
+                ecode = gs_error_rangecheck;
+            else
+                break;
+            goto ccse;
+        default:
+            ecode = code;
+ccse:
+            param_signal_error(plist, param_name, ecode);
+        case 1:
+            break;
+    }
+    if ((code = param_read_bool(plist, (param_name = "ICCImageGrid"),
+                                                        &image_grid)) < 0) {
+        ecode = code;
+        param_signal_error(plist, param_name, ecode);
+    }
     if ((code = param_read_bool(plist, (param_name = "UseCIEColor"), &ucc)) < 0) {
         ecode = code;
         param_signal_error(plist, param_name, ecode);
@@ -2127,6 +2221,12 @@ label:\
     if (code < 0)
         return code;
     code = gx_default_put_graydetection(graydetection, dev);
+    if (code < 0)
+        return code;
+    code = gx_default_put_colormemosize(color_memo_size, dev);
+    if (code < 0)
+        return code;
+    code = gx_default_put_imagegrid(image_grid, dev);
     if (code < 0)
         return code;
     return gx_default_put_prebandthreshold(prebandthreshold, dev);
@@ -480,7 +480,8 @@ capture_spot_equivalent_cmyk_colors(gx_device * pdev, const gs_gstate * pgs,
                           0 /* graydection */, 0 /* pageneutralcolor */,
                           0 /* usefastcolor */, 0 /* supports_devn */,
                           0 /* sim_overprint */, 0 /* spotnames */,
-                          0 /* prebandthreshold */, 0 /* memory */,
+                          0 /* prebandthreshold */, 0 /* color_memo_size */,
+                          0 /* image_grid */, 0 /* memory */,
                           { 0 } /* rc_header */
                           };
 
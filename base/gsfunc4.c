@@ -29,16 +29,6 @@
 #include "spprint.h"
 #include "stream.h"
 
-typedef struct gs_function_PtCr_s {
-    gs_function_head_t head;
-    gs_function_PtCr_params_t params;
-    /* Define a bogus DataSource for get_function_info. */
-    gs_data_source_t data_source;
-} gs_function_PtCr_t;
-
-/* GC descriptor */
-private_st_function_PtCr();
-
 /* Define the maximum stack depth. */
 #define MAX_VSTACK 256		/* Max 100 is enough per PDF spec, but we use this
                                  * for DeviceN handling. Must be at least as large
@@ -52,14 +42,64 @@ typedef enum {
     CVT_INT,
     CVT_FLOAT
 } calc_value_type_t;
+typedef union calc_number_u {
+    int i;			/* also used for Boolean */
+    float f;
+} calc_number_t;
 typedef struct calc_value_s {
     calc_value_type_t type;
-    union {
-        int i;			/* also used for Boolean */
-        float f;
-    } value;
+    calc_number_t value;
 } calc_value_t;
 
+/*
+ * Most functions are compiled by gs_function_PtCr_init into a sequence of
+ * instructions on a fixed set of registers, one per stack slot.  The types
+ * and the stack depth at every point are worked out by the compiler, so the
+ * instructions carry no type information, and constant operands are either
+ * folded or become immediate operands.  Functions whose types can't be
+ * determined statically (integer arithmetic that might overflow, repeat,
+ * branches that leave different types on the stack) or that would fail are
+ * left to the interpreter, which remains the reference implementation.
+ */
+typedef enum {
+    CI_return,
+    CI_const,			/* r[a] = k */
+    CI_move,			/* r[a] = r[b] */
+    CI_exch,			/* r[a] <-> r[a + 1] */
+    CI_copy,			/* r[a .. a+b-1] = r[a-b .. a-1] */
+    CI_roll,			/* rotate r[a .. a+b-1] up by k.i */
+    CI_jz,			/* if (!r[a].i) goto b */
+    CI_jmp,			/* goto b */
+        /* r[a] = op r[a] */
+    CI_i2f, CI_cvi, CI_not,
+    CI_abs, CI_ceiling, CI_cos, CI_floor, CI_ln, CI_log, CI_neg,
+    CI_round, CI_sin, CI_sqrt, CI_truncate,
+        /* r[a] = r[a] op r[a + 1] */
+    CI_add, CI_and, CI_atan, CI_bitshift, CI_div, CI_exp, CI_idiv,
+    CI_mod, CI_mul, CI_or, CI_sub, CI_xor,
+    CI_eq, CI_ge, CI_gt, CI_le, CI_lt, CI_ne,
+    CI_eq_int, CI_ge_int, CI_gt_int, CI_le_int, CI_lt_int, CI_ne_int,
+        /* r[a] = r[b] op k, or k op r[b] for rsub */
+    CI_add_k, CI_mul_k, CI_sub_k, CI_rsub_k, CI_div_k
+} calc_insn_op_t;
+typedef struct calc_insn_s {
+    ushort op;			/* calc_insn_op_t */
+    ushort a;
+    int b;
+    calc_number_t k;
+} calc_insn_t;
+
+typedef struct gs_function_PtCr_s {
+    gs_function_head_t head;
+    gs_function_PtCr_params_t params;
+    /* Define a bogus DataSource for get_function_info. */
+    gs_data_source_t data_source;
+    calc_insn_t *code;		/* compiled form of params.ops, or 0 */
+} gs_function_PtCr_t;
+
+/* GC descriptor */
+private_st_function_PtCr();
+
 /* Store a float. */
 static inline void
 store_float(calc_value_t *vsp, double f)
@@ -102,28 +142,14 @@ typedef enum {
 
 } gs_PtCr_typed_opcode_t;
 
-/* Evaluate a PostScript Calculator function. */
-static int
-fn_PtCr_evaluate(const gs_function_t *pfn_common, const float *in, float *out)
-{
-    const gs_function_PtCr_t *pfn = (const gs_function_PtCr_t *)pfn_common;
-    calc_value_t vstack_buf[2 + MAX_VSTACK + 1];
-    calc_value_t *vstack = &vstack_buf[1];
-    calc_value_t *vsp = vstack + pfn->params.m;
-    const byte *p = pfn->params.ops.data;
-    int repeat_count[MAX_PSC_FUNCTION_NESTING];
-    int repeat_proc_size[MAX_PSC_FUNCTION_NESTING];
-    int repeat_nesting_level = -1;
-    int i;
-
-    /*
-     * Define the table for mapping explicit opcodes to typed opcodes.
-     * We index this table with the opcode and the types of the top 2
-     * values on the stack.
-     */
-    static const struct op_defn_s {
-        byte opcode[16];	/* 4 * type[-1] + type[0] */
-    } op_defn_table[] = {
+/*
+ * Define the table for mapping explicit opcodes to typed opcodes.
+ * We index this table with the opcode and the types of the top 2
+ * values on the stack.
+ */
+static const struct op_defn_s {
+    byte opcode[16];	/* 4 * type[-1] + type[0] */
+} op_defn_table[] = {
         /* Keep this consistent with opcodes in gsfunc4.h! */
 
 #define O4(op) op,op,op,op
@@ -219,16 +245,40 @@ fn_PtCr_evaluate(const gs_function_t *pfn_common, const float *in, float *out)
         OP_NONE(PtCr_return),		/* return */
         OP1(E, PtCr_repeat, E),		/* repeat */
         OP_NONE(PtCr_repeat_end)	/* repeat_end */
-    };
+};
+
+#undef O4
+#undef E
+#undef E4
+#undef N
+#undef OP_NONE
+#undef OP1
+#undef OP_NUM1
+#undef OP_MATH1
+#undef OP_ANY1
+#undef OP_NUM2
+#undef OP_INT_BOOL2
+#undef OP_MATH2
+#undef OP_INT2
+#undef OP_REL2
+#undef OP_ANY2
+
+/*
+ * Execute an operation string.  vstack[-1] and vstack[0] must be empty,
+ * and *pvsp points to the top of the stack on entry and on return.
+ */
+static int
+calc_execute(const byte *p, calc_value_t *vstack, calc_value_t **pvsp)
+{
+    calc_value_t *vsp = *pvsp;
+    int repeat_count[MAX_PSC_FUNCTION_NESTING];
+    int repeat_proc_size[MAX_PSC_FUNCTION_NESTING];
+    int repeat_nesting_level = -1;
+    int i;
 
     memset(repeat_count, 0x00, MAX_PSC_FUNCTION_NESTING * sizeof(int));
     memset(repeat_proc_size, 0x00, MAX_PSC_FUNCTION_NESTING * sizeof(int));
 
-    vstack[-1].type = CVT_NONE;  /* for type dispatch in empty stack case */
-    vstack[0].type = CVT_NONE;	/* catch underflow */
-    for (i = 0; i < pfn->params.m; ++i)
-        store_float(&vstack[i + 1], in[i]);
-
     for (; ; ) {
         int code, n;
 
@@ -530,7 +580,8 @@ fn_PtCr_evaluate(const gs_function_t *pfn_common, const float *in, float *out)
             p += 2 + (p[0] << 8) + p[1];	/* skip the past body */
             continue;
         case PtCr_return:
-            goto fin;
+            *pvsp = vsp;
+            return 0;
         case PtCr_repeat:
             repeat_nesting_level++;
             repeat_count[repeat_nesting_level] = vsp->value.i;
@@ -549,8 +600,254 @@ fn_PtCr_evaluate(const gs_function_t *pfn_common, const float *in, float *out)
             continue;
         }
     }
- fin:
+}
 
+/*
+ * Run the compiled form of a function.  Return 1 if the caller must use
+ * the interpreter instead.
+ */
+static int
+calc_run(const gs_function_PtCr_t *pfn, const float *in, float *out)
+{
+    calc_number_t r[MAX_VSTACK];
+    const calc_insn_t *code = pfn->code;
+    const calc_insn_t *ip;
+    int i;
+
+    for (i = 0; i < pfn->params.m; ++i)
+        r[i].f = in[i];
+    for (ip = code; ; ++ip) {
+        calc_number_t *const ra = &r[ip->a];
+
+        switch ((calc_insn_op_t)ip->op) {
+        case CI_return:
+            for (i = 0; i < pfn->params.n; ++i)
+                out[i] = r[i].f;
+            return 0;
+        case CI_const:
+            *ra = ip->k;
+            continue;
+        case CI_move:
+            *ra = r[ip->b];
+            continue;
+        case CI_exch: {
+            calc_number_t t = ra[0];
+
+            ra[0] = ra[1];
+            ra[1] = t;
+            continue;
+        }
+        case CI_copy:
+            memcpy(ra, ra - ip->b, ip->b * sizeof(*ra));
+            continue;
+        case CI_roll: {
+            calc_number_t t[MAX_VSTACK];
+            int n = ip->b, j = ip->k.i;
+
+            memcpy(t, ra, n * sizeof(*ra));
+            memcpy(ra + j, t, (n - j) * sizeof(*ra));
+            memcpy(ra, t + n - j, j * sizeof(*ra));
+            continue;
+        }
+        case CI_jz:
+            if (ra->i)
+                continue;
+            /* falls through */
+        case CI_jmp:
+            ip = code + ip->b - 1;
+            continue;
+
+            /* Unary operators */
+
+        case CI_i2f:
+            ra->f = (double)ra->i;
+            continue;
+        case CI_cvi:
+            ra->i = (int)(ra->f);
+            continue;
+        case CI_not:
+            ra->i = ~ra->i;
+            continue;
+        case CI_abs:
+            ra->f = fabs(ra->f);
+            continue;
+        case CI_ceiling:
+            ra->f = ceil(ra->f);
+            continue;
+        case CI_cos:
+            ra->f = gs_cos_degrees(ra->f);
+            continue;
+        case CI_floor:
+            ra->f = floor(ra->f);
+            continue;
+        case CI_ln:
+            ra->f = log(ra->f);
+            continue;
+        case CI_log:
+            ra->f = log10(ra->f);
+            continue;
+        case CI_neg:
+            ra->f = -ra->f;
+            continue;
+        case CI_round:
+            ra->f = floor(ra->f + 0.5);
+            continue;
+        case CI_sin:
+            ra->f = gs_sin_degrees(ra->f);
+            continue;
+        case CI_sqrt:
+            ra->f = sqrt(ra->f);
+            continue;
+        case CI_truncate:
+            ra->f = (ra->f < 0 ? ceil(ra->f) : floor(ra->f));
+            continue;
+
+            /* Binary operators */
+
+        case CI_add:
+            ra[0].f += ra[1].f;
+            continue;
+        case CI_and:
+            ra[0].i &= ra[1].i;
+            continue;
+        case CI_atan: {
+            double result;
+            int code = gs_atan2_degrees(ra[0].f, ra[1].f, &result);
+
+            if (code < 0)
+                return code;
+            ra[0].f = result;
+            continue;
+        }
+        case CI_bitshift:
+#define MAX_SHIFT (ARCH_SIZEOF_INT * 8 - 1)
+            if (ra[1].i < -MAX_SHIFT || ra[1].i > MAX_SHIFT)
+                ra[0].i = 0;
+#undef MAX_SHIFT
+            else if (ra[1].i < 0)
+                ra[0].i = ((uint)(ra[0].i)) >> -ra[1].i;
+            else
+                ra[0].i <<= ra[1].i;
+            continue;
+        case CI_div:
+            if (ra[1].f == 0)
+                return_error(gs_error_undefinedresult);
+            ra[0].f /= ra[1].f;
+            continue;
+        case CI_exp:
+            ra[0].f = pow(ra[0].f, ra[1].f);
+            continue;
+        case CI_idiv:
+            if (ra[1].i == 0)
+                return_error(gs_error_undefinedresult);
+            if ((ra[0].i /= ra[1].i) == min_int && ra[1].i == -1)
+                return_error(gs_error_rangecheck);
+            continue;
+        case CI_mod:
+            if (ra[1].i == 0)
+                return_error(gs_error_undefinedresult);
+            ra[0].i %= ra[1].i;
+            continue;
+        case CI_mul:
+            ra[0].f *= ra[1].f;
+            continue;
+        case CI_or:
+            ra[0].i |= ra[1].i;
+            continue;
+        case CI_sub:
+            ra[0].f -= ra[1].f;
+            continue;
+        case CI_xor:
+            ra[0].i ^= ra[1].i;
+            continue;
+
+#define DO_REL(rel, m)\
+  ra[0].i = ra[0].m rel ra[1].m
+
+        case CI_eq:
+            DO_REL(==, f);
+            continue;
+        case CI_ge:
+            DO_REL(>=, f);
+            continue;
+        case CI_gt:
+            DO_REL(>, f);
+            continue;
+        case CI_le:
+            DO_REL(<=, f);
+            continue;
+        case CI_lt:
+            DO_REL(<, f);
+            continue;
+        case CI_ne:
+            DO_REL(!=, f);
+            continue;
+        case CI_eq_int:
+            DO_REL(==, i);
+            continue;
+        case CI_ge_int:
+            DO_REL(>=, i);
+            continue;
+        case CI_gt_int:
+            DO_REL(>, i);
+            continue;
+        case CI_le_int:
+            DO_REL(<=, i);
+            continue;
+        case CI_lt_int:
+            DO_REL(<, i);
+            continue;
+        case CI_ne_int:
+            DO_REL(!=, i);
+            continue;
+
+#undef DO_REL
+
+            /* Operators with an immediate operand */
+
+        case CI_add_k:
+            ra->f = r[ip->b].f + ip->k.f;
+            continue;
+        case CI_mul_k:
+            ra->f = r[ip->b].f * ip->k.f;
+            continue;
+        case CI_sub_k:
+            ra->f = r[ip->b].f - ip->k.f;
+            continue;
+        case CI_rsub_k:
+            ra->f = ip->k.f - r[ip->b].f;
+            continue;
+        case CI_div_k:
+            ra->f = r[ip->b].f / ip->k.f;
+            continue;
+        default:
+            return 1;
+        }
+    }
+}
+
+/* Evaluate a PostScript Calculator function. */
+static int
+fn_PtCr_evaluate(const gs_function_t *pfn_common, const float *in, float *out)
+{
+    const gs_function_PtCr_t *pfn = (const gs_function_PtCr_t *)pfn_common;
+    calc_value_t vstack_buf[2 + MAX_VSTACK + 1];
+    calc_value_t *vstack = &vstack_buf[1];
+    calc_value_t *vsp = vstack + pfn->params.m;
+    int i, code;
+
+    if (pfn->code != 0) {
+        code = calc_run(pfn, in, out);
+        if (code <= 0)
+            return code;
+    }
+    vstack[-1].type = CVT_NONE;  /* for type dispatch in empty stack case */
+    vstack[0].type = CVT_NONE;	/* catch underflow */
+    for (i = 0; i < pfn->params.m; ++i)
+        store_float(&vstack[i + 1], in[i]);
+    code = calc_execute(pfn->params.ops.data, vstack, &vsp);
+    if (code < 0)
+        return code;
     if (vsp != vstack + pfn->params.n)
         return_error(gs_error_rangecheck);
     for (i = 0; i < pfn->params.n; ++i) {
@@ -726,6 +1023,591 @@ fn_PtCr_get_info(const gs_function_t *pfn_common, gs_function_info_t *pfi)
     }
 }
 
+/* ---------------- Compilation ---------------- */
+
+#define CALC_NOT_COMPILED 1	/* leave the function to the interpreter */
+#define MAX_CALC_PENDING 32	/* max forward jumps not yet reached */
+
+/* A forward jump, and the (materialized) stack state at the jump. */
+typedef struct calc_pending_s {
+    uint target;		/* offset in ops */
+    int insn;			/* jump instruction to patch, or -1 */
+    int depth;
+    byte types[MAX_VSTACK];
+} calc_pending_t;
+
+/* The state of the compiler. */
+typedef struct calc_compiler_s {
+    gs_memory_t *memory;	/* for the instruction buffer */
+    calc_insn_t *code;
+    int count, size;
+    int depth;			/* -1 if the code is unreachable */
+    calc_value_t stack[MAX_VSTACK];
+    bool known[MAX_VSTACK];	/* value is a constant, not in the register */
+    calc_pending_t pending[MAX_CALC_PENDING];
+    int num_pending;
+    calc_value_t fold_stack[2 + MAX_VSTACK + 1];
+} calc_compiler_t;
+
+/* Append an instruction. */
+static int
+calc_emit(calc_compiler_t *cc, calc_insn_op_t op, int a, int b,
+          const calc_number_t *pk)
+{
+    calc_insn_t *pi;
+
+    if (cc->count == cc->size) {
+        int size = (cc->size == 0 ? 64 : cc->size * 2);
+        calc_insn_t *code = (calc_insn_t *)
+            gs_alloc_byte_array(cc->memory, size, sizeof(calc_insn_t),
+                                "calc_emit");
+
+        if (code == 0)
+            return_error(gs_error_VMerror);
+        if (cc->count)
+            memcpy(code, cc->code, cc->count * sizeof(calc_insn_t));
+        gs_free_object(cc->memory, cc->code, "calc_emit");
+        cc->code = code;
+        cc->size = size;
+    }
+    pi = &cc->code[cc->count++];
+    pi->op = (ushort)op;
+    pi->a = (ushort)a;
+    pi->b = b;
+    if (pk)
+        pi->k = *pk;
+    else
+        pi->k.i = 0;
+    return 0;
+}
+
+/* Load a constant into its register. */
+static int
+calc_materialize(calc_compiler_t *cc, int s)
+{
+    if (!cc->known[s])
+        return 0;
+    cc->known[s] = false;
+    return calc_emit(cc, CI_const, s, 0, &cc->stack[s].value);
+}
+static int
+calc_materialize_all(calc_compiler_t *cc)
+{
+    int s, code = 0;
+
+    for (s = 0; s < cc->depth && code >= 0; ++s)
+        code = calc_materialize(cc, s);
+    return code;
+}
+
+/* Convert an integer to a float, like PtCr_int_to_float. */
+static int
+calc_coerce(calc_compiler_t *cc, int s)
+{
+    calc_value_t *pv = &cc->stack[s];
+
+    if (cc->known[s]) {
+        store_float(pv, (double)pv->value.i);
+        return 0;
+    }
+    pv->type = CVT_FLOAT;
+    return calc_emit(cc, CI_i2f, s, 0, NULL);
+}
+
+/* Record a forward jump; the stack must have been materialized. */
+static int
+calc_add_pending(calc_compiler_t *cc, uint target, int insn)
+{
+    calc_pending_t *pp;
+    int s;
+
+    if (cc->num_pending == MAX_CALC_PENDING)
+        return CALC_NOT_COMPILED;
+    pp = &cc->pending[cc->num_pending++];
+    pp->target = target;
+    pp->insn = insn;
+    pp->depth = cc->depth;
+    for (s = 0; s < cc->depth; ++s)
+        pp->types[s] = (byte)cc->stack[s].type;
+    return 0;
+}
+
+/*
+ * Merge the states of the jumps to the current offset with the state
+ * falling through to it.  All of them must agree on the stack depth and
+ * types.
+ */
+static int
+calc_merge(calc_compiler_t *cc, uint offset)
+{
+    bool merged = false;
+    int i = 0, s, code;
+
+    while (i < cc->num_pending) {
+        calc_pending_t *pp = &cc->pending[i];
+
+        if (pp->target < offset)
+            return CALC_NOT_COMPILED;	/* not on an operator boundary */
+        if (pp->target > offset) {
+            ++i;
+            continue;
+        }
+        if (!merged) {
+            merged = true;
+            if (cc->depth >= 0) {
+                code = calc_materialize_all(cc);
+                if (code < 0)
+                    return code;
+            } else {
+                cc->depth = pp->depth;
+                for (s = 0; s < pp->depth; ++s) {
+                    cc->stack[s].type = (calc_value_type_t)pp->types[s];
+                    cc->known[s] = false;
+                }
+            }
+        }
+        if (pp->depth != cc->depth)
+            return CALC_NOT_COMPILED;
+        for (s = 0; s < pp->depth; ++s)
+            if (pp->types[s] != cc->stack[s].type)
+                return CALC_NOT_COMPILED;
+        if (pp->insn >= 0)
+            cc->code[pp->insn].b = cc->count;
+        *pp = cc->pending[--(cc->num_pending)];
+    }
+    return 0;
+}
+
+/* Compile an arithmetic, comparison or stack operator. */
+static int
+calc_compile_op(calc_compiler_t *cc, gs_PtCr_opcode_t op)
+{
+    calc_value_t *vs = cc->stack;
+    bool *known = cc->known;
+    int d = cc->depth;
+    int typed, code, i, n;
+    calc_insn_op_t cop, kop;
+
+    if (op < PtCr_copy) {
+        /* Arithmetic and comparison operators take 1 or 2 operands. */
+        int nargs = 2;
+
+        switch (op) {
+        case PtCr_abs: case PtCr_ceiling: case PtCr_cos: case PtCr_cvi:
+        case PtCr_cvr: case PtCr_floor: case PtCr_ln: case PtCr_log:
+        case PtCr_neg: case PtCr_not: case PtCr_round: case PtCr_sin:
+        case PtCr_sqrt: case PtCr_truncate:
+            nargs = 1;
+        default:
+            break;
+        }
+        if (d >= nargs && known[d - 1] && (nargs == 1 || known[d - 2])) {
+            /* Fold the operation, using the interpreter. */
+            calc_value_t *fs = &cc->fold_stack[1];
+            calc_value_t *fsp = fs + nargs;
+            byte fops[2];
+
+            fops[0] = (byte)op;
+            fops[1] = PtCr_return;
+            fs[-1].type = fs[0].type = CVT_NONE;
+            memcpy(&fs[1], &vs[d - nargs], nargs * sizeof(*fs));
+            code = calc_execute(fops, fs, &fsp);
+            if (code < 0 || fsp != fs + 1)
+                return CALC_NOT_COMPILED;
+            vs[d - nargs] = fs[1];
+            cc->depth = d - nargs + 1;
+            return 0;
+        }
+    }
+    for (;;) {
+        typed = op_defn_table[op].opcode[
+                    ((d > 1 ? vs[d - 2].type : CVT_NONE) << 2) +
+                    (d > 0 ? vs[d - 1].type : CVT_NONE)];
+        switch (typed) {
+        case PtCr_int_to_float:
+            code = calc_coerce(cc, d - 1);
+            break;
+        case PtCr_int2_to_float:
+            code = calc_coerce(cc, d - 1);
+            if (code < 0)
+                return code;
+            /* falls through */
+        case PtCr_2nd_int_to_float:
+            code = calc_coerce(cc, d - 2);
+            break;
+        default:
+            goto dispatch;
+        }
+        if (code < 0)
+            return code;
+    }
+ dispatch:
+    switch (typed) {
+    case PtCr_no_op:
+        return 0;
+
+        /* Stack operators */
+
+    case PtCr_copy:
+        if (!known[d - 1])
+            return CALC_NOT_COMPILED;
+        i = vs[d - 1].value.i;
+        if (i < 0 || i >= d || i > MAX_VSTACK - (d - 1) ||
+            d - 1 + i >= MAX_VSTACK)
+            return CALC_NOT_COMPILED;
+        for (n = 0; n < i; ++n)
+            if (!known[d - 1 - i + n])
+                break;
+        if (n < i) {
+            code = calc_emit(cc, CI_copy, d - 1, i, NULL);
+            if (code < 0)
+                return code;
+        }
+        memcpy(&vs[d - 1], &vs[d - 1 - i], i * sizeof(*vs));
+        memcpy(&known[d - 1], &known[d - 1 - i], i * sizeof(*known));
+        cc->depth = d - 1 + i;
+        return 0;
+    case PtCr_dup:
+        i = 0;
+        goto index;
+    case PtCr_exch:
+        if (!known[d - 1] || !known[d - 2]) {
+            code = calc_emit(cc, CI_exch, d - 2, 0, NULL);
+            if (code < 0)
+                return code;
+        }
+        {
+            calc_value_t v = vs[d - 1];
+            bool k = known[d - 1];
+
+            vs[d - 1] = vs[d - 2], known[d - 1] = known[d - 2];
+            vs[d - 2] = v, known[d - 2] = k;
+        }
+        return 0;
+    case PtCr_index:
+        if (!known[d - 1])
+            return CALC_NOT_COMPILED;
+        i = vs[d - 1].value.i;
+        if (i < 0 || i >= d - 1)
+            return CALC_NOT_COMPILED;
+        cc->depth = --d;
+    index:
+        if (d + 1 >= MAX_VSTACK)
+            return CALC_NOT_COMPILED;
+        if (!known[d - 1 - i]) {
+            code = calc_emit(cc, CI_move, d, d - 1 - i, NULL);
+            if (code < 0)
+                return code;
+        }
+        vs[d] = vs[d - 1 - i];
+        known[d] = known[d - 1 - i];
+        cc->depth = d + 1;
+        return 0;
+    case PtCr_pop:
+        cc->depth = d - 1;
+        return 0;
+    case PtCr_roll: {
+        calc_value_t tv[MAX_VSTACK];
+        bool tk[MAX_VSTACK];
+        int j;
+
+        if (!known[d - 1] || !known[d - 2])
+            return CALC_NOT_COMPILED;
+        n = vs[d - 2].value.i;
+        j = vs[d - 1].value.i;
+        if (n < 0 || n > d - 2)
+            return CALC_NOT_COMPILED;
+        d -= 2;
+        cc->depth = d;
+        if (n == 0 || (j %= n) == 0)
+            return 0;
+        if (j < 0)
+            j += n;
+        for (i = 0; i < n; ++i)
+            if (!known[d - n + i])
+                break;
+        if (i < n) {
+            calc_number_t k;
+
+            k.i = j;
+            code = calc_emit(cc, CI_roll, d - n, n, &k);
+            if (code < 0)
+                return code;
+        }
+        memcpy(tv, &vs[d - n], n * sizeof(*vs));
+        memcpy(tk, &known[d - n], n * sizeof(*known));
+        for (i = 0; i < n; ++i) {
+            vs[d - n + (i + j) % n] = tv[i];
+            known[d - n + (i + j) % n] = tk[i];
+        }
+        return 0;
+    }
+
+        /* Unary operators */
+
+    case PtCr_abs: cop = CI_abs; goto unary;
+    case PtCr_ceiling: cop = CI_ceiling; goto unary;
+    case PtCr_cos: cop = CI_cos; goto unary;
+    case PtCr_cvi: cop = CI_cvi; goto unary;
+    case PtCr_floor: cop = CI_floor; goto unary;
+    case PtCr_ln: cop = CI_ln; goto unary;
+    case PtCr_log: cop = CI_log; goto unary;
+    case PtCr_neg: cop = CI_neg; goto unary;
+    case PtCr_not: cop = CI_not; goto unary;
+    case PtCr_round: cop = CI_round; goto unary;
+    case PtCr_sin: cop = CI_sin; goto unary;
+    case PtCr_sqrt: cop = CI_sqrt; goto unary;
+    case PtCr_truncate: cop = CI_truncate;
+    unary:
+        code = calc_materialize(cc, d - 1);
+        if (code >= 0)
+            code = calc_emit(cc, cop, d - 1, 0, NULL);
+        if (cop == CI_cvi)
+            vs[d - 1].type = CVT_INT;
+        return code;
+
+        /* Binary operators */
+
+    case PtCr_add:
+        cop = CI_add, kop = CI_add_k;
+        goto commutative;
+    case PtCr_mul:
+        cop = CI_mul, kop = CI_mul_k;
+    commutative:
+        if (known[d - 1])
+            goto immediate;
+        if (known[d - 2]) {
+            code = calc_emit(cc, kop, d - 2, d - 1, &vs[d - 2].value);
+            goto imm_done;
+        }
+        goto binary;
+    case PtCr_sub:
+        cop = CI_sub, kop = CI_sub_k;
+        if (known[d - 1])
+            goto immediate;
+        if (known[d - 2]) {
+            code = calc_emit(cc, CI_rsub_k, d - 2, d - 1, &vs[d - 2].value);
+            goto imm_done;
+        }
+        goto binary;
+    case PtCr_div:
+        cop = CI_div, kop = CI_div_k;
+        if (known[d - 1] && vs[d - 1].value.f != 0)
+            goto immediate;
+        goto binary;
+    case PtCr_and: cop = CI_and; goto binary;
+    case PtCr_atan: cop = CI_atan; goto binary;
+    case PtCr_bitshift: cop = CI_bitshift; goto binary;
+    case PtCr_exp: cop = CI_exp; goto binary;
+    case PtCr_idiv: cop = CI_idiv; goto binary;
+    case PtCr_mod: cop = CI_mod; goto binary;
+    case PtCr_or: cop = CI_or; goto binary;
+    case PtCr_xor: cop = CI_xor; goto binary;
+    case PtCr_eq: cop = CI_eq; goto binary;
+    case PtCr_ge: cop = CI_ge; goto binary;
+    case PtCr_gt: cop = CI_gt; goto binary;
+    case PtCr_le: cop = CI_le; goto binary;
+    case PtCr_lt: cop = CI_lt; goto binary;
+    case PtCr_ne: cop = CI_ne; goto binary;
+    case PtCr_eq_int: cop = CI_eq_int; goto binary;
+    case PtCr_ge_int: cop = CI_ge_int; goto binary;
+    case PtCr_gt_int: cop = CI_gt_int; goto binary;
+    case PtCr_le_int: cop = CI_le_int; goto binary;
+    case PtCr_lt_int: cop = CI_lt_int; goto binary;
+    case PtCr_ne_int: cop = CI_ne_int;
+    binary:
+        code = calc_materialize(cc, d - 2);
+        if (code >= 0)
+            code = calc_materialize(cc, d - 1);
+        if (code >= 0)
+            code = calc_emit(cc, cop, d - 2, 0, NULL);
+        if (cop >= CI_eq)
+            vs[d - 2].type = CVT_BOOL;
+        else if (cop == CI_bitshift || cop == CI_idiv || cop == CI_mod)
+            vs[d - 2].type = CVT_INT;
+        /* and, or and xor keep the type of their first operand */
+        cc->depth = d - 1;
+        return code;
+    immediate:
+        code = calc_emit(cc, kop, d - 2, d - 2, &vs[d - 1].value);
+    imm_done:
+        known[d - 2] = false;
+        cc->depth = d - 1;
+        return code;
+
+    default:
+        /*
+         * Type errors, and integer arithmetic, whose result type depends
+         * on whether it overflows.
+         */
+        return CALC_NOT_COMPILED;
+    }
+}
+
+/* Compile the operation string of a function into cc->code. */
+static int
+calc_compile_ops(calc_compiler_t *cc, const gs_function_PtCr_params_t *params)
+{
+    const byte *ops = params->ops.data;
+    const byte *p = ops;
+    int code, s;
+
+    cc->depth = params->m;
+    for (s = 0; s < params->m; ++s) {
+        cc->stack[s].type = CVT_FLOAT;
+        cc->known[s] = false;
+    }
+    for (;;) {
+        uint offset = p - ops;
+        gs_PtCr_opcode_t op = (gs_PtCr_opcode_t)*p;
+        calc_value_t *pv;
+        uint target;
+
+        code = calc_merge(cc, offset);
+        if (code != 0)
+            return code;
+        if (op == PtCr_return)
+            break;
+        if (cc->depth < 0) {		/* skip unreachable code */
+            switch (op) {
+            case PtCr_byte: p += 2; break;
+            case PtCr_int: p += 1 + sizeof(int); break;
+            case PtCr_float: p += 1 + sizeof(float); break;
+            case PtCr_if: case PtCr_else: p += 3; break;
+            case PtCr_repeat: case PtCr_repeat_end:
+                return CALC_NOT_COMPILED;
+            default: ++p;
+            }
+            continue;
+        }
+        pv = &cc->stack[cc->depth];
+        switch (op) {
+        case PtCr_byte:
+            pv->type = CVT_INT, pv->value.i = p[1];
+            p += 2;
+            goto push;
+        case PtCr_int:
+            pv->type = CVT_INT;
+            memcpy(&pv->value.i, p + 1, sizeof(int));
+            p += 1 + sizeof(int);
+            goto push;
+        case PtCr_float:
+            pv->type = CVT_FLOAT;
+            memcpy(&pv->value.f, p + 1, sizeof(float));
+            p += 1 + sizeof(float);
+            goto push;
+        case PtCr_true:
+        case PtCr_false:
+            pv->type = CVT_BOOL, pv->value.i = (op == PtCr_true);
+            ++p;
+        push:
+            if (cc->depth + 1 >= MAX_VSTACK)
+                return CALC_NOT_COMPILED;
+            cc->known[cc->depth++] = true;
+            continue;
+        case PtCr_if:
+            if (cc->depth == 0 || pv[-1].type != CVT_BOOL)
+                return CALC_NOT_COMPILED;
+            target = offset + 3 + (p[1] << 8) + p[2];
+            p += 3;
+            if (cc->known[--(cc->depth)]) {
+                if (pv[-1].value.i)
+                    continue;		/* execute the body */
+                code = calc_materialize_all(cc);
+                if (code < 0)
+                    return code;
+                code = calc_add_pending(cc, target, -1);
+                cc->depth = -1;
+            } else {
+                code = calc_materialize_all(cc);
+                if (code < 0)
+                    return code;
+                code = calc_emit(cc, CI_jz, cc->depth, 0, NULL);
+                if (code < 0)
+                    return code;
+                code = calc_add_pending(cc, target, cc->count - 1);
+            }
+            if (code != 0)
+                return code;
+            continue;
+        case PtCr_else:
+            target = offset + 3 + (p[1] << 8) + p[2];
+            p += 3;
+            code = calc_materialize_all(cc);
+            if (code < 0)
+                return code;
+            code = calc_emit(cc, CI_jmp, 0, 0, NULL);
+            if (code < 0)
+                return code;
+            code = calc_add_pending(cc, target, cc->count - 1);
+            if (code != 0)
+                return code;
+            cc->depth = -1;
+            continue;
+        case PtCr_repeat:
+        case PtCr_repeat_end:
+            return CALC_NOT_COMPILED;
+        default:
+            code = calc_compile_op(cc, op);
+            if (code != 0)
+                return code;
+            ++p;
+        }
+    }
+    /* The results must all be numbers, converted to floats. */
+    if (cc->num_pending != 0 || cc->depth != params->n)
+        return CALC_NOT_COMPILED;
+    for (s = 0; s < params->n; ++s)
+        switch (cc->stack[s].type) {
+        case CVT_INT:
+            code = calc_coerce(cc, s);
+            if (code < 0)
+                return code;
+        case CVT_FLOAT:
+            break;
+        default:
+            return CALC_NOT_COMPILED;
+        }
+    code = calc_materialize_all(cc);
+    if (code < 0)
+        return code;
+    return calc_emit(cc, CI_return, 0, 0, NULL);
+}
+
+/*
+ * Compile a function, setting pfn->code, or leaving it 0 if the function
+ * must be interpreted.  Only VMerror is reported.
+ */
+static int
+calc_compile(gs_function_PtCr_t *pfn, gs_memory_t *mem)
+{
+    calc_compiler_t *cc;
+    int code;
+
+    pfn->code = 0;
+    cc = (calc_compiler_t *)gs_alloc_bytes(mem->non_gc_memory,
+                                           sizeof(*cc), "calc_compile");
+    if (cc == 0)
+        return_error(gs_error_VMerror);
+    cc->memory = mem->non_gc_memory;
+    cc->code = 0;
+    cc->count = cc->size = 0;
+    cc->num_pending = 0;
+    code = calc_compile_ops(cc, &pfn->params);
+    if (code == 0) {
+        pfn->code = (calc_insn_t *)
+            gs_alloc_byte_array(mem, cc->count, sizeof(calc_insn_t),
+                                "calc_compile(code)");
+        if (pfn->code == 0)
+            code = gs_note_error(gs_error_VMerror);
+        else
+            memcpy(pfn->code, cc->code, cc->count * sizeof(calc_insn_t));
+    }
+    gs_free_object(cc->memory, cc->code, "calc_compile");
+    gs_free_object(cc->memory, cc, "calc_compile");
+    return (code < 0 ? code : 0);
+}
+
 /* Make a scaled copy of a PostScript Calculator function. */
 static int
 fn_PtCr_make_scaled(const gs_function_PtCr_t *pfn, gs_function_PtCr_t **ppsfn,
@@ -746,6 +1628,7 @@ fn_PtCr_make_scaled(const gs_function_PtCr_t *pfn, gs_function_PtCr_t **ppsfn,
         gs_free_object(mem, psfn, "fn_PtCr_make_scaled");
         return_error(gs_error_VMerror);
     }
+    psfn->code = 0;
     psfn->params = pfn->params;
     psfn->params.ops.data = ops;
     psfn->params.ops.size = opsize;
@@ -784,10 +1667,25 @@ fn_PtCr_make_scaled(const gs_function_PtCr_t *pfn, gs_function_PtCr_t **ppsfn,
     psfn->params.ops.data =
         gs_resize_string(mem, ops, opsize, psfn->params.ops.size,
                          "fn_PtCr_make_scaled");
+    code = calc_compile(psfn, mem);
+    if (code < 0) {
+        gs_function_free((gs_function_t *)psfn, true, mem);
+        return code;
+    }
     *ppsfn = psfn;
     return 0;
 }
 
+/* Free a PostScript Calculator function. */
+static void
+fn_PtCr_free(gs_function_t * pfn_common, bool free_params, gs_memory_t * mem)
+{
+    gs_function_PtCr_t *const pfn = (gs_function_PtCr_t *)pfn_common;
+
+    gs_free_object(mem, pfn->code, "fn_PtCr_free(code)");
+    fn_common_free(pfn_common, free_params, mem);
+}
+
 /* Free the parameters of a PostScript Calculator function. */
 void
 gs_function_PtCr_free_params(gs_function_PtCr_params_t * params, gs_memory_t * mem)
@@ -826,7 +1724,7 @@ gs_function_PtCr_init(gs_function_t ** ppfn,
             fn_common_get_params,
             (fn_make_scaled_proc_t) fn_PtCr_make_scaled,
             (fn_free_params_proc_t) gs_function_PtCr_free_params,
-            fn_common_free,
+            fn_PtCr_free,
             (fn_serialize_proc_t) gs_function_PtCr_serialize,
         }
     };
@@ -884,6 +1782,11 @@ gs_function_PtCr_init(gs_function_t ** ppfn,
         data_source_init_string2(&pfn->data_source, NULL, 0);
         pfn->data_source.access = calc_access;
         pfn->head = function_PtCr_head;
+        code = calc_compile(pfn, mem);
+        if (code < 0) {
+            gs_free_object(mem, pfn, "gs_function_PtCr_init");
+            return code;
+        }
         *ppfn = (gs_function_t *) pfn;
     }
     return 0;
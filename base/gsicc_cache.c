@@ -42,9 +42,14 @@
          *  We will likely want to do at least have an estimate of the
          *  memory used based upon how the CMS is configured.
          *  This will be done later.  For now, just limit the number
-         *  of links.
+         *  of links.  The limit is soft: if every link in the cache
+         *  is in use, a new one is added anyway rather than waiting.
          */
-#define ICC_CACHE_MAXLINKS 50
+#ifndef ICC_CACHE_MAXLINKS
+#  define ICC_CACHE_MAXLINKS 50
+#endif
+/* Initial size of the hash table, must be a power of 2 */
+#define ICC_CACHE_TABLE_SIZE 128
 
 /* Static prototypes */
 
@@ -59,7 +64,7 @@ static int gsicc_compute_linkhash(gsicc_manager_t *icc_manager, gx_device *dev,
                                   gsicc_rendering_param_t *rendering_params,
                                   gsicc_hashlink_t *hash);
 
-static gsicc_link_t* gsicc_find_zeroref_cache(gsicc_link_cache_t *icc_link_cache);
+static int gsicc_find_zeroref_cache(gsicc_link_cache_t *icc_link_cache);
 
 static void gsicc_remove_link(gsicc_link_t *link, const gs_memory_t *memory);
 
@@ -71,15 +76,34 @@ static void rc_gsicc_link_cache_free(gs_memory_t * mem, void *ptr_in, client_nam
 
 struct_proc_finalize(icc_link_finalize);
 
-gs_private_st_ptrs3_final(st_icc_link, gsicc_link_t, "gsiccmanage_link",
+gs_private_st_ptrs2_final(st_icc_link, gsicc_link_t, "gsiccmanage_link",
                     icc_link_enum_ptrs, icc_link_reloc_ptrs, icc_link_finalize,
-                    icc_link_cache, next, lock);
+                    icc_link_cache, lock);
+
+/* The hash table itself is not in gc memory, the links in it are */
+static
+ENUM_PTRS_WITH(icc_linkcache_enum_ptrs, gsicc_link_cache_t *link_cache)
+{
+    index -= 1;
+    if (index < link_cache->table_size)
+        ENUM_RETURN(link_cache->table[index]);
+    return 0;
+}
+case 0: ENUM_RETURN(link_cache->lock);
+ENUM_PTRS_END
+
+static RELOC_PTRS_WITH(icc_linkcache_reloc_ptrs, gsicc_link_cache_t *link_cache)
+{
+    uint i;
 
-struct_proc_finalize(icc_linkcache_finalize);
+    RELOC_PTR(gsicc_link_cache_t, lock);
+    for (i = 0; i < link_cache->table_size; i++)
+        RELOC_PTR(gsicc_link_cache_t, table[i]);
+}
+RELOC_PTRS_END
 
-gs_private_st_ptrs2_final(st_icc_linkcache, gsicc_link_cache_t, "gsiccmanage_linkcache",
-                    icc_linkcache_enum_ptrs, icc_linkcache_reloc_ptrs, icc_linkcache_finalize,
-                    head, lock);
+gs_private_st_composite_final(st_icc_linkcache, gsicc_link_cache_t, "gsiccmanage_linkcache",
+                    icc_linkcache_enum_ptrs, icc_linkcache_reloc_ptrs, icc_linkcache_finalize);
 
 /* These are used to construct a hash for the ICC link based upon the
    render parameters */
@@ -104,6 +128,11 @@ gsicc_cache_new(gs_memory_t *memory)
                              "gsicc_cache_new");
     if ( result == NULL )
         return(NULL);
+    result->table = NULL;
+    result->table_size = 0;
+    result->num_links = 0;
+    result->memory = memory->stable_memory;
+    rc_init_free(result, memory->stable_memory, 1, rc_gsicc_link_cache_free);
 #ifdef MEMENTO_SQUEEZE_BUILD
     result->lock = NULL;
 #else
@@ -114,10 +143,20 @@ gsicc_cache_new(gs_memory_t *memory)
         return(NULL);
     }
 #endif
-    rc_init_free(result, memory->stable_memory, 1, rc_gsicc_link_cache_free);
-    result->head = NULL;
-    result->num_links = 0;
-    result->memory = memory->stable_memory;
+    result->table = (gsicc_link_t **)gs_alloc_byte_array(memory->stable_memory->non_gc_memory,
+                             ICC_CACHE_TABLE_SIZE, sizeof(gsicc_link_t *),
+                             "gsicc_cache_new(table)");
+    if (result->table == NULL) {
+#ifndef MEMENTO_SQUEEZE_BUILD
+        gx_monitor_free(result->lock);
+        result->lock = NULL;
+#endif
+        gs_free_object(memory->stable_memory, result, "gsicc_cache_new");
+        return(NULL);
+    }
+    memset(result->table, 0, ICC_CACHE_TABLE_SIZE * sizeof(gsicc_link_t *));
+    result->table_size = ICC_CACHE_TABLE_SIZE;
+    result->hand = 0;
     if_debug2m(gs_debug_flag_icc, memory,
                "[icc] Allocating link cache = 0x%p memory = 0x%p\n", result,
                result->memory);
@@ -138,24 +177,36 @@ rc_gsicc_link_cache_free(gs_memory_t * mem, void *ptr_in, client_name_t cname)
 }
 
 /* release the monitor of the link_cache when it is freed */
-void
+static void
 icc_linkcache_finalize(const gs_memory_t *mem, void *ptr)
 {
     gsicc_link_cache_t *link_cache = (gsicc_link_cache_t * ) ptr;
+    uint i;
+
+    for (i = 0; link_cache->table != NULL && i < link_cache->table_size; i++) {
+        gsicc_link_t *link = link_cache->table[i];
 
-    while (link_cache->head != NULL) {
-        if (link_cache->head->ref_count != 0) {
+        if (link == NULL)
+            continue;
+        if (link->ref_count != 0) {
             emprintf2(mem, "link at 0x%p being removed, but has ref_count = %d\n",
-                      link_cache->head, link_cache->head->ref_count);
-            link_cache->head->ref_count = 0;	/* force removal */
+                      link, link->ref_count);
         }
-        gsicc_remove_link(link_cache->head, mem);
+        link_cache->table[i] = NULL;
+        link_cache->num_links--;
+        gsicc_link_free(link, mem);
     }
 #ifdef DEBUG
     if (link_cache->num_links != 0) {
         emprintf1(mem, "num_links is %d, should be 0.\n", link_cache->num_links);
     }
 #endif
+    if (link_cache->table != NULL) {
+        gs_free_object(link_cache->memory->non_gc_memory, link_cache->table,
+                       "icc_linkcache_finalize");
+        link_cache->table = NULL;
+        link_cache->table_size = 0;
+    }
     if (link_cache->rc.ref_count == 0) {
 #ifndef MEMENTO_SQUEEZE_BUILD
         gx_monitor_free(link_cache->lock);
@@ -195,7 +246,6 @@ gsicc_alloc_link_dev(gs_memory_t *memory, cmm_profile_t *src_profile,
     result->orig_procs.map_buffer = NULL;
     result->orig_procs.map_color = NULL;
     result->orig_procs.free_link = NULL;
-    result->next = NULL;
     result->link_handle = NULL;
     result->icc_link_cache = NULL;
     result->procs.map_buffer = gscms_transform_color_buffer;
@@ -210,6 +260,12 @@ gsicc_alloc_link_dev(gs_memory_t *memory, cmm_profile_t *src_profile,
     result->includes_devlink = 0;
     result->is_identity = false;
     result->valid = true;
+    result->referenced = false;
+    result->color_memo_size = 0;
+    result->color_memo = NULL;
+    result->image_grid = false;
+    result->image_lut = NULL;
+    result->image_lut_pixels = 0;
     result->memory = memory->stable_memory;
 
     if_debug2m('^', result->memory, "[^]%s 0x%lx init = 1\n",
@@ -287,7 +343,6 @@ gsicc_alloc_link(gs_memory_t *memory, gsicc_hashlink_t hashcode)
     result->orig_procs.map_buffer = NULL;
     result->orig_procs.map_color = NULL;
     result->orig_procs.free_link = NULL;
-    result->next = NULL;
     result->link_handle = NULL;
     result->procs.map_buffer = gscms_transform_color_buffer;
     result->procs.map_color = gscms_transform_color;
@@ -301,6 +356,12 @@ gsicc_alloc_link(gs_memory_t *memory, gsicc_hashlink_t hashcode)
     result->includes_devlink = 0;
     result->is_identity = false;
     result->valid = false;		/* not yet complete */
+    result->referenced = true;
+    result->color_memo_size = 0;
+    result->color_memo = NULL;
+    result->image_grid = false;
+    result->image_lut = NULL;
+    result->image_lut_pixels = 0;
     result->memory = memory->stable_memory;
 
     if_debug2m('^', result->memory, "[^]%s 0x%lx init = 1\n",
@@ -345,9 +406,507 @@ gsicc_set_link_data(gsicc_link_t *icc_link, void *link_handle,
 #endif
 }
 
+/* Memo of single color transforms.  Office documents use few distinct
+   colors for many fills, so remembering the last results for each link
+   saves most of the calls into the CMS.  Each memo is direct mapped on a
+   hash of the input color.  The clist rendering threads share the link
+   cache, so each thread has a memo of its own on the link, found by the
+   allocator of the device it is drawing to (each rendering thread has its
+   own chunk allocator).  The entries need no locking then; the link's lock
+   is only taken to add a memo to its list.  Readers walk the list without
+   it, as for the lcms2mt link handles, so a memo is never taken off the
+   list until the link is freed.  When a rendering thread ends its memos are
+   given up (see gsicc_cache_release_color_memos) for the next thread. */
+#define GSICC_COLOR_MEMO_MAX_OWNERS 16
+
+struct gsicc_color_memo_s {
+    const gs_memory_t *owner;	/* allocator of the thread using it, or NULL */
+    gsicc_color_memo_t *next;
+    int size;			/* number of entries, a power of 2 */
+    int num_in;
+    int num_out;
+    int stride;			/* entry: in use flag, input, output */
+    ulong hits;
+    ulong misses;
+    unsigned short data[1];	/* size * stride values */
+};
+
+static uint
+gsicc_color_memo_hash(const unsigned short *input, int num_in)
+{
+    uint hash = 0x811c9dc5;
+    int k;
+
+    for (k = 0; k < num_in; k++)
+        hash = (hash ^ input[k]) * 0x01000193;
+    return hash ^ (hash >> 16);
+}
+
+static gsicc_color_memo_t *
+gsicc_color_memo_alloc(gsicc_link_t *link)
+{
+    gs_memory_t *mem = link->memory->non_gc_memory;
+    gsicc_color_memo_t *memo;
+    int size = 1;
+    int stride = 1 + link->num_input + link->num_output;
+
+    if (link->num_input <= 0 || link->num_input > GS_CLIENT_COLOR_MAX_COMPONENTS ||
+        link->num_output <= 0 || link->num_output > GS_CLIENT_COLOR_MAX_COMPONENTS)
+        return NULL;
+    while (size < link->color_memo_size)
+        size <<= 1;
+    memo = (gsicc_color_memo_t *)gs_alloc_bytes(mem, sizeof(gsicc_color_memo_t) +
+                      (size * stride - 1) * sizeof(unsigned short), "gsicc_color_memo_alloc");
+    if (memo == NULL)
+        return NULL;
+    memo->owner = NULL;
+    memo->next = NULL;
+    memo->size = size;
+    memo->num_in = link->num_input;
+    memo->num_out = link->num_output;
+    memo->stride = stride;
+    memo->hits = memo->misses = 0;
+    memset(memo->data, 0, size * stride * sizeof(unsigned short));
+    return memo;
+}
+
+/* Get the memo for the thread drawing to dev, making it on first use.
+   Returns NULL if there is to be no memo. */
+gsicc_color_memo_t *
+gsicc_color_memo_get(gsicc_link_t *link, const gx_device *dev)
+{
+    gsicc_color_memo_t *memo;
+    const gs_memory_t *owner;
+    int count = 0;
+
+    if (link->color_memo_size <= 0 || dev == NULL || dev->memory == NULL)
+        return NULL;
+    owner = dev->memory;
+    for (memo = link->color_memo; memo != NULL; memo = memo->next)
+        if (memo->owner == owner)
+            return memo;
+
+#ifndef MEMENTO_SQUEEZE_BUILD
+    gx_monitor_enter(link->lock);
+#endif
+    for (memo = link->color_memo; memo != NULL; memo = memo->next, count++)
+        if (memo->owner == NULL)
+            break;
+    if (memo == NULL && count < GSICC_COLOR_MEMO_MAX_OWNERS) {
+        memo = gsicc_color_memo_alloc(link);
+        if (memo != NULL) {
+            memo->next = link->color_memo;
+            link->color_memo = memo;
+        }
+    }
+    if (memo != NULL)
+        memo->owner = owner;
+#ifndef MEMENTO_SQUEEZE_BUILD
+    gx_monitor_leave(link->lock);
+#endif
+    return memo;
+}
+
+/* Look up a 16 bit color.  Returns true, with the output filled in, on a hit */
+bool
+gsicc_color_memo_lookup(gsicc_color_memo_t *memo, const unsigned short *input,
+                        unsigned short *output)
+{
+    const unsigned short *entry;
+
+    if (memo == NULL)
+        return false;
+    entry = memo->data + (gsicc_color_memo_hash(input, memo->num_in) & (memo->size - 1)) * memo->stride;
+    if (entry[0] && memcmp(entry + 1, input, memo->num_in * sizeof(unsigned short)) == 0) {
+        memcpy(output, entry + 1 + memo->num_in, memo->num_out * sizeof(unsigned short));
+        memo->hits++;
+        return true;
+    }
+    memo->misses++;
+    return false;
+}
+
+/* Remember the result of transforming a 16 bit color */
+void
+gsicc_color_memo_store(gsicc_color_memo_t *memo, const unsigned short *input,
+                       const unsigned short *output)
+{
+    unsigned short *entry;
+
+    if (memo == NULL)
+        return;
+    entry = memo->data + (gsicc_color_memo_hash(input, memo->num_in) & (memo->size - 1)) * memo->stride;
+    entry[0] = 1;
+    memcpy(entry + 1, input, memo->num_in * sizeof(unsigned short));
+    memcpy(entry + 1 + memo->num_in, output, memo->num_out * sizeof(unsigned short));
+}
+
+/* Give up the memos of the links in the cache that were used by the
+   thread with allocator owner, which is going away.  The entries are still
+   good for the link, so the next thread to want one keeps them. */
+void
+gsicc_cache_release_color_memos(gsicc_link_cache_t *cache, const gs_memory_t *owner)
+{
+    gsicc_color_memo_t *memo;
+    uint i;
+
+    if (cache == NULL || owner == NULL)
+        return;
+#ifndef MEMENTO_SQUEEZE_BUILD
+    gx_monitor_enter(cache->lock);
+#endif
+    for (i = 0; cache->table != NULL && i < cache->table_size; i++) {
+        gsicc_link_t *link = cache->table[i];
+
+        if (link == NULL || !link->valid)
+            continue;
+#ifndef MEMENTO_SQUEEZE_BUILD
+        gx_monitor_enter(link->lock);
+#endif
+        for (memo = link->color_memo; memo != NULL; memo = memo->next)
+            if (memo->owner == owner)
+                memo->owner = NULL;
+#ifndef MEMENTO_SQUEEZE_BUILD
+        gx_monitor_leave(link->lock);
+#endif
+    }
+#ifndef MEMENTO_SQUEEZE_BUILD
+    gx_monitor_leave(cache->lock);
+#endif
+}
+
+/* Grid for 8 bit image data.  Photographic images push millions of 8 bit
+   pixels through a handful of links, so for the common gray, RGB and CMYK
+   sources the link is sampled once into a 16 bit grid and rows are then
+   interpolated here rather than going through the CMS's generic
+   formatters: linearly for one input, tetrahedrally for three and
+   tetrahedrally plus linearly in the first channel for four, which is
+   what lcms does with its own precalculated grids.  The grid sizes follow
+   ColorAccuracy.  The per channel tables give, for each 8 bit input value,
+   the offset of the grid cell below it and the position within the cell,
+   so the inner loops are integer only.
+
+   The grid and the CMS sample at different points, so results can differ
+   from the CMS's by a level.  The grid is therefore only used when the
+   device sets ICCImageGrid. */
+#define IMAGE_LUT_FRAC_BITS 12
+#define IMAGE_LUT_FRAC_ONE (1 << IMAGE_LUT_FRAC_BITS)
+#define IMAGE_LUT_ROUND(x) (((x) + (IMAGE_LUT_FRAC_ONE >> 1)) >> IMAGE_LUT_FRAC_BITS)
+/* Same rounding from 16 to 8 bits as lcms */
+#define IMAGE_LUT_TO_8(x) ((byte)((((uint)(x)) * 65281U + 8388608U) >> 24))
+
+struct gsicc_image_lut_s {
+    int num_in;
+    int num_out;
+    int grid_points;		/* per input channel */
+    int stride[4];		/* grid samples between neighbours per channel */
+    int offset[4][256];		/* grid offset of the cell below the value */
+    int frac[4][256];		/* position in the cell, 0 to IMAGE_LUT_FRAC_ONE */
+    unsigned short grid[1];	/* grid_points^num_in entries of num_out */
+};
+
+static int
+gsicc_image_lut_grid_points(int num_in, gs_memory_t *mem)
+{
+    int accuracy = gsicc_currentcoloraccuracy(mem);
+
+    if (num_in == 1)
+        return 256;		/* exact */
+    if (num_in == 3)
+        return accuracy == 0 ? 17 : (accuracy == 1 ? 33 : 49);
+    return accuracy == 0 ? 11 : (accuracy == 1 ? 17 : 23);
+}
+
+/* Sample the link.  Called with the link locked. */
+static gsicc_image_lut_t *
+gsicc_image_lut_build(gx_device *dev, gsicc_link_t *icclink)
+{
+    gs_memory_t *mem = icclink->memory->non_gc_memory;
+    int num_in = icclink->num_input;
+    int num_out = icclink->num_output;
+    int n = gsicc_image_lut_grid_points(num_in, icclink->memory);
+    int num_rows = 1, k, j, i, c;
+    gsicc_image_lut_t *lut;
+    unsigned short *in_row, *out, *pos;
+    unsigned short levels[256];
+    gsicc_bufferdesc_t input_buff_desc;
+    gsicc_bufferdesc_t output_buff_desc;
+    int code;
+
+    for (k = 1; k < num_in; k++)
+        num_rows *= n;
+    lut = (gsicc_image_lut_t *)gs_alloc_bytes(mem, sizeof(gsicc_image_lut_t) +
+                      ((size_t)num_rows * n * num_out - 1) * sizeof(unsigned short),
+                      "gsicc_image_lut_build");
+    in_row = (unsigned short *)gs_alloc_bytes(mem, n * num_in * sizeof(unsigned short),
+                                              "gsicc_image_lut_build");
+    if (lut == NULL || in_row == NULL) {
+        gs_free_object(mem, lut, "gsicc_image_lut_build");
+        gs_free_object(mem, in_row, "gsicc_image_lut_build");
+        return NULL;
+    }
+    lut->num_in = num_in;
+    lut->num_out = num_out;
+    lut->grid_points = n;
+    for (k = 0; k < n; k++)
+        levels[k] = (k * 65535 + (n - 1) / 2) / (n - 1);
+    /* Channel 0 varies slowest */
+    for (c = num_in - 1, j = num_out; c >= 0; c--, j *= n)
+        lut->stride[c] = j;
+    for (c = 0; c < num_in; c++) {
+        for (k = 0; k < 256; k++) {
+            int p = k * (n - 1);
+            int cell = p / 255;
+
+            if (cell == n - 1)
+                cell--;		/* k == 255: top of the last cell */
+            lut->offset[c][k] = cell * lut->stride[c];
+            lut->frac[c][k] = ((p - cell * 255) * IMAGE_LUT_FRAC_ONE + 127) / 255;
+        }
+    }
+    /* One call to the CMS per row of the grid along the last channel */
+    gsicc_init_buffer(&input_buff_desc, num_in, 2, false, false, false, 0,
+                      n * num_in * 2, 1, n);
+    gsicc_init_buffer(&output_buff_desc, num_out, 2, false, false, false, 0,
+                      n * num_out * 2, 1, n);
+    out = lut->grid;
+    for (j = 0; j < num_rows; j++) {
+        int index = j;
+        unsigned short fixed[3];
+
+        for (c = num_in - 2; c >= 0; c--) {
+            fixed[c] = levels[index % n];
+            index /= n;
+        }
+        for (i = 0, pos = in_row; i < n; i++) {
+            for (c = 0; c < num_in - 1; c++)
+                *pos++ = fixed[c];
+            *pos++ = levels[i];
+        }
+        code = (icclink->procs.map_buffer)(dev, icclink, &input_buff_desc,
+                                           &output_buff_desc, in_row, out);
+        if (code < 0) {
+            gs_free_object(mem, lut, "gsicc_image_lut_build");
+            lut = NULL;
+            break;
+        }
+        out += n * num_out;
+    }
+    gs_free_object(mem, in_row, "gsicc_image_lut_build");
+    return lut;
+}
+
+static void
+gsicc_image_lut_row1(const gsicc_image_lut_t *lut, const byte *in, byte *out,
+                     int num_pixels)
+{
+    int num_out = lut->num_out;
+    int s0 = lut->stride[0];
+    int k, c;
+
+    for (k = 0; k < num_pixels; k++, in++) {
+        const unsigned short *g = lut->grid + lut->offset[0][in[0]];
+        int f = lut->frac[0][in[0]];
+
+        for (c = 0; c < num_out; c++, g++)
+            *out++ = IMAGE_LUT_TO_8(g[0] + IMAGE_LUT_ROUND((g[s0] - g[0]) * f));
+    }
+}
+
+/* Tetrahedral interpolation in the cell at g, returned at 16 bits */
+static inline void
+gsicc_image_lut_tetra(const unsigned short *g, int num_out, int s0, int s1, int s2,
+                      int f0, int f1, int f2, int *res)
+{
+    int a, b, c, fa, fb, fc, k;
+
+    /* Walk from the low corner along the channels in order of decreasing
+       fraction; a, b, c are the grid offsets of the three steps */
+    if (f0 >= f1) {
+        if (f1 >= f2) {
+            a = s0; b = s1; c = s2; fa = f0; fb = f1; fc = f2;
+        } else if (f0 >= f2) {
+            a = s0; b = s2; c = s1; fa = f0; fb = f2; fc = f1;
+        } else {
+            a = s2; b = s0; c = s1; fa = f2; fb = f0; fc = f1;
+        }
+    } else {
+        if (f0 >= f2) {
+            a = s1; b = s0; c = s2; fa = f1; fb = f0; fc = f2;
+        } else if (f1 >= f2) {
+            a = s1; b = s2; c = s0; fa = f1; fb = f2; fc = f0;
+        } else {
+            a = s2; b = s1; c = s0; fa = f2; fb = f1; fc = f0;
+        }
+    }
+    b += a;
+    c += b;
+    for (k = 0; k < num_out; k++, g++) {
+        int v0 = g[0];
+
+        res[k] = v0 + IMAGE_LUT_ROUND((g[a] - v0) * fa + (g[b] - g[a]) * fb +
+                                      (g[c] - g[b]) * fc);
+    }
+}
+
+static void
+gsicc_image_lut_row3(const gsicc_image_lut_t *lut, const byte *in, byte *out,
+                     int num_pixels)
+{
+    int num_out = lut->num_out;
+    int res[GS_CLIENT_COLOR_MAX_COMPONENTS];
+    int k, c;
+
+    for (k = 0; k < num_pixels; k++, in += 3) {
+        const unsigned short *g = lut->grid + lut->offset[0][in[0]] +
+            lut->offset[1][in[1]] + lut->offset[2][in[2]];
+
+        gsicc_image_lut_tetra(g, num_out, lut->stride[0], lut->stride[1],
+                              lut->stride[2], lut->frac[0][in[0]],
+                              lut->frac[1][in[1]], lut->frac[2][in[2]], res);
+        for (c = 0; c < num_out; c++)
+            *out++ = IMAGE_LUT_TO_8(res[c]);
+    }
+}
+
+static void
+gsicc_image_lut_row4(const gsicc_image_lut_t *lut, const byte *in, byte *out,
+                     int num_pixels)
+{
+    int num_out = lut->num_out;
+    int s0 = lut->stride[0];
+    int res0[GS_CLIENT_COLOR_MAX_COMPONENTS];
+    int res1[GS_CLIENT_COLOR_MAX_COMPONENTS];
+    int k, c;
+
+    for (k = 0; k < num_pixels; k++, in += 4) {
+        const unsigned short *g = lut->grid + lut->offset[0][in[0]] +
+            lut->offset[1][in[1]] + lut->offset[2][in[2]] + lut->offset[3][in[3]];
+        int f0 = lut->frac[0][in[0]];
+        int f1 = lut->frac[1][in[1]];
+        int f2 = lut->frac[2][in[2]];
+        int f3 = lut->frac[3][in[3]];
+
+        gsicc_image_lut_tetra(g, num_out, lut->stride[1], lut->stride[2],
+                              lut->stride[3], f1, f2, f3, res0);
+        if (f0 == 0) {
+            for (c = 0; c < num_out; c++)
+                *out++ = IMAGE_LUT_TO_8(res0[c]);
+        } else {
+            gsicc_image_lut_tetra(g + s0, num_out, lut->stride[1], lut->stride[2],
+                                  lut->stride[3], f1, f2, f3, res1);
+            for (c = 0; c < num_out; c++)
+                *out++ = IMAGE_LUT_TO_8(res0[c] +
+                                        IMAGE_LUT_ROUND((res1[c] - res0[c]) * f0));
+        }
+    }
+}
+
+static bool
+gsicc_image_lut_applies(const gsicc_link_t *icclink,
+                        const gsicc_bufferdesc_t *input_buff_desc,
+                        const gsicc_bufferdesc_t *output_buff_desc)
+{
+    int num_in = input_buff_desc->num_chan;
+
+    return icclink->procs.map_buffer == gscms_transform_color_buffer &&
+        !icclink->is_identity &&
+        input_buff_desc->bytes_per_chan == 1 && output_buff_desc->bytes_per_chan == 1 &&
+        !input_buff_desc->has_alpha && !output_buff_desc->has_alpha &&
+        !input_buff_desc->is_planar && !output_buff_desc->is_planar &&
+        (num_in == 1 || num_in == 3 || num_in == 4) && num_in == icclink->num_input &&
+        output_buff_desc->num_chan == icclink->num_output &&
+        icclink->num_output <= GS_CLIENT_COLOR_MAX_COMPONENTS;
+}
+
+/* Transform a buffer of image data.  If the device set ICCImageGrid, 8 bit
+   chunky data from gray, RGB and CMYK sources goes through the link's grid
+   once enough of it has been seen to pay for sampling the link.
+   Everything else, including links being monitored and links that don't
+   come from the CMS, goes to the link's map_buffer. */
+int
+gsicc_transform_image_buffer(gx_device *dev, gsicc_link_t *icclink,
+                             gsicc_bufferdesc_t *input_buff_desc,
+                             gsicc_bufferdesc_t *output_buff_desc,
+                             void *inputbuffer, void *outputbuffer)
+{
+    gsicc_image_lut_t *lut;
+    int num_pixels = input_buff_desc->pixels_per_row;
+    int j;
+
+    /* image_grid is set before the link is published, and never changes */
+    if (!icclink->image_grid ||
+        !gsicc_image_lut_applies(icclink, input_buff_desc, output_buff_desc))
+        return (icclink->procs.map_buffer)(dev, icclink, input_buff_desc,
+                                           output_buff_desc, inputbuffer,
+                                           outputbuffer);
+    /* The rendering threads share the link, so the grid pointer and the
+       pixel count are only touched under the link's lock.  The grid is
+       filled in before the pointer is stored, and the lock orders that
+       for any thread that later reads the pointer. */
+#ifndef MEMENTO_SQUEEZE_BUILD
+    gx_monitor_enter(icclink->lock);
+#endif
+    lut = icclink->image_lut;
+    if (lut == NULL && icclink->image_lut_pixels >= 0) {
+        int n = gsicc_image_lut_grid_points(icclink->num_input, icclink->memory);
+        int grid_size = n;
+
+        /* Only sample the link once it has seen about as many pixels as
+           there are grid points, small images are cheaper through the CMS. */
+        for (j = 1; j < icclink->num_input; j++)
+            grid_size *= n;
+        icclink->image_lut_pixels += num_pixels * input_buff_desc->num_rows;
+        if (icclink->image_lut_pixels >= grid_size) {
+            lut = icclink->image_lut = gsicc_image_lut_build(dev, icclink);
+            if (lut == NULL)
+                icclink->image_lut_pixels = -1;		/* don't try again */
+        }
+    }
+#ifndef MEMENTO_SQUEEZE_BUILD
+    gx_monitor_leave(icclink->lock);
+#endif
+    if (lut == NULL)
+        return (icclink->procs.map_buffer)(dev, icclink, input_buff_desc,
+                                           output_buff_desc, inputbuffer,
+                                           outputbuffer);
+    for (j = 0; j < input_buff_desc->num_rows; j++) {
+        const byte *in = (const byte *)inputbuffer + j * input_buff_desc->row_stride;
+        byte *out = (byte *)outputbuffer + j * output_buff_desc->row_stride;
+
+        switch (lut->num_in) {
+            case 1:
+                gsicc_image_lut_row1(lut, in, out, num_pixels);
+                break;
+            case 3:
+                gsicc_image_lut_row3(lut, in, out, num_pixels);
+                break;
+            default:
+                gsicc_image_lut_row4(lut, in, out, num_pixels);
+                break;
+        }
+    }
+    return 0;
+}
+
 static void
 gsicc_link_free_contents(gsicc_link_t *icc_link)
 {
+    while (icc_link->color_memo != NULL) {
+        gsicc_color_memo_t *memo = icc_link->color_memo;
+
+        if_debug3m(gs_debug_flag_icc, icc_link->memory,
+                   "[icc] Link 0x%p color memo: %lu hits, %lu misses\n",
+                   icc_link, memo->hits, memo->misses);
+        icc_link->color_memo = memo->next;
+        gs_free_object(icc_link->memory->non_gc_memory, memo,
+                       "gsicc_link_free_contents");
+    }
+    if (icc_link->image_lut != NULL) {
+        gs_free_object(icc_link->memory->non_gc_memory, icc_link->image_lut,
+                       "gsicc_link_free_contents");
+        icc_link->image_lut = NULL;
+    }
     icc_link->procs.free_link(icc_link);
 #ifndef MEMENTO_SQUEEZE_BUILD
     gx_monitor_free(icc_link->lock);
@@ -496,103 +1055,194 @@ gsicc_get_cspace_hash(gsicc_manager_t *icc_manager, gx_device *dev,
     return 0;
 }
 
-gsicc_link_t*
-gsicc_findcachelink(gsicc_hashlink_t hash, gsicc_link_cache_t *icc_link_cache,
-                    bool includes_proof, bool includes_devlink)
+/* Starting table index for a link hash code */
+static uint
+gsicc_cache_slot(const gsicc_link_cache_t *icc_link_cache, int64_t hashcode)
 {
-    gsicc_link_t *curr, *prev;
-    int64_t hashcode = hash.link_hashcode;
-
-    /* Look through the cache for the hashcode */
-#ifndef MEMENTO_SQUEEZE_BUILD
-    gx_monitor_enter(icc_link_cache->lock);
-#endif
+    /* The hash codes are derived from md5 sums, so the bits are well mixed */
+    return (uint)(hashcode ^ (hashcode >> 32)) & (icc_link_cache->table_size - 1);
+}
 
-    /* List scanning is fast, so we scan the entire list, this includes   */
-    /* links that are currently unused, but still in the cache (zero_ref) */
-    curr = icc_link_cache->head;
-    prev = NULL;
+/* Return the table index of the matching link, or -1 if there is none.
+   Cache lock must be held. */
+static int
+gsicc_cache_lookup(const gsicc_link_cache_t *icc_link_cache, int64_t hashcode,
+                   bool includes_proof, bool includes_devlink)
+{
+    uint mask = icc_link_cache->table_size - 1;
+    uint i = gsicc_cache_slot(icc_link_cache, hashcode);
+    gsicc_link_t *curr;
 
-    while (curr != NULL ) {
+    /* The table is never more than half full, so this terminates quickly */
+    while ((curr = icc_link_cache->table[i]) != NULL) {
         if (curr->hashcode.link_hashcode == hashcode &&
             includes_proof == curr->includes_softproof &&
-            includes_devlink == curr->includes_devlink) {
-            /* move this one to the front of the list hoping we will use it
-               again soon */
-            if (prev != NULL) {
-                /* if prev == NULL, curr is already the head */
-                prev->next = curr->next;
-                curr->next = icc_link_cache->head;
-                icc_link_cache->head = curr;
-            }
-            /* bump the ref_count since we will be using this one */
-            curr->ref_count++;
-            if_debug3m('^', curr->memory, "[^]%s 0x%lx ++ => %ld\n",
-                       "icclink", curr, curr->ref_count);
-            while (curr->valid == false) {
+            includes_devlink == curr->includes_devlink)
+            return i;
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+/* Double the size of the table.  Cache lock must be held. */
+static int
+gsicc_cache_grow(gsicc_link_cache_t *icc_link_cache)
+{
+    gs_memory_t *mem = icc_link_cache->memory->non_gc_memory;
+    gsicc_link_t **old_table = icc_link_cache->table;
+    uint old_size = icc_link_cache->table_size;
+    gsicc_link_t **new_table;
+    uint i, j;
+
+    new_table = (gsicc_link_t **)gs_alloc_byte_array(mem, old_size * 2,
+                                sizeof(gsicc_link_t *), "gsicc_cache_grow");
+    if (new_table == NULL)
+        return_error(gs_error_VMerror);
+    memset(new_table, 0, old_size * 2 * sizeof(gsicc_link_t *));
+    icc_link_cache->table = new_table;
+    icc_link_cache->table_size = old_size * 2;
+    icc_link_cache->hand = 0;
+    for (i = 0; i < old_size; i++) {
+        if (old_table[i] == NULL)
+            continue;
+        j = gsicc_cache_slot(icc_link_cache, old_table[i]->hashcode.link_hashcode);
+        while (new_table[j] != NULL)
+            j = (j + 1) & (icc_link_cache->table_size - 1);
+        new_table[j] = old_table[i];
+    }
+    gs_free_object(mem, old_table, "gsicc_cache_grow");
+    return 0;
+}
+
+/* Add a link to the table.  Cache lock must be held. */
+static int
+gsicc_cache_insert(gsicc_link_cache_t *icc_link_cache, gsicc_link_t *link)
+{
+    uint i;
+
+    if ((uint)(icc_link_cache->num_links + 1) * 2 > icc_link_cache->table_size) {
+        int code = gsicc_cache_grow(icc_link_cache);
+
+        if (code < 0)
+            return code;
+    }
+    i = gsicc_cache_slot(icc_link_cache, link->hashcode.link_hashcode);
+    while (icc_link_cache->table[i] != NULL)
+        i = (i + 1) & (icc_link_cache->table_size - 1);
+    icc_link_cache->table[i] = link;
+    icc_link_cache->num_links++;
+    return 0;
+}
+
+/* Remove the link at index i from the table, shifting back any entries
+   that would otherwise no longer be found.  Cache lock must be held. */
+static void
+gsicc_cache_delete(gsicc_link_cache_t *icc_link_cache, uint i)
+{
+    uint mask = icc_link_cache->table_size - 1;
+    uint j = i, k;
+
+    icc_link_cache->table[i] = NULL;
+    for (;;) {
+        j = (j + 1) & mask;
+        if (icc_link_cache->table[j] == NULL)
+            break;
+        k = gsicc_cache_slot(icc_link_cache,
+                             icc_link_cache->table[j]->hashcode.link_hashcode);
+        /* Leave the entry if its home slot lies cyclically in (i, j] */
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            continue;
+        icc_link_cache->table[i] = icc_link_cache->table[j];
+        icc_link_cache->table[j] = NULL;
+        i = j;
+    }
+    icc_link_cache->num_links--;
+}
+
+/* Wait for another thread to finish building a link */
+static void
+gsicc_link_wait_valid(gsicc_link_t *link)
+{
 #ifndef MEMENTO_SQUEEZE_BUILD
-                gx_monitor_leave(icc_link_cache->lock); /* exit to let other threads run briefly */
-                gx_monitor_enter(curr->lock);			/* wait until we can acquire the lock */
-                gx_monitor_leave(curr->lock);			/* it _should be valid now */
-                /* If it is still not valid, but we were able to lock, it means that the thread	*/
-                /* that was building it failed to be able to complete building it		*/
-                /* this is probably a fatal error. MV ???					*/
-                if (curr->valid == false) {
-                    emprintf1(curr->memory, "link 0x%p lock released, but still not valid.\n", curr);	/* Breakpoint here */
-                }
-                gx_monitor_enter(icc_link_cache->lock);	/* re-enter to loop and check */
+    while (link->valid == false) {
+        gx_monitor_enter(link->lock);			/* wait until we can acquire the lock */
+        gx_monitor_leave(link->lock);			/* it _should be valid now */
+        /* If it is still not valid, but we were able to lock, it means that the thread	*/
+        /* that was building it failed to be able to complete building it		*/
+        /* this is probably a fatal error. MV ???					*/
+        if (link->valid == false) {
+            emprintf1(link->memory, "link 0x%p lock released, but still not valid.\n", link);	/* Breakpoint here */
+        }
+    }
 #endif
-            }
+}
+
+gsicc_link_t*
+gsicc_findcachelink(gsicc_hashlink_t hash, gsicc_link_cache_t *icc_link_cache,
+                    bool includes_proof, bool includes_devlink)
+{
+    gsicc_link_t *curr = NULL;
+    bool valid = true;
+    int i;
+
+    /* Look through the cache for the hashcode. This includes links that */
+    /* are currently unused, but still in the cache (zero_ref)            */
 #ifndef MEMENTO_SQUEEZE_BUILD
-            gx_monitor_leave(icc_link_cache->lock);
+    gx_monitor_enter(icc_link_cache->lock);
 #endif
-            return(curr);	/* success */
-        }
-        prev = curr;
-        curr = curr->next;
+    i = gsicc_cache_lookup(icc_link_cache, hash.link_hashcode, includes_proof,
+                           includes_devlink);
+    if (i >= 0) {
+        curr = icc_link_cache->table[i];
+        /* bump the ref_count since we will be using this one, and note */
+        /* the use so that the eviction sweep passes it by next time    */
+        curr->ref_count++;
+        curr->referenced = true;
+        valid = curr->valid;
+        if_debug3m('^', curr->memory, "[^]%s 0x%lx ++ => %ld\n",
+                   "icclink", curr, curr->ref_count);
     }
 #ifndef MEMENTO_SQUEEZE_BUILD
     gx_monitor_leave(icc_link_cache->lock);
 #endif
-    return NULL;
+    if (!valid)
+        gsicc_link_wait_valid(curr);
+    return curr;
 }
 
-/* Find entry with zero ref count and remove it */
-/* lock the cache during this time for multi-threaded case */
-/* This may release links waiting for an icc_link_cache slot */
-static gsicc_link_t*
+/* Find an entry with zero ref count that has not been used since the */
+/* clock hand last passed it.  Returns its table index, or -1 if all  */
+/* entries are in use.  Cache lock must be held.                      */
+static int
 gsicc_find_zeroref_cache(gsicc_link_cache_t *icc_link_cache)
 {
-    gsicc_link_t *curr = NULL;
-
-    /* Look through the cache for first zero ref count */
-    /* when ref counts go to zero, the icc_link is moved to the */
-    /* end of the list, so the first we find is the 'oldest'.
-       If we get to the last entry we return NULL.  At that point
-       there are no slots available and the thread should be
-       put into a wait state.  Since most threads have at most 1 active
-       link at anyone time, this will not be an issue for a single-threaded
-       case. */
-
-    curr = icc_link_cache->head;
-    while (curr != NULL ) {
-        if (curr->ref_count == 0) {
-            curr->ref_count++;		/* we will use this one */
-            if_debug3m('^', curr->memory, "[^]%s 0x%lx ++ => %ld\n",
-                       "icclink", curr, curr->ref_count);
-            break;
+    uint mask = icc_link_cache->table_size - 1;
+    uint n;
+
+    /* Two turns of the hand are enough to clear every referenced flag */
+    for (n = 0; n < 2 * icc_link_cache->table_size; n++) {
+        uint i = icc_link_cache->hand;
+        gsicc_link_t *curr = icc_link_cache->table[i];
+
+        icc_link_cache->hand = (i + 1) & mask;
+        if (curr == NULL || curr->ref_count != 0)
+            continue;
+        if (curr->referenced) {
+            curr->referenced = false;	/* second chance */
+            continue;
         }
-        curr = curr->next;
+        return i;
     }
-    return(curr);
+    return -1;
 }
 
 /* Remove link from cache.  Notify CMS and free */
 static void
 gsicc_remove_link(gsicc_link_t *link, const gs_memory_t *memory)
 {
-    gsicc_link_t *curr, *prev;
     gsicc_link_cache_t *icc_link_cache = link->icc_link_cache;
+    uint mask, i;
+    bool found = false;
 
     if_debug2m(gs_debug_flag_icc, memory,
                "[icc] Removing link = 0x%p memory = 0x%p\n", link,
@@ -603,37 +1253,24 @@ gsicc_remove_link(gsicc_link_t *link, const gs_memory_t *memory)
 #endif
     if (link->ref_count != 0) {
         emprintf2(memory, "link at 0x%p being removed, but has ref_count = %d\n", link, link->ref_count);
-    }
-    curr = icc_link_cache->head;
-    prev = NULL;
-
-    while (curr != NULL ) {
+    } else {
         /* don't get rid of it if another thread has decided to use it */
-        if (curr == link && link->ref_count == 0) {
-            /* remove this one from the list */
-            if (prev == NULL)
-                icc_link_cache->head = curr->next;
-            else
-                prev->next = curr->next;
-            break;
+        mask = icc_link_cache->table_size - 1;
+        i = gsicc_cache_slot(icc_link_cache, link->hashcode.link_hashcode);
+        while (icc_link_cache->table[i] != NULL) {
+            if (icc_link_cache->table[i] == link) {
+                gsicc_cache_delete(icc_link_cache, i);
+                found = true;
+                break;
+            }
+            i = (i + 1) & mask;
         }
-        prev = curr;
-        curr = curr->next;
     }
-    /* if curr != link we didn't find it or another thread may have decided to */
-    /* use it (ref_count > 0). Skip freeing it if so.                          */
-    if (curr == link && link->ref_count == 0) {
-        icc_link_cache->num_links--;	/* no longer in the cache */
 #ifndef MEMENTO_SQUEEZE_BUILD
-        gx_monitor_leave(icc_link_cache->lock);
+    gx_monitor_leave(icc_link_cache->lock);
 #endif
+    if (found)
         gsicc_link_free(link, memory);	/* outside link cache now. */
-    } else {
-        /* even if we didn't find the link to remove, unlock the cache */
-#ifndef MEMENTO_SQUEEZE_BUILD
-        gx_monitor_leave(icc_link_cache->lock);
-#endif
-    }
 }
 
 static void
@@ -885,39 +1522,43 @@ gsicc_alloc_link_entry(gsicc_link_cache_t *icc_link_cache,
                        bool include_softproof, bool include_devlink)
 {
     gs_memory_t *cache_mem = icc_link_cache->memory;
-    gsicc_link_t *link;
+    gsicc_link_t *victims[2];
+    int num_victims = 0;
+    int i;
 
     *ret_link = NULL;
-    /* First see if we can add a link */
-    /* TODO: this should be based on memory usage, not just num_links */
 #ifndef MEMENTO_SQUEEZE_BUILD
     gx_monitor_enter(icc_link_cache->lock);
 #endif
-    while (icc_link_cache->num_links >= ICC_CACHE_MAXLINKS) {
-        /* If not, see if there is anything we can remove from cache. */
-        while ((link = gsicc_find_zeroref_cache(icc_link_cache)) == NULL) {
-#ifndef MEMENTO_SQUEEZE_BUILD
-            /* unlock while waiting for a link to come available */
-            gx_monitor_leave(icc_link_cache->lock);
-#endif
-            /* repeat the findcachelink to see if some other thread has	*/
-            /*already started building the link	we need			*/
-            *ret_link = gsicc_findcachelink(hash, icc_link_cache,
-                                            include_softproof, include_devlink);
-            /* Got a hit, return link. ref_count for the link was already bumped */
-            if (*ret_link != NULL)
-                return true;
+    /* Some other thread may have started building the link we need	*/
+    /* since we last looked.  Only one thread builds any given link.	*/
+    i = gsicc_cache_lookup(icc_link_cache, hash.link_hashcode,
+                           include_softproof, include_devlink);
+    if (i >= 0) {
+        gsicc_link_t *link = icc_link_cache->table[i];
+        bool valid = link->valid;
+
+        link->ref_count++;
+        link->referenced = true;
+        if_debug3m('^', link->memory, "[^]%s 0x%lx ++ => %ld\n",
+                   "icclink", link, link->ref_count);
 #ifndef MEMENTO_SQUEEZE_BUILD
-            gx_monitor_enter(icc_link_cache->lock);	    /* restore the lock */
+        gx_monitor_leave(icc_link_cache->lock);
 #endif
-            /* we will re-test the num_links above while locked to insure */
-            /* that some other thread didn't grab the slot and max us out */
-        }
-        /* Remove the zero ref_count link profile we found.		*/
-        /* Even if we remove this link, we may still be maxed out so	*/
-        /* the outermost 'while' will check to make sure some other	*/
-        /* thread did not grab the one we remove.			*/
-        gsicc_remove_link(link, cache_mem);
+        if (!valid)
+            gsicc_link_wait_valid(link);
+        *ret_link = link;
+        return true;
+    }
+    /* See if we can add a link, or if there is an unused one we can	*/
+    /* remove to make room.  If every link is in use, exceed the limit	*/
+    /* rather than wait for one to be released.				*/
+    /* TODO: this should be based on memory usage, not just num_links */
+    while (icc_link_cache->num_links >= ICC_CACHE_MAXLINKS &&
+           num_victims < countof(victims) &&
+           (i = gsicc_find_zeroref_cache(icc_link_cache)) >= 0) {
+        victims[num_victims++] = icc_link_cache->table[i];
+        gsicc_cache_delete(icc_link_cache, i);
     }
     /* insert an empty link that we will reserve so we can unlock while	*/
     /* building the link contents. If successful, the entry will set	*/
@@ -927,14 +1568,24 @@ gsicc_alloc_link_entry(gsicc_link_cache_t *icc_link_cache,
     /* the lock will be released when the link becomes valid.           */
     if (*ret_link) {
         (*ret_link)->icc_link_cache = icc_link_cache;
-        (*ret_link)->next = icc_link_cache->head;
-        icc_link_cache->head = *ret_link;
-        icc_link_cache->num_links++;
+        (*ret_link)->includes_softproof = include_softproof;
+        (*ret_link)->includes_devlink = include_devlink;
+        if (gsicc_cache_insert(icc_link_cache, *ret_link) < 0) {
+            (*ret_link)->ref_count = 0;
+#ifndef MEMENTO_SQUEEZE_BUILD
+            gx_monitor_leave((*ret_link)->lock);
+#endif
+            gsicc_link_free(*ret_link, cache_mem);
+            *ret_link = NULL;
+        }
     }
 #ifndef MEMENTO_SQUEEZE_BUILD
     /* unlock before returning */
     gx_monitor_leave(icc_link_cache->lock);
 #endif
+    /* Free the evicted links outside the cache lock */
+    while (num_victims > 0)
+        gsicc_link_free(victims[--num_victims], cache_mem);
     return false;
 }
 
@@ -965,7 +1616,7 @@ gsicc_get_link_profile(const gs_gstate *pgs, gx_device *dev,
     int code;
     bool include_softproof = false;
     bool include_devicelink = false;
-    cmm_dev_profile_t *dev_profile;
+    cmm_dev_profile_t *dev_profile = NULL;
     cmm_profile_t *proof_profile = NULL;
     cmm_profile_t *devlink_profile = NULL;
     bool src_dev_link = gs_input_profile->isdevlink;
@@ -1074,6 +1725,12 @@ gsicc_get_link_profile(const gs_gstate *pgs, gx_device *dev,
         return link;
     if (link == NULL)
         return NULL;		/* error, couldn't allocate a link */
+    /* Single colors through this link may be memoized, and 8 bit
+       images may go through a grid if the device asked for it */
+    if (dev_profile != NULL) {
+        link->color_memo_size = dev_profile->color_memo_size;
+        link->image_grid = dev_profile->image_grid;
+    }
 
     /* Here the link was new and the contents have valid=false and we	*/
     /* own the lock for the link_profile. Build the profile, set valid	*/
@@ -1652,7 +2309,7 @@ gsicc_transform_named_color(const float tint_values[],
 }
 
 /* Used by gs to notify the ICC manager that we are done with this link for now */
-/* This may release elements waiting on an icc_link_cache slot */
+/* The link stays in the cache and may be evicted once its ref_count is zero */
 void
 gsicc_release_link(gsicc_link_t *icclink)
 {
@@ -1664,41 +2321,7 @@ gsicc_release_link(gsicc_link_t *icclink)
     if_debug3m('^', icclink->memory, "[^]%s 0x%lx -- => %ld\n",
                "icclink", icclink, icclink->ref_count - 1);
     /* Decrement the reference count */
-    if (--(icclink->ref_count) == 0) {
-
-        gsicc_link_t *curr, *prev;
-
-        /* Find link in cache, and move it to the end of the list.  */
-        /* This way zero ref_count links are found LRU first	*/
-        curr = icc_link_cache->head;
-        prev = NULL;
-        while (curr != icclink) {
-            prev = curr;
-            curr = curr->next;
-        };
-        if (prev == NULL) {
-            /* this link was the head */
-            icc_link_cache->head = curr->next;
-        } else {
-            prev->next = curr->next;		/* de-link this one */
-        }
-        /* Find the first zero-ref entry on the list */
-        curr = icc_link_cache->head;
-        prev = NULL;
-        while (curr != NULL && curr->ref_count > 0) {
-            prev = curr;
-            curr = curr->next;
-        }
-        /* Found where to link this one into the tail of the list */
-        if (prev == NULL) {
-            icc_link_cache->head = icclink;
-            icclink->next = icc_link_cache->head->next;
-        } else {
-            /* link this one in here */
-            prev->next = icclink;
-            icclink->next = curr;
-        }
-    }
+    --(icclink->ref_count);
 #ifndef MEMENTO_SQUEEZE_BUILD
     gx_monitor_leave(icc_link_cache->lock);
 #endif
@@ -36,6 +36,8 @@ typedef struct gsicc_namedcolor_s {
 } gsicc_namedcolor_t;
 
 gsicc_link_cache_t* gsicc_cache_new(gs_memory_t *memory);
+void gsicc_cache_release_color_memos(gsicc_link_cache_t *cache,
+                                     const gs_memory_t *owner);
 gsicc_link_t* gsicc_findcachelink(gsicc_hashlink_t hashcode,
                                   gsicc_link_cache_t *icc_link_cache,
                                   bool includes_proof, bool includes_devlink);
@@ -67,6 +69,10 @@ int gsicc_transform_named_color(const float tint_values[],
                             const gs_gstate *pgs, gx_device *dev,
                             cmm_profile_t *gs_output_profile,
                             gsicc_rendering_param_t *rendering_params);
+int gsicc_transform_image_buffer(gx_device *dev, gsicc_link_t *icclink,
+                                 gsicc_bufferdesc_t *input_buff_desc,
+                                 gsicc_bufferdesc_t *output_buff_desc,
+                                 void *inputbuffer, void *outputbuffer);
 int  gsicc_get_device_profile_comps(const cmm_dev_profile_t *dev_profile);
 gsicc_link_t * gsicc_alloc_link_dev(gs_memory_t *memory, cmm_profile_t *src_profile,
     cmm_profile_t *des_profile, gsicc_rendering_param_t *rendering_params);
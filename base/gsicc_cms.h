@@ -42,6 +42,11 @@ bool gsicc_mcm_monitor_rgb(void *inputcolor, int num_bytes);
 bool gsicc_mcm_monitor_cmyk(void *inputcolor, int num_bytes);
 bool gsicc_mcm_monitor_lab(void *inputcolor, int num_bytes);
 void gsicc_mcm_set_link(gsicc_link_t* link);
+gsicc_color_memo_t *gsicc_color_memo_get(gsicc_link_t *link, const gx_device *dev);
+bool gsicc_color_memo_lookup(gsicc_color_memo_t *memo, const unsigned short *input,
+                             unsigned short *output);
+void gsicc_color_memo_store(gsicc_color_memo_t *memo, const unsigned short *input,
+                            const unsigned short *output);
 int gsicc_mcm_end_monitor(gsicc_link_cache_t *cache, gx_device *dev);
 int gsicc_mcm_begin_monitor(gsicc_link_cache_t *cache, gx_device *dev);
 gsicc_link_t* gsicc_rcm_get_link(const gs_gstate *pgs, gx_device *dev,
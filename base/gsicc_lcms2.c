@@ -466,11 +466,18 @@ gscms_transform_color(gx_device *dev, gsicc_link_t *icclink, void *inputcolor,
 {
     cmsHTRANSFORM hTransform = (cmsHTRANSFORM)icclink->link_handle;
     cmsUInt32Number dwInputFormat,dwOutputFormat;
+    gsicc_color_memo_t *memo = NULL;
 
     /* For a single color, we are going to use the link as it is
        with the exception of taking care of the word size. */
     /* numbytes = sizeof(gx_color_value); */
     if (num_bytes>2) num_bytes = 0;  /* littleCMS encodes float with 0 ToDO. */
+    /* Single colors repeat a lot, try the link's memo first */
+    if (num_bytes == 2) {
+        memo = gsicc_color_memo_get(icclink, dev);
+        if (gsicc_color_memo_lookup(memo, inputcolor, outputcolor))
+            return 0;
+    }
     dwInputFormat = cmsGetTransformInputFormat(hTransform);
     dwOutputFormat = cmsGetTransformOutputFormat(hTransform);
     dwInputFormat = (dwInputFormat & (~LCMS_BYTES_MASK))  | BYTES_SH(num_bytes);
@@ -479,6 +486,8 @@ gscms_transform_color(gx_device *dev, gsicc_link_t *icclink, void *inputcolor,
     cmsChangeBuffersFormat(hTransform,dwInputFormat,dwOutputFormat);
     /* Do conversion */
     cmsDoTransform(hTransform,inputcolor,outputcolor,1);
+    if (num_bytes == 2)
+        gsicc_color_memo_store(memo, inputcolor, outputcolor);
 
     return 0;
 }
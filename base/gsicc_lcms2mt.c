@@ -545,12 +545,20 @@ gscms_transform_color(gx_device *dev, gsicc_link_t *icclink, void *inputcolor,
     cmsUInt32Number dwInputFormat, dwOutputFormat;
     cmsContext ctx = gs_lib_ctx_get_cms_context(icclink->memory);
     int big_endianIN, big_endianOUT, needed_flags;
+    gsicc_color_memo_t *memo = NULL;
 
     /* For a single color, we are going to use the link as it is
        with the exception of taking care of the word size. */
     if (num_bytes > 2)
         return_error(gs_error_rangecheck);	/* TODO: we don't support float */
 
+    /* Single colors repeat a lot, try the link's memo first */
+    if (num_bytes == 2) {
+        memo = gsicc_color_memo_get(icclink, dev);
+        if (gsicc_color_memo_lookup(memo, inputcolor, outputcolor))
+            return 0;
+    }
+
     dwInputFormat = cmsGetTransformInputFormat(ctx, hTransform);
     big_endianIN = T_ENDIAN16(dwInputFormat);
     dwOutputFormat = cmsGetTransformOutputFormat(ctx, hTransform);
@@ -619,6 +627,8 @@ gscms_transform_color(gx_device *dev, gsicc_link_t *icclink, void *inputcolor,
 
     /* Do conversion */
     cmsDoTransform(ctx, hTransform, inputcolor, outputcolor, 1);
+    if (num_bytes == 2)
+        gsicc_color_memo_store(memo, inputcolor, outputcolor);
 
     return 0;
 }
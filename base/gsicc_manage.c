@@ -1429,6 +1429,8 @@ gsicc_new_device_profile_array(gs_memory_t *memory)
     result->pageneutralcolor = false;
     result->usefastcolor = false;  /* Default is to not use fast color */
     result->prebandthreshold = true;
+    result->color_memo_size = ICC_COLOR_MEMO_SIZE;
+    result->image_grid = false;
     result->supports_devn = false;
     result->sim_overprint = false;  /* Default is now not to simulate overprint */
     rc_init_free(result, memory->non_gc_memory, 1, rc_free_profile_array);
@@ -412,6 +412,7 @@ gsicc_mcm_end_monitor(gsicc_link_cache_t *cache, gx_device *dev)
 {
     gx_monitor_t *lock = cache->lock;
     gsicc_link_t *curr;
+    uint i;
     int code;
     cmm_dev_profile_t *dev_profile;
 
@@ -430,8 +431,10 @@ gsicc_mcm_end_monitor(gsicc_link_cache_t *cache, gx_device *dev)
 
     /* Lock the cache as we remove monitoring from the links */
     gx_monitor_enter(lock);
-    curr = cache->head;
-    while (curr != NULL ) {
+    for (i = 0; i < cache->table_size; i++) {
+        curr = cache->table[i];
+        if (curr == NULL)
+            continue;
         if (curr->is_monitored) {
             curr->procs = curr->orig_procs;
             if (curr->hashcode.des_hash == curr->hashcode.src_hash)
@@ -440,7 +443,6 @@ gsicc_mcm_end_monitor(gsicc_link_cache_t *cache, gx_device *dev)
         }
         /* Now release any tasks/threads waiting for these contents */
         gx_monitor_leave(curr->lock);
-        curr = curr->next;
     }
     gx_monitor_leave(lock);	/* done with updating, let everyone run */
     return 0;
@@ -454,6 +456,7 @@ gsicc_mcm_begin_monitor(gsicc_link_cache_t *cache, gx_device *dev)
 {
     gx_monitor_t *lock = cache->lock;
     gsicc_link_t *curr;
+    uint i;
     int code;
     cmm_dev_profile_t *dev_profile;
 
@@ -472,14 +475,13 @@ gsicc_mcm_begin_monitor(gsicc_link_cache_t *cache, gx_device *dev)
     /* Lock the cache as we remove monitoring from the links */
     gx_monitor_enter(lock);
 
-    curr = cache->head;
-    while (curr != NULL ) {
-        if (curr->data_cs != gsGRAY) {
+    for (i = 0; i < cache->table_size; i++) {
+        curr = cache->table[i];
+        if (curr != NULL && curr->data_cs != gsGRAY) {
             gsicc_mcm_set_link(curr);
             /* Now release any tasks/threads waiting for these contents */
             gx_monitor_leave(curr->lock);
         }
-        curr = curr->next;
     }
     gx_monitor_leave(lock);	/* done with updating, let everyone run */
     return 0;
@@ -23,6 +23,7 @@
 #include "stdio_.h"
 #include "string_.h" /* memset */
 #include "gp.h"
+#include "gpsync.h"
 #include "gsicc_manage.h"
 #include "gserrors.h"
 #include "gscdefs.h"            /* for gs_lib_device_list */
@@ -43,6 +44,9 @@ gs_lib_ctx_get_real_stdio(FILE **in, FILE **out, FILE **err)
 #include "gsmemory.h"
 
 #ifndef GS_THREADSAFE
+/* The memory of the first instance created, used for messages printed
+ * without a memory pointer.  Protected by the process wide lock, since
+ * several instances may come and go. */
 static gs_memory_t *mem_err_print = NULL;
 
 gs_memory_t *
@@ -151,7 +155,10 @@ int gs_lib_ctx_init( gs_memory_t *mem )
         return_error(gs_error_Fatal);
 
 #ifndef GS_THREADSAFE
-    mem_err_print = mem;
+    gp_global_lock();
+    if (mem_err_print == NULL)
+        mem_err_print = mem;
+    gp_global_unlock();
 #endif
 
     if (mem->gs_lib_ctx) /* one time initialization */
@@ -199,6 +206,8 @@ int gs_lib_ctx_init( gs_memory_t *mem )
 
     /* Set scanconverter to 1 (default) */
     pio->scanconverter = GS_SCANCONVERTER_DEFAULT;
+    pio->scanconverter_threads = 0;
+    pio->scanconverter_threshold = 100000;
 
     if (gs_lib_ctx_alloc_root_structure(mem, &pio->name_table_root))
         goto Failure;
@@ -238,6 +247,8 @@ void gs_lib_ctx_fin(gs_memory_t *mem)
     ctx = mem->gs_lib_ctx;
     ctx_mem = ctx->memory;
 
+    if (ctx->scanconverter_pool_free)
+        ctx->scanconverter_pool_free(ctx_mem, ctx->scanconverter_pool);
     sjpxd_destroy(mem);
     gscms_destroy(ctx_mem);
     gs_free_object(ctx_mem, ctx->profiledir,
@@ -251,7 +262,10 @@ void gs_lib_ctx_fin(gs_memory_t *mem)
     gs_free_object(ctx_mem, ctx->font_dir_root, "gs_lib_ctx_fin");
 
 #ifndef GS_THREADSAFE
-    mem_err_print = NULL;
+    gp_global_lock();
+    if (mem_err_print == ctx_mem)
+        mem_err_print = NULL;
+    gp_global_unlock();
 #endif
     remove_ctx_pointers(ctx_mem);
     gs_free_object(ctx_mem, ctx, "gs_lib_ctx_init");
@@ -308,7 +322,12 @@ int outwrite(const gs_memory_t *mem, const char *str, int len)
 #ifndef GS_THREADSAFE
 int errwrite_nomem(const char *str, int len)
 {
-    return errwrite(mem_err_print, str, len);
+    int code;
+
+    gp_global_lock();
+    code = mem_err_print ? errwrite(mem_err_print, str, len) : 0;
+    gp_global_unlock();
+    return code;
 }
 #endif
 
@@ -355,7 +374,10 @@ void outflush(const gs_memory_t *mem)
 #ifndef GS_THREADSAFE
 void errflush_nomem(void)
 {
-    errflush(mem_err_print);
+    gp_global_lock();
+    if (mem_err_print)
+        errflush(mem_err_print);
+    gp_global_unlock();
 }
 #endif
 
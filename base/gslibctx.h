@@ -98,7 +98,25 @@ typedef struct gs_lib_ctx_s
     char *default_device_list;
     int gcsignal;
     int scanconverter;
+    /* Threads to split the scan conversion of paths with at least
+     * scanconverter_threshold segments between (0 or 1 for none). */
+    int scanconverter_threads;
+    int scanconverter_threshold;
+    /* The threads themselves (see gxscanc.c), and how to stop them. */
+    void *scanconverter_pool;
+    void (*scanconverter_pool_free)(gs_memory_t *mem, void *pool);
     void *sjpxd_private; /* optional for use of jpx codec */
+    /* The band list i/o procs included in the build, set up by the
+     * gs_gxclfile_init and gs_gxclmem_init init procs; the file procs
+     * are NULL if BAND_LIST_STORAGE=memory (see gxclist.c). */
+    const struct clist_io_procs_s *clist_io_procs_file;
+    const struct clist_io_procs_s *clist_io_procs_memory;
+    const struct clist_io_procs_s *clist_io_procs_memory_lz4;
+    /* Hooks called by the PostScript scanner for each comment that
+     * starts with %% or %! and for any other comment respectively
+     * (see iscan.c).  NULL if not wanted. */
+    int (*scan_dsc_proc)(const byte *, uint);
+    int (*scan_comment_proc)(const byte *, uint);
 } gs_lib_ctx_t;
 
 enum {
@@ -453,6 +453,8 @@ gs_heap_status(gs_memory_t * mem, gs_memory_status_t * pstat)
     pstat->allocated = mmem->used + heap_available();
     pstat->used = mmem->used;
     pstat->max_used = mmem->max_used;
+    pstat->parent_calls = 0;
+    pstat->retained = 0;
     pstat->is_thread_safe = true;	/* this allocator has a mutex (monitor) and IS thread safe */
 }
 static void
@@ -169,9 +169,13 @@ typedef struct gs_memory_chunk_s {
     chunk_free_node_t *free_loc; /* free tree */
     chunk_obj_node_t *defer_finalize_list;
     chunk_obj_node_t *defer_free_list;
-    unsigned long used;
+    chunk_obj_node_t *retained;  /* freed large objects kept for reuse */
+    unsigned long retained_size;
+    unsigned long retain_limit;  /* 0 to return large objects at once */
+    unsigned long used;          /* space obtained from the target */
     unsigned long max_used;
-    unsigned long total_free;
+    unsigned long total_free;    /* free space in slabs, and retained */
+    unsigned long parent_calls;  /* allocations and frees in the target */
 #ifdef DEBUG_SEQ
     unsigned int sequence;
 #endif
@@ -211,6 +215,10 @@ gs_memory_chunk_wrap(gs_memory_t **wrapped,      /* chunk allocator init */
     cmem->used = 0;
     cmem->max_used = 0;
     cmem->total_free = 0;
+    cmem->parent_calls = 0;
+    cmem->retained = NULL;
+    cmem->retained_size = 0;
+    cmem->retain_limit = 0;
 #ifdef DEBUG_SEQ
     cmem->sequence = 0;
 #endif
@@ -252,6 +260,51 @@ gs_memory_chunk_unwrap(gs_memory_t *mem)
     return tmem;
 }
 
+/*
+ * Large objects (more than half a chunk) normally go straight to and from
+ * the target.  A rendering thread allocates the same large buffers for
+ * every band, and the target is usually the locked heap, so it can ask for
+ * up to 'limit' bytes of freed large objects to be kept for reuse instead.
+ * gs_memory_chunk_trim, called between bands, gives back the ones that
+ * haven't been reused since the previous call.
+ */
+void
+gs_memory_chunk_set_retain(gs_memory_t *mem, ulong limit)
+{
+    gs_memory_chunk_t *cmem = (gs_memory_chunk_t *)mem;
+
+    if (mem->procs.status != chunk_status)
+        return;
+    cmem->retain_limit = limit;
+    if (limit == 0)
+        gs_memory_chunk_trim(mem);	/* gives back everything */
+}
+
+void
+gs_memory_chunk_trim(gs_memory_t *mem)
+{
+    gs_memory_chunk_t *cmem = (gs_memory_chunk_t *)mem;
+    chunk_obj_node_t **pprev, *obj;
+
+    if (mem->procs.status != chunk_status)
+        return;
+    pprev = &cmem->retained;
+    while ((obj = *pprev) != NULL) {
+        /* padding counts the trims the retained object has survived */
+        if (obj->padding > 0 || cmem->retain_limit == 0) {
+            *pprev = obj->defer_next;
+            cmem->retained_size -= obj->size;
+            cmem->total_free -= obj->size;
+            cmem->used -= obj->size;
+            cmem->parent_calls++;
+            gs_free_object(cmem->target, obj, "gs_memory_chunk_trim");
+        } else {
+            obj->padding++;
+            pprev = &obj->defer_next;
+        }
+    }
+}
+
 /* ---------- Accessors ------------- */
 
 /* Retrieve this allocator's target */
@@ -274,13 +327,20 @@ static void
 chunk_mem_node_free_all_slabs(gs_memory_chunk_t *cmem)
 {
     chunk_slab_t *slab, *next;
+    chunk_obj_node_t *obj, *next_obj;
     gs_memory_t *const target = cmem->target;
 
     for (slab = cmem->slabs; slab != NULL; slab = next) {
         next = slab->next;
         gs_free_object(target, slab, "chunk_mem_node_free_all_slabs");
     }
+    for (obj = cmem->retained; obj != NULL; obj = next_obj) {
+        next_obj = obj->defer_next;
+        gs_free_object(target, obj, "chunk_mem_node_free_all_slabs");
+    }
 
+    cmem->retained = NULL;
+    cmem->retained_size = 0;
     cmem->slabs = NULL;
     cmem->free_size = NULL;
     cmem->free_loc = NULL;
@@ -378,6 +438,7 @@ gs_memory_chunk_dump_memory(const gs_memory_t *mem)
     void *addr = NULL;
     uint size = 1;
     uint total = 0;
+    const chunk_obj_node_t *obj;
 
 #ifdef DEBUG_CHUNK_PRINT
     dmlprintf1(cmem->target, "Chunk %p:\n", cmem);
@@ -401,6 +462,9 @@ gs_memory_chunk_dump_memory(const gs_memory_t *mem)
         dmlprintf2(cmem->target, "Tree mismatch! %d vs %d\n", count1, count2);
         crash();
     }
+    /* total_free also counts the retained objects */
+    for (obj = cmem->retained; obj != NULL; obj = obj->defer_next)
+        total += obj->size;
     if (total != cmem->total_free) {
         void (*crash)(void) = NULL;
         dmlprintf2(cmem->target, "Free size mismatch! %u vs %lu\n", total, cmem->total_free);
@@ -753,6 +817,26 @@ static void remove_free(gs_memory_chunk_t *cmem, chunk_free_node_t *node)
 #define SINGLE_OBJECT_CHUNK(size) ((size) > (CHUNK_SIZE>>1))
 #endif
 
+/* Take the best fitting retained large object, if one is close enough */
+static chunk_obj_node_t *
+chunk_take_retained(gs_memory_chunk_t *cmem, uint newsize)
+{
+    chunk_obj_node_t **pprev, **pbest = NULL, *obj;
+
+    for (pprev = &cmem->retained; (obj = *pprev) != NULL; pprev = &obj->defer_next) {
+        if (obj->size >= newsize && obj->size - newsize <= (newsize >> 2) &&
+            (pbest == NULL || obj->size < (*pbest)->size))
+            pbest = pprev;
+    }
+    if (pbest == NULL)
+        return NULL;
+    obj = *pbest;
+    *pbest = obj->defer_next;
+    cmem->retained_size -= obj->size;
+    cmem->total_free -= obj->size;
+    return obj;
+}
+
 /* All of the allocation routines reduce to this function */
 static byte *
 chunk_obj_alloc(gs_memory_t *mem, uint size, gs_memory_type_ptr_t type, client_name_t cname)
@@ -784,11 +868,21 @@ chunk_obj_alloc(gs_memory_t *mem, uint size, gs_memory_type_ptr_t type, client_n
 #endif
 #endif
 
-    /* Large blocks are allocated directly */
-    if (SINGLE_OBJECT_CHUNK(newsize)) {
-        obj = (chunk_obj_node_t *)gs_alloc_bytes_immovable(cmem->target, newsize, cname);
-        if (obj == NULL)
-            return NULL;
+    /* Large blocks are allocated directly, unless we kept a freed one.
+       Test the requested size, as chunk_free_object does. */
+    if (SINGLE_OBJECT_CHUNK(size)) {
+        obj = NULL;
+        if (cmem->retained != NULL)
+            obj = chunk_take_retained(cmem, newsize);
+        if (obj != NULL)
+            newsize = obj->size;
+        else {
+            obj = (chunk_obj_node_t *)gs_alloc_bytes_immovable(cmem->target, newsize, cname);
+            if (obj == NULL)
+                return NULL;
+            cmem->parent_calls++;
+            cmem->used += newsize;
+        }
     } else {
         /* Find the smallest free block that's large enough */
         /* okp points to the parent pointer to the block we pick */
@@ -909,6 +1003,8 @@ chunk_obj_alloc(gs_memory_t *mem, uint size, gs_memory_type_ptr_t type, client_n
             slab = (chunk_slab_t *)gs_alloc_bytes_immovable(cmem->target, slab_size, cname);
             if (slab == NULL)
                 return NULL;
+            cmem->parent_calls++;
+            cmem->used += slab_size;
             slab->next = cmem->slabs;
             cmem->slabs = slab;
 
@@ -944,6 +1040,8 @@ chunk_obj_alloc(gs_memory_t *mem, uint size, gs_memory_type_ptr_t type, client_n
     obj->padding = newsize - size; /* actual size - client requested size */
     obj->type = type;    /* and client desired type */
     obj->defer_next = NULL;
+    if (cmem->used - cmem->total_free > cmem->max_used)
+        cmem->max_used = cmem->used - cmem->total_free;
 
 #ifdef DEBUG_SEQ
     obj->sequence = cmem->sequence;
@@ -1039,8 +1137,8 @@ chunk_resize_object(gs_memory_t * mem, void *ptr, uint new_num_elements, client_
     memcpy(new_ptr, ptr, min(old_size, new_size));
     chunk_free_object(mem, ptr, cname);
     cmem->max_used = save_max_used;
-    if (cmem->used > cmem->max_used)
-        cmem->max_used = cmem->used;
+    if (cmem->used - cmem->total_free > cmem->max_used)
+        cmem->max_used = cmem->used - cmem->total_free;
     return new_ptr;
 }
 
@@ -1089,6 +1187,17 @@ chunk_free_object(gs_memory_t *mem, void *ptr, client_name_t cname)
                client_name_string(cname), (ulong) ptr, obj->size);
 
     if (SINGLE_OBJECT_CHUNK(obj->size - obj->padding)) {
+        if (cmem->retained_size + obj->size <= cmem->retain_limit) {
+            obj->type = NULL;
+            obj->padding = 0;
+            obj->defer_next = cmem->retained;
+            cmem->retained = obj;
+            cmem->retained_size += obj->size;
+            cmem->total_free += obj->size;
+            return;
+        }
+        cmem->used -= obj->size;
+        cmem->parent_calls++;
         gs_free_object(cmem->target, obj, "chunk_free_object(single object)");
 #ifdef DEBUG_CHUNK
         gs_memory_chunk_dump_memory(cmem);
@@ -1332,6 +1441,8 @@ chunk_status(gs_memory_t * mem, gs_memory_status_t * pstat)
     pstat->allocated = cmem->used;
     pstat->used = cmem->used - cmem->total_free;
     pstat->max_used = cmem->max_used;
+    pstat->parent_calls = cmem->parent_calls;
+    pstat->retained = cmem->retained_size;
     pstat->is_thread_safe = false;	/* this allocator does not have an internal mutex */
 }
 
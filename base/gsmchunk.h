@@ -38,6 +38,13 @@ void gs_memory_chunk_release(gs_memory_t *cmem);
 gs_memory_t * /* Always succeeds */
 gs_memory_chunk_unwrap(gs_memory_t *mem);
 
+/* Keep up to 'limit' bytes of freed large objects for reuse, rather than
+ * returning them to the target at once (0, the default, keeps none) */
+void gs_memory_chunk_set_retain(gs_memory_t *cmem, ulong limit);
+
+/* Return the retained objects not reused since the previous call */
+void gs_memory_chunk_trim(gs_memory_t *cmem);
+
 /* ---------- Accessors ------------- */
 
 /* Retrieve this allocator's target */
@@ -89,6 +89,15 @@ typedef struct gs_memory_status_s {
      */
     ulong used;
     ulong max_used;
+    /*
+     * Allocators that get their space from a parent allocator count the
+     * calls they make to it (for the rendering threads' chunk allocators
+     * these are the ones that take the heap's lock), and the space they
+     * hold on to for reuse rather than giving it back.  Both are 0 for
+     * other allocators.
+     */
+    ulong parent_calls;
+    ulong retained;
     /* used when wrapping if underlying allocator must be thread safe */
     bool is_thread_safe;
 } gs_memory_status_t;
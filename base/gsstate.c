@@ -39,6 +39,7 @@
 #include "gxcolor2.h"
 #include "gxpcolor.h"
 #include "gsicc_manage.h"
+#include "gxscanc.h"
 
 /* Forward references */
 static gs_gstate *gstate_alloc(gs_memory_t *, client_name_t,
@@ -762,6 +763,28 @@ gs_getscanconverter(const gs_memory_t * mem)
     return libctx->scanconverter;
 }
 
+/* The edgebuffer scanconverter can split paths with at least 'threshold'
+ * segments between 'threads' threads. The output is the same either way. */
+void
+gs_setscanconverterthreads(gs_gstate * gs, int threads, int threshold)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(gs->memory);
+
+    gx_scanc_pool_reserve(gs->memory, threads);
+    libctx->scanconverter_threads = threads;
+    libctx->scanconverter_threshold = threshold;
+}
+
+/* getscanconverterthreads */
+int
+gs_getscanconverterthreads(const gs_memory_t * mem, int *threshold)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(mem);
+
+    *threshold = libctx->scanconverter_threshold;
+    return libctx->scanconverter_threads;
+}
+
 /* setrenderingintent
  *
  *  Use ICC numbers from Table 18 (section 6.1.11) rather than the PDF order
@@ -73,6 +73,8 @@ void gs_setcpsimode(gs_memory_t *, bool);
 
 int gs_getscanconverter(const gs_memory_t *);
 void gs_setscanconverter(gs_gstate *, int);
+int gs_getscanconverterthreads(const gs_memory_t *, int *);
+void gs_setscanconverterthreads(gs_gstate *, int, int);
 
 /* Device control */
 #include "gsdevice.h"
@@ -39,6 +39,12 @@ typedef struct tifs_io_private_t
 {
     FILE *f;
     gx_device_printer *pdev;
+    /* For TIFFs held in memory (f == NULL) */
+    gs_memory_t *mem;
+    byte *data;
+    uint64_t size;
+    uint64_t pos;
+    uint64_t max_size;
 } tifs_io_private;
 
 /* libtiff i/o hooks */
@@ -157,6 +163,7 @@ tiff_from_filep(gx_device_printer *dev,  const char *name, FILE *filep, int big_
     if (!tiffio) {
         return NULL;
     }
+    memset(tiffio, 0, sizeof(*tiffio));
     tiffio->f = filep;
     tiffio->pdev = dev;
 
@@ -169,6 +176,126 @@ tiff_from_filep(gx_device_printer *dev,  const char *name, FILE *filep, int big_
     return t;
 }
 
+/* i/o hooks for TIFFs held in memory */
+static size_t
+gs_tifsMemReadProc(thandle_t fd, void* buf, size_t size)
+{
+    tifs_io_private *tiffio = (tifs_io_private *)fd;
+
+    if (tiffio->pos >= tiffio->size)
+        return 0;
+    if (size > tiffio->size - tiffio->pos)
+        size = (size_t)(tiffio->size - tiffio->pos);
+    memcpy(buf, tiffio->data + tiffio->pos, size);
+    tiffio->pos += size;
+    return size;
+}
+
+static size_t
+gs_tifsMemWriteProc(thandle_t fd, void* buf, size_t size)
+{
+    tifs_io_private *tiffio = (tifs_io_private *)fd;
+    uint64_t end = tiffio->pos + size;
+
+    if (end > tiffio->max_size) {
+        uint64_t new_size = max(end, tiffio->max_size * 2);
+        byte *data;
+
+        if (new_size > max_uint)
+            return (size_t) -1;
+        data = gs_alloc_bytes(tiffio->mem, (uint)new_size, "gs_tifsMemWriteProc");
+        if (data == NULL)
+            return (size_t) -1;
+        if (tiffio->size > 0)
+            memcpy(data, tiffio->data, (size_t)tiffio->size);
+        gs_free_object(tiffio->mem, tiffio->data, "gs_tifsMemWriteProc");
+        tiffio->data = data;
+        tiffio->max_size = new_size;
+    }
+    if (tiffio->pos > tiffio->size)
+        memset(tiffio->data + tiffio->size, 0, (size_t)(tiffio->pos - tiffio->size));
+    memcpy(tiffio->data + tiffio->pos, buf, size);
+    tiffio->pos = end;
+    if (end > tiffio->size)
+        tiffio->size = end;
+    return size;
+}
+
+static uint64_t
+gs_tifsMemSeekProc(thandle_t fd, uint64_t off, int whence)
+{
+    tifs_io_private *tiffio = (tifs_io_private *)fd;
+
+    switch (whence) {
+        case SEEK_CUR:
+            off += tiffio->pos;
+            break;
+        case SEEK_END:
+            off += tiffio->size;
+            break;
+    }
+    tiffio->pos = off;
+    return off;
+}
+
+static int
+gs_tifsMemCloseProc(thandle_t fd)
+{
+    tifs_io_private *tiffio = (tifs_io_private *)fd;
+    gs_memory_t *mem = tiffio->mem;
+
+    gs_free_object(mem, tiffio->data, "gs_tifsMemWriteProc");
+    gs_free_object(mem, tiffio, "tiff_from_memory");
+    return 0;
+}
+
+static uint64_t
+gs_tifsMemSizeProc(thandle_t fd)
+{
+    tifs_io_private *tiffio = (tifs_io_private *)fd;
+
+    return tiffio->size;
+}
+
+/* Open a TIFF for writing into memory (allocated from mem, which need not
+ * be the device's). This lets us use the libtiff codecs to compress
+ * strips of the page on other threads, for copying into the real file
+ * with TIFFWriteRawStrip. Close it with TIFFClose as usual. */
+TIFF *
+tiff_from_memory(gx_device_printer *dev, gs_memory_t *mem, const char *name, int big_endian)
+{
+    TIFF *t;
+    tifs_io_private *tiffio;
+
+    tiffio = (tifs_io_private *)gs_alloc_bytes(mem, sizeof(tifs_io_private), "tiff_from_memory");
+    if (!tiffio) {
+        return NULL;
+    }
+    memset(tiffio, 0, sizeof(*tiffio));
+    tiffio->pdev = dev;
+    tiffio->mem = mem;
+
+    t = TIFFClientOpen(name, (big_endian ? "wb" : "wl"),
+        (thandle_t) tiffio, (TIFFReadWriteProc)gs_tifsMemReadProc,
+        (TIFFReadWriteProc)gs_tifsMemWriteProc, (TIFFSeekProc)gs_tifsMemSeekProc,
+        gs_tifsMemCloseProc, (TIFFSizeProc)gs_tifsMemSizeProc, gs_tifsDummyMapProc,
+        gs_tifsDummyUnmapProc);
+    if (t == NULL)
+        gs_tifsMemCloseProc((thandle_t) tiffio);
+
+    return t;
+}
+
+/* The data written so far to a TIFF from tiff_from_memory. */
+const byte *
+tiff_memory_data(TIFF *t, uint64_t *size)
+{
+    tifs_io_private *tiffio = (tifs_io_private *)TIFFClientdata(t);
+
+    *size = tiffio->size;
+    return tiffio->data;
+}
+
 static void
 gs_tifsWarningHandlerEx(thandle_t client_data, const char* module, const char* fmt, va_list ap)
 {
@@ -22,6 +22,10 @@
 
 TIFF *
 tiff_from_filep(gx_device_printer *dev,  const char *name, FILE *filep, int big_endian, bool usebigtiff);
+TIFF *
+tiff_from_memory(gx_device_printer *dev, gs_memory_t *mem, const char *name, int big_endian);
+const byte *
+tiff_memory_data(TIFF *t, uint64_t *size);
 void tiff_set_handlers (void);
 
 #endif /* gstiffio_INCLUDED */
@@ -174,6 +174,8 @@ pdf14_preserve_backdrop_cm(pdf14_buf *buf, cmm_profile_t *group_profile,
         gsicc_bufferdesc_t input_buff_desc;
         gsicc_bufferdesc_t output_buff_desc;
 
+        /* Clear whatever part of a lazily cleared tos we are about to read. */
+        pdf14_buf_touch(tos, x0, y0, x1, y1);
         /* Define the rendering intents */
         rendering_params.black_point_comp = gsBLACKPTCOMP_ON;
         rendering_params.graphics_type_tag = GS_IMAGE_TAG;
@@ -259,6 +261,8 @@ pdf14_preserve_backdrop(pdf14_buf *buf, pdf14_buf *tos, bool knockout_buff)
         byte *buf_plane, *tos_plane;
         int i, n_planes;
 
+        /* Clear whatever part of a lazily cleared tos we are about to read. */
+        pdf14_buf_touch(tos, x0, y0, x1, y1);
         if (knockout_buff) {
             buf_plane = buf->backdrop;
             tos_plane = tos->backdrop;
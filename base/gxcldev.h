@@ -54,6 +54,13 @@ void clist_cfd_init(stream_CFD_state *ss, int width, int height,
 /* contain information for length or logical end-of-data.            */
 int cmd_write_pseudo_band(gx_device_clist_writer *cldev, unsigned char *pbuf,
                           int data_size, int pseudo_band_offset);
+
+/* The same, for callers that write the data to page_cfile themselves:  */
+/* cmd_begin_pseudo_band returns the position the data will start at,   */
+/* cmd_end_pseudo_band reports any error from writing it.               */
+int cmd_begin_pseudo_band(gx_device_clist_writer *cldev,
+                          int pseudo_band_offset, int64_t *ppos);
+int cmd_end_pseudo_band(gx_device_clist_writer *cldev);
 /*
  * A command always consists of an operation followed by operands;
  * the syntax of the operands depends on the operation.
@@ -687,12 +694,13 @@ int cmd_write_icctable(gx_device_clist_writer * cldev, unsigned char *pbuf, int
 
 /* Enumeration of psuedo band offsets for extra c-list data.
    This includes the ICC profile table and and color_usage and
-   may later include compressed image data */
+   image data shared between bands */
 
 typedef enum {
 
     COLOR_USAGE_OFFSET = 1,
-    ICC_TABLE_OFFSET = 2
+    ICC_TABLE_OFFSET = 2,
+    IMAGE_DATA_OFFSET = 3
 
 } psuedoband_offset;
 
@@ -24,10 +24,6 @@
 #include "gp.h"
 #include "gxclio.h"
 
-#ifdef PACIFY_VALGRIND
-#include "valgrind.h"
-#endif
-
 
 /* This is an implementation of the command list I/O interface */
 /* that uses the file system for storage. */
@@ -214,6 +210,62 @@ cl_cache_load_slot(CL_CACHE *cache, CL_CACHE_SLOT *slot, int64_t pos, byte *data
     memmove(slot->base, data, len);
 }
 
+/*
+ * Where the platform can map files, a file that has been written is read
+ * back through a read-only mapping instead of the cache above.  Reads are
+ * then just copies out of the page cache, with no system call per block.
+ * The mapping is made once, by the file that was written, and shared by
+ * the clones opened for the rendering threads, so that they all read the
+ * same pages.  For the command file, the kernel is also told to fetch
+ * CL_MAP_READAHEAD bytes ahead of each reader, starting again wherever
+ * a band's commands begin.  Writing to the file drops the mapping; it is
+ * remade, at the new size, by the next read.
+ *
+ * Files are only opened and closed by the thread that sets up and tears
+ * down the rendering threads, so the reference count needs no lock.
+ */
+#define CL_MAP_READAHEAD (1 << 20)
+
+typedef struct
+{
+    gs_memory_t *memory;
+    int refs;			/* # of IFILEs using the mapping */
+    const byte *base;
+    int64_t size;
+} CL_MAP;
+
+static CL_MAP *
+cl_map_alloc(gs_memory_t *mem, FILE *f, int64_t size)
+{
+    CL_MAP *map;
+    const void *base;
+
+    if (size <= 0)
+        return NULL;
+    base = gp_fmap(f, size);
+    if (base == NULL)
+        return NULL;
+    map = (CL_MAP *)gs_alloc_bytes(mem, sizeof(CL_MAP), "alloc CL_MAP");
+    if (map == NULL) {
+        gp_funmap(base, size);
+        return NULL;
+    }
+    map->memory = mem;
+    map->refs = 1;
+    map->base = base;
+    map->size = size;
+    return map;
+}
+
+static void
+cl_map_release(CL_MAP *map)
+{
+    if (map == NULL || --map->refs > 0)
+        return;
+    gp_funmap(map->base, map->size);
+    gs_free_object(map->memory, map, "free CL_MAP");
+}
+
 /* Use our own FILE structure so that, on some platforms, we write and read
  * tmp files via a single file descriptor. That allows cleaning of tmp files
  * to be addressed via DELETE_ON_CLOSE under Windows, and immediate unlink
@@ -231,8 +283,64 @@ typedef struct
     int64_t pos;
     int64_t filesize;		/* filesize maintained by clist_fwrite */
     CL_CACHE *cache;
+    CL_MAP *map;		/* mapping of the first filesize bytes, or NULL */
+    bool map_tried;		/* don't retry a mapping that failed */
+    bool read_ahead;		/* command file: hint the reader's next bytes */
+    int64_t ahead_start;	/* range last hinted by read ahead */
+    int64_t ahead_end;
 } IFILE;
 
+/* Return the mapping of the file, making it if necessary and possible. */
+static CL_MAP *
+cl_map_get(IFILE *ifile)
+{
+    if (ifile->map != NULL && ifile->map->size != ifile->filesize) {
+        cl_map_release(ifile->map);
+        ifile->map = NULL;
+        ifile->map_tried = false;
+    }
+    if (ifile->map == NULL && !ifile->map_tried) {
+        ifile->map_tried = true;
+        ifile->map = cl_map_alloc(ifile->mem, ifile->f, ifile->filesize);
+    }
+    return ifile->map;
+}
+
+/* Drop the mapping, e.g. because the file is about to change. */
+static void
+cl_map_drop(IFILE *ifile)
+{
+    cl_map_release(ifile->map);
+    ifile->map = NULL;
+    ifile->map_tried = false;
+    ifile->ahead_start = ifile->ahead_end = 0;
+}
+
+/* Read from the mapping at the current position. */
+static int
+cl_map_read(byte *data, uint len, IFILE *ifile)
+{
+    CL_MAP *map = ifile->map;
+    int64_t pos = ifile->pos;
+    int64_t end;
+
+    if (pos >= map->size)
+        return 0;
+    end = min(pos + len, map->size);
+    /* Hint the next window when the reader moves outside the last one, */
+    /* or gets within half a window of its end. */
+    if (ifile->read_ahead &&
+        (pos < ifile->ahead_start ||
+         (end + CL_MAP_READAHEAD / 2 > ifile->ahead_end &&
+          ifile->ahead_end < map->size))) {
+        ifile->ahead_start = pos;
+        ifile->ahead_end = min(pos + CL_MAP_READAHEAD, map->size);
+        gp_fmap_willneed(map->base, pos, ifile->ahead_end - pos);
+    }
+    memcpy(data, map->base + pos, end - pos);
+    return end - pos;
+}
+
 static void
 file_to_fake_path(clist_file_ptr file, char fname[gp_file_name_sizeof])
 {
@@ -264,6 +372,10 @@ static IFILE *wrap_file(gs_memory_t *mem, FILE *f, const char *fmode)
     ifile->pos = 0;
     ifile->filesize = 0;
     ifile->cache = cl_cache_alloc(ifile->mem);
+    ifile->map = NULL;
+    ifile->map_tried = false;
+    ifile->read_ahead = false;
+    ifile->ahead_start = ifile->ahead_end = 0;
     return ifile;
 }
 
@@ -274,6 +386,7 @@ static int close_file(IFILE *ifile)
         res = fclose(ifile->f);
         if (ifile->cache != NULL)
             cl_cache_destroy(ifile->cache);
+        cl_map_release(ifile->map);
         gs_free_object(ifile->mem, ifile, "Free wrapped IFILE");
     }
     return res;
@@ -308,8 +421,20 @@ clist_fopen(char fname[gp_file_name_sizeof], const char *fmode,
             /*  A special (fake) fname is passed in. If so, clone the FILE handle */
             *pcf = wrap_file(mem, gp_fdup(((IFILE *)ocf)->f, fmode), fmode);
             /* when cloning, copy other parts not done by wrap_file */
-            if (*pcf)
-                ((IFILE *)(*pcf))->filesize = ((IFILE *)ocf)->filesize;
+            if (*pcf) {
+                IFILE *icf = (IFILE *)*pcf;
+                CL_MAP *map;
+
+                icf->filesize = ((IFILE *)ocf)->filesize;
+                /* Share the original's mapping, rather than making our own */
+                if (gp_can_share_fdesc() && fmode[0] == 'r') {
+                    map = cl_map_get((IFILE *)ocf);
+                    if (map != NULL)
+                        map->refs++;
+                    icf->map = map;
+                    icf->map_tried = true;
+                }
+            }
         } else {
             *pcf = wrap_file(mem, gp_fopen(fname, fmode), fmode);
         }
@@ -369,6 +494,8 @@ clist_fwrite_chars(const void *data, uint len, clist_file_ptr cf)
     if (res >= 0)
         icf->pos += len;
     icf->filesize = icf->pos;	/* write truncates file */
+    if (icf->map != NULL || icf->map_tried)
+        cl_map_drop(icf);	/* remap at the new size when next read */
     if (!CL_CACHE_NEEDS_INIT(icf->cache)) {
         /* writing invalidates the read cache */
         cl_cache_destroy(icf->cache);
@@ -388,6 +515,11 @@ clist_fread_chars(void *data, uint len, clist_file_ptr cf)
         IFILE *icf = (IFILE *)cf;
         byte *dp = data;
 
+        if (cl_map_get(icf) != NULL) {
+            nread = cl_map_read(dp, len, icf);
+            icf->pos += nread;
+            return nread;
+        }
         /* if we have a cache, check if it needs init, and do it */
         if (CL_CACHE_NEEDS_INIT(icf->cache)) {
             icf->cache = cl_cache_read_init(icf->cache, CL_CACHE_NSLOTS, 1<<CL_CACHE_SLOT_SIZE_LOG2, icf->filesize);
@@ -456,6 +588,15 @@ clist_set_memory_warning(clist_file_ptr cf, int bytes_left)
     return 0;			/* no-op */
 }
 
+static void
+clist_set_read_ahead(clist_file_ptr cf, bool read_ahead)
+{
+    IFILE *ifile = (IFILE *)cf;
+
+    ifile->read_ahead = read_ahead;
+    ifile->ahead_start = ifile->ahead_end = 0;
+}
+
 static int
 clist_ferror_code(clist_file_ptr cf)
 {
@@ -485,6 +626,7 @@ clist_rewind(clist_file_ptr cf, bool discard_data, const char *fname)
             /* fname is an encoded ifile pointer. We can use an entirely
              * new scratch file. */
             char tfname[gp_file_name_sizeof];
+            cl_map_drop(ocf);
             fclose(ocf->f);
             ocf->f = gp_open_scratch_file_rm(NULL, gp_scratch_file_name_prefix, tfname, fmode);
             /* if there was a cache, get rid of it an get a new (empty) one */
@@ -554,15 +696,13 @@ static clist_io_procs_t clist_io_procs_file = {
     clist_ftell,
     clist_rewind,
     clist_fseek,
+    clist_set_read_ahead,
 };
 
 init_proc(gs_gxclfile_init);
 int
 gs_gxclfile_init(gs_memory_t *mem)
 {
-#ifdef PACIFY_VALGRIND
-    VALGRIND_HG_DISABLE_CHECKING(&clist_io_procs_file_global, sizeof(clist_io_procs_file_global));
-#endif
-    clist_io_procs_file_global = &clist_io_procs_file;
+    mem->gs_lib_ctx->clist_io_procs_file = &clist_io_procs_file;
     return 0;
 }
@@ -395,6 +395,10 @@ static int cmd_image_plane_data_mon(gx_device_clist_writer * cldev,
                                  uint bytes_per_plane,
                                  const uint * offsets, int dx, int h,
                                  bool *found_color);
+static int cmd_image_data_ref(gx_device_clist_writer * cldev,
+                              gx_clist_state * pcls, uint bytes_per_plane,
+                              uint raster, uint plane_size, int64_t pos,
+                              int dx, int h);
 static uint clist_image_unknowns(gx_device *dev,
                                   const clist_image_enum *pie);
 static int write_image_end_all(gx_device *dev,
@@ -940,6 +944,105 @@ use_default:
     }
 }
 
+/*
+ * Compute the rows of source data that intersect the band being
+ * enumerated by pre (ibox), and the rectangle transmitted by the band's
+ * begin_image command (entire_box).  The transmitted subrectangle has to
+ * be computed at the time we write the begin_image command; this in turn
+ * controls how much of each scan line we write out.
+ */
+static bool
+image_band_data_box(gx_device * dev, const clist_image_enum * pie,
+                    const cmd_rects_enum_t * pre, gs_int_rect * ibox,
+                    gs_int_rect * entire_box)
+{
+    int band_ymax = min(pre->band_end, pie->ymax);
+    int band_ymin = max(pre->band_end - pre->band_height, pie->ymin);
+
+    return image_band_box(dev, pie, pre->y, pre->height, ibox) &&
+        image_band_box(dev, pie, band_ymin, band_ymax - band_ymin,
+                       entire_box);
+}
+
+/*
+ * When the scan lines of an image run across several bands (typically
+ * because the image is skewed), writing the data inline replicates each
+ * row into every band it touches.  In that case write the rows once, as
+ * a pseudo band, and have the bands refer to them by position.
+ * Sets *ppos to the position of the rows in the cfile, or to -1 if the
+ * data should be written inline as usual.
+ */
+static int
+clist_image_share_rows(gx_device_clist_writer * cdev,
+                       const clist_image_enum * pie,
+                       const gx_image_plane_t * planes, int y0, int h,
+                       int ry, int rheight, int64_t *ppos, uint *praster)
+{
+    gx_device *dev = (gx_device *)cdev;
+    int bpp = pie->bits_per_plane;
+    uint raster = ((pie->rect.q.x - pie->rect.p.x) * bpp + 7) >> 3;
+    int64_t shared_size = (int64_t)raster * h * pie->num_planes;
+    int64_t inline_size = 0;
+    cmd_rects_enum_t re;
+    int i, code;
+
+    *ppos = -1;
+    if (pie->monitor_color || planes[0].data_x != 0 ||
+        rheight <= cdev->page_band_height)
+        return 0;
+    RECT_ENUM_INIT(re, ry, rheight);
+    do {
+        gs_int_rect ibox, entire_box;
+        int by0, by1, xskip;
+
+        RECT_STEP_INIT(re);
+        if (!image_band_data_box(dev, pie, &re, &ibox, &entire_box))
+            continue;
+        by0 = max(ibox.p.y, y0);
+        by1 = min(ibox.q.y, y0 + h);
+        if (by1 <= by0)
+            continue;
+        /* This must match the computation in clist_image_plane_data. */
+        xskip = (entire_box.p.x - pie->rect.p.x) &
+            -(int)"\001\010\004\010\002\010\004\010"[bpp & 7];
+        inline_size += (int64_t)(by1 - by0) * pie->num_planes *
+            (((entire_box.q.x - (pie->rect.p.x + xskip)) * bpp + 7) >> 3);
+        shared_size += 2 + 4 * cmd_sizew_max + sizeof(int64_t);
+    } while ((re.y += re.height) < re.yend);
+    /* Only bother if inline data would be at least half as big again. */
+    if (inline_size * 2 < shared_size * 3)
+        return 0;
+
+    code = cmd_begin_pseudo_band(cdev, IMAGE_DATA_OFFSET, ppos);
+    if (code < 0)
+        return code;
+    if_debug3m('L', cdev->memory,
+               "[L]sharing %d image rows of %u bytes at %"PRId64"\n",
+               h, raster, *ppos);
+    for (i = 0; i < pie->num_planes; ++i) {
+        if (planes[i].raster == raster)
+            cdev->page_info.io_procs->fwrite_chars(planes[i].data,
+                                                   raster * h,
+                                                   cdev->page_cfile);
+        else {
+            int r;
+
+            for (r = 0; r < h; ++r)
+                cdev->page_info.io_procs->fwrite_chars(planes[i].data +
+                                                       r * planes[i].raster,
+                                                       raster,
+                                                       cdev->page_cfile);
+        }
+    }
+    code = cmd_end_pseudo_band(cdev);
+    if (code < 0) {
+        *ppos = -1;
+        return code;
+    }
+    *praster = raster;
+    return 0;
+}
+
 /* Error cleanup for clist_image_plane_data. */
 static inline int
 clist_image_plane_data_retry_cleanup(gx_device *dev, clist_image_enum *pie, int yh_used, int code)
@@ -976,6 +1079,8 @@ clist_image_plane_data(gx_image_enum_common_t * info,
     int code;
     cmd_rects_enum_t re;
     bool found_color = false;
+    int64_t shared_pos;
+    uint shared_raster = 0;
 
 #ifdef DEBUG
     if (pie->id != cdev->image_enum_id) {
@@ -1050,6 +1155,11 @@ clist_image_plane_data(gx_image_enum_common_t * info,
     cdev->clip_path = NULL;
     cmd_check_clip_path(cdev, pie->pcpath);
 
+    code = clist_image_share_rows(cdev, pie, planes, y0, yh_used, ry, rheight,
+                                  &shared_pos, &shared_raster);
+    if (code < 0)
+        return code;
+
     RECT_ENUM_INIT(re, ry, rheight);
     do {
         gs_int_rect ibox;
@@ -1061,21 +1171,8 @@ clist_image_plane_data(gx_image_enum_common_t * info,
          * Note that y and height always define a complete band.
          */
 
-        if (!image_band_box(dev, pie, re.y, re.height, &ibox))
+        if (!image_band_data_box(dev, pie, &re, &ibox, &entire_box))
             continue;
-        /*
-         * The transmitted subrectangle has to be computed at the time
-         * we write the begin_image command; this in turn controls how
-         * much of each scan line we write out.
-         */
-        {
-            int band_ymax = min(re.band_end, pie->ymax);
-            int band_ymin = max(re.band_end - re.band_height, pie->ymin);
-
-            if (!image_band_box(dev, pie, band_ymin,
-                                band_ymax - band_ymin, &entire_box))
-                continue;
-        }
 
         re.pcls->color_usage.or |= pie->color_usage.or;
         re.pcls->color_usage.slow_rop |= pie->color_usage.slow_rop;
@@ -1209,6 +1306,18 @@ clist_image_plane_data(gx_image_enum_common_t * info,
                     for (i = 0; i < num_planes; ++i)
                         offsets[i] += planes[i].raster * nrows;
                 }
+            } else if (shared_pos >= 0) {
+                if (by1 > by0) {
+                    code = cmd_image_data_ref(cdev, re.pcls, bytes_per_plane,
+                                              shared_raster,
+                                              shared_raster * yh_used,
+                                              shared_pos +
+                                              (int64_t)(by0 - y0) * shared_raster +
+                                              ((xskip * bpp) >> 3),
+                                              xoff - xskip, by1 - by0);
+                    if (code < 0)
+                        return code;
+                }
             } else {
                 for (iy = by0, ih = by1 - by0; ih > 0; iy += nrows, ih -= nrows) {
                     nrows = min(ih, rows_per_cmd);
@@ -1941,6 +2050,33 @@ cmd_image_plane_data(gx_device_clist_writer * cldev, gx_clist_state * pcls,
     return 0;
 }
 
+/* Write a reference to rows of image data shared between bands. */
+static int
+cmd_image_data_ref(gx_device_clist_writer * cldev, gx_clist_state * pcls,
+                   uint bytes_per_plane, uint raster, uint plane_size,
+                   int64_t pos, int dx, int h)
+{
+    byte *dp;
+    int code;
+
+    if (dx) {
+        code = cmd_put_set_data_x(cldev, pcls, dx);
+        if (code < 0)
+            return code;
+    }
+    code = set_cmd_put_op(&dp, cldev, pcls, cmd_opv_extend,
+                          2 + cmd_size2w(h, bytes_per_plane) +
+                          cmd_size2w(raster, plane_size) + sizeof(pos));
+    if (code < 0)
+        return code;
+    dp[1] = cmd_opv_ext_image_data_ref;
+    dp += 2;
+    cmd_put2w(h, bytes_per_plane, &dp);
+    cmd_put2w(raster, plane_size, &dp);
+    memcpy(dp, &pos, sizeof(pos));
+    return 0;
+}
+
 /* Write data for a partial image with color monitor. */
 static int
 cmd_image_plane_data_mon(gx_device_clist_writer * cldev, gx_clist_state * pcls,
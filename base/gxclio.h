@@ -88,11 +88,15 @@ struct clist_io_procs_s {
     void (*rewind)(clist_file_ptr cf, bool discard_data, const char *fname);
 
     int (*fseek)(clist_file_ptr cf, int64_t offset, int mode, const char *fname);
+
+    /*
+     * Tell the implementation that the file will be read as runs of band
+     * commands, so it may fetch data ahead of the reader.  This is a hint
+     * only; the band reader sets it on the command file.
+     */
+    void (*set_read_ahead)(clist_file_ptr cf, bool read_ahead);
 };
 
 typedef struct clist_io_procs_s clist_io_procs_t;
 
-extern const clist_io_procs_t *clist_io_procs_file_global;
-extern const clist_io_procs_t *clist_io_procs_memory_global;
-
 #endif /* gxclio_INCLUDED */
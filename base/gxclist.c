@@ -209,25 +209,23 @@ const gx_device_procs gs_clist_device_procs = {
 /*------------------- Choose the implementation -----------------------
 
    For chossing the clist i/o implementation by makefile options
-   we define global variables, which are initialized with
+   the instance's gs_lib_ctx holds pointers, which are initialized with
    file/memory io procs when they are included into the build.
  */
-const clist_io_procs_t *clist_io_procs_file_global = NULL;
-const clist_io_procs_t *clist_io_procs_memory_global = NULL;
-
 void
-clist_init_io_procs(gx_device_clist *pclist_dev, bool in_memory)
+clist_init_io_procs(gx_device_clist *pclist_dev, bool in_memory,
+                    bool compress_lz4)
 {
-#ifdef PACIFY_VALGRIND
-    VALGRIND_HG_DISABLE_CHECKING(&clist_io_procs_file_global, sizeof(clist_io_procs_file_global));
-    VALGRIND_HG_DISABLE_CHECKING(&clist_io_procs_memory_global, sizeof(clist_io_procs_memory_global));
-#endif
-    /* if clist_io_procs_file_global is NULL, then BAND_LIST_STORAGE=memory */
+    gs_lib_ctx_t *ctx = pclist_dev->common.memory->gs_lib_ctx;
+
+    /* if clist_io_procs_file is NULL, then BAND_LIST_STORAGE=memory */
     /* was specified in the build, and "file" is not available */
-    if (in_memory || clist_io_procs_file_global == NULL)
-        pclist_dev->common.page_info.io_procs = clist_io_procs_memory_global;
+    if (in_memory || ctx->clist_io_procs_file == NULL)
+        pclist_dev->common.page_info.io_procs =
+            (compress_lz4 ? ctx->clist_io_procs_memory_lz4 :
+                            ctx->clist_io_procs_memory);
     else
-        pclist_dev->common.page_info.io_procs = clist_io_procs_file_global;
+        pclist_dev->common.page_info.io_procs = ctx->clist_io_procs_file;
 }
 
 /* ------ Define the command set and syntax ------ */
@@ -708,6 +706,7 @@ clist_open(gx_device *dev)
         return code;
     cdev->icc_cache_list_len = 0;
     cdev->icc_cache_list = NULL;
+    cdev->render_pool = NULL;
     code = clist_open_output_file(dev);
     if ( code >= 0)
         code = clist_emit_page_header(dev);
@@ -733,6 +732,7 @@ clist_close(gx_device *dev)
      * in *2* places, once in gdev_prn_tear_down() for regular clists, and once in
      * gx_pattern_cache_free_entry() for pattern clists....
      */
+    clist_free_render_pool(dev);
     for(i = 0; i < cdev->icc_cache_list_len; i++) {
         rc_decrement(cdev->icc_cache_list[i], "clist_close");
     }
@@ -1370,7 +1370,7 @@ clist_make_accum_device(gx_device *target, const char *dname, void *base, int sp
         cwdev->procs = gs_clist_device_procs;
         gx_device_copy_color_params((gx_device *)cwdev, target);
         rc_assign(cwdev->target, target, "clist_make_accum_device");
-        clist_init_io_procs(cdev, use_memory_clist);
+        clist_init_io_procs(cdev, use_memory_clist, target->BLC_lz4);
         cwdev->data = base;
         cwdev->data_size = space;
         memcpy (&(cwdev->buf_procs), buf_procs, sizeof(gx_device_buf_procs_t));
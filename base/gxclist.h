@@ -169,6 +169,11 @@ typedef struct cmd_list_s {
  */
 typedef struct gx_clist_state_s gx_clist_state;
 
+#ifndef clist_render_pool_t_DEFINED
+#  define clist_render_pool_t_DEFINED
+typedef struct clist_render_pool_s clist_render_pool_t;
+#endif
+
 #define gx_device_clist_common_members\
         gx_device_forward_common;	/* (see gxdevice.h) */\
                 /* Following must be set before writing or reading. */\
@@ -201,7 +206,8 @@ typedef struct gx_clist_state_s gx_clist_state;
                                            file location. */\
         gsicc_link_cache_t *icc_cache_cl; /* Link cache */\
         int icc_cache_list_len;         /* Length of list of caches, one per rendering thread */\
-        gsicc_link_cache_t **icc_cache_list  /* Link cache list */
+        gsicc_link_cache_t **icc_cache_list;  /* Link cache list */\
+        clist_render_pool_t *render_pool  /* rendering threads, kept from page to page */
 
 /* Define a structure to hold where the ICC profiles are stored in the clist
    Profiles are added into psuedo bands of the clist, these are bands that exist beyond
@@ -386,6 +392,11 @@ typedef struct gx_device_clist_writer_s gx_device_clist_writer;
 typedef struct clist_render_thread_control_s clist_render_thread_control_t;
 #endif
 
+#ifndef clist_render_queue_t_DEFINED
+#  define clist_render_queue_t_DEFINED
+typedef struct clist_render_queue_s clist_render_queue_t;
+#endif
+
 /* Define the state of a band list when reading. */
 /* For normal rasterizing, pages and num_pages are both 0. */
 typedef struct gx_device_clist_reader_s {
@@ -399,9 +410,7 @@ typedef struct gx_device_clist_reader_s {
     int num_render_threads;		/* number of threads being used */
     clist_render_thread_control_t *render_threads;	/* array of threads */
     byte *main_thread_data;		/* saved data pointer of main thread */
-    int curr_render_thread;		/* index into array */
-    int thread_lookahead_direction;	/* +1 or -1 */
-    int next_band;			/* may be < 0 or >= num bands when no more remain to render */
+    clist_render_queue_t *render_queue;	/* band queue shared with the threads */
 
 } gx_device_clist_reader;
 
@@ -444,7 +453,9 @@ extern_st(st_device_clist);
 /* The device template itself is never used, only the procedures. */
 extern const gx_device_procs gs_clist_device_procs;
 
-void clist_init_io_procs(gx_device_clist *pclist_dev, bool in_memory);
+/* compress_lz4 selects the LZ4 compressor for band lists kept in memory. */
+void clist_init_io_procs(gx_device_clist *pclist_dev, bool in_memory,
+                         bool compress_lz4);
 
 /* Reset (or prepare to append to) the command list after printing a page. */
 int clist_finish_page(gx_device * dev, bool flush);
@@ -560,6 +571,10 @@ clist_enable_multi_thread_render(gx_device *dev);
 void
 clist_teardown_render_threads(gx_device *dev);
 
+/* Stop the rendering threads kept for the device and free the pool */
+void
+clist_free_render_pool(gx_device *dev);
+
 #ifdef DEBUG
 #define clist_debug_rect clist_debug_rect_imp
 void clist_debug_rect_imp(int x, int y, int width, int height);
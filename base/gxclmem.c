@@ -20,10 +20,7 @@
 #include "gserrors.h"
 #include "gxclmem.h"
 #include "gssprintf.h"
-
-#ifdef PACIFY_VALGRIND
-#include "valgrind.h"
-#endif
+#include "slz4x.h"
 
 /*
  * Based on: memfile.c        Version: 1.4 3/21/95 14:59:33 by Ray Johnston.
@@ -70,6 +67,19 @@ COMPRESSION.
    used during subsequent compression when the last logical block of the
    file fills the physical block.
 
+   Where possible the compression is done by a thread of its own, so that
+   the writer doesn't stall: the logical blocks are queued for the thread in
+   file order, and the writer gets a new raw physical block for each block
+   it starts rather than re-using the one just compressed (the thread frees
+   that).  The queue is allowed to grow to the number of blocks in the file
+   when compression began, so memory use doesn't go beyond that point. If
+   the allocator isn't thread safe, or the thread can't be started, the
+   blocks are compressed inline as before.
+
+   The compressor is the one chosen for the build (see gxclzlib.c and
+   gxcllzw.c) unless the file was opened through clist_io_procs_memory_lz4,
+   which uses the much faster, though less thorough, LZ4 filters.
+
 DECOMPRESSION.
 
    During reading the clist, if the logical block points to an uncompressed
@@ -162,6 +172,17 @@ static const int64_t COMPRESSION_THRESHOLD =
   do {gs_free_object((f)->data_memory, obj, cname);\
     (f)->total_space -= sizeof(*(obj));} while (0)
 
+/* Queue at least this many blocks before the writer waits for the thread. */
+#define MIN_COMPRESS_QUEUE 16
+
+/* Lock the shared state, if there is a compression thread. */
+#define MEMFILE_LOCK(f)\
+  do {if ((f)->compress_monitor != NULL)\
+    gx_monitor_enter((f)->compress_monitor);} while (0)
+#define MEMFILE_UNLOCK(f)\
+  do {if ((f)->compress_monitor != NULL)\
+    gx_monitor_leave((f)->compress_monitor);} while (0)
+
 /* Structure descriptor for GC */
 private_st_MEMFILE();
 
@@ -171,6 +192,35 @@ static int memfile_init_empty(MEMFILE * f);
 static int memfile_set_memory_warning(clist_file_ptr cf, int bytes_left);
 static int memfile_fclose(clist_file_ptr cf, const char *fname, bool delete);
 static int memfile_get_pdata(MEMFILE * f);
+static int memfile_compress_stop(MEMFILE * f);
+
+/* Return the prototype filter states for this file's compressor. */
+static const stream_template *
+memfile_compressor_template(const MEMFILE * f)
+{
+    return (f->compress_lz4 ? &s_LZ4E_template : clist_compressor_template());
+}
+static const stream_template *
+memfile_decompressor_template(const MEMFILE * f)
+{
+    return (f->compress_lz4 ? &s_LZ4D_template : clist_decompressor_template());
+}
+static void
+memfile_compressor_init(const MEMFILE * f, stream_state *state)
+{
+    if (f->compress_lz4)
+        state->templat = &s_LZ4E_template;
+    else
+        clist_compressor_init(state);
+}
+static void
+memfile_decompressor_init(const MEMFILE * f, stream_state *state)
+{
+    if (f->compress_lz4)
+        state->templat = &s_LZ4D_template;
+    else
+        clist_decompressor_init(state);
+}
 
 /************************************************/
 /*   #define DEBUG      /- force statistics -/  */
@@ -207,6 +257,7 @@ allocateWithReserve(
     int code = 0;       /* assume success */
     void *block = MALLOC(f, sizeofBlock, allocName);
 
+    MEMFILE_LOCK(f);
     if (block == NULL) {
         /* Try to recover block from reserve */
         if (sizeofBlock == sizeof(LOG_MEMFILE_BLK)) {
@@ -231,6 +282,7 @@ allocateWithReserve(
         f->total_space += sizeofBlock;
     else
         code = gs_note_error(gs_error_VMerror);
+    MEMFILE_UNLOCK(f);
     *return_code = code;
     return block;
 }
@@ -238,9 +290,9 @@ allocateWithReserve(
 /* ---------------- Open/close/unlink ---------------- */
 
 static int
-memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
-              clist_file_ptr /*MEMFILE * */  * pf,
-              gs_memory_t *mem, gs_memory_t *data_mem, bool ok_to_compress)
+memfile_open(char fname[gp_file_name_sizeof], const char *fmode,
+             clist_file_ptr /*MEMFILE * */  * pf,
+             gs_memory_t *mem, gs_memory_t *data_mem, bool compress_lz4)
 {
     MEMFILE *f = NULL;
     int code = 0;
@@ -267,6 +319,11 @@ memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
         } else {
             /* We need to 'clone' this memfile so that each reader instance     */
             /* will be able to maintain it's own 'state'                        */
+            /* The copy has to see the block list as the background            */
+            /* compressor leaves it, so stop that first.                        */
+            if ((code = memfile_compress_stop(base_f)) < 0)
+                goto finish;
+            code = 0;           /* a low-memory warning is the writer's */
             f = gs_alloc_struct(mem, MEMFILE, &st_MEMFILE,
                                 "memfile_fopen_instance(MEMFILE)");
             if (f == NULL) {
@@ -291,6 +348,8 @@ memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
             f->log_curr_pos = 0;
             f->raw_head = NULL;
             f->error_code = 0;
+            f->compress_monitor = NULL;         /* the thread belongs to base_f */
+            f->compress_work = f->compress_done = NULL;
 
             if (f->log_head->phys_blk->data_limit != NULL) {
                 /* The file is compressed, so we need to copy the logical block */
@@ -299,7 +358,7 @@ memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
                 LOG_MEMFILE_BLK *log_block, *new_log_block;
                 int i;
                 int num_log_blocks = (f->log_length + MEMFILE_DATA_SIZE - 1) / MEMFILE_DATA_SIZE;
-                const stream_template *decompress_template = clist_decompressor_template();
+                const stream_template *decompress_template = memfile_decompressor_template(f);
 
                 new_log_block = MALLOC(f, num_log_blocks * sizeof(LOG_MEMFILE_BLK), "memfile_fopen" );
                 if (new_log_block == NULL) {
@@ -327,7 +386,7 @@ memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
                     code = gs_note_error(gs_error_VMerror);
                     goto finish;
                 }
-                clist_decompressor_init(f->decompress_state);
+                memfile_decompressor_init(f, f->decompress_state);
                 f->decompress_state->memory = mem;
                 if (decompress_template->set_defaults)
                     (*decompress_template->set_defaults) (f->decompress_state);
@@ -360,6 +419,9 @@ memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
     f->reservePhysBlockCount = 0;
     f->reserveLogBlockChain = NULL;
     f->reserveLogBlockCount = 0;
+    f->compress_lz4 = compress_lz4;
+    f->compress_monitor = NULL;
+    f->compress_work = f->compress_done = NULL;
     /* init an empty file           */
     if ((code = memfile_init_empty(f)) < 0)
         goto finish;
@@ -373,8 +435,8 @@ memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
     f->compress_state = 0;      /* make clean for GC */
     f->decompress_state = 0;
     if (f->ok_to_compress) {
-        const stream_template *compress_template = clist_compressor_template();
-        const stream_template *decompress_template = clist_decompressor_template();
+        const stream_template *compress_template = memfile_compressor_template(f);
+        const stream_template *decompress_template = memfile_decompressor_template(f);
 
         f->compress_state =
             gs_alloc_struct(mem, stream_state, compress_template->stype,
@@ -389,8 +451,8 @@ memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
             code = gs_note_error(gs_error_VMerror);
             goto finish;
         }
-        clist_compressor_init(f->compress_state);
-        clist_decompressor_init(f->decompress_state);
+        memfile_compressor_init(f, f->compress_state);
+        memfile_decompressor_init(f, f->decompress_state);
         f->compress_state->memory = mem;
         f->decompress_state->memory = mem;
         if (compress_template->set_defaults)
@@ -428,11 +490,31 @@ finish:
     return code;
 }
 
+static int
+memfile_fopen(char fname[gp_file_name_sizeof], const char *fmode,
+              clist_file_ptr /*MEMFILE * */  * pf,
+              gs_memory_t *mem, gs_memory_t *data_mem, bool ok_to_compress)
+{
+    return memfile_open(fname, fmode, pf, mem, data_mem, false);
+}
+
+static int
+memfile_fopen_lz4(char fname[gp_file_name_sizeof], const char *fmode,
+                  clist_file_ptr /*MEMFILE * */  * pf,
+                  gs_memory_t *mem, gs_memory_t *data_mem, bool ok_to_compress)
+{
+    return memfile_open(fname, fmode, pf, mem, data_mem, true);
+}
+
 static int
 memfile_fclose(clist_file_ptr cf, const char *fname, bool delete)
 {
     MEMFILE *const f = (MEMFILE *)cf;
+    int code;
 
+    /* Readers may follow, so finish off any background compression. */
+    if ((code = memfile_compress_stop(f)) < 0)
+        f->error_code = code;
     f->is_open = false;
     if (!delete) {
         if (f->base_memfile) {
@@ -456,23 +538,20 @@ memfile_fclose(clist_file_ptr cf, const char *fname, bool delete)
             /* If the file is compressed, free the logical blocks, but not */
             /* the phys_blk info (that is still used by the base memfile   */
             if (f->log_head->phys_blk->data_limit != NULL) {
-                LOG_MEMFILE_BLK *tmpbp, *bp = f->log_head;
-
-                while (bp != NULL) {
-                    tmpbp = bp->link;
-                    FREE(f, bp, "memfile_free_mem(log_blk)");
-                    bp = tmpbp;
-                }
+                /* memfile_fopen copied the logical blocks into one array */
+                FREE(f, f->log_head, "memfile_free_mem(log_blk)");
                 f->log_head = NULL;
 
-                /* Free any internal compressor state. */
-                if (f->compressor_initialized) {
-                    if (f->decompress_state->templat->release != 0)
-                        (*f->decompress_state->templat->release) (f->decompress_state);
-                    if (f->compress_state->templat->release != 0)
-                        (*f->compress_state->templat->release) (f->compress_state);
-                    f->compressor_initialized = false;
-                }
+                /* Free the decompressor state; a reader instance has no */
+                /* compressor, and only initializes the decompressor when */
+                /* it allocates the raw buffers.                          */
+                if (f->raw_head != NULL &&
+                    f->decompress_state->templat->release != 0)
+                    (*f->decompress_state->templat->release) (f->decompress_state);
+                gs_free_object(f->memory, f->decompress_state,
+                               "memfile_close_and_unlink(decompress_state)");
+                f->decompress_state = NULL;
+                f->compressor_initialized = false;
                 /* free the raw buffers                                           */
                 while (f->raw_head != NULL) {
                     RAW_BUFFER *tmpraw = f->raw_head->fwd;
@@ -562,6 +641,7 @@ memfile_set_memory_warning(clist_file_ptr cf, int bytes_left)
     if (f->raw_head == NULL)
         ++physNeeded;   /* have yet to allocate read buffers */
 
+    MEMFILE_LOCK(f);
     /* Allocate or free memory depending on need */
     while (logNeeded > f->reserveLogBlockCount) {
         LOG_MEMFILE_BLK *block =
@@ -605,6 +685,7 @@ memfile_set_memory_warning(clist_file_ptr cf, int bytes_left)
     }
     f->error_code = 0;  /* memfile_set_block_size is how user resets this */
 finish:
+    MEMFILE_UNLOCK(f);
     return code;
 }
 
@@ -633,9 +714,14 @@ compress_log_blk(MEMFILE * f, LOG_MEMFILE_BLK * bp)
                                                     &(f->rd), &(f->wt), true);
     bp->phys_blk->data_limit = (char *)(f->wt.ptr);
 
-    if (status == 1) {          /* More output space needed (see strimpl.h) */
+    /*
+     * A block that doesn't compress, starting near the end of a physical
+     * block, can spill over into a third one, so keep going as long as
+     * more output space is needed (see strimpl.h).
+     */
+    while (status == 1) {
         /* allocate another physical block, then compress remainder       */
-        compressed_size = f->wt.limit - start_ptr;
+        compressed_size += f->wt.limit - start_ptr;
         newphys =
             allocateWithReserve(f, sizeof(*newphys), &code, "memfile newphys",
                         "compress_log_blk : MALLOC for 'newphys' failed\n");
@@ -643,7 +729,7 @@ compress_log_blk(MEMFILE * f, LOG_MEMFILE_BLK * bp)
             return code;
         ecode |= code;  /* accumulate any low-memory warnings */
         newphys->link = NULL;
-        bp->phys_blk->link = newphys;
+        f->phys_curr->link = newphys;
         f->phys_curr = newphys;
         f->wt.ptr = (byte *) (newphys->data) - 1;
         f->wt.limit = f->wt.ptr + MEMFILE_DATA_SIZE;
@@ -652,16 +738,6 @@ compress_log_blk(MEMFILE * f, LOG_MEMFILE_BLK * bp)
         status =
             (*f->compress_state->templat->process)(f->compress_state,
                                                    &(f->rd), &(f->wt), true);
-        if (status != 0) {
-            /*
-             * You'd think the above line is a bug, but in real life 1 src
-             * block never ends up getting split across 3 dest blocks.
-             */
-            /* CHANGE memfile_set_memory_warning if this assumption changes. */
-            emprintf(f->memory,
-                     "Compression required more than one full block!\n");
-            return_error(gs_error_Fatal);
-        }
         newphys->data_limit = (char *)(f->wt.ptr);
     }
     compressed_size += f->wt.ptr - start_ptr;
@@ -677,6 +753,144 @@ compress_log_blk(MEMFILE * f, LOG_MEMFILE_BLK * bp)
     return (status < 0 ? gs_note_error(gs_error_ioerror) : ecode);
 }                               /* end "compress_log_blk()"                                     */
 
+/* ---------------- Background compression ---------------- */
+
+/* Compress the queued blocks in order until stopped. */
+static void
+memfile_compress_thread(void *data)
+{
+    MEMFILE *const f = (MEMFILE *)data;
+
+    for (;;) {
+        LOG_MEMFILE_BLK *bp;
+        PHYS_MEMFILE_BLK *oldphys;
+        int code;
+
+        gx_semaphore_wait(f->compress_work);
+        gx_monitor_enter(f->compress_monitor);
+        if (f->compress_pending == 0) {
+            /* Nothing queued, so this is the signal to stop. */
+            gx_monitor_leave(f->compress_monitor);
+            break;
+        }
+        bp = f->compress_next;
+        gx_monitor_leave(f->compress_monitor);
+
+        oldphys = bp->phys_blk;
+        code = compress_log_blk(f, bp);
+
+        gx_monitor_enter(f->compress_monitor);
+        if (code < 0) {
+            if (f->compress_code >= 0)
+                f->compress_code = code;
+        } else {
+            if (f->compress_code >= 0)
+                f->compress_code |= code;
+            FREE(f, oldphys, "memfile_compress_thread(oldphys)");
+        }
+        f->compress_next = bp->link;
+        f->compress_pending--;
+        if (f->compress_waiting) {
+            f->compress_waiting = false;
+            gx_semaphore_signal(f->compress_done);
+        }
+        gx_monitor_leave(f->compress_monitor);
+    }
+}
+
+/*
+ * Start compressing the blocks before 'last' on a thread of their own.
+ * Return false (leaving the compression to the caller) if the allocator
+ * isn't thread safe or the thread can't be started.
+ */
+static bool
+memfile_compress_start(MEMFILE * f, LOG_MEMFILE_BLK * last)
+{
+    gs_memory_status_t status;
+    LOG_MEMFILE_BLK *bp;
+    int i, count = 0;
+
+    gs_memory_status(f->data_memory, &status);
+    if (!status.is_thread_safe)
+        return false;
+    for (bp = f->log_head; bp != last; bp = bp->link)
+        count++;
+    f->compress_monitor = gx_monitor_label(gx_monitor_alloc(f->memory),
+                                           "memfile compress");
+    f->compress_work = gx_semaphore_label(gx_semaphore_alloc(f->memory),
+                                          "memfile compress work");
+    f->compress_done = gx_semaphore_label(gx_semaphore_alloc(f->memory),
+                                          "memfile compress done");
+    if (f->compress_monitor != NULL && f->compress_work != NULL &&
+        f->compress_done != NULL) {
+        f->compress_next = f->log_head;
+        f->compress_pending = count;
+        f->compress_limit = max(count, MIN_COMPRESS_QUEUE);
+        f->compress_waiting = false;
+        f->compress_code = 0;
+        if (gp_thread_start(memfile_compress_thread, f,
+                            &f->compress_thread) >= 0) {
+            for (i = 0; i < count; i++)
+                gx_semaphore_signal(f->compress_work);
+            if_debug1m(':', f->memory,
+                       "[:]Compressing %d blocks in the background\n", count);
+            return true;
+        }
+    }
+    if (f->compress_done != NULL)
+        gx_semaphore_free(f->compress_done);
+    if (f->compress_work != NULL)
+        gx_semaphore_free(f->compress_work);
+    if (f->compress_monitor != NULL)
+        gx_monitor_free(f->compress_monitor);
+    f->compress_monitor = NULL;
+    f->compress_work = f->compress_done = NULL;
+    return false;
+}
+
+/*
+ * Wait until no more than max_pending blocks are queued.  Return any error
+ * or low-memory warning from the thread; warnings are only reported once.
+ */
+static int
+memfile_compress_wait(MEMFILE * f, int max_pending)
+{
+    int code;
+
+    gx_monitor_enter(f->compress_monitor);
+    while (f->compress_pending > max_pending) {
+        f->compress_waiting = true;
+        gx_monitor_leave(f->compress_monitor);
+        gx_semaphore_wait(f->compress_done);
+        gx_monitor_enter(f->compress_monitor);
+    }
+    code = f->compress_code;
+    if (code > 0)
+        f->compress_code = 0;
+    gx_monitor_leave(f->compress_monitor);
+    return code;
+}
+
+/* Finish the queue and stop the compression thread, if there is one. */
+/* Any later compression is done inline. */
+static int
+memfile_compress_stop(MEMFILE * f)
+{
+    int code;
+
+    if (f->compress_monitor == NULL)
+        return 0;
+    code = memfile_compress_wait(f, 0);
+    gx_semaphore_signal(f->compress_work);
+    gp_thread_finish(f->compress_thread);
+    gx_semaphore_free(f->compress_done);
+    gx_semaphore_free(f->compress_work);
+    gx_monitor_free(f->compress_monitor);
+    f->compress_monitor = NULL;
+    f->compress_work = f->compress_done = NULL;
+    return code;
+}
+
 /*      Internal (private) routine to handle end of logical block       */
 static int      /* ret 0 ok, -ve error, or +ve low-memory warning */
 memfile_next_blk(MEMFILE * f)
@@ -687,7 +901,8 @@ memfile_next_blk(MEMFILE * f)
     int ecode = 0;              /* accumulate low-memory warnings */
     int code;
 
-    if (f->phys_curr == NULL) { /* means NOT compressing                */
+    /* (phys_curr belongs to the compression thread while it runs)    */
+    if (f->compress_monitor == NULL && f->phys_curr == NULL) { /* means NOT compressing */
         /* allocate a new block                                           */
         newphys =
             allocateWithReserve(f, sizeof(*newphys), &code, "memfile newphys",
@@ -730,6 +945,8 @@ memfile_next_blk(MEMFILE * f)
             f->wt.ptr = (byte *) (newphys->data) - 1;
             f->wt.limit = f->wt.ptr + MEMFILE_DATA_SIZE;
             bp = f->log_head;
+            if (memfile_compress_start(f, newbp))
+                bp = newbp;     /* the thread does the loop below       */
             while (bp != newbp) {       /* don't compress last block    */
                 int code;
 
@@ -756,7 +973,43 @@ memfile_next_blk(MEMFILE * f)
         f->pdata = newphys->data;
         f->pdata_end = newphys->data + MEMFILE_DATA_SIZE;
     }    /* end if NOT compressing                                 */
-    /* File IS being compressed                                       */
+    /* File IS being compressed, in the background                    */
+    else if (f->compress_monitor != NULL) {
+        /* Queue this block and carry on in a new raw physical block      */
+        newphys =
+            allocateWithReserve(f, sizeof(*newphys), &code, "memfile newphys",
+                        "memfile_next_blk: MALLOC 3 for 'newphys' failed\n");
+        if (code < 0)
+            return code;
+        ecode |= code;
+        newphys->link = NULL;
+        newphys->data_limit = NULL;     /* raw                          */
+        newbp =
+            allocateWithReserve(f, sizeof(*newbp), &code, "memfile newbp",
+                        "memfile_next_blk: MALLOC 3 for 'newbp' failed\n");
+        if (code < 0) {
+            MEMFILE_LOCK(f);
+            FREE(f, newphys, "memfile newphys");
+            MEMFILE_UNLOCK(f);
+            return code;
+        }
+        ecode |= code;
+        newbp->link = NULL;
+        newbp->raw_block = NULL;
+        newbp->phys_blk = newphys;
+        gx_monitor_enter(f->compress_monitor);
+        bp->link = newbp;
+        f->compress_pending++;
+        gx_monitor_leave(f->compress_monitor);
+        gx_semaphore_signal(f->compress_work);
+        f->pdata = newphys->data;
+        f->pdata_end = f->pdata + MEMFILE_DATA_SIZE;
+        f->log_curr_blk = newbp;
+        if ((code = memfile_compress_wait(f, f->compress_limit)) < 0)
+            return code;
+        ecode |= code;
+    }
+    /* File IS being compressed, inline                               */
     else {
         int code;
 
@@ -845,6 +1098,7 @@ memfile_get_pdata(MEMFILE * f)
 {
     int code, i, num_raw_buffers, status;
     LOG_MEMFILE_BLK *bp = f->log_curr_blk;
+    PHYS_MEMFILE_BLK *pphys;
 
     if (bp->phys_blk->data_limit == NULL) {
         /* Not compressed, return this data pointer                       */
@@ -943,18 +1197,25 @@ memfile_get_pdata(MEMFILE * f)
 #endif
             status = (*f->decompress_state->templat->process)
                 (f->decompress_state, &(f->rd), &(f->wt), true);
-            if (status == 0) {  /* More input data needed */
+            pphys = bp->phys_blk;
+            while (status == 0) {       /* More input data needed */
                 /* switch to next block and continue decompress             */
                 int back_up = 0;        /* adjust pointer backwards     */
 
+                if (pphys->link == NULL) {
+                    emprintf(f->memory,
+                             "Decompression ran out of compressed data!\n");
+                    return_error(gs_error_Fatal);
+                }
                 if (f->rd.ptr != f->rd.limit) {
                     /* transfer remainder bytes from the previous block      */
                     back_up = f->rd.limit - f->rd.ptr;
                     for (i = 0; i < back_up; i++)
-                        *(bp->phys_blk->link->data - back_up + i) = *++f->rd.ptr;
+                        *(pphys->link->data - back_up + i) = *++f->rd.ptr;
                 }
-                f->rd.ptr = (const byte *)bp->phys_blk->link->data - back_up - 1;
-                f->rd.limit = (const byte *)bp->phys_blk->link->data_limit;
+                pphys = pphys->link;
+                f->rd.ptr = (const byte *)pphys->data - back_up - 1;
+                f->rd.limit = (const byte *)pphys->data_limit;
 #ifdef DEBUG
                 decomp_wt_ptr1 = f->wt.ptr;
                 decomp_wt_limit1 = f->wt.limit;
@@ -963,11 +1224,6 @@ memfile_get_pdata(MEMFILE * f)
 #endif
                 status = (*f->decompress_state->templat->process)
                     (f->decompress_state, &(f->rd), &(f->wt), true);
-                if (status == 0) {
-                    emprintf(f->memory,
-                             "Decompression required more than one full block!\n");
-                    return_error(gs_error_Fatal);
-                }
             }
             bp->raw_block = f->raw_head;        /* point to raw block           */
         }
@@ -1010,7 +1266,10 @@ memfile_fread_chars(void *data, uint len, clist_file_ptr cf)
     char *str = (char *)data;
     MEMFILE *f = (MEMFILE *) cf;
     uint count = len, num_read, move_count;
+    int code;
 
+    if ((code = memfile_compress_stop(f)) < 0)
+        f->error_code = code;
     num_read = f->log_length - f->log_curr_pos;
     if (count > num_read)
         count = num_read;
@@ -1037,6 +1296,12 @@ memfile_fread_chars(void *data, uint len, clist_file_ptr cf)
 
 /* ---------------- Position/status ---------------- */
 
+static void
+memfile_set_read_ahead(clist_file_ptr cf, bool read_ahead)
+{
+    /* no-op: the data is already in memory */
+}
+
 static int
 memfile_ferror_code(clist_file_ptr cf)
 {
@@ -1053,7 +1318,10 @@ static void
 memfile_rewind(clist_file_ptr cf, bool discard_data, const char *ignore_fname)
 {
     MEMFILE *f = (MEMFILE *) cf;
+    int code;
 
+    if ((code = memfile_compress_stop(f)) < 0)
+        f->error_code = code;
     if (discard_data) {
         /* This affects the memfile data, not just the MEMFILE * access struct */
         /* Check first to make sure that we have exclusive access */
@@ -1080,6 +1348,10 @@ memfile_fseek(clist_file_ptr cf, int64_t offset, int mode, const char *ignore_fn
 {
     MEMFILE *f = (MEMFILE *) cf;
     int64_t i, block_num, new_pos;
+    int code;
+
+    if ((code = memfile_compress_stop(f)) < 0)
+        f->error_code = code;
 
     switch (mode) {
         case SEEK_SET:          /* offset from the beginning of the file */
@@ -1126,6 +1398,8 @@ memfile_free_mem(MEMFILE * f)
 {
     LOG_MEMFILE_BLK *bp, *tmpbp;
 
+    /* The data is about to go, so any errors compressing it don't matter. */
+    memfile_compress_stop(f);
 #ifdef DEBUG
     /* output some diagnostics about the effectiveness                   */
     if (tot_raw > 100) {
@@ -1261,15 +1535,30 @@ clist_io_procs_t clist_io_procs_memory = {
     memfile_ftell,
     memfile_rewind,
     memfile_fseek,
+    memfile_set_read_ahead,
+};
+
+clist_io_procs_t clist_io_procs_memory_lz4 = {
+    memfile_fopen_lz4,
+    memfile_fclose,
+    memfile_unlink,
+    memfile_fwrite_chars,
+    memfile_fread_chars,
+    memfile_set_memory_warning,
+    memfile_ferror_code,
+    memfile_ftell,
+    memfile_rewind,
+    memfile_fseek,
+    memfile_set_read_ahead,
 };
 
 init_proc(gs_gxclmem_init);
 int
 gs_gxclmem_init(gs_memory_t *mem)
 {
-#ifdef PACIFY_VALGRIND
-    VALGRIND_HG_DISABLE_CHECKING(&clist_io_procs_memory_global, sizeof(clist_io_procs_memory_global));
-#endif
-    clist_io_procs_memory_global = &clist_io_procs_memory;
+    gs_lib_ctx_t *ctx = mem->gs_lib_ctx;
+
+    ctx->clist_io_procs_memory = &clist_io_procs_memory;
+    ctx->clist_io_procs_memory_lz4 = &clist_io_procs_memory_lz4;
     return 0;
 }
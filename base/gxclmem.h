@@ -21,6 +21,7 @@
 
 #include "gxclio.h"		/* defines interface */
 #include "strimpl.h"		/* stream structures      */
+#include "gxsync.h"		/* for the compression thread */
 
 /*
  * The best values of MEMFILE_DATA_SIZE are slightly less than a power of 2,
@@ -118,8 +119,28 @@ struct MEMFILE_s {
     stream_cursor_read rd;	/* use .ptr, .limit */			/******* READER INSTANCE *******/
     stream_cursor_write wt;	/* use .ptr, .limit */			/******* READER INSTANCE *******/
     bool compressor_initialized;
+    bool compress_lz4;		/* use LZ4 rather than the build's compressor */
     stream_state *compress_state;
     stream_state *decompress_state;					/******* READER INSTANCE *******/
+        /*
+         * Once compression has begun, the writer hands each logical block
+         * it fills to a compression thread (if the allocator is thread safe
+         * and threads are available) and carries on in a fresh raw block.
+         * The thread compresses the queued blocks in order, starting at
+         * compress_next.  The monitor protects the queue counts, total_space
+         * and the reserve chains while the thread runs.  The thread is
+         * stopped, after finishing the queue, before the file is read,
+         * repositioned, reset or closed.
+         */
+    gx_monitor_t *compress_monitor;	/* NULL if not compressing in the background */
+    gx_semaphore_t *compress_work;	/* signalled once per queued block, and to stop */
+    gx_semaphore_t *compress_done;	/* signalled when compress_waiting is set */
+    gp_thread_id compress_thread;
+    LOG_MEMFILE_BLK *compress_next;	/* oldest block not yet compressed */
+    int compress_pending;	/* # of blocks queued for the thread */
+    int compress_limit;		/* writer waits while more than this are queued */
+    bool compress_waiting;	/* writer is waiting for compress_pending to drop */
+    int compress_code;		/* error or low-memory warning from the thread */
 };
 #ifndef MEMFILE_DEFINED
 #define MEMFILE_DEFINED
@@ -455,6 +455,7 @@ do_page_load(gx_device_printer *pdev, gx_saved_page *page, clist_file_ptr *save_
     crdev->num_pages = 1;		/* single page at a time */
     crdev->offset_map = NULL;
     crdev->render_threads = NULL;
+    crdev->render_queue = NULL;
     crdev->ymin = crdev->ymax = 0;      /* invalidate buffer contents to force rasterizing */
 
     /* We probably don't need to copy in the filenames, but do it in case something expects it */
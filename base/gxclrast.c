@@ -1523,6 +1523,7 @@ idata:                  data_size = 0;
                                 }
                             }
                         }
+idata_planes:
 #ifdef DEBUG
                         if (gs_debug_c('L')) {
                             int plane;
@@ -1770,6 +1771,42 @@ idata:                  data_size = 0;
                                 state.color_is_devn = false;
                                 if_debug0m('L', mem, " ext_unset_color_is_devn\n");
                                 break;
+                            case cmd_opv_ext_image_data_ref:
+                                {
+                                    uint bytes_per_plane, raster, plane_size;
+                                    uint span;
+                                    int64_t pos;
+                                    int plane;
+
+                                    cmd_getw(data_height, cbp);
+                                    cmd_getw(bytes_per_plane, cbp);
+                                    cmd_getw(raster, cbp);
+                                    cmd_getw(plane_size, cbp);
+                                    memcpy(&pos, cbp, sizeof(pos));
+                                    cbp += sizeof(pos);
+                                    if_debug3m('L', mem,
+                                               " ext_image_data_ref height=%u raster=%u pos=%"PRId64"\n",
+                                               data_height, raster, pos);
+                                    /* Read each plane's rows from the shared block. */
+                                    span = (data_height - 1) * raster + bytes_per_plane;
+                                    data_on_heap =
+                                        gs_alloc_bytes(mem, span * image_info->num_planes,
+                                                       "clist image_data_ref");
+                                    if (data_on_heap == 0) {
+                                        code = gs_note_error(gs_error_VMerror);
+                                        goto out;
+                                    }
+                                    for (plane = 0; plane < image_info->num_planes;
+                                         ++plane) {
+                                        planes[plane].data = data_on_heap + plane * span;
+                                        planes[plane].raster = raster;
+                                        planes[plane].data_x = data_x;
+                                        clist_read_chunk(cdev,
+                                                   pos + (int64_t)plane * plane_size,
+                                                   span, data_on_heap + plane * span);
+                                    }
+                                }
+                                goto idata_planes;
                             case cmd_opv_ext_tile_rect_hl:
                                 /* Strip tile with devn colors */
                                 cbp = cmd_read_rect(op & 0xf0, &state.rect, cbp);
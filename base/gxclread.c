@@ -88,6 +88,7 @@ s_band_read_init(stream_state * st)
     ss->b_this.band_max = 0;
     ss->b_this.pos = 0;
     io_procs->rewind(ss->page_bfile, false, ss->page_bfname);
+    io_procs->set_read_ahead(ss->page_cfile, true);
     return 0;
 }
 
@@ -566,6 +567,7 @@ clist_render_init(gx_device_clist *dev)
     crdev->icc_table = NULL;
     crdev->color_usage_array = NULL;
     crdev->render_threads = NULL;
+    crdev->render_queue = NULL;
 
     return 0;
 }
@@ -39,8 +39,9 @@
 #include "gzht.h"		/* for gx_ht_cache_default_bits_size */
 
 /* Forward reference prototypes */
-static int clist_start_render_thread(gx_device *dev, int thread_index, int band);
-static void clist_render_thread(void *param);
+static clist_render_pool_t *clist_get_render_pool(gx_device *dev);
+static int clist_grow_render_pool(clist_render_pool_t *pool, int num_threads);
+static void clist_render_thread(clist_render_thread_control_t *thread);
 
 /* clone a device and set params and its chunk memory                   */
 /* The chunk_base_mem MUST be thread safe                               */
@@ -281,6 +282,121 @@ out_cleanup:
     return NULL;
 }
 
+/* Free the band queue along with its reorder buffer slots */
+static void
+clist_free_render_queue(clist_render_queue_t *queue, gx_device *dev,
+                        gx_process_page_options_t *options)
+{
+    gs_memory_t *mem;
+    int i;
+
+    if (queue == NULL)
+        return;
+    mem = queue->memory;
+    for (i = 0; i < queue->num_slots; i++) {
+        clist_render_slot_t *slot = &(queue->slots[i]);
+
+        if (slot->buffer != NULL && options && options->free_buffer_fn)
+            options->free_buffer_fn(options->arg, dev, mem, slot->buffer);
+        gs_free_object(mem, slot->alloc, "clist_free_render_queue");
+    }
+    gs_free_object(mem, queue->slots, "clist_free_render_queue");
+    gx_semaphore_free(queue->band_done);
+    gx_monitor_free(queue->lock);
+    gs_free_object(mem, queue, "clist_free_render_queue");
+}
+
+/* Allocate the band queue. The slots themselves are added as each */
+/* thread is set up, see clist_add_render_slots.                   */
+static clist_render_queue_t *
+clist_alloc_render_queue(gs_memory_t *mem, int num_threads, int band_count)
+{
+    clist_render_queue_t *queue;
+
+    queue = (clist_render_queue_t *)gs_alloc_bytes(mem, sizeof(clist_render_queue_t),
+                                                   "clist_alloc_render_queue");
+    if (queue == NULL)
+        return NULL;
+    memset(queue, 0, sizeof(clist_render_queue_t));
+    queue->memory = mem;
+    queue->band_count = band_count;
+    queue->next_band = -1;
+    queue->direction = 1;
+    queue->slots = (clist_render_slot_t *)gs_alloc_byte_array(mem,
+                            num_threads * CLIST_RENDER_SLOTS_PER_THREAD,
+                            sizeof(clist_render_slot_t), "clist_alloc_render_queue");
+    if (queue->slots == NULL ||
+        (queue->lock = gx_monitor_label(gx_monitor_alloc(mem), "Band queue")) == NULL ||
+        (queue->band_done = gx_semaphore_label(gx_semaphore_alloc(mem), "Band done")) == NULL) {
+        clist_free_render_queue(queue, NULL, NULL);
+        return NULL;
+    }
+    return queue;
+}
+
+/* Add the reorder buffer slots for one thread. Each slot gets a data */
+/* area the same size as the thread device's, and a process_page      */
+/* buffer, so that completed bands can be parked there while the      */
+/* thread goes on to the next one.                                    */
+static int
+clist_add_render_slots(clist_render_queue_t *queue, gx_device *dev, gx_device *ndev,
+                       gx_process_page_options_t *options, int band_height)
+{
+    uint size = ((gx_device_clist_common *)ndev)->data_size;
+    int i, code;
+
+    for (i = 0; i < CLIST_RENDER_SLOTS_PER_THREAD; i++) {
+        clist_render_slot_t *slot = &(queue->slots[queue->num_slots]);
+
+        slot->band = -1;
+        slot->buffer = NULL;
+        slot->alloc = slot->data = gs_alloc_bytes(queue->memory, size, "clist_add_render_slots");
+        if (slot->alloc == NULL)
+            return_error(gs_error_VMerror);
+        queue->num_slots++;
+        if (options && options->init_buffer_fn) {
+            code = options->init_buffer_fn(options->arg, dev, queue->memory, dev->width, band_height, &slot->buffer);
+            if (code < 0)
+                return code;
+        }
+    }
+    return 0;
+}
+
+/* The number of bands that may be started now. Bands beyond the     */
+/* reorder buffer can't be started until the main thread catches up, */
+/* since there would be nowhere to park them. Must be called with the */
+/* queue lock held.                                                   */
+static int
+clist_render_queue_startable(clist_render_queue_t *queue)
+{
+    int avail, left;
+
+    if (queue->quit || queue->next_band < 0 || queue->next_band >= queue->band_count)
+        return 0;
+    avail = queue->num_slots - (queue->next_band - queue->curr_band) * queue->direction;
+    left = queue->direction > 0 ? queue->band_count - queue->next_band : queue->next_band + 1;
+    return min(avail, left);
+}
+
+/* Wake up enough pool threads to take the bands that may be started */
+/* now on the page's idle thread controls. Must be called with the   */
+/* queue lock held.                                                  */
+static void
+clist_wake_render_threads(clist_render_queue_t *queue)
+{
+    int i, idle = 0;
+    int avail = clist_render_queue_startable(queue);
+
+    for (i = 0; i < queue->num_threads; i++)
+        if (queue->threads[i].status == THREAD_IDLE)
+            idle++;
+    if (avail > idle)
+        avail = idle;
+    while (avail-- > 0)
+        gx_semaphore_signal(queue->pool->wake);
+}
+
 /* Set up and start the render threads */
 static int
 clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *options)
@@ -292,7 +408,9 @@ clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *opt
     gs_memory_t *mem = cdev->bandlist_memory;
     gs_memory_t *chunk_base_mem = mem->thread_safe_memory;
     gs_memory_status_t mem_status;
-    int i, j, band;
+    clist_render_pool_t *pool;
+    clist_render_queue_t *queue, **pq;
+    int i, j, band, pool_threads;
     int code = 0;
     int band_count = cdev->nbands;
     int band_height = crdev->page_info.band_params.BandHeight;
@@ -323,6 +441,32 @@ clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *opt
     if (crdev->num_render_threads > band_count)
         crdev->num_render_threads = band_count; /* don't bother starting more threads than bands */
 
+    /* If the 'mem' is not thread safe, we need to wrap it in a locking memory */
+    gs_memory_status(chunk_base_mem, &mem_status);
+    if (mem_status.is_thread_safe == false) {
+            return_error(gs_error_VMerror);
+    }
+    if ((pool = clist_get_render_pool(dev)) == NULL)
+        return_error(gs_error_VMerror);
+
+    /* If we don't have one large enough already, create an icc cache list */
+    if (crdev->num_render_threads > crdev->icc_cache_list_len) {
+        gsicc_link_cache_t **old = crdev->icc_cache_list;
+        crdev->icc_cache_list = (gsicc_link_cache_t **)gs_alloc_byte_array(mem->thread_safe_memory,
+                                    crdev->num_render_threads,
+                                    sizeof(void*), "clist_render_setup_threads");
+        if (crdev->icc_cache_list == NULL) {
+            crdev->icc_cache_list = NULL;
+            return_error(gs_error_VMerror);
+        }
+        if (crdev->icc_cache_list_len > 0)
+            memcpy(crdev->icc_cache_list, old, crdev->icc_cache_list_len * sizeof(gsicc_link_cache_t *));
+        memset(&(crdev->icc_cache_list[crdev->icc_cache_list_len]), 0,
+            (crdev->num_render_threads - crdev->icc_cache_list_len) * sizeof(void *));
+        crdev->icc_cache_list_len = crdev->num_render_threads;
+        gs_free_object(mem, old, "clist_render_setup_threads");
+    }
+
     /* Allocate and initialize an array of thread control structures */
     crdev->render_threads = (clist_render_thread_control_t *)
               gs_alloc_byte_array(mem, crdev->num_render_threads,
@@ -337,49 +481,31 @@ clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *opt
                                                         crdev->num_render_threads,
                                                         sizeof(void *),
                                                         "clist_setup_render_threads");
-    if (reserve_memory_array == NULL) {
+    crdev->render_queue = queue = clist_alloc_render_queue(chunk_base_mem,
+                                                   crdev->num_render_threads, band_count);
+    if (reserve_memory_array == NULL || queue == NULL) {
+        gs_free_object(mem, reserve_memory_array, "clist_setup_render_threads");
         gs_free_object(mem, crdev->render_threads, "clist_setup_render_threads");
         crdev->render_threads = NULL;
+        clist_free_render_queue(queue, dev, options);
+        crdev->render_queue = NULL;
         emprintf(mem, " VMerror prevented threads from starting.\n");
         return_error(gs_error_VMerror);
     }
     memset(reserve_memory_array, 0, crdev->num_render_threads * sizeof(void *));
     memset(crdev->render_threads, 0, crdev->num_render_threads *
             sizeof(clist_render_thread_control_t));
+    queue->pool = pool;
+    queue->threads = crdev->render_threads;
 
     crdev->main_thread_data = cdev->data;               /* save data area */
     /* Based on the line number requested, decide the order of band rendering */
     /* Almost all devices go in increasing line order (except the bmp* devices ) */
-    crdev->thread_lookahead_direction = (y < (cdev->height - 1)) ? 1 : -1;
+    queue->direction = (y < (cdev->height - 1)) ? 1 : -1;
     band = y / band_height;
 
-    /* If the 'mem' is not thread safe, we need to wrap it in a locking memory */
-    gs_memory_status(chunk_base_mem, &mem_status);
-    if (mem_status.is_thread_safe == false) {
-            return_error(gs_error_VMerror);
-    }
-
-    /* If we don't have one large enough already, create an icc cache list */
-    if (crdev->num_render_threads > crdev->icc_cache_list_len) {
-        gsicc_link_cache_t **old = crdev->icc_cache_list;
-        crdev->icc_cache_list = (gsicc_link_cache_t **)gs_alloc_byte_array(mem->thread_safe_memory,
-                                    crdev->num_render_threads,
-                                    sizeof(void*), "clist_render_setup_threads");
-        if (crdev->icc_cache_list == NULL) {
-            crdev->icc_cache_list = NULL;
-            return_error(gs_error_VMerror);
-        }
-        if (crdev->icc_cache_list_len > 0)
-            memcpy(crdev->icc_cache_list, old, crdev->icc_cache_list_len * sizeof(gsicc_link_cache_t *));
-        memset(&(crdev->icc_cache_list[crdev->icc_cache_list_len]), 0,
-            (crdev->num_render_threads - crdev->icc_cache_list_len) * sizeof(void *));
-        crdev->icc_cache_list_len = crdev->num_render_threads;
-        gs_free_object(mem, old, "clist_render_setup_threads");
-    }
-
     /* Loop creating the devices and semaphores for each thread, then start them */
-    for (i=0; (i < crdev->num_render_threads) && (band >= 0) && (band < band_count);
-            i++, band += crdev->thread_lookahead_direction) {
+    for (i=0; i < crdev->num_render_threads; i++) {
         gx_device *ndev;
         clist_render_thread_control_t *thread = &(crdev->render_threads[i]);
 
@@ -399,36 +525,33 @@ clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *opt
 
         thread->cdev = ndev;
         thread->memory = ndev->memory;
+        /* Let the thread keep its large buffers (pdf14 and the like) from
+           band to band, up to what we reserved for it, so that it doesn't
+           go back to the locked heap for them every band. */
+        gs_memory_chunk_set_retain(thread->memory, reserve_size + reserve_pdf14_memory_size);
+        thread->queue = queue;
         thread->band = -1;              /* a value that won't match any valid band */
         thread->options = options;
         thread->buffer = NULL;
+        /* The process_page buffers move between the threads and the reorder  */
+        /* buffer, so they all come from the (thread safe) queue allocator.   */
         if (options && options->init_buffer_fn) {
-            code = options->init_buffer_fn(options->arg, dev, thread->memory, dev->width, band_height, &thread->buffer);
+            code = options->init_buffer_fn(options->arg, dev, queue->memory, dev->width, band_height, &thread->buffer);
             if (code < 0)
                 break;
         }
 
-        /* create the buf device for this thread, and allocate the semaphores */
+        /* create the buf device for this thread */
         if ((code = gdev_create_buf_device(cdev->buf_procs.create_buf_device,
                                 &(thread->bdev), ndev,
                                 band*crdev->page_band_height, NULL,
                                 thread->memory, &(crdev->color_usage_array[0])) < 0))
             break;
-        if ((thread->sema_this = gx_semaphore_label(gx_semaphore_alloc(thread->memory), "Band")) == NULL ||
-            (thread->sema_group = gx_semaphore_label(gx_semaphore_alloc(thread->memory), "Group")) == NULL) {
-            code = gs_error_VMerror;
+        if ((code = clist_add_render_slots(queue, dev, ndev, options, band_height)) < 0)
             break;
-        }
-        /* We don't start the threads yet until we  free up the */
-        /* reserve memory we have allocated for that band. */
-        thread->band = band;
     }
     /* If the code < 0, the last thread creation failed -- clean it up */
     if (code < 0) {
-        /* NB: 'band' will be the one that failed, so will be the next_band needed to start */
-        /* the following relies on 'free' ignoring NULL pointers */
-        gx_semaphore_free(crdev->render_threads[i].sema_group);
-        gx_semaphore_free(crdev->render_threads[i].sema_this);
         if (crdev->render_threads[i].bdev != NULL)
             cdev->buf_procs.destroy_buf_device(crdev->render_threads[i].bdev);
         if (crdev->render_threads[i].cdev != NULL) {
@@ -444,7 +567,7 @@ clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *opt
             "clist_setup_render_threads");
         }
         if (crdev->render_threads[i].buffer != NULL && options && options->free_buffer_fn != NULL) {
-            options->free_buffer_fn(options->arg, dev, crdev->render_threads[i].memory, crdev->render_threads[i].buffer);
+            options->free_buffer_fn(options->arg, dev, queue->memory, crdev->render_threads[i].buffer);
             crdev->render_threads[i].buffer = NULL;
         }
         if (crdev->render_threads[i].memory != NULL) {
@@ -464,6 +587,8 @@ clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *opt
         }
         gs_free_object(mem, crdev->render_threads, "clist_setup_render_threads");
         crdev->render_threads = NULL;
+        clist_free_render_queue(queue, dev, options);
+        crdev->render_queue = NULL;
         /* restore the file pointers */
         if (cdev->page_info.cfile == NULL) {
             char fmode[4];
@@ -477,27 +602,43 @@ clist_setup_render_threads(gx_device *dev, int y, gx_process_page_options_t *opt
                                 mem, cdev->bandlist_memory, false);
             cdev->page_info.io_procs->fseek(cdev->page_info.bfile, 0, SEEK_SET, cdev->page_info.bfname);
         }
+        gs_free_object(mem, reserve_memory_array, "clist_setup_render_threads");
         emprintf1(mem, "Rendering threads not started, code=%d.\n", code);
         return_error(code);
     }
-    /* Free up any "reserve" memory we may have allocated, and start the
-     * threads since we deferred that in the thread setup loop above.
-     * We know if we get here we can start at least 1 thread.
+    /* Free up any "reserve" memory we may have allocated, and make sure
+     * the pool has the threads, since we deferred that in the thread setup
+     * loop above. The pool threads are kept until the device is closed,
+     * so they are only started once.
      */
-    for (j=0, code = 0; j<crdev->num_render_threads; j++) {
+    for (j=0; j<crdev->num_render_threads; j++)
         gs_free_object(mem, reserve_memory_array[j], "clist_setup_render_threads");
-        if (code == 0 && j < i)
-            code = clist_start_render_thread(dev, j, crdev->render_threads[j].band);
-    }
     gs_free_object(mem, reserve_memory_array, "clist_setup_render_threads");
-    crdev->num_render_threads = i;
-    crdev->curr_render_thread = 0;
-    crdev->next_band = band;
+    crdev->num_render_threads = queue->num_threads = i;
+    pool_threads = clist_grow_render_pool(pool, crdev->num_render_threads);
+    if (pool_threads < 0) {
+        code = pool_threads;
+        clist_teardown_render_threads(dev);
+        emprintf1(mem, "Rendering threads not started, code=%d.\n", code);
+        return_error(code);
+    }
+
+    /* Put the page on the pool, after any pages already being rendered */
+    gx_monitor_enter(pool->lock);
+    for (pq = &pool->queues; *pq != NULL; pq = &(*pq)->next)
+        ;
+    *pq = queue;
+    gx_monitor_leave(pool->lock);
+
+    gx_monitor_enter(queue->lock);
+    queue->curr_band = queue->next_band = band;
+    clist_wake_render_threads(queue);
+    gx_monitor_leave(queue->lock);
 
     if(gs_debug[':'] != 0)
-        dmprintf1(mem, "%% Using %d rendering threads\n", i);
+        dmprintf2(mem, "%% Using %d rendering threads on %d pool threads\n", i, pool_threads);
 
-    return code;
+    return 0;
 }
 
 /* This is also exported for teardown after background printing */
@@ -515,6 +656,8 @@ teardown_device_and_mem_for_thread(gx_device *dev, gp_thread_id thread_id, bool
         /* we are cleaning up a background printing thread, so we clean up similarly to */
         /* what is done  by clist_finish_page, but without re-opening the clist files.  */
         clist_teardown_render_threads(dev);	/* we may have used multiple threads */
+        /* The threads were lent by the printer device, which keeps them */
+        thread_cdev->render_pool = NULL;
         /* free the thread's icc_table since this was not done by clist_finish_page */
         clist_free_icc_table(thread_crdev->icc_table, thread_memory);
         thread_crdev->icc_table = NULL;
@@ -530,6 +673,8 @@ teardown_device_and_mem_for_thread(gx_device *dev, gp_thread_id thread_id, bool
          */
         thread_crdev->icc_table = NULL;
     }
+    /* Let the next thread have this one's color memos on any shared links */
+    gsicc_cache_release_color_memos(thread_crdev->icc_cache_cl, thread_memory);
     rc_decrement(thread_crdev->icc_cache_cl, "teardown_render_thread");
     thread_crdev->icc_cache_cl = NULL;
     /*
@@ -570,44 +715,93 @@ clist_teardown_render_threads(gx_device *dev)
     gx_device_clist_common *cdev = (gx_device_clist_common *)dev;
     gx_device_clist_reader *crdev = &cldev->reader;
     gs_memory_t *mem = cdev->bandlist_memory;
-    int i;
+    clist_render_queue_t *queue = crdev->render_queue;
+    clist_render_pool_t *pool;
+    clist_render_queue_t **pq;
+    gx_process_page_options_t *options;
+    byte *tmp;
+    int i, busy;
 
     if (crdev->render_threads != NULL) {
-        /* Wait for each thread to finish then free its memory */
+        options = crdev->render_threads[0].options;
+
+        /* Take the page off the pool so that no thread starts on it  */
+        /* again, then tell the threads still rendering its bands to  */
+        /* stop and wait for them to let go of the thread controls.   */
+        pool = queue->pool;
+        gx_monitor_enter(pool->lock);
+        for (pq = &pool->queues; *pq != NULL; pq = &(*pq)->next) {
+            if (*pq == queue) {
+                *pq = queue->next;
+                break;
+            }
+        }
+        gx_monitor_leave(pool->lock);
+        gx_monitor_enter(queue->lock);
+        queue->quit = true;
+        for (;;) {
+            for (i = 0, busy = 0; i < queue->num_threads; i++)
+                if (queue->threads[i].status == THREAD_BUSY)
+                    busy++;
+            if (busy == 0)
+                break;
+            gx_monitor_leave(queue->lock);
+            gx_semaphore_wait(queue->band_done);
+            gx_monitor_enter(queue->lock);
+        }
+        gx_monitor_leave(queue->lock);
+
+        /* The data areas have been passing between the main thread, the  */
+        /* threads and the reorder buffer. Swap the main thread's own one */
+        /* back to it before the others are freed.                        */
+        for (i = 0; i < crdev->num_render_threads; i++) {
+            gx_device_clist_common *thread_cdev = (gx_device_clist_common *)crdev->render_threads[i].cdev;
+
+            if (thread_cdev->data == crdev->main_thread_data) {
+                thread_cdev->data = cdev->data;
+                cdev->data = crdev->main_thread_data;
+            }
+        }
+        for (i = 0; i < queue->num_slots; i++) {
+            if (queue->slots[i].data == crdev->main_thread_data) {
+                tmp = queue->slots[i].data;
+                queue->slots[i].data = cdev->data;
+                cdev->data = tmp;
+            }
+        }
+
+        /* Free each thread's resources then its memory */
         for (i = (crdev->num_render_threads - 1); i >= 0; i--) {
             clist_render_thread_control_t *thread = &(crdev->render_threads[i]);
             gx_device_clist_common *thread_cdev = (gx_device_clist_common *)thread->cdev;
 
-            if (thread->status == THREAD_BUSY)
-                gx_semaphore_wait(thread->sema_this);
-            /* Free control semaphores */
-            gx_semaphore_free(thread->sema_group);
-            gx_semaphore_free(thread->sema_this);
             /* destroy the thread's buffer device */
             thread_cdev->buf_procs.destroy_buf_device(thread->bdev);
 
             if (thread->options) {
                 if (thread->options->free_buffer_fn && thread->buffer) {
-                    thread->options->free_buffer_fn(thread->options->arg, dev, thread->memory, thread->buffer);
+                    thread->options->free_buffer_fn(thread->options->arg, dev, queue->memory, thread->buffer);
                     thread->buffer = NULL;
                 }
                 thread->options = NULL;
             }
-
-            /* before freeing this device's memory, swap with cdev if it was the main_thread_data */
-            if (thread_cdev->data == crdev->main_thread_data) {
-                thread_cdev->data = cdev->data;
-                cdev->data = crdev->main_thread_data;
-            }
 #ifdef DEBUG
-            if (gs_debug[':'])
+            if (gs_debug[':']) {
+                gs_memory_status_t mem_status;
+
+                gs_memory_status(thread->memory, &mem_status);
                 dmprintf2(thread->memory, "%% Thread %d total usertime=%ld msec\n", i, thread->cputime);
+                dmprintf4(thread->memory, "%% Thread %d max_used=%lu, heap calls=%lu, retained=%lu\n",
+                          i, mem_status.max_used, mem_status.parent_calls, mem_status.retained);
+            }
             dmprintf1(thread->memory, "\nThread %d ", i);
 #endif
-            teardown_device_and_mem_for_thread((gx_device *)thread_cdev, thread->thread, false);
+            teardown_device_and_mem_for_thread((gx_device *)thread_cdev, NULL, false);
         }
         gs_free_object(mem, crdev->render_threads, "clist_teardown_render_threads");
         crdev->render_threads = NULL;
+        clist_free_render_queue(queue, dev, options);
+        crdev->render_queue = NULL;
 
         /* Now re-open the clist temp files so we can write to them */
         if (cdev->page_info.cfile == NULL) {
@@ -625,85 +819,313 @@ clist_teardown_render_threads(gx_device *dev)
     }
 }
 
+/* Find the oldest page with a band that can be started now, and claim */
+/* one of its thread controls that no other pool thread is running.    */
+/* Returns NULL if there is none.                                      */
+static clist_render_thread_control_t *
+clist_render_pool_take(clist_render_pool_t *pool)
+{
+    clist_render_queue_t *queue;
+    clist_render_thread_control_t *thread = NULL;
+    int i;
+
+    gx_monitor_enter(pool->lock);
+    for (queue = pool->queues; queue != NULL && thread == NULL; queue = queue->next) {
+        gx_monitor_enter(queue->lock);
+        if (clist_render_queue_startable(queue) > 0) {
+            for (i = 0; i < queue->num_threads; i++) {
+                if (queue->threads[i].status == THREAD_IDLE) {
+                    thread = &(queue->threads[i]);
+                    thread->status = THREAD_BUSY;
+                    break;
+                }
+            }
+        }
+        gx_monitor_leave(queue->lock);
+    }
+    gx_monitor_leave(pool->lock);
+    return thread;
+}
+
+/* Free a pool whose threads have all finished, or were never started */
+static void
+clist_free_render_pool_memory(clist_render_pool_t *pool)
+{
+    gs_memory_t *mem = pool->memory;
+
+    gs_free_object(mem, pool->threads, "clist_free_render_pool");
+    gx_semaphore_free(pool->wake);
+    gx_monitor_free(pool->lock);
+    gs_free_object(mem, pool, "clist_free_render_pool");
+}
+
+/* Get the device's pool, creating it (with no threads yet) the first */
+/* time. Only the thread that owns the device may call this.         */
+static clist_render_pool_t *
+clist_get_render_pool(gx_device *dev)
+{
+    gx_device_clist_common *cdev = (gx_device_clist_common *)dev;
+    gs_memory_t *mem = cdev->memory->thread_safe_memory;
+    clist_render_pool_t *pool = cdev->render_pool;
+
+    if (pool != NULL)
+        return pool;
+    pool = (clist_render_pool_t *)gs_alloc_bytes(mem, sizeof(clist_render_pool_t),
+                                                 "clist_get_render_pool");
+    if (pool == NULL)
+        return NULL;
+    memset(pool, 0, sizeof(clist_render_pool_t));
+    pool->memory = mem;
+    if ((pool->lock = gx_monitor_label(gx_monitor_alloc(mem), "Band pool")) == NULL ||
+        (pool->wake = gx_semaphore_label(gx_semaphore_alloc(mem), "Band wake")) == NULL) {
+        clist_free_render_pool_memory(pool);
+        return NULL;
+    }
+    cdev->render_pool = pool;
+    return pool;
+}
+
+int
+clist_lend_render_pool(gx_device *dev, gx_device *ndev)
+{
+    clist_render_pool_t *pool = clist_get_render_pool(dev);
+
+    if (pool == NULL)
+        return_error(gs_error_VMerror);
+    ((gx_device_clist_common *)ndev)->render_pool = pool;
+    return 0;
+}
+
+/* The body of a pool thread. Each time it is woken it runs the thread */
+/* controls of any pages with bands that can be started, then waits   */
+/* until there are more or until the device is closed.                */
+static void
+clist_render_pool_thread(void *data)
+{
+    clist_render_pool_t *pool = (clist_render_pool_t *)data;
+    clist_render_thread_control_t *thread;
+    bool quit;
+
+    for (;;) {
+        gx_semaphore_wait(pool->wake);
+        gx_monitor_enter(pool->lock);
+        quit = pool->quit;
+        gx_monitor_leave(pool->lock);
+        if (quit)
+            break;
+        while ((thread = clist_render_pool_take(pool)) != NULL)
+            clist_render_thread(thread);
+    }
+}
+
+/* Start pool threads until there are at least 'num_threads'. Pages   */
+/* printed in the background may ask for them at the same time.      */
+/* Returns the number of threads, or an error if there are none.     */
 static int
-clist_start_render_thread(gx_device *dev, int thread_index, int band)
+clist_grow_render_pool(clist_render_pool_t *pool, int num_threads)
+{
+    gp_thread_id *threads;
+    int code = 0;
+
+    gx_monitor_enter(pool->lock);
+    if (num_threads > pool->num_threads) {
+        threads = (gp_thread_id *)gs_alloc_byte_array(pool->memory, num_threads,
+                                    sizeof(gp_thread_id), "clist_grow_render_pool");
+        if (threads == NULL)
+            code = gs_note_error(gs_error_VMerror);
+        else {
+            if (pool->num_threads > 0)
+                memcpy(threads, pool->threads, pool->num_threads * sizeof(gp_thread_id));
+            gs_free_object(pool->memory, pool->threads, "clist_grow_render_pool");
+            pool->threads = threads;
+            while (pool->num_threads < num_threads) {
+                code = gp_thread_start(clist_render_pool_thread, pool,
+                                       &pool->threads[pool->num_threads]);
+                if (code < 0)
+                    break;
+                gp_thread_label(pool->threads[pool->num_threads], "Band");
+                pool->num_threads++;
+            }
+        }
+    }
+    if (pool->num_threads > 0)
+        code = pool->num_threads;
+    gx_monitor_leave(pool->lock);
+    return code;
+}
+
+void
+clist_free_render_pool(gx_device *dev)
 {
     gx_device_clist *cldev = (gx_device_clist *)dev;
-    gx_device_clist_reader *crdev = &cldev->reader;
-    int code;
+    gx_device_clist_common *cdev = (gx_device_clist_common *)dev;
+    clist_render_pool_t *pool = cdev->render_pool;
+    int i;
 
-    crdev->render_threads[thread_index].band = band;
-    crdev->render_threads[thread_index].status = THREAD_BUSY;
+    if (pool == NULL)
+        return;
+    /* A page still being read holds some of the threads */
+    if (!CLIST_IS_WRITER(cldev))
+        clist_teardown_render_threads(dev);
+    gx_monitor_enter(pool->lock);
+    pool->quit = true;
+    gx_monitor_leave(pool->lock);
+    for (i = 0; i < pool->num_threads; i++)
+        gx_semaphore_signal(pool->wake);
+    for (i = 0; i < pool->num_threads; i++)
+        gp_thread_finish(pool->threads[i]);
+    clist_free_render_pool_memory(pool);
+    cdev->render_pool = NULL;
+}
 
-    /* Finally, fire it up */
-    code = gp_thread_start(clist_render_thread,
-                           &(crdev->render_threads[thread_index]),
-                           &(crdev->render_threads[thread_index].thread));
-    gp_thread_label(crdev->render_threads[thread_index].thread, "Band");
+/* Take the next band from the queue. Returns -1 (having marked the */
+/* thread idle) if there is no band that can be started now.        */
+static int
+clist_render_thread_next_band(clist_render_thread_control_t *thread)
+{
+    clist_render_queue_t *queue = thread->queue;
+    int band;
 
-    return code;
+    gx_monitor_enter(queue->lock);
+    band = queue->next_band;
+    if (queue->quit || band < 0 || band >= queue->band_count ||
+        (band - queue->curr_band) * queue->direction >= queue->num_slots) {
+        thread->status = THREAD_IDLE;
+        band = -1;
+        /* Teardown is waiting for the pool threads to let go of the page */
+        if (queue->quit)
+            gx_semaphore_signal(queue->band_done);
+    } else {
+        queue->next_band += queue->direction;
+        queue->num_busy++;
+    }
+    thread->band = band;
+    gx_monitor_leave(queue->lock);
+    return band;
 }
 
+/* Park the band this thread has just rendered in the reorder buffer, */
+/* taking a free data area (and process_page buffer) in exchange.     */
 static void
-clist_render_thread(void *data)
+clist_render_thread_band_done(clist_render_thread_control_t *thread, int code)
+{
+    clist_render_queue_t *queue = thread->queue;
+    gx_device_clist_common *cdev = (gx_device_clist_common *)thread->cdev;
+    clist_render_slot_t *slot = NULL;
+    byte *data;
+    void *buffer;
+    int i;
+
+    gx_monitor_enter(queue->lock);
+    if (code >= 0) {
+        /* The lookahead limit guarantees a free slot for any band in progress */
+        for (i = 0; i < queue->num_slots; i++) {
+            if (queue->slots[i].band < 0) {
+                slot = &(queue->slots[i]);
+                break;
+            }
+        }
+        if (slot == NULL)
+            code = gs_note_error(gs_error_unknownerror);	/* shouldn't happen */
+    }
+    if (code < 0) {
+        if (queue->error == 0)
+            queue->error = code;
+    } else {
+        data = slot->data;
+        slot->data = cdev->data;
+        cdev->data = data;
+        buffer = slot->buffer;
+        slot->buffer = thread->buffer;
+        thread->buffer = buffer;
+        slot->band = thread->band;
+    }
+    thread->band = -1;
+    queue->num_busy--;
+    gx_monitor_leave(queue->lock);
+    gx_semaphore_signal(queue->band_done);
+}
+
+static void
+clist_render_thread(clist_render_thread_control_t *thread)
 {
-    clist_render_thread_control_t *thread = (clist_render_thread_control_t *)data;
     gx_device *dev = thread->cdev;
     gx_device_clist *cldev = (gx_device_clist *)dev;
     gx_device_clist_reader *crdev = &cldev->reader;
     gx_device *bdev = thread->bdev;
     gs_int_rect band_rect;
-    byte *mdata = crdev->data + crdev->page_tile_cache_size;
-    byte *mlines = (crdev->page_line_ptrs_offset == 0 ? NULL : mdata + crdev->page_line_ptrs_offset);
+    byte *mdata;
+    byte *mlines;
     uint raster = gx_device_raster_plane(dev, NULL);
     int code;
     int band_height = crdev->page_band_height;
-    int band = thread->band;
-    int band_begin_line = band * band_height;
-    int band_end_line = band_begin_line + band_height;
+    int band;
+    int band_begin_line;
+    int band_end_line;
     int band_num_lines;
 #ifdef DEBUG
     long starttime[2], endtime[2];
+#endif
 
-    gp_get_usertime(starttime); /* thread start time */
+    /* Render bands until there are none that can be started now. The */
+    /* pool thread running us then looks for work on other pages.     */
+    while ((band = clist_render_thread_next_band(thread)) >= 0) {
+#ifdef DEBUG
+        gp_get_usertime(starttime); /* band start time */
 #endif
-    if (band_end_line > dev->height)
-        band_end_line = dev->height;
-    band_num_lines = band_end_line - band_begin_line;
-
-    code = crdev->buf_procs.setup_buf_device
-            (bdev, mdata, raster, (byte **)mlines, 0, band_num_lines, band_num_lines);
-    band_rect.p.x = 0;
-    band_rect.p.y = band_begin_line;
-    band_rect.q.x = dev->width;
-    band_rect.q.y = band_end_line;
-    if (code >= 0)
-        code = clist_render_rectangle(cldev, &band_rect, bdev, NULL, true);
-
-    if (code >= 0 && thread->options && thread->options->process_fn)
-        code = thread->options->process_fn(thread->options->arg, dev, bdev, &band_rect, thread->buffer);
-
-    /* Reset the band boundaries now */
-    crdev->ymin = band_begin_line;
-    crdev->ymax = band_end_line;
-    crdev->offset_map = NULL;
-    if (code < 0)
-        thread->status = THREAD_ERROR;          /* shouldn't happen */
-    else
-        thread->status = THREAD_DONE;    /* OK */
+        band_begin_line = band * band_height;
+        band_end_line = band_begin_line + band_height;
+        if (band_end_line > dev->height)
+            band_end_line = dev->height;
+        band_num_lines = band_end_line - band_begin_line;
+
+        /* The data area changes from band to band, see band_done */
+        mdata = crdev->data + crdev->page_tile_cache_size;
+        mlines = (crdev->page_line_ptrs_offset == 0 ? NULL : mdata + crdev->page_line_ptrs_offset);
+        code = crdev->buf_procs.setup_buf_device
+                (bdev, mdata, raster, (byte **)mlines, 0, band_num_lines, band_num_lines);
+        band_rect.p.x = 0;
+        band_rect.p.y = band_begin_line;
+        band_rect.q.x = dev->width;
+        band_rect.q.y = band_end_line;
+        if (code >= 0)
+            code = clist_render_rectangle(cldev, &band_rect, bdev, NULL, true);
+
+        if (code >= 0 && thread->options && thread->options->process_fn)
+            code = thread->options->process_fn(thread->options->arg, dev, bdev, &band_rect, thread->buffer);
 
+        /* Reset the band boundaries now */
+        crdev->ymin = band_begin_line;
+        crdev->ymax = band_end_line;
+        crdev->offset_map = NULL;
 #ifdef DEBUG
-    gp_get_usertime(endtime);
-    thread->cputime += (endtime[0] - starttime[0]) * 1000 +
-             (endtime[1] - starttime[1]) / 1000000;
+        gp_get_usertime(endtime);
+        thread->cputime += (endtime[0] - starttime[0]) * 1000 +
+                 (endtime[1] - starttime[1]) / 1000000;
 #endif
-    /*
-     * Signal the semaphores. We signal the 'group' first since even if
-     * the waiter is released on the group, it still needs to check
-     * status on the thread
-     */
-    gx_semaphore_signal(thread->sema_group);
-    gx_semaphore_signal(thread->sema_this);
+        clist_render_thread_band_done(thread, code);
+        /* Give back what this band didn't reuse from the previous one */
+        gs_memory_chunk_trim(thread->memory);
+    }
+}
+
+/* Wait until the threads that are rendering bands have all finished. */
+/* No new bands are started while waiting.                            */
+static void
+clist_drain_render_threads(clist_render_queue_t *queue)
+{
+    int busy;
+
+    gx_monitor_enter(queue->lock);
+    queue->next_band = -1;
+    busy = queue->num_busy;
+    gx_monitor_leave(queue->lock);
+    while (busy > 0) {
+        gx_semaphore_wait(queue->band_done);
+        gx_monitor_enter(queue->lock);
+        busy = queue->num_busy;
+        gx_monitor_leave(queue->lock);
+    }
 }
 
 /*
@@ -711,8 +1133,9 @@ clist_render_thread(void *data)
  * device (the main thread)
  * Return 0 if OK, < 0 is the error code from the thread
  *
- * After swapping the pointers, start up the completed thread with the
- * next band remaining to do (if any)
+ * The band is taken from the reorder buffer, waiting for it to arrive
+ * if need be. After swapping the pointers, the slot is released and
+ * idle threads are woken to start on the bands it makes room for.
  */
 static int
 clist_get_band_from_thread(gx_device *dev, int band_needed, gx_process_page_options_t *options)
@@ -720,86 +1143,79 @@ clist_get_band_from_thread(gx_device *dev, int band_needed, gx_process_page_opti
     gx_device_clist *cldev = (gx_device_clist *)dev;
     gx_device_clist_common *cdev = (gx_device_clist_common *)dev;
     gx_device_clist_reader *crdev = &cldev->reader;
+    clist_render_queue_t *queue = crdev->render_queue;
+    clist_render_slot_t *slot = NULL;
     int i, code = 0;
-    int thread_index = crdev->curr_render_thread;
-    clist_render_thread_control_t *thread = &(crdev->render_threads[thread_index]);
-    gx_device_clist_common *thread_cdev = (gx_device_clist_common *)thread->cdev;
     int band_height = crdev->page_info.band_params.BandHeight;
     int band_count = cdev->nbands;
     byte *tmp;                  /* for swapping data areas */
 
-    /* We expect that the thread needed will be the 'current' thread */
-    if (thread->band != band_needed) {
-        int band = band_needed;
-
-        emprintf3(thread->memory,
-                  "thread->band = %d, band_needed = %d, direction = %d, ",
-                  thread->band, band_needed, crdev->thread_lookahead_direction);
+    /* We expect that the band needed will be the 'current' band */
+    if (queue->curr_band != band_needed) {
+        emprintf3(cdev->memory,
+                  "curr_band = %d, band_needed = %d, direction = %d, ",
+                  queue->curr_band, band_needed, queue->direction);
 
         /* Probably we went in the wrong direction, so let the threads */
         /* all complete, then restart them in the opposite direction   */
         /* If the caller is 'bouncing around' we may end up back here, */
         /* but that is a VERY rare case (we haven't seen it yet).      */
-        for (i=0; i < crdev->num_render_threads; i++) {
-            clist_render_thread_control_t *thread = &(crdev->render_threads[i]);
+        clist_drain_render_threads(queue);
 
-            if (thread->status == THREAD_BUSY)
-                gx_semaphore_wait(thread->sema_this);
-        }
-        crdev->thread_lookahead_direction *= -1;      /* reverse direction (but may be overruled below) */
+        gx_monitor_enter(queue->lock);
+        queue->direction *= -1;      /* reverse direction (but may be overruled below) */
         if (band_needed == band_count-1)
-            crdev->thread_lookahead_direction = -1;   /* assume backwards if we are asking for the last band */
+            queue->direction = -1;   /* assume backwards if we are asking for the last band */
         if (band_needed == 0)
-            crdev->thread_lookahead_direction = 1;    /* force forward if we are looking for band 0 */
-
-        dmprintf1(thread->memory, "new_direction = %d\n", crdev->thread_lookahead_direction);
-
-        /* Loop starting the threads in the new lookahead_direction */
-        for (i=0; (i < crdev->num_render_threads) && (band >= 0) && (band < band_count);
-                i++, band += crdev->thread_lookahead_direction) {
-            thread = &(crdev->render_threads[i]);
-            thread->band = -1;          /* a value that won't match any valid band */
-            /* Start thread 'i' to do band */
-            if ((code = clist_start_render_thread(dev, i, band)) < 0)
+            queue->direction = 1;    /* force forward if we are looking for band 0 */
+        for (i = 0; i < queue->num_slots; i++)
+            queue->slots[i].band = -1;
+        queue->curr_band = queue->next_band = band_needed;
+        clist_wake_render_threads(queue);
+        gx_monitor_leave(queue->lock);
+
+        dmprintf1(cdev->memory, "new_direction = %d\n", queue->direction);
+    }
+    /* Wait for the band to arrive in the reorder buffer */
+    for (;;) {
+        gx_monitor_enter(queue->lock);
+        code = queue->error;
+        for (i = 0; i < queue->num_slots; i++) {
+            if (queue->slots[i].band == band_needed) {
+                slot = &(queue->slots[i]);
                 break;
+            }
         }
-        crdev->next_band = i;			/* may be < 0 or == band_count, but that is handled later */
-        crdev->curr_render_thread = thread_index = 0;
-        thread = &(crdev->render_threads[0]);
-        thread_cdev = (gx_device_clist_common *)thread->cdev;
+        gx_monitor_leave(queue->lock);
+        if (slot != NULL || code < 0)
+            break;
+        gx_semaphore_wait(queue->band_done);
     }
-    /* Wait for this thread */
-    gx_semaphore_wait(thread->sema_this);
-    gp_thread_finish(thread->thread);
-    thread->thread = NULL;
-    if (thread->status == THREAD_ERROR)
+    if (code < 0)
         return_error(gs_error_unknownerror);          /* FAIL */
 
     if (options && options->output_fn) {
-        code = options->output_fn(options->arg, dev, thread->buffer);
+        code = options->output_fn(options->arg, dev, slot->buffer);
         if (code < 0)
             return code;
     }
 
     /* Swap the data areas to avoid the copy */
     tmp = cdev->data;
-    cdev->data = thread_cdev->data;
-    thread_cdev->data = tmp;
-    thread->status = THREAD_IDLE;        /* the data is no longer valid */
-    thread->band = -1;
+    cdev->data = slot->data;
+    slot->data = tmp;
     /* Update the bounds for this band */
     cdev->ymin =  band_needed * band_height;
     cdev->ymax =  cdev->ymin + band_height;
     if (cdev->ymax > dev->height)
         cdev->ymax = dev->height;
 
-    if (crdev->next_band >= 0 && crdev->next_band < band_count) {
-        code = clist_start_render_thread(dev, thread_index, crdev->next_band);
-        crdev->next_band += crdev->thread_lookahead_direction;
-    }
-    /* bump the 'curr' to the next thread */
-    crdev->curr_render_thread = crdev->curr_render_thread == crdev->num_render_threads - 1 ?
-                0 : crdev->curr_render_thread + 1;
+    /* Release the slot (the data is no longer valid) and move on */
+    gx_monitor_enter(queue->lock);
+    slot->band = -1;
+    queue->curr_band += queue->direction;
+    clist_wake_render_threads(queue);
+    gx_monitor_leave(queue->lock);
 
     return code;
 }
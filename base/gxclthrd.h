@@ -36,6 +36,11 @@ gx_device * setup_device_and_mem_for_thread(gs_memory_t *chunk_base_mem, gx_devi
 /* Exported for use by background printing.                             */
 void teardown_device_and_mem_for_thread(gx_device *dev, gp_thread_id thread_id, bool bg_print);
 
+/* Let 'ndev', the device of a page printed in the background, render   */
+/* on the threads of 'dev', its printer device. The pool stays with 'dev' */
+/* and is given back by teardown_device_and_mem_for_thread.              */
+int clist_lend_render_pool(gx_device *dev, gx_device *ndev);
+
 /* Following is used for clist background printing and multi-threaded rendering */
 typedef enum {
     THREAD_ERROR = -1,
@@ -49,16 +54,79 @@ typedef enum {
 typedef struct clist_render_thread_control_s clist_render_thread_control_t;
 #endif
 
+#ifndef clist_render_queue_t_DEFINED
+#  define clist_render_queue_t_DEFINED
+typedef struct clist_render_queue_s clist_render_queue_t;
+#endif
+
+#ifndef clist_render_pool_t_DEFINED
+#  define clist_render_pool_t_DEFINED
+typedef struct clist_render_pool_s clist_render_pool_t;
+#endif
+
+/* The rendering threads of a device. They are started as pages first   */
+/* need them and kept until the device is closed. Pages printed in the  */
+/* background render on their printer device's pool (see               */
+/* clist_lend_render_pool), so however many pages are in flight there  */
+/* are only NumRenderingThreads threads between them. A free thread    */
+/* takes the oldest page that has a band it can start, and runs one of */
+/* that page's thread controls (below) until the page has none left.   */
+struct clist_render_pool_s {
+    gs_memory_t *memory;	/* thread safe allocator for the pool */
+    gx_monitor_t *lock;		/* protects all of the following */
+    gx_semaphore_t *wake;	/* signalled for each band that may be started */
+    bool quit;			/* set when the device is closed */
+    int num_threads;
+    gp_thread_id *threads;
+    clist_render_queue_t *queues;	/* pages being rendered, oldest first */
+};
+
+/* Number of reorder buffer slots allocated for each rendering thread.   */
+/* This bounds how far ahead of the band being consumed the threads can  */
+/* run, and so how much a single slow band can hold up the others.       */
+#define CLIST_RENDER_SLOTS_PER_THREAD 2
+
+/* A reorder buffer slot holds a completed band until the main thread    */
+/* asks for it. The data area and process_page buffer are swapped in and */
+/* out of the slot, so 'data' need not be the area that 'alloc' points to */
+typedef struct clist_render_slot_s {
+    int band;			/* band held in this slot, -1 if free */
+    byte *data;			/* band data area currently parked here */
+    byte *alloc;		/* the data area allocated for this slot */
+    void *buffer;		/* process_page buffer that goes with 'data' */
+} clist_render_slot_t;
+
+/* The band queue shared by the rendering threads. Whichever thread is  */
+/* free takes the next band in the lookahead direction, so an expensive */
+/* band only occupies one thread rather than stalling the round robin.  */
+struct clist_render_queue_s {
+    gs_memory_t *memory;	/* thread safe allocator for slots and buffers */
+    clist_render_pool_t *pool;	/* the threads that render the bands */
+    clist_render_queue_t *next;	/* next page on the pool, protected by the pool lock */
+    gx_monitor_t *lock;		/* protects all of the following */
+    gx_semaphore_t *band_done;	/* signalled each time a thread finishes a band */
+    int band_count;
+    int curr_band;		/* next band the main thread will consume */
+    int next_band;		/* next band to hand out, may be out of range */
+    int direction;		/* +1 or -1 */
+    int num_busy;		/* number of threads rendering a band */
+    int error;			/* first error reported by a thread */
+    bool quit;			/* set at teardown to stop handing out bands */
+    int num_slots;
+    clist_render_slot_t *slots;	/* the reorder buffer */
+    int num_threads;
+    clist_render_thread_control_t *threads;	/* the page's thread controls */
+};
+
+/* The state for rendering one page's bands on one thread at a time. */
+/* Any of the pool's threads may run it, see clist_render_pool_take.  */
 struct clist_render_thread_control_s {
-    thread_status status;	/* 0: not started, 1: done, 2: busy, < 0: error */
-                                /* values allow waiting until status < 2 */
+    thread_status status;	/* 0: idle, 2: being run by a pool thread */
     gs_memory_t *memory;	/* thread's 'chunk' memory allocator */
-    gx_semaphore_t *sema_this;
-    gx_semaphore_t *sema_group;
+    clist_render_queue_t *queue;	/* band queue shared with the main thread */
     gx_device *cdev;	/* clist device copy */
     gx_device *bdev;	/* this thread's buffer device */
-    int band;
-    gp_thread_id thread;
+    int band;			/* band being rendered, -1 if none */
 
     /* For process_page mode */
     gx_process_page_options_t *options;
@@ -214,6 +214,25 @@ cmd_write_band(gx_device_clist_writer * cldev, int band_min, int band_max,
 /* Write out a pseudo-band block of data, using the specific pseudo_band_offset */
 int
 cmd_write_pseudo_band(gx_device_clist_writer * cldev, unsigned char *pbuf, int data_size, int pseudo_band_offset)
+{
+    int64_t pos;
+    int code = cmd_begin_pseudo_band(cldev, pseudo_band_offset, &pos);
+
+    if (code < 0)
+        return code;
+
+    /* Now store the information in the cfile */
+    if_debug2m('l', cldev->memory, "[l]writing %d bytes into cfile at %ld\n",
+            data_size, (long)pos);
+
+    cldev->page_info.io_procs->fwrite_chars(pbuf, data_size, cldev->page_cfile);
+
+    return cmd_end_pseudo_band(cldev);
+}
+
+/* Start a pseudo-band block, leaving the cfile positioned for its data. */
+int
+cmd_begin_pseudo_band(gx_device_clist_writer * cldev, int pseudo_band_offset, int64_t *ppos)
 {
 
     /* Data is written out maxband + pseudo_band_offset */
@@ -222,7 +241,6 @@ cmd_write_pseudo_band(gx_device_clist_writer * cldev, unsigned char *pbuf, int d
     clist_file_ptr cfile = cldev->page_cfile;
     clist_file_ptr bfile = cldev->page_bfile;
     cmd_block cb;
-    int code_b, code_c;
 
     if (cfile == 0 || bfile == 0)
         return_error(gs_error_ioerror);
@@ -238,16 +256,19 @@ cmd_write_pseudo_band(gx_device_clist_writer * cldev, unsigned char *pbuf, int d
                   band, (long)cb.pos);
 
     cldev->page_info.io_procs->fwrite_chars(&cb, sizeof(cb), bfile);
+    *ppos = cb.pos;
+    return 0;
+}
 
-    /* Now store the information in the cfile */
-    if_debug2m('l', cldev->memory, "[l]writing %d bytes into cfile at %ld\n",
-            data_size, (long)cldev->page_info.io_procs->ftell(cfile));
-
-    cldev->page_info.io_procs->fwrite_chars(pbuf, data_size, cfile);
+/* Finish a pseudo-band block, checking for write errors. */
+int
+cmd_end_pseudo_band(gx_device_clist_writer * cldev)
+{
+    int code_b, code_c;
 
     process_interrupts(cldev->memory);
-    code_b = cldev->page_info.io_procs->ferror_code(bfile);
-    code_c = cldev->page_info.io_procs->ferror_code(cfile);
+    code_b = cldev->page_info.io_procs->ferror_code(cldev->page_bfile);
+    code_c = cldev->page_info.io_procs->ferror_code(cldev->page_cfile);
 
     if (code_b < 0)
         return_error(code_b);
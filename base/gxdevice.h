@@ -123,6 +123,7 @@
         0/*PageCount*/, 0/*ShowpageCount*/, 1/*NumCopies*/, 0/*NumCopies_set*/,\
         0/*IgnoreNumCopies*/, 0/*UseCIEColor*/, 0/*LockSafetyParams*/,\
         0/*band_offset_x*/, 0/*band_offset_y*/, false /*BLS_force_memory*/, \
+        false /*BLC_lz4*/,\
         {false}/* sgr */,\
         0/* MaxPatternBitmap */, 0/*page_uses_transparency*/,\
         { MAX_BITMAP, BUFFER_SPACE,\
@@ -20,10 +20,16 @@
 #include "gdevprn.h"
 #include "assert_.h"
 #include "ets.h"
+#include "gxsync.h"
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
 
 enum
 {
-    MAX_ETS_PLANES = 8
+    MAX_ETS_PLANES = 8,
+    MAX_ED_CHAINS = 4
 };
 
 /* Error diffusion data is stored in errors block.
@@ -68,196 +74,200 @@ static void pack_8to1(byte *outp, byte *inp, int w)
     }
 }
 
-static void down_core(gx_downscaler_t *ds,
-                      byte            *out_buffer,
-                      byte            *in_buffer,
-                      int              row,
-                      int              plane,
-                      int              span)
+/* The box filter behind all of the integer cores. Each output pixel is the
+ * sum of a factor x factor block of input bytes; we form the sums for up to
+ * DOWN_BLOCK output pixels at a time, first down the columns (factor rows
+ * at once, 16 columns at a time with SSE2), then across them. Sums are
+ * exact (at most 8*8*255), so the error diffusion cores can use them in
+ * place of their own inner loops and get identical results.
+ *
+ * All the input for a block is read before any sum is written, so a caller
+ * may write its results over the block it has just consumed.
+ */
+#define DOWN_BLOCK 32
+
+static void down_box_sums(unsigned short *sums,
+                          const byte     *inp,
+                          int             n,
+                          int             nc,
+                          int             factor,
+                          int             span)
 {
-    int        x, xx, y, value;
-    int        e_downleft, e_down, e_forward = 0;
-    int        pad_white;
-    byte      *inp, *outp;
-    int        width     = ds->width;
-    int        awidth    = ds->awidth;
-    int        factor    = ds->factor;
-    int       *errors    = ds->errors + (awidth+3)*plane;
-    const int  threshold = factor*factor*128;
-    const int  max_value = factor*factor*255;
-
-    pad_white = (awidth - width) * factor;
-    if (pad_white < 0)
-        pad_white = 0;
+    unsigned short cols[DOWN_BLOCK * 8 * 4];
+    int len = n * factor * nc;
+    int i, j, xx, y;
 
-    if (pad_white)
+    i = 0;
+#ifdef HAVE_SSE2
     {
-        inp = in_buffer + width*factor;
-        for (y = factor; y > 0; y--)
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16 <= len; i += 16)
         {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
+            const byte *p = inp + i;
+            __m128i lo = zero;
+            __m128i hi = zero;
+
+            for (y = factor; y > 0; y--)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i *)p);
+
+                lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(v, zero));
+                hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(v, zero));
+                p += span;
+            }
+            _mm_storeu_si128((__m128i *)(cols + i), lo);
+            _mm_storeu_si128((__m128i *)(cols + i + 8), hi);
         }
     }
-
-    inp = in_buffer;
-    if ((row & 1) == 0)
+#endif
+    for (; i < len; i++)
     {
-        /* Left to Right pass (no min feature size) */
-        const int back = span * factor - 1;
-        errors += 2;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        const byte *p = inp + i;
+        int value = 0;
+
+        for (y = factor; y > 0; y--)
         {
-            value = e_forward + *errors;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            if (value >= threshold)
-            {
-                *outp++ = 1;
-                value -= max_value;
-            }
-            else
-            {
-                *outp++ = 0;
-            }
-            e_forward  = value * 7/16;
-            e_downleft = value * 3/16;
-            e_down     = value * 5/16;
-            value     -= e_forward + e_downleft + e_down;
-            errors[-2] += e_downleft;
-            errors[-1] += e_down;
-            *errors++   = value;
+            value += *p;
+            p += span;
         }
-        outp -= awidth;
+        cols[i] = value;
     }
-    else
+
+    for (i = 0; i < len; i += factor * nc)
     {
-        /* Right to Left pass (no min feature size) */
-        const int back = span * factor + 1;
-        errors += awidth;
-        inp += awidth*factor-1;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        for (j = 0; j < nc; j++)
         {
-            value = e_forward + *errors;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            if (value >= threshold)
-            {
-                *outp-- = 1;
-                value -= max_value;
-            }
-            else
-            {
-                *outp-- = 0;
-            }
-            e_forward  = value * 7/16;
-            e_downleft = value * 3/16;
-            e_down     = value * 5/16;
-            value     -= e_forward + e_downleft + e_down;
-            errors[2] += e_downleft;
-            errors[1] += e_down;
-            *errors--   = value;
+            int value = 0;
+
+            for (xx = j; xx < factor * nc; xx += nc)
+                value += cols[i + xx];
+            *sums++ = value;
         }
-        outp++;
     }
-    pack_8to1(out_buffer, outp, awidth);
 }
 
-static void down_core_ets_1(gx_downscaler_t *ds,
-                            byte            *out_buffer,
-                            byte            *in_buffer,
-                            int              row,
-                            int              plane,
-                            int              span)
+/* Box sum a whole (chunky) line of nc components into sums. */
+static void down_box_line(gx_downscaler_t *ds,
+                          unsigned short  *sums,
+                          const byte      *in_buffer,
+                          int              nc,
+                          int              span)
 {
-    unsigned char *dest[MAX_ETS_PLANES];
-    ETS_SrcPixel *src[MAX_ETS_PLANES];
-    int pad_white, y;
     int factor = ds->factor;
+    int awidth = ds->awidth;
+    int x, n;
 
-    pad_white = (ds->awidth - ds->width) * factor * 4;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
+    for (x = 0; x < awidth; x += n)
     {
-        unsigned char *inp = in_buffer + ds->width * factor * 4;
-        for (y = factor; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
+        n = awidth - x;
+        if (n > DOWN_BLOCK)
+            n = DOWN_BLOCK;
+        down_box_sums(sums + x * nc, in_buffer + x * factor * nc, n, nc,
+                      factor, span);
     }
+}
 
-    if (ds->ets_downscale)
-        ds->ets_downscale(ds, in_buffer, in_buffer, row, plane, span);
-
-    src[0] = in_buffer;
-    dest[0] = in_buffer;
-    ets_line((ETS_Ctx *)ds->ets_config, dest, (const ETS_SrcPixel * const *)src);
+/* Box filter a whole line of nc components down to bytes. outp may be
+ * in_buffer. */
+static void down_box8(gx_downscaler_t *ds,
+                      byte            *outp,
+                      const byte      *in_buffer,
+                      int              nc,
+                      int              span)
+{
+    unsigned short sums[DOWN_BLOCK * 4];
+    int factor = ds->factor;
+    int awidth = ds->awidth;
+    int div    = factor*factor;
+    int x, i, n;
 
-    pack_8to1(out_buffer, in_buffer, ds->awidth);
+    for (x = 0; x < awidth; x += n)
+    {
+        n = awidth - x;
+        if (n > DOWN_BLOCK)
+            n = DOWN_BLOCK;
+        down_box_sums(sums, in_buffer + x * factor * nc, n, nc, factor, span);
+        for (i = 0; i < n * nc; i++)
+            *outp++ = (sums[i] + (div>>1))/div;
+    }
 }
 
-static void down_core_1(gx_downscaler_t *ds,
-                        byte            *out_buffer,
-                        byte            *in_buffer,
-                        int              row,
-                        int              plane,
-                        int              span)
+/* Fill the padding to the right of the page (when awidth > width) with
+ * white, for factor lines of nc components. */
+static void down_pad_white(gx_downscaler_t *ds,
+                           byte            *in_buffer,
+                           int              nc,
+                           int              span)
 {
-    int        x, value;
-    int        e_downleft, e_down, e_forward = 0;
-    int        pad_white;
-    byte      *inp, *outp;
-    int        width     = ds->width;
-    int        awidth    = ds->awidth;
-    int       *errors    = ds->errors + (awidth+3)*plane;
-    const int  threshold = 128;
-    const int  max_value = 255;
+    int pad_white = (ds->awidth - ds->width) * ds->factor * nc;
+    byte *inp;
+    int y;
 
-    pad_white = (awidth - width);
-    if (pad_white < 0)
-        pad_white = 0;
+    if (pad_white <= 0)
+        return;
 
-    if (pad_white)
+    inp = in_buffer + ds->width * ds->factor * nc;
+    for (y = ds->factor; y > 0; y--)
     {
-        memset(in_buffer + width, 0xFF, pad_white);
+        memset(inp, 0xFF, pad_white);
+        inp += span;
     }
+}
+
+/* The error diffusion stages. These take a line of box sums (as made by
+ * down_box_line) and write the resulting 0/1 values for component comp of
+ * its nc interleaved ones (awidth samples) to outp, ready for packing.
+ * e_forward is the error carried on from the end of the component before
+ * (0 for the first), and the one to carry on to the next is returned. So
+ * each component's lines have to be diffused in order, each after the same
+ * line of the component before, but that is all (see
+ * gx_downscaler_process_page_ets). ETS couples its planes, so down_ed_ets
+ * does them all at once, as component 0. */
+typedef int (down_ed_core)(gx_downscaler_t      *ds,
+                           byte                 *outp,
+                           const unsigned short *sums,
+                           int                   row,
+                           int                   plane,
+                           int                   nc,
+                           int                   comp,
+                           int                   e_forward);
+
+/* Floyd Steinberg, for 1 plane or nc interleaved components. As ever, the
+ * forward error carries over from the end of one component to the start of
+ * the next. */
+static int down_ed_fs(gx_downscaler_t      *ds,
+                      byte                 *outp,
+                      const unsigned short *sums,
+                      int                   row,
+                      int                   plane,
+                      int                   nc,
+                      int                   comp,
+                      int                   e_forward)
+{
+    int        x, value;
+    int        e_downleft, e_down;
+    int       *errors;
+    int        awidth    = ds->awidth;
+    int        factor    = ds->factor;
+    const int  threshold = factor*factor*128;
+    const int  max_value = factor*factor*255;
 
-    inp = in_buffer;
     if ((row & 1) == 0)
     {
         /* Left to Right pass (no min feature size) */
-        errors += 2;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        errors = ds->errors + (awidth+3)*(plane + comp) + 2;
+        for (x = comp; x < awidth * nc; x += nc)
         {
-            value = e_forward + *errors + *inp++;
+            value = e_forward + *errors + sums[x];
             if (value >= threshold)
             {
-                *outp++ = 1;
+                outp[x] = 1;
                 value -= max_value;
             }
             else
             {
-                *outp++ = 0;
+                outp[x] = 0;
             }
             e_forward  = value * 7/16;
             e_downleft = value * 3/16;
@@ -267,25 +277,22 @@ static void down_core_1(gx_downscaler_t *ds,
             errors[-1] += e_down;
             *errors++   = value;
         }
-        outp -= awidth;
     }
     else
     {
         /* Right to Left pass (no min feature size) */
-        errors += awidth;
-        inp += awidth-1;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        errors = ds->errors + (awidth+3)*(plane + comp) + awidth;
+        for (x = (awidth-1) * nc + comp; x >= 0; x -= nc)
         {
-            value = e_forward + *errors + *inp--;
+            value = e_forward + *errors + sums[x];
             if (value >= threshold)
             {
-                *outp-- = 1;
+                outp[x] = 1;
                 value -= max_value;
             }
             else
             {
-                *outp-- = 0;
+                outp[x] = 0;
             }
             e_forward  = value * 7/16;
             e_downleft = value * 3/16;
@@ -295,60 +302,72 @@ static void down_core_1(gx_downscaler_t *ds,
             errors[1] += e_down;
             *errors--   = value;
         }
-        outp++;
     }
-    pack_8to1(out_buffer, outp, awidth);
+    return e_forward;
 }
 
-static void down_core_2(gx_downscaler_t *ds,
-                        byte            *out_buffer,
-                        byte            *in_buffer,
-                        int              row,
-                        int              plane,
-                        int              span)
+/* Floyd Steinberg with min feature size = 2, for a grey plane (where 0 is
+ * the ink we must keep in features of at least 2x2). */
+static int down_ed_mfs(gx_downscaler_t      *ds,
+                       byte                 *outp,
+                       const unsigned short *sums,
+                       int                   row,
+                       int                   plane,
+                       int                   nc /* unused */,
+                       int                   comp /* unused */,
+                       int                   e_forward)
 {
     int        x, value;
-    int        e_downleft, e_down, e_forward = 0;
-    int        pad_white;
-    byte      *inp, *outp;
-    int        width     = ds->width;
+    int        e_downleft, e_down;
     int        awidth    = ds->awidth;
+    int        factor    = ds->factor;
     int       *errors    = ds->errors + (awidth+3)*plane;
-    const int  threshold = 2*2*128;
-    const int  max_value = 2*2*255;
-
-    pad_white = (awidth - width) * 2;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*2;
-        for (x = 2; x > 0; x--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
+    byte      *mfs_data  = ds->mfs_data + (awidth+1)*plane;
+    const int  threshold = factor*factor*128;
+    const int  max_value = factor*factor*255;
 
-    inp = in_buffer;
     if ((row & 1) == 0)
     {
-        /* Left to Right pass (no min feature size) */
+        /* Left to Right pass (with min feature size = 2) */
+        byte mfs, force_forward = 0;
         errors += 2;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        *mfs_data++ = mfs_clear;
+        for (x = 0; x < awidth; x++)
         {
-            value = e_forward + *errors + inp[0] + inp[1] + inp[span] + inp[span+1];
-            inp += 2;
-            if (value >= threshold)
+            value = e_forward + *errors + sums[x];
+            mfs = *mfs_data;
+            *mfs_data++ = mfs_clear;
+            if ((mfs & mfs_force_off) || force_forward)
             {
-                *outp++ = 1;
-                value -= max_value;
+                /* We are being forced to be 0 */
+                outp[x] = 0;
+                force_forward = 0;
+            }
+            else if (value < threshold)
+            {
+                /* We want to be 0 anyway */
+                outp[x] = 0;
+                if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
+                        != (mfs_above_is_0 | mfs_above_left_is_0))
+                {
+                    /* We aren't in a group anyway, so must force other
+                     * pixels. */
+                    mfs_data[-2] |= mfs_force_off;
+                    mfs_data[-1] |= mfs_force_off;
+                    force_forward = 1;
+                }
+                else
+                {
+                    /* No forcing, but we need to tell other pixels that
+                     * we were 0. */
+                    mfs_data[-2] |= mfs_above_is_0;
+                    mfs_data[-1] |= mfs_above_left_is_0;
+                }
             }
             else
             {
-                *outp++ = 0;
+                outp[x] = 1;
+                value -= max_value;
             }
             e_forward  = value * 7/16;
             e_downleft = value * 3/16;
@@ -358,26 +377,49 @@ static void down_core_2(gx_downscaler_t *ds,
             errors[-1] += e_down;
             *errors++   = value;
         }
-        outp -= awidth;
     }
     else
     {
-        /* Right to Left pass (no min feature size) */
+        /* Right to Left pass (with min feature size = 2) */
+        byte mfs, force_forward = 0;
         errors += awidth;
-        inp += (awidth-1)*2;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        mfs_data += awidth;
+        *mfs_data-- = mfs_clear;
+        for (x = awidth-1; x >= 0; x--)
         {
-            value = e_forward + *errors + inp[0] + inp[1] + inp[span] + inp[span+1];
-            inp -= 2;
-            if (value >= threshold)
+            value = e_forward + *errors + sums[x];
+            mfs = *mfs_data;
+            *mfs_data-- = mfs_clear;
+            if ((mfs & mfs_force_off) || force_forward)
             {
-                *outp-- = 1;
-                value -= max_value;
+                /* We are being forced to be 0 */
+                outp[x] = 0;
+                force_forward = 0;
             }
-            else
+            else if (value < threshold)
             {
-                *outp-- = 0;
+                outp[x] = 0;
+                if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
+                        != (mfs_above_is_0 | mfs_above_left_is_0))
+                {
+                    /* We aren't in a group anyway, so must force other
+                     * pixels. */
+                    mfs_data[1] |= mfs_force_off;
+                    mfs_data[2] |= mfs_force_off;
+                    force_forward = 1;
+                }
+                else
+                {
+                    /* No forcing, but we need to tell other pixels that
+                     * we were 0. */
+                    mfs_data[1] |= mfs_above_is_0;
+                    mfs_data[2] |= mfs_above_left_is_0;
+                }
+            }
+            else
+            {
+                outp[x] = 1;
+                value -= max_value;
             }
             e_forward  = value * 7/16;
             e_downleft = value * 3/16;
@@ -387,63 +429,74 @@ static void down_core_2(gx_downscaler_t *ds,
             errors[1] += e_down;
             *errors--   = value;
         }
-        outp++;
     }
-    pack_8to1(out_buffer, outp, awidth);
+    return e_forward;
 }
 
-static void down_core_3(gx_downscaler_t *ds,
-                        byte            *out_buffer,
-                        byte            *in_buffer,
-                        int              row,
-                        int              plane,
-                        int              span)
+/* Floyd Steinberg with min feature size = 2, for interleaved CMYK (where
+ * 1 is the ink). */
+static int down_ed_mfs4(gx_downscaler_t      *ds,
+                        byte                 *outp,
+                        const unsigned short *sums,
+                        int                   row,
+                        int                   plane /* unused */,
+                        int                   nc /* unused */,
+                        int                   comp,
+                        int                   e_forward)
 {
     int        x, value;
-    int        e_downleft, e_down, e_forward = 0;
-    int        pad_white;
-    byte      *inp, *outp;
-    int        width     = ds->width;
+    int        e_downleft, e_down;
     int        awidth    = ds->awidth;
-    int       *errors    = ds->errors + (awidth+3)*plane;
-    const int  threshold = 3*3*128;
-    const int  max_value = 3*3*255;
-
-    pad_white = (awidth - width) * 3;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*3;
-        for (x = 3; x > 0; x--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
+    int        factor    = ds->factor;
+    int       *errors;
+    const int  threshold = factor*factor*128;
+    const int  max_value = factor*factor*255;
+    byte      *mfs_data;
 
-    inp = in_buffer;
     if ((row & 1) == 0)
     {
-        /* Left to Right pass (no min feature size) */
-        errors += 2;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        /* Left to Right pass (with min feature size = 2) */
+        byte mfs, force_forward = 0;
+        errors = ds->errors + (awidth+3)*comp + 2;
+        mfs_data = ds->mfs_data + (awidth+1)*comp;
+        *mfs_data++ = mfs_clear;
+        for (x = comp; x < awidth*4; x += 4)
         {
-            value = e_forward + *errors +
-                    inp[     0] + inp[       1] + inp[       2] +
-                    inp[span  ] + inp[span  +1] + inp[span  +2] +
-                    inp[span*2] + inp[span*2+1] + inp[span*2+2];
-            inp += 3;
-            if (value >= threshold)
+            value = e_forward + *errors + sums[x];
+            mfs = *mfs_data;
+            *mfs_data++ = mfs_clear;
+            if ((mfs & mfs_force_off) || force_forward)
             {
-                *outp++ = 1;
+                /* We are being forced to be 0 */
+                outp[x] = 1;
+                value -= max_value;
+                force_forward = 0;
+            }
+            else if (value >= threshold)
+            {
+                /* We want to be 1 anyway */
+                outp[x] = 1;
                 value -= max_value;
+                if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
+                        != (mfs_above_is_0 | mfs_above_left_is_0))
+                {
+                    /* We aren't in a group anyway, so must force other
+                     * pixels. */
+                    mfs_data[-2] |= mfs_force_off;
+                    mfs_data[-1] |= mfs_force_off;
+                    force_forward = 1;
+                }
+                else
+                {
+                    /* No forcing, but we need to tell other pixels that
+                     * we were 1. */
+                    mfs_data[-2] |= mfs_above_is_0;
+                    mfs_data[-1] |= mfs_above_left_is_0;
+                }
             }
             else
             {
-                *outp++ = 0;
+                outp[x] = 0;
             }
             e_forward  = value * 7/16;
             e_downleft = value * 3/16;
@@ -453,29 +506,50 @@ static void down_core_3(gx_downscaler_t *ds,
             errors[-1] += e_down;
             *errors++   = value;
         }
-        outp -= awidth;
     }
     else
     {
-        /* Right to Left pass (no min feature size) */
-        errors += awidth;
-        inp += (awidth-1)*3;
-        outp = inp;
-        for (x = awidth; x > 0; x--)
+        /* Right to Left pass (with min feature size = 2) */
+        byte mfs, force_forward = 0;
+        errors = ds->errors + (awidth+3)*comp + awidth;
+        mfs_data = ds->mfs_data + (awidth+1)*comp + awidth;
+        *mfs_data-- = mfs_clear;
+        for (x = (awidth-1)*4 + comp; x >= 0; x -= 4)
         {
-            value = e_forward + *errors +
-                    inp[     0] + inp[       1] + inp[       2] +
-                    inp[span  ] + inp[span  +1] + inp[span  +2] +
-                    inp[span*2] + inp[span*2+1] + inp[span*2+2];
-            inp -= 3;
-            if (value >= threshold)
+            value = e_forward + *errors + sums[x];
+            mfs = *mfs_data;
+            *mfs_data-- = mfs_clear;
+            if ((mfs & mfs_force_off) || force_forward)
             {
-                *outp-- = 1;
+                /* We are being forced to be 0 */
+                outp[x] = 1;
+                value -= max_value;
+                force_forward = 0;
+            }
+            else if (value >= threshold)
+            {
+                outp[x] = 1;
                 value -= max_value;
+                if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
+                        != (mfs_above_is_0 | mfs_above_left_is_0))
+                {
+                    /* We aren't in a group anyway, so must force other
+                     * pixels. */
+                    mfs_data[1] |= mfs_force_off;
+                    mfs_data[2] |= mfs_force_off;
+                    force_forward = 1;
+                }
+                else
+                {
+                    /* No forcing, but we need to tell other pixels that
+                     * we were 1. */
+                    mfs_data[1] |= mfs_above_is_0;
+                    mfs_data[2] |= mfs_above_left_is_0;
+                }
             }
             else
             {
-                *outp-- = 0;
+                outp[x] = 0;
             }
             e_forward  = value * 7/16;
             e_downleft = value * 3/16;
@@ -485,12 +559,103 @@ static void down_core_3(gx_downscaler_t *ds,
             errors[1] += e_down;
             *errors--   = value;
         }
-        outp++;
     }
-    pack_8to1(out_buffer, outp, awidth);
+    return e_forward;
+}
+
+/* Even toned screening, for 1 plane or interleaved CMYK. The box sums are
+ * averaged back to bytes first, exactly as the contone cores would. */
+static int down_ed_ets(gx_downscaler_t      *ds,
+                       byte                 *outp,
+                       const unsigned short *sums,
+                       int                   row /* unused */,
+                       int                   plane /* unused */,
+                       int                   nc,
+                       int                   comp /* unused */,
+                       int                   e_forward /* unused */)
+{
+    unsigned char *dest[MAX_ETS_PLANES];
+    ETS_SrcPixel *src[MAX_ETS_PLANES];
+    int div = ds->factor * ds->factor;
+    int x;
+
+    for (x = 0; x < ds->awidth * nc; x++)
+        outp[x] = (sums[x] + (div>>1))/div;
+
+    if (nc == 1)
+    {
+        src[0] = outp;
+        dest[0] = outp;
+    }
+    else
+    {
+        src[0] = outp+3;
+        dest[0] = outp+3;
+        src[1] = outp+1;
+        dest[1] = outp+1;
+        src[2] = outp+0;
+        dest[2] = outp+0;
+        src[3] = outp+2;
+        dest[3] = outp+2;
+    }
+    ets_line((ETS_Ctx *)ds->ets_config, dest, (const ETS_SrcPixel * const *)src);
+    return 0;
+}
+
+/* How many components an error diffusion stage does one at a time. */
+#define DOWN_ED_CHAINS(ed_core, nc) ((ed_core) == down_ed_ets ? 1 : (nc))
+
+/* Run a whole line through the box filter and an error diffusion stage,
+ * using in_buffer as scratch for the unpacked result. */
+static void down_core_ed(gx_downscaler_t *ds,
+                         byte            *out_buffer,
+                         byte            *in_buffer,
+                         int              row,
+                         int              plane,
+                         int              span,
+                         int              nc,
+                         down_ed_core    *ed_core)
+{
+    int comp, e_forward = 0;
+
+    down_pad_white(ds, in_buffer, nc, span);
+    down_box_line(ds, ds->box_sums, in_buffer, nc, span);
+    for (comp = 0; comp < DOWN_ED_CHAINS(ed_core, nc); comp++)
+        e_forward = ed_core(ds, in_buffer, ds->box_sums, row, plane, nc, comp, e_forward);
+    pack_8to1(out_buffer, in_buffer, ds->awidth * nc);
+}
+
+static void down_core(gx_downscaler_t *ds,
+                      byte            *out_buffer,
+                      byte            *in_buffer,
+                      int              row,
+                      int              plane,
+                      int              span)
+{
+    down_core_ed(ds, out_buffer, in_buffer, row, plane, span, 1, down_ed_fs);
+}
+
+static void down_core_mfs(gx_downscaler_t *ds,
+                          byte            *out_buffer,
+                          byte            *in_buffer,
+                          int              row,
+                          int              plane,
+                          int              span)
+{
+    down_core_ed(ds, out_buffer, in_buffer, row, plane, span, 1, down_ed_mfs);
+}
+
+static void down_core_ets_1(gx_downscaler_t *ds,
+                            byte            *out_buffer,
+                            byte            *in_buffer,
+                            int              row,
+                            int              plane,
+                            int              span)
+{
+    down_core_ed(ds, out_buffer, in_buffer, row, plane, span, 1, down_ed_ets);
 }
 
-static void down_core_4(gx_downscaler_t *ds,
+static void down_core_1(gx_downscaler_t *ds,
                         byte            *out_buffer,
                         byte            *in_buffer,
                         int              row,
@@ -504,21 +669,16 @@ static void down_core_4(gx_downscaler_t *ds,
     int        width     = ds->width;
     int        awidth    = ds->awidth;
     int       *errors    = ds->errors + (awidth+3)*plane;
-    const int  threshold = 4*4*128;
-    const int  max_value = 4*4*255;
+    const int  threshold = 128;
+    const int  max_value = 255;
 
-    pad_white = (awidth - width) * 4;
+    pad_white = (awidth - width);
     if (pad_white < 0)
         pad_white = 0;
 
     if (pad_white)
     {
-        inp = in_buffer + width*4;
-        for (x = 4; x > 0; x--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
+        memset(in_buffer + width, 0xFF, pad_white);
     }
 
     inp = in_buffer;
@@ -529,12 +689,7 @@ static void down_core_4(gx_downscaler_t *ds,
         outp = inp;
         for (x = awidth; x > 0; x--)
         {
-            value = e_forward + *errors +
-                    inp[     0] + inp[       1] + inp[       2] + inp[3       ] +
-                    inp[span  ] + inp[span  +1] + inp[span  +2] + inp[span  +3] +
-                    inp[span*2] + inp[span*2+1] + inp[span*2+2] + inp[span*2+3] +
-                    inp[span*3] + inp[span*3+1] + inp[span*3+2] + inp[span*3+3];
-            inp += 4;
+            value = e_forward + *errors + *inp++;
             if (value >= threshold)
             {
                 *outp++ = 1;
@@ -558,16 +713,11 @@ static void down_core_4(gx_downscaler_t *ds,
     {
         /* Right to Left pass (no min feature size) */
         errors += awidth;
-        inp += (awidth-1)*4;
+        inp += awidth-1;
         outp = inp;
         for (x = awidth; x > 0; x--)
         {
-            value = e_forward + *errors +
-                    inp[     0] + inp[       1] + inp[       2] + inp[3       ] +
-                    inp[span  ] + inp[span  +1] + inp[span  +2] + inp[span  +3] +
-                    inp[span*2] + inp[span*2+1] + inp[span*2+2] + inp[span*2+3] +
-                    inp[span*3] + inp[span*3+1] + inp[span*3+2] + inp[span*3+3];
-            inp -= 4;
+            value = e_forward + *errors + *inp--;
             if (value >= threshold)
             {
                 *outp-- = 1;
@@ -590,24 +740,52 @@ static void down_core_4(gx_downscaler_t *ds,
     pack_8to1(out_buffer, outp, awidth);
 }
 
-static void down_core_mfs(gx_downscaler_t *ds,
-                          byte            *out_buffer,
-                          byte            *in_buffer,
-                          int              row,
-                          int              plane,
-                          int              span)
+/* CMYK 32 -> 4bit core */
+static void down_core4(gx_downscaler_t *ds,
+                       byte            *out_buffer,
+                       byte            *in_buffer,
+                       int              row,
+                       int              plane /* unused */,
+                       int              span)
 {
-    int        x, xx, y, value;
-    int        e_downleft, e_down, e_forward = 0;
-    int        pad_white;
-    byte      *inp, *outp;
-    int        width     = ds->width;
-    int        awidth    = ds->awidth;
-    int        factor    = ds->factor;
-    int       *errors    = ds->errors + (awidth+3)*plane;
-    byte      *mfs_data  = ds->mfs_data + (awidth+1)*plane;
-    const int  threshold = factor*factor*128;
-    const int  max_value = factor*factor*255;
+    down_core_ed(ds, out_buffer, in_buffer, row, 0, span, 4, down_ed_fs);
+}
+
+static void down_core4_ets(gx_downscaler_t *ds,
+                           byte            *out_buffer,
+                           byte            *in_buffer,
+                           int              row,
+                           int              plane /* unused */,
+                           int              span)
+{
+    down_core_ed(ds, out_buffer, in_buffer, row, 0, span, 4, down_ed_ets);
+}
+
+static void down_core4_mfs(gx_downscaler_t *ds,
+                           byte            *out_buffer,
+                           byte            *in_buffer,
+                           int              row,
+                           int              plane /* unused */,
+                           int              span)
+{
+    down_core_ed(ds, out_buffer, in_buffer, row, 0, span, 4, down_ed_mfs4);
+}
+
+/* Grey (or planar) downscale code */
+static void down_core16(gx_downscaler_t *ds,
+                        byte            *outp,
+                        byte            *in_buffer,
+                        int              row,
+                        int              plane,
+                        int              span)
+{
+    int   x, xx, y, value;
+    int   pad_white;
+    byte *inp;
+    int   width  = ds->width;
+    int   awidth = ds->awidth;
+    int   factor = ds->factor;
+    int   div    = factor*factor;
 
     pad_white = (awidth - width) * factor;
     if (pad_white < 0)
@@ -615,519 +793,21 @@ static void down_core_mfs(gx_downscaler_t *ds,
 
     if (pad_white)
     {
-        inp = in_buffer + width*factor;
+        inp = in_buffer + width*2*factor;
         for (y = factor; y > 0; y--)
         {
-            memset(inp, 0xFF, pad_white);
+            memset(inp, 0xFF, pad_white*2);
             inp += span;
         }
     }
 
     inp = in_buffer;
-    if ((row & 1) == 0)
     {
-        /* Left to Right pass (with min feature size = 2) */
-        const int back = span * factor -1;
-        byte mfs, force_forward = 0;
-        errors += 2;
-        outp = inp;
-        *mfs_data++ = mfs_clear;
+        /* Left to Right pass (no min feature size) */
+        const int back = span * factor -2;
         for (x = awidth; x > 0; x--)
         {
-            value = e_forward + *errors;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            mfs = *mfs_data;
-            *mfs_data++ = mfs_clear;
-            if ((mfs & mfs_force_off) || force_forward)
-            {
-                /* We are being forced to be 0 */
-                *outp++ = 0;
-                force_forward = 0;
-            }
-            else if (value < threshold)
-            {
-                /* We want to be 0 anyway */
-                *outp++ = 0;
-                if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
-                        != (mfs_above_is_0 | mfs_above_left_is_0))
-                {
-                    /* We aren't in a group anyway, so must force other
-                     * pixels. */
-                    mfs_data[-2] |= mfs_force_off;
-                    mfs_data[-1] |= mfs_force_off;
-                    force_forward = 1;
-                }
-                else
-                {
-                    /* No forcing, but we need to tell other pixels that
-                     * we were 0. */
-                    mfs_data[-2] |= mfs_above_is_0;
-                    mfs_data[-1] |= mfs_above_left_is_0;
-                }
-            }
-            else
-            {
-                *outp++ = 1;
-                value -= max_value;
-            }
-            e_forward  = value * 7/16;
-            e_downleft = value * 3/16;
-            e_down     = value * 5/16;
-            value     -= e_forward + e_downleft + e_down;
-            errors[-2] += e_downleft;
-            errors[-1] += e_down;
-            *errors++   = value;
-        }
-        outp -= awidth;
-    }
-    else
-    {
-        /* Right to Left pass (with min feature size = 2) */
-        const int back = span * factor + 1;
-        byte mfs, force_forward = 0;
-        errors += awidth;
-        mfs_data += awidth;
-        inp += awidth*factor-1;
-        outp = inp;
-        *mfs_data-- = mfs_clear;
-        for (x = awidth; x > 0; x--)
-        {
-            value = e_forward + *errors;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            mfs = *mfs_data;
-            *mfs_data-- = mfs_clear;
-            if ((mfs & mfs_force_off) || force_forward)
-            {
-                /* We are being forced to be 0 */
-                *outp-- = 0;
-                force_forward = 0;
-            }
-            else if (value < threshold)
-            {
-                *outp-- = 0;
-                if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
-                        != (mfs_above_is_0 | mfs_above_left_is_0))
-                {
-                    /* We aren't in a group anyway, so must force other
-                     * pixels. */
-                    mfs_data[1] |= mfs_force_off;
-                    mfs_data[2] |= mfs_force_off;
-                    force_forward = 1;
-                }
-                else
-                {
-                    /* No forcing, but we need to tell other pixels that
-                     * we were 0. */
-                    mfs_data[1] |= mfs_above_is_0;
-                    mfs_data[2] |= mfs_above_left_is_0;
-                }
-            }
-            else
-            {
-                *outp-- = 1;
-                value -= max_value;
-            }
-            e_forward  = value * 7/16;
-            e_downleft = value * 3/16;
-            e_down     = value * 5/16;
-            value     -= e_forward + e_downleft + e_down;
-            errors[2] += e_downleft;
-            errors[1] += e_down;
-            *errors--   = value;
-        }
-        outp++;
-    }
-    pack_8to1(out_buffer, outp, awidth);
-}
-
-/* CMYK 32 -> 4bit core */
-static void down_core4(gx_downscaler_t *ds,
-                       byte            *out_buffer,
-                       byte            *in_buffer,
-                       int              row,
-                       int              plane /* unused */,
-                       int              span)
-{
-    int        x, xx, y, value, comp;
-    int        e_downleft, e_down, e_forward = 0;
-    int        pad_white;
-    byte      *inp, *outp;
-    int        width     = ds->width;
-    int        awidth    = ds->awidth;
-    int        factor    = ds->factor;
-    int       *errors    = ds->errors;
-    const int  threshold = factor*factor*128;
-    const int  max_value = factor*factor*255;
-
-    pad_white = (awidth - width) * factor * 4;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*factor * 4;
-        for (y = factor; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
-
-    if ((row & 1) == 0)
-    {
-        /* Left to Right pass (no min feature size) */
-        const int back = span * factor - 4;
-        for (comp = 0; comp < 4; comp++)
-        {
-            errors = ds->errors + (awidth+3)*comp + 2;
-            inp = in_buffer + comp;
-            outp = inp;
-            for (x = awidth; x > 0; x--)
-            {
-                value = e_forward + *errors;
-                for (xx = factor; xx > 0; xx--)
-                {
-                    for (y = factor; y > 0; y--)
-                    {
-                        value += *inp;
-                        inp += span;
-                    }
-                    inp -= back;
-                }
-                if (value >= threshold)
-                {
-                    *outp = 1; outp += 4;
-                    value -= max_value;
-                }
-                else
-                {
-                    *outp = 0; outp += 4;
-                }
-                e_forward  = value * 7/16;
-                e_downleft = value * 3/16;
-                e_down     = value * 5/16;
-                value     -= e_forward + e_downleft + e_down;
-                errors[-2] += e_downleft;
-                errors[-1] += e_down;
-                *errors++   = value;
-            }
-        }
-        outp = in_buffer;
-    }
-    else
-    {
-        /* Right to Left pass (no min feature size) */
-        const int back = span * factor + 4;
-        for (comp = 0; comp < 4; comp++)
-        {
-            errors = ds->errors + (awidth+3)*comp + awidth;
-            inp = in_buffer + awidth*factor*4 - 4 + comp;
-            outp = inp;
-            for (x = awidth; x > 0; x--)
-            {
-                value = e_forward + *errors;
-                for (xx = factor; xx > 0; xx--)
-                {
-                    for (y = factor; y > 0; y--)
-                    {
-                        value += *inp;
-                        inp += span;
-                    }
-                    inp -= back;
-                }
-                if (value >= threshold)
-                {
-                    *outp = 1; outp -= 4;
-                    value -= max_value;
-                }
-                else
-                {
-                    *outp = 0; outp -= 4;
-                }
-                e_forward  = value * 7/16;
-                e_downleft = value * 3/16;
-                e_down     = value * 5/16;
-                value     -= e_forward + e_downleft + e_down;
-                errors[2] += e_downleft;
-                errors[1] += e_down;
-                *errors--   = value;
-            }
-        }
-        outp = in_buffer + awidth*factor*4 - (awidth*4);
-    }
-    pack_8to1(out_buffer, outp, awidth*4);
-}
-
-static void down_core4_ets(gx_downscaler_t *ds,
-                           byte            *out_buffer,
-                           byte            *in_buffer,
-                           int              row,
-                           int              plane /* unused */,
-                           int              span)
-{
-    unsigned char *dest[MAX_ETS_PLANES];
-    ETS_SrcPixel *src[MAX_ETS_PLANES];
-    int pad_white, y;
-    int factor = ds->factor;
-
-    pad_white = (ds->awidth - ds->width) * factor * 4;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        unsigned char *inp = in_buffer + ds->width * factor * 4;
-        for (y = factor; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
-
-    if (ds->ets_downscale)
-        ds->ets_downscale(ds, in_buffer, in_buffer, row, plane, span);
-
-    src[0] = in_buffer+3;
-    dest[0] = in_buffer+3;
-    src[1] = in_buffer+1;
-    dest[1] = in_buffer+1;
-    src[2] = in_buffer+0;
-    dest[2] = in_buffer+0;
-    src[3] = in_buffer+2;
-    dest[3] = in_buffer+2;
-    ets_line((ETS_Ctx *)ds->ets_config, dest, (const ETS_SrcPixel * const *)src);
-
-    pack_8to1(out_buffer, in_buffer, ds->awidth * 4);
-}
-
-static void down_core4_mfs(gx_downscaler_t *ds,
-                           byte            *out_buffer,
-                           byte            *in_buffer,
-                           int              row,
-                           int              plane /* unused */,
-                           int              span)
-{
-    int        x, xx, y, value, comp;
-    int        e_downleft, e_down, e_forward = 0;
-    int        pad_white;
-    byte      *inp, *outp;
-    int        width     = ds->width;
-    int        awidth    = ds->awidth;
-    int        factor    = ds->factor;
-    int       *errors;
-    const int  threshold = factor*factor*128;
-    const int  max_value = factor*factor*255;
-    byte      *mfs_data;
-
-    pad_white = (awidth - width) * factor * 4;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*factor*4;
-        for (y = factor*4; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
-
-    if ((row & 1) == 0)
-    {
-        /* Left to Right pass (with min feature size = 2) */
-        const int back = span * factor - 4;
-        for (comp = 0; comp < 4; comp++)
-        {
-            byte mfs, force_forward = 0;
-            errors = ds->errors + (awidth+3)*comp + 2;
-            inp = in_buffer + comp;
-            outp = inp;
-            mfs_data = ds->mfs_data + (awidth+1)*comp;
-            *mfs_data++ = mfs_clear;
-            for (x = awidth; x > 0; x--)
-            {
-                value = e_forward + *errors;
-                for (xx = factor; xx > 0; xx--)
-                {
-                    for (y = factor; y > 0; y--)
-                    {
-                        value += *inp;
-                        inp += span;
-                    }
-                    inp -= back;
-                }
-                mfs = *mfs_data;
-                *mfs_data++ = mfs_clear;
-                if ((mfs & mfs_force_off) || force_forward)
-                {
-                    /* We are being forced to be 0 */
-                    *outp = 1; outp += 4;
-                    value -= max_value;
-                    force_forward = 0;
-                }
-                else if (value >= threshold)
-                {
-                    /* We want to be 1 anyway */
-                    *outp = 1; outp += 4;
-                    value -= max_value;
-                    if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
-                            != (mfs_above_is_0 | mfs_above_left_is_0))
-                    {
-                        /* We aren't in a group anyway, so must force other
-                         * pixels. */
-                        mfs_data[-2] |= mfs_force_off;
-                        mfs_data[-1] |= mfs_force_off;
-                        force_forward = 1;
-                    }
-                    else
-                    {
-                        /* No forcing, but we need to tell other pixels that
-                         * we were 1. */
-                        mfs_data[-2] |= mfs_above_is_0;
-                        mfs_data[-1] |= mfs_above_left_is_0;
-                    }
-                }
-                else
-                {
-                    *outp = 0; outp += 4;
-                }
-                e_forward  = value * 7/16;
-                e_downleft = value * 3/16;
-                e_down     = value * 5/16;
-                value     -= e_forward + e_downleft + e_down;
-                errors[-2] += e_downleft;
-                errors[-1] += e_down;
-                *errors++   = value;
-            }
-        }
-        outp = in_buffer;
-    }
-    else
-    {
-        /* Right to Left pass (with min feature size = 2) */
-        const int back = span * factor + 4;
-        for (comp = 0; comp < 4; comp++)
-        {
-            byte mfs, force_forward = 0;
-            errors = ds->errors + (awidth+3)*comp + awidth;
-            inp = in_buffer + awidth*factor*4 - 4 + comp;
-            outp = inp;
-            mfs_data = ds->mfs_data + (awidth+1)*comp + awidth;
-            *mfs_data-- = mfs_clear;
-            for (x = awidth; x > 0; x--)
-            {
-                value = e_forward + *errors;
-                for (xx = factor; xx > 0; xx--)
-                {
-                    for (y = factor; y > 0; y--)
-                    {
-                        value += *inp;
-                        inp += span;
-                    }
-                    inp -= back;
-                }
-                mfs = *mfs_data;
-                *mfs_data-- = mfs_clear;
-                if ((mfs & mfs_force_off) || force_forward)
-                {
-                    /* We are being forced to be 0 */
-                    *outp = 1; outp -= 4;
-                    value -= max_value;
-                    force_forward = 0;
-                }
-                else if (value >= threshold)
-                {
-                    *outp = 1; outp -= 4;
-                    value -= max_value;
-                    if ((mfs & (mfs_above_is_0 | mfs_above_left_is_0))
-                            != (mfs_above_is_0 | mfs_above_left_is_0))
-                    {
-                        /* We aren't in a group anyway, so must force other
-                         * pixels. */
-                        mfs_data[1] |= mfs_force_off;
-                        mfs_data[2] |= mfs_force_off;
-                        force_forward = 1;
-                    }
-                    else
-                    {
-                        /* No forcing, but we need to tell other pixels that
-                         * we were 1. */
-                        mfs_data[1] |= mfs_above_is_0;
-                        mfs_data[2] |= mfs_above_left_is_0;
-                    }
-                }
-                else
-                {
-                    *outp = 0; outp -= 4;
-                }
-                e_forward  = value * 7/16;
-                e_downleft = value * 3/16;
-                e_down     = value * 5/16;
-                value     -= e_forward + e_downleft + e_down;
-                errors[2] += e_downleft;
-                errors[1] += e_down;
-                *errors--   = value;
-            }
-        }
-        outp = in_buffer + awidth*factor*4 - (awidth*4);
-    }
-    pack_8to1(out_buffer, outp, awidth*4);
-}
-
-/* Grey (or planar) downscale code */
-static void down_core16(gx_downscaler_t *ds,
-                        byte            *outp,
-                        byte            *in_buffer,
-                        int              row,
-                        int              plane,
-                        int              span)
-{
-    int   x, xx, y, value;
-    int   pad_white;
-    byte *inp;
-    int   width  = ds->width;
-    int   awidth = ds->awidth;
-    int   factor = ds->factor;
-    int   div    = factor*factor;
-
-    pad_white = (awidth - width) * factor;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*2*factor;
-        for (y = factor; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white*2);
-            inp += span;
-        }
-    }
-
-    inp = in_buffer;
-    {
-        /* Left to Right pass (no min feature size) */
-        const int back = span * factor -2;
-        for (x = awidth; x > 0; x--)
-        {
-            value = 0;
+            value = 0;
             for (xx = factor; xx > 0; xx--)
             {
                 for (y = factor; y > 0; y--)
@@ -1148,52 +828,13 @@ static void down_core16(gx_downscaler_t *ds,
 
 static void down_core8(gx_downscaler_t *ds,
                        byte            *outp,
-                       byte            *in_buffer,
-                       int              row,
-                       int              plane,
-                       int              span)
-{
-    int   x, xx, y, value;
-    int   pad_white;
-    byte *inp;
-    int   width  = ds->width;
-    int   awidth = ds->awidth;
-    int   factor = ds->factor;
-    int   div    = factor*factor;
-
-    pad_white = (awidth - width) * factor;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*factor;
-        for (y = factor; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
-
-    inp = in_buffer;
-    {
-        /* Left to Right pass (no min feature size) */
-        const int back = span * factor -1;
-        for (x = awidth; x > 0; x--)
-        {
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            *outp++ = (value+(div>>1))/div;
-        }
-    }
+                       byte            *in_buffer,
+                       int              row,
+                       int              plane,
+                       int              span)
+{
+    down_pad_white(ds, in_buffer, 1, span);
+    down_box8(ds, outp, in_buffer, 1, span);
 }
 
 static void down_core8_2(gx_downscaler_t *ds,
@@ -1224,9 +865,33 @@ static void down_core8_2(gx_downscaler_t *ds,
     }
 
     inp = in_buffer;
+    x = awidth;
+
+#ifdef HAVE_SSE2
+    /* 8 pixels at a time: add the byte pairs of each line in 16 bits. */
+    {
+        const __m128i lo_bytes = _mm_set1_epi16(0x00ff);
+        const __m128i round = _mm_set1_epi16(2);
+
+        for (; x >= 8; x -= 8)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i *)inp);
+            __m128i b = _mm_loadu_si128((const __m128i *)(inp + span));
+            __m128i s;
+
+            s = _mm_add_epi16(_mm_and_si128(a, lo_bytes), _mm_srli_epi16(a, 8));
+            s = _mm_add_epi16(s, _mm_and_si128(b, lo_bytes));
+            s = _mm_add_epi16(s, _mm_srli_epi16(b, 8));
+            s = _mm_srli_epi16(_mm_add_epi16(s, round), 2);
+            _mm_storel_epi64((__m128i *)outp, _mm_packus_epi16(s, s));
+            inp += 16;
+            outp += 8;
+        }
+    }
+#endif
 
     /* Left to Right pass (no min feature size) */
-    for (x = awidth; x > 0; x--)
+    for (; x > 0; x--)
     {
         *outp++ = (inp[0] + inp[1] + inp[span] + inp[span+1] + 2)>>2;
         inp += 2;
@@ -1300,9 +965,46 @@ static void down_core8_4(gx_downscaler_t *ds,
     }
 
     inp = in_buffer;
+    x = awidth;
+
+#ifdef HAVE_SSE2
+    /* 8 pixels at a time: sum the byte pairs of the 4 lines in 16 bits,
+     * then pairs of those in 32. */
+    {
+        const __m128i lo_bytes = _mm_set1_epi16(0x00ff);
+        const __m128i ones = _mm_set1_epi16(1);
+        const __m128i round = _mm_set1_epi32(8);
+
+        for (; x >= 8; x -= 8)
+        {
+            __m128i lo = _mm_setzero_si128();
+            __m128i hi = _mm_setzero_si128();
+            const byte *p = inp;
+            int y;
+
+            for (y = 4; y > 0; y--)
+            {
+                __m128i a = _mm_loadu_si128((const __m128i *)p);
+                __m128i b = _mm_loadu_si128((const __m128i *)(p + 16));
+
+                lo = _mm_add_epi16(lo, _mm_and_si128(a, lo_bytes));
+                lo = _mm_add_epi16(lo, _mm_srli_epi16(a, 8));
+                hi = _mm_add_epi16(hi, _mm_and_si128(b, lo_bytes));
+                hi = _mm_add_epi16(hi, _mm_srli_epi16(b, 8));
+                p += span;
+            }
+            lo = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(lo, ones), round), 4);
+            hi = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(hi, ones), round), 4);
+            lo = _mm_packs_epi32(lo, hi);
+            _mm_storel_epi64((__m128i *)outp, _mm_packus_epi16(lo, lo));
+            inp += 32;
+            outp += 8;
+        }
+    }
+#endif
 
     /* Left to Right pass (no min feature size) */
-    for (x = awidth; x > 0; x--)
+    for (; x > 0; x--)
     {
         *outp++ = (inp[0     ] + inp[       1] + inp[       2] + inp[       3] +
                    inp[span  ] + inp[span  +1] + inp[span  +2] + inp[span  +3] +
@@ -1436,76 +1138,8 @@ static void down_core24(gx_downscaler_t *ds,
                         int              plane,
                         int              span)
 {
-    int   x, xx, y, value;
-    int   pad_white;
-    byte *inp;
-    int   width  = ds->width;
-    int   awidth = ds->awidth;
-    int   factor = ds->factor;
-    int   div    = factor*factor;
-
-    pad_white = (awidth - width) * factor * 3;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*factor*3;
-        for (y = factor; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
-
-    inp = in_buffer;
-    {
-        /* Left to Right pass (no min feature size) */
-        const int back  = span * factor - 3;
-        const int back2 = factor * 3 - 1;
-        for (x = awidth; x > 0; x--)
-        {
-            /* R */
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            inp -= back2;
-            *outp++ = (value+(div>>1))/div;
-            /* G */
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            inp -= back2;
-            *outp++ = (value+(div>>1))/div;
-            /* B */
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            inp -= 2;
-            *outp++ = (value+(div>>1))/div;
-        }
-    }
+    down_pad_white(ds, in_buffer, 3, span);
+    down_box8(ds, outp, in_buffer, 3, span);
 }
 
 /* CMYK downscale (no error diffusion) code */
@@ -1517,89 +1151,8 @@ static void down_core32(gx_downscaler_t *ds,
                         int              plane,
                         int              span)
 {
-    int   x, xx, y, value;
-    int   pad_white;
-    byte *inp;
-    int   width  = ds->width;
-    int   awidth = ds->awidth;
-    int   factor = ds->factor;
-    int   div    = factor*factor;
-
-    pad_white = (awidth - width) * factor * 4;
-    if (pad_white < 0)
-        pad_white = 0;
-
-    if (pad_white)
-    {
-        inp = in_buffer + width*factor*4;
-        for (y = factor; y > 0; y--)
-        {
-            memset(inp, 0xFF, pad_white);
-            inp += span;
-        }
-    }
-
-    inp = in_buffer;
-    {
-        /* Left to Right pass (no min feature size) */
-        const int back  = span * factor - 4;
-        const int back2 = factor * 4 - 1;
-        for (x = awidth; x > 0; x--)
-        {
-            /* C */
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            inp -= back2;
-            *outp++ = (value+(div>>1))/div;
-            /* M */
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            inp -= back2;
-            *outp++ = (value+(div>>1))/div;
-            /* Y */
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            inp -= back2;
-            *outp++ = (value+(div>>1))/div;
-            /* K */
-            value = 0;
-            for (xx = factor; xx > 0; xx--)
-            {
-                for (y = factor; y > 0; y--)
-                {
-                    value += *inp;
-                    inp += span;
-                }
-                inp -= back;
-            }
-            inp -= 3;
-            *outp++ = (value+(div>>1))/div;
-        }
-    }
+    down_pad_white(ds, in_buffer, 4, span);
+    down_box8(ds, outp, in_buffer, 4, span);
 }
 
 static void decode_factor(int factor, int *up, int *down)
@@ -1718,7 +1271,7 @@ static int check_trapping(gs_memory_t *memory, int trap_w, int trap_h,
     return 0;
 }
 
-static int init_ets(gx_downscaler_t *ds, int num_planes, gx_downscale_core *downscale_core)
+static int init_ets(gx_downscaler_t *ds, int num_planes)
 {
     ETS_Params params = { 0 };
     int strengths[MAX_ETS_PLANES] = { 128, 51, 51, 13, 13, 13, 13, 13 };
@@ -1735,8 +1288,6 @@ static int init_ets(gx_downscaler_t *ds, int num_planes, gx_downscale_core *down
     if (num_planes > MAX_ETS_PLANES)
         return gs_error_rangecheck;
 
-    ds->ets_downscale = downscale_core;
-
     /* Setup a simple gamma scale */
     {
         double scale = ETS_SRC_MAX;
@@ -1903,12 +1454,6 @@ int gx_downscaler_init_planar_trapped_cm(gx_downscaler_t      *ds,
     } else if (dst_bpc == 1) {
         if (mfs > 1)
             core = &down_core_mfs;
-        else if (factor == 4)
-            core = &down_core_4;
-        else if (factor == 3)
-            core = &down_core_3;
-        else if (factor == 2)
-            core = &down_core_2;
         else if (factor == 1)
             core = &down_core_1;
         else
@@ -1946,6 +1491,13 @@ int gx_downscaler_init_planar_trapped_cm(gx_downscaler_t      *ds,
             goto cleanup;
         }
         memset(ds->errors, 0, num_comps * (width+3) * sizeof(int));
+        ds->box_sums = (unsigned short *)gs_alloc_byte_array(dev->memory,
+                                           width, sizeof(unsigned short),
+                                           "gx_downscaler(box_sums)");
+        if (ds->box_sums == NULL) {
+            code = gs_note_error(gs_error_VMerror);
+            goto cleanup;
+        }
     }
 
     return 0;
@@ -2195,7 +1747,7 @@ int gx_downscaler_init_trapped_cm_ets(gx_downscaler_t    *ds,
                 core = &down_core4_mfs;
             else if (ets)
             {
-                code = init_ets(ds, 4, core);
+                code = init_ets(ds, 4);
                 if (code)
                     goto cleanup;
                 core = &down_core4_ets;
@@ -2209,17 +1761,11 @@ int gx_downscaler_init_trapped_cm_ets(gx_downscaler_t    *ds,
                 core = &down_core_mfs;
             else if (ets)
             {
-                code = init_ets(ds, 1, core);
+                code = init_ets(ds, 1);
                 if (code)
                     goto cleanup;
                 core = &down_core_ets_1;
             }
-            else if (factor == 4)
-                core = &down_core_4;
-            else if (factor == 3)
-                core = &down_core_3;
-            else if (factor == 2)
-                core = &down_core_2;
             else if (factor == 1)
                 core = &down_core_1;
             else
@@ -2297,6 +1843,13 @@ int gx_downscaler_init_trapped_cm_ets(gx_downscaler_t    *ds,
                 goto cleanup;
             }
             memset(ds->errors, 0, num_comps * (awidth+3) * sizeof(int));
+            ds->box_sums = (unsigned short *)gs_alloc_byte_array(dev->memory,
+                                               awidth*nc, sizeof(unsigned short),
+                                               "gx_downscaler(box_sums)");
+            if (ds->box_sums == NULL) {
+                code = gs_note_error(gs_error_VMerror);
+                goto cleanup;
+            }
         }
     }
 
@@ -2322,6 +1875,8 @@ void gx_downscaler_fin(gx_downscaler_t *ds)
     ds->mfs_data = NULL;
     gs_free_object(ds->dev->memory, ds->errors, "gx_downscaler(errors)");
     ds->errors = NULL;
+    gs_free_object(ds->dev->memory, ds->box_sums, "gx_downscaler(box_sums)");
+    ds->box_sums = NULL;
     gs_free_object(ds->dev->memory, ds->scaled_data, "gx_downscaler(scaled_data)");
     ds->scaled_data = NULL;
 
@@ -2543,21 +2098,72 @@ int gx_downscaler_get_bits_rectangle(gx_downscaler_t      *ds,
     return code;
 }
 
+typedef struct downscaler_process_page_buffer_s downscaler_process_page_buffer_t;
+
 typedef struct downscaler_process_page_arg_s
 {
     gx_process_page_options_t *orig_options;
     int upfactor;
     int downfactor;
     gx_downscaler_t ds;
+    int nc;                     /* Components in the box sums */
+    down_ed_core *ed_core;      /* Error diffusion stage (or NULL) */
+    /* Error diffusion goes down the page as one chain of bands per
+     * component (see downscaler_ed_work). The rest is under lock. */
+    int chains;
+    bool in_order;              /* Bands arrive top down */
+    gx_monitor_t *lock;
+    gx_semaphore_t *chain_moved;
+    bool output_waiting;        /* output_fn is waiting on chain_moved */
+    int next_row[MAX_ED_CHAINS];  /* The next row each chain diffuses */
+    bool busy[MAX_ED_CHAINS];
+    downscaler_process_page_buffer_t *pending; /* Bands not yet diffused */
+    int ed_error;
 }
 downscaler_process_page_arg_t;
 
-typedef struct downscaler_process_page_buffer_s
+struct downscaler_process_page_buffer_s
 {
     gx_device *bdev;
     void *orig_buffer;
+    /* When error diffusing, the box sums for the band, kept until they can
+     * be diffused (into bdev), and how far that has got. */
+    unsigned short *sums;
+    int *carry;                 /* e_forward between chains, per row */
+    gs_int_rect rect;
+    int row0, rows;             /* The band's output rows */
+    int row_end;                /* Where the chains go on from after it */
+    int chains_done;
+    bool done;
+    downscaler_process_page_buffer_t *next;
+};
+
+static int downscaler_create_buf_device(gx_device *dev, gs_memory_t *memory, int h, gx_device **pbdev)
+{
+    int code;
+
+    code = gx_default_create_buf_device(pbdev, dev, 0, NULL, memory, NULL);
+    if (code < 0)
+        return code;
+    /* Have the memory device allocate (and free) its own bitmap. */
+    ((gx_device_memory *)*pbdev)->bitmap_memory = memory;
+    (*pbdev)->height = h;
+    code = dev_proc(*pbdev, open_device)(*pbdev);
+    if (code < 0) {
+        gx_default_destroy_buf_device(*pbdev);
+        *pbdev = NULL;
+    }
+    return code;
+}
+
+static void downscaler_free_buffer(gs_memory_t *memory, downscaler_process_page_buffer_t *buffer)
+{
+    if (buffer->bdev)
+        gx_default_destroy_buf_device(buffer->bdev);
+    gs_free_object(memory, buffer->carry, "downscaler process_page carry");
+    gs_free_object(memory, buffer->sums, "downscaler process_page sums");
+    gs_free_object(memory, buffer, "downscaler process_page buffer");
 }
-downscaler_process_page_buffer_t;
 
 static int downscaler_init_fn(void *arg_, gx_device *dev, gs_memory_t *memory, int w, int h, void **pbuffer)
 {
@@ -2570,14 +2176,30 @@ static int downscaler_init_fn(void *arg_, gx_device *dev, gs_memory_t *memory, i
         return_error(gs_error_VMerror);
     memset(buffer, 0, sizeof(*buffer));
 
-    if (arg->upfactor > arg->downfactor) {
-        code = gx_default_create_buf_device(&buffer->bdev, dev,
-                          (h*arg->upfactor + arg->downfactor-1)/arg->downfactor,
-                          NULL, memory, NULL);
-        if (code < 0) {
-            gs_free_object(memory, buffer, "downscaler process_page buffer");
-            return code;
+    if (arg->ed_core) {
+        int rows = h / arg->downfactor;
+
+        if (rows < 1)
+            rows = 1;
+        code = downscaler_create_buf_device(dev, memory, rows, &buffer->bdev);
+        if (code >= 0) {
+            buffer->sums = (unsigned short *)gs_alloc_byte_array(memory,
+                                    rows * arg->ds.awidth * arg->nc,
+                                    sizeof(unsigned short),
+                                    "downscaler process_page sums");
+            buffer->carry = (int *)gs_alloc_byte_array(memory, rows, sizeof(int),
+                                    "downscaler process_page carry");
+            if (buffer->sums == NULL || buffer->carry == NULL)
+                code = gs_note_error(gs_error_VMerror);
         }
+    } else if (arg->upfactor > arg->downfactor) {
+        code = downscaler_create_buf_device(dev, memory,
+                          (h*arg->upfactor + arg->downfactor-1)/arg->downfactor,
+                          &buffer->bdev);
+    }
+    if (code < 0) {
+        downscaler_free_buffer(memory, buffer);
+        return code;
     }
 
     if (arg->orig_options && arg->orig_options->init_buffer_fn) {
@@ -2586,9 +2208,7 @@ static int downscaler_init_fn(void *arg_, gx_device *dev, gs_memory_t *memory, i
                                                  (h * arg->upfactor + arg->downfactor-1)/arg->downfactor,
                                                  &buffer->orig_buffer);
         if (code < 0) {
-            if (buffer->bdev)
-                dev_proc(dev, close_device)(dev);
-            gs_free_object(memory, buffer, "downscaler process_page buffer");
+            downscaler_free_buffer(memory, buffer);
             return code;
         }
     }
@@ -2597,11 +2217,132 @@ static int downscaler_init_fn(void *arg_, gx_device *dev, gs_memory_t *memory, i
     return code;
 }
 
+/* Diffuse one chain (component) of a band's rows into its buffer device.
+ * After the last chain, pack the rows and hand them on for further
+ * processing. */
+static int
+downscaler_ed_chain(downscaler_process_page_arg_t *arg, gx_device *dev,
+                    downscaler_process_page_buffer_t *buffer, int chain)
+{
+    int n = arg->ds.awidth * arg->nc;
+    bool last = (chain == arg->chains - 1);
+    const unsigned short *sums = buffer->sums;
+    gs_get_bits_params_t params;
+    gs_int_rect out_rect;
+    byte *out_ptr;
+    int code, y, raster;
+
+    if (buffer->rows <= 0)
+        return 0;
+
+    out_rect.p.x = 0;
+    out_rect.p.y = 0;
+    out_rect.q.x = arg->ds.awidth;
+    out_rect.q.y = buffer->rows;
+    params.options = GB_COLORS_NATIVE | GB_ALPHA_NONE | GB_PACKING_CHUNKY | GB_RETURN_POINTER | GB_ALIGN_ANY | GB_OFFSET_0 | GB_RASTER_ANY;
+    code = dev_proc(buffer->bdev, get_bits_rectangle)(buffer->bdev, &out_rect, &params, NULL);
+    if (code < 0)
+        return code;
+
+    /* Each row of the buffer device has room for the unpacked result. */
+    out_ptr = params.data[0];
+    raster = gx_device_raster(buffer->bdev, true);
+    for (y = 0; y < buffer->rows; y++)
+    {
+        buffer->carry[y] = arg->ed_core(&arg->ds, out_ptr, sums,
+                                        buffer->row0 + y, 0, arg->nc, chain,
+                                        chain == 0 ? 0 : buffer->carry[y]);
+        if (last)
+            pack_8to1(out_ptr, out_ptr, n);
+        out_ptr += raster;
+        sums += n;
+    }
+
+    if (last && arg->orig_options && arg->orig_options->process_fn) {
+        out_rect.p.y = buffer->row0;
+        out_rect.q.y = buffer->row0 + buffer->rows;
+        code = arg->orig_options->process_fn(arg->orig_options->arg, dev,
+                                             buffer->bdev, &out_rect,
+                                             buffer->orig_buffer);
+    }
+    return code;
+}
+
+/*
+ * Diffuse whatever can be diffused now, having first added band 'add' (if
+ * any) to those waiting. A band's next chain can run once that chain has
+ * done the band above, if no one else is running it. So each component's
+ * chain goes down the page in order, from whichever thread gets there, and
+ * the chain for each component after the first runs a band or more behind
+ * the one before it (which hands on e_forward row by row), alongside it.
+ * Every row of every component sees exactly what it would in the serial
+ * code, so the output is the same however many threads there are.
+ *
+ * The rendering threads call this as each band is box filtered; output_fn
+ * calls it with the band it is to hand on ('wait_for'), and waits (doing
+ * what it can meanwhile) until that band is done. Nothing else waits: all
+ * the bands above wait_for have been output, so its chains are either
+ * free to run or running.
+ */
+static int
+downscaler_ed_work(downscaler_process_page_arg_t *arg, gx_device *dev,
+                   downscaler_process_page_buffer_t *add,
+                   downscaler_process_page_buffer_t *wait_for)
+{
+    downscaler_process_page_buffer_t *buffer, **pprev;
+    int chain = 0, code;
+
+    gx_monitor_enter(arg->lock);
+    if (add != NULL) {
+        add->next = arg->pending;
+        arg->pending = add;
+    }
+    for (;;) {
+        if (wait_for != NULL && (wait_for->done || arg->ed_error < 0))
+            break;
+        for (buffer = arg->pending; buffer != NULL; buffer = buffer->next) {
+            chain = buffer->chains_done;
+            if (!arg->busy[chain] && arg->next_row[chain] == buffer->row0)
+                break;
+        }
+        if (buffer == NULL) {
+            if (wait_for == NULL)
+                break;
+            arg->output_waiting = true;
+            gx_monitor_leave(arg->lock);
+            gx_semaphore_wait(arg->chain_moved);
+            gx_monitor_enter(arg->lock);
+            continue;
+        }
+        arg->busy[chain] = true;
+        gx_monitor_leave(arg->lock);
+        code = downscaler_ed_chain(arg, dev, buffer, chain);
+        gx_monitor_enter(arg->lock);
+        if (code < 0 && arg->ed_error == 0)
+            arg->ed_error = code;
+        arg->busy[chain] = false;
+        arg->next_row[chain] = buffer->row_end;
+        if (++buffer->chains_done == arg->chains) {
+            for (pprev = &arg->pending; *pprev != buffer; pprev = &(*pprev)->next)
+                ;
+            *pprev = buffer->next;
+            buffer->done = true;
+        }
+        if (arg->output_waiting) {
+            arg->output_waiting = false;
+            gx_semaphore_signal(arg->chain_moved);
+        }
+    }
+    code = arg->ed_error;
+    gx_monitor_leave(arg->lock);
+    return code;
+}
+
 static int downscaler_process_fn(void *arg_, gx_device *dev, gx_device *bdev, const gs_int_rect *rect, void *buffer_)
 {
     downscaler_process_page_arg_t *arg = (downscaler_process_page_arg_t *)arg_;
     downscaler_process_page_buffer_t *buffer = (downscaler_process_page_buffer_t *)buffer_;
-    int code, raster_in, raster_out;
+    int code, raster_out;
     gs_get_bits_params_t params;
     gs_int_rect in_rect, out_rect;
     byte *in_ptr, *out_ptr;
@@ -2618,20 +2359,60 @@ static int downscaler_process_fn(void *arg_, gx_device *dev, gx_device *bdev, co
     /* Where do we get the data from? */
     params.options = GB_COLORS_NATIVE | GB_ALPHA_NONE | GB_PACKING_CHUNKY | GB_RETURN_POINTER | GB_ALIGN_ANY | GB_OFFSET_0 | GB_RASTER_ANY;
     code = dev_proc(bdev, get_bits_rectangle)(bdev, &in_rect, &params, NULL);
-    if (code < 0)
+    if (code < 0) {
+        if (arg->ed_core && arg->in_order) {
+            /* The chains can't get past this band now, so stop output_fn
+             * waiting for them. */
+            gx_monitor_enter(arg->lock);
+            if (arg->ed_error == 0)
+                arg->ed_error = code;
+            if (arg->output_waiting) {
+                arg->output_waiting = false;
+                gx_semaphore_signal(arg->chain_moved);
+            }
+            gx_monitor_leave(arg->lock);
+        }
         return code;
-    raster_in = params.raster;
+    }
     in_ptr = params.data[0];
 
+    /* Error diffusion has to go down the page, so box filter the band,
+     * and then diffuse what we can (see downscaler_ed_work). */
+    if (arg->ed_core) {
+        unsigned short *sums = buffer->sums;
+        int n = arg->ds.awidth * arg->nc;
+        int y;
+
+        buffer->rows = 0;
+        for (y = rect->p.y; y + arg->downfactor <= rect->q.y; y += arg->downfactor)
+        {
+            down_box_line(&arg->ds, sums, in_ptr, arg->nc, arg->ds.span);
+            in_ptr += arg->ds.span * arg->downfactor;
+            sums += n;
+            buffer->rows++;
+        }
+        buffer->rect = *rect;
+        buffer->row0 = rect->p.y / arg->downfactor;
+        buffer->row_end = rect->q.y / arg->downfactor;
+        buffer->chains_done = 0;
+        buffer->done = (buffer->row_end == buffer->row0);
+        if (arg->in_order && !buffer->done) {
+            /* Any error turns up in output_fn. */
+            (void)downscaler_ed_work(arg, dev, buffer, NULL);
+        }
+        return 0;
+    }
+
     /* Where do we write it to? */
     if (buffer->bdev) {
         code = dev_proc(bdev, get_bits_rectangle)(buffer->bdev, &out_rect, &params, NULL);
         if (code < 0)
             return code;
-        raster_out = params.raster;
+        raster_out = gx_device_raster(buffer->bdev, true);
         out_ptr = params.data[0];
     } else {
-        raster_out = raster_in;
+        /* In place; the rasters are standard, so params.raster isn't set */
+        raster_out = arg->ds.span;
         out_ptr = params.data[0];
     }
 
@@ -2663,11 +2444,10 @@ downscaler_free_fn(void *arg_, gx_device *dev, gs_memory_t *memory, void *buffer
     downscaler_process_page_arg_t *arg = (downscaler_process_page_arg_t *)arg_;
     downscaler_process_page_buffer_t *buffer = (downscaler_process_page_buffer_t *)buffer_;
 
-    arg->orig_options->free_buffer_fn(arg->orig_options->arg, dev, memory,
-                                      buffer->orig_buffer);
-    if (buffer->bdev)
-        dev_proc(dev, close_device)(dev);
-    gs_free_object(memory, buffer, "downscaler process_page buffer");
+    if (arg->orig_options->free_buffer_fn)
+        arg->orig_options->free_buffer_fn(arg->orig_options->arg, dev, memory,
+                                          buffer->orig_buffer);
+    downscaler_free_buffer(memory, buffer);
 }
 
 static int
@@ -2675,23 +2455,66 @@ downscaler_output_fn(void *arg_, gx_device *dev, void *buffer_)
 {
     downscaler_process_page_arg_t *arg = (downscaler_process_page_arg_t *)arg_;
     downscaler_process_page_buffer_t *buffer = (downscaler_process_page_buffer_t *)buffer_;
+    int code = 0;
+
+    if (arg->ed_core) {
+        if (arg->in_order) {
+            if (!buffer->done)
+                code = downscaler_ed_work(arg, dev, NULL, buffer);
+        } else {
+            /* Bottom up, we just diffuse each band as it comes. */
+            int chain;
+
+            for (chain = 0; chain < arg->chains && code >= 0; chain++)
+                code = downscaler_ed_chain(arg, dev, buffer, chain);
+        }
+        if (code < 0)
+            return code;
+    }
 
+    if (arg->orig_options->output_fn == NULL)
+        return 0;
     return arg->orig_options->output_fn(arg->orig_options->arg, dev,
                                         buffer->orig_buffer);
 }
 
-/* No error diffusion with process_page as bands need to be handled
- * separately. */
 int gx_downscaler_process_page(gx_device                 *dev,
                                gx_process_page_options_t *options,
                                int                        factor)
+{
+    return gx_downscaler_process_page_ets(dev, options, factor, 0,
+                                          dev->color_info.comp_bits[0], 0);
+}
+
+/* Contone downscaling all happens on the rendering threads. So does 1 bit
+ * output (Floyd Steinberg, min feature size or ETS): the bands are box
+ * filtered as they are rendered, and then diffused down the page, one
+ * chain per component, by whichever threads are free (see
+ * downscaler_ed_work). The output is the same however many threads there
+ * are. */
+int gx_downscaler_process_page_ets(gx_device                 *dev,
+                                   gx_process_page_options_t *options,
+                                   int                        factor,
+                                   int                        mfs,
+                                   int                        dst_bpc,
+                                   int                        ets)
 {
     downscaler_process_page_arg_t arg = { 0 };
     gx_process_page_options_t my_options = { 0 };
-    int num_comps = dev->color_info.num_components;
     int src_bpc = dev->color_info.comp_bits[0];
+    int num_comps;
     int scaled_w;
-    gx_downscale_core *core;
+    gx_downscale_core *core = NULL;
+    int code;
+
+    /* Count the components from the depth, so that any alpha channel (as
+     * for pngalpha) gets downscaled along with the colors. Devices that
+     * don't fill in comp_bits get an even split of the depth. */
+    if (src_bpc <= 0 && dev->color_info.num_components > 0)
+        src_bpc = dev->color_info.depth / dev->color_info.num_components;
+    if (src_bpc <= 0 || dev->color_info.depth % src_bpc != 0)
+        return gs_note_error(gs_error_rangecheck);
+    num_comps = dev->color_info.depth / src_bpc;
 
     arg.orig_options = options;
     decode_factor(factor, &arg.upfactor, &arg.downfactor);
@@ -2704,12 +2527,28 @@ int gx_downscaler_process_page(gx_device                 *dev,
     arg.ds.src_bpc = src_bpc;
     arg.ds.scaled_span = bitmap_raster(scaled_w * num_comps * src_bpc);
     arg.ds.num_planes = 0;
+    arg.nc = num_comps;
 
     /* Choose an appropriate core */
     if (factor > 8)
     {
         return gs_note_error(gs_error_rangecheck);
     }
+    else if (dst_bpc == 1)
+    {
+        if (src_bpc != 8 || (num_comps != 1 && num_comps != 4))
+            return gs_note_error(gs_error_rangecheck);
+        /* As for gx_downscaler_init, partial pixels at the right hand
+         * edge are dropped. */
+        arg.ds.width = dev->width / factor;
+        arg.ds.awidth = arg.ds.width;
+        if (mfs > 1)
+            arg.ed_core = (num_comps == 4 ? down_ed_mfs4 : down_ed_mfs);
+        else if (ets)
+            arg.ed_core = down_ed_ets;
+        else
+            arg.ed_core = down_ed_fs;
+    }
     else if ((src_bpc == 16) && (num_comps == 1))
     {
         core = &down_core16;
@@ -2736,13 +2575,57 @@ int gx_downscaler_process_page(gx_device                 *dev,
     }
     arg.ds.down_core = core;
 
+    if (arg.ed_core) {
+        int awidth = arg.ds.awidth;
+
+        arg.ds.errors = (int *)gs_alloc_bytes(dev->memory,
+                                              num_comps*(awidth+3)*sizeof(int),
+                                              "gx_downscaler(errors)");
+        if (arg.ds.errors == NULL)
+            return gs_note_error(gs_error_VMerror);
+        memset(arg.ds.errors, 0, num_comps*(awidth+3)*sizeof(int));
+        if (mfs > 1) {
+            arg.ds.mfs_data = (byte *)gs_alloc_bytes(dev->memory,
+                                                     (awidth+1)*num_comps,
+                                                     "gx_downscaler(mfs)");
+            if (arg.ds.mfs_data == NULL) {
+                code = gs_note_error(gs_error_VMerror);
+                goto cleanup;
+            }
+            memset(arg.ds.mfs_data, 0, (awidth+1)*num_comps);
+        } else if (ets) {
+            code = init_ets(&arg.ds, num_comps);
+            if (code < 0)
+                goto cleanup;
+        }
+        arg.chains = DOWN_ED_CHAINS(arg.ed_core, num_comps);
+        arg.in_order = !(options->options & GX_PROCPAGE_BOTTOM_UP);
+        arg.lock = gx_monitor_label(gx_monitor_alloc(dev->memory->non_gc_memory),
+                                    "downscaler ed lock");
+        arg.chain_moved = gx_semaphore_label(gx_semaphore_alloc(dev->memory->non_gc_memory),
+                                             "downscaler ed chain moved");
+        if (arg.lock == NULL || arg.chain_moved == NULL) {
+            code = gs_note_error(gs_error_VMerror);
+            goto cleanup;
+        }
+    }
+
     my_options.init_buffer_fn = downscaler_init_fn;
     my_options.process_fn = downscaler_process_fn;
     my_options.output_fn = downscaler_output_fn;
     my_options.free_buffer_fn = downscaler_free_fn;
     my_options.arg = &arg;
+    my_options.options = options->options;
 
-    return dev_proc(dev, process_page)(dev, &my_options);
+    code = dev_proc(dev, process_page)(dev, &my_options);
+
+  cleanup:
+    if (arg.ed_core) {
+        gx_semaphore_free(arg.chain_moved);
+        gx_monitor_free(arg.lock);
+        gx_downscaler_fin(&arg.ds);
+    }
+    return code;
 }
 
 int gx_downscaler_read_params(gs_param_list        *plist,
@@ -85,7 +85,8 @@ struct gx_downscaler_s {
     int                   post_cm_num_comps;
 
     void                 *ets_config;
-    gx_downscale_core    *ets_downscale;
+    unsigned short       *box_sums;   /* Box filtered line, for the error
+                                       * diffusion cores */
 
     byte                 *pre_cm[GS_CLIENT_COLOR_MAX_COMPONENTS];
     byte                 *post_cm[GS_CLIENT_COLOR_MAX_COMPONENTS];
@@ -296,6 +297,20 @@ int gx_downscaler_process_page(gx_device                 *dev,
                                gx_process_page_options_t *options,
                                int                        factor);
 
+/* As above, but also allowing dst_bpc == 1 (for src_bpc == 8 and 1 or 4
+ * components), with mfs and ets as for gx_downscaler_init_ets. The
+ * rectangles passed to process_fn then hold packed 1 bit data (dropping
+ * any partial pixel at the right hand edge), and process_fn is called in
+ * band order on the calling thread, once the error diffusion for the band
+ * is done. Band heights must be multiples of the factor (see
+ * gx_downscaler_adjust_bandheight). */
+int gx_downscaler_process_page_ets(gx_device                 *dev,
+                                   gx_process_page_options_t *options,
+                                   int                        factor,
+                                   int                        mfs,
+                                   int                        dst_bpc,
+                                   int                        ets);
+
 /* The following structure is used to hold the configuration
  * parameters for the downscaler.
  */
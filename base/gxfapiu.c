@@ -22,6 +22,7 @@
 #include "stream.h"
 #include "strmio.h"
 #include "gsmalloc.h"
+#include "gpsync.h"  /* for gp_global_lock */
 #include "gxfixed.h" /* required by gxchar.h */
 #include "gxchar.h"  /* for MAX_CCACHE_TEMP_BITMAP_BITS */
 
@@ -40,6 +41,10 @@
    to our context here.
    When we fix the UFST_REENTRANT option, there will be
    provision for passing the context through the UFST.
+   Until then the UFST keeps its own state in globals, so it can only
+   serve one instance at a time: the one whose memory is in gs_mem_ctx,
+   from gx_UFST_init until gx_UFST_fini.  These, and the statics below,
+   are changed under gp_global_lock.
 */
 #if UFST_REENTRANT
 /* not currently supported */
@@ -372,8 +377,16 @@ gx_UFST_init(gs_memory_t * mem, const UB8 * ufst_root_dir)
     int status;
 
 #if !UFST_REENTRANT
-    if (ufst_initialized)
-        return 0;
+    gp_global_lock();
+    if (ufst_initialized) {
+        /* Another instance can't share it, see gs_mem_ctx above. */
+        status = (gs_mem_ctx->gs_lib_ctx == mem->gs_lib_ctx ? 0 :
+                  gs_error_invalidaccess);
+        gp_global_unlock();
+        if (status < 0)
+            dmprintf(mem, "UFST is in use by another instance\n");
+        return status;
+    }
     gs_mem_ctx = mem;
 #endif
     strcpy(config_block.ufstPath, ufst_root_dir);
@@ -387,33 +400,46 @@ gx_UFST_init(gs_memory_t * mem, const UB8 * ufst_root_dir)
 
     if ((status = CGIFinit(FSA0)) != 0) {
         dmprintf1(mem, "CGIFinit() error: %d\n", status);
-        gs_mem_ctx = NULL;
-        return status;
+        goto fail;
     }
     if ((status = CGIFconfig(FSA &config_block)) != 0) {
         dmprintf1(mem, "CGIFconfig() error: %d\n", status);
-        gs_mem_ctx = NULL;
-        return status;
+        goto fail;
     }
     CGIFfont_access(FSA DISK_ACCESS);
     if ((status = CGIFenter(FSA0)) != 0) {
         dmprintf1(mem, "CGIFenter() error: %u\n",status);
-        gs_mem_ctx = NULL;
-        return status;
+        goto fail;
     }
 #if !UFST_REENTRANT
     ufst_initialized = TRUE;
+    gp_global_unlock();
 #endif
     return 1;                   /* first time, caller may have more initialization to do */
+
+fail:
+#if !UFST_REENTRANT
+    gs_mem_ctx = NULL;
+    gp_global_unlock();
+#endif
+    return status;
 }
 
 int
-gx_UFST_fini(void)
+gx_UFST_fini(gs_memory_t * mem)
 {
+#if !UFST_REENTRANT
+    gp_global_lock();
+    if (!ufst_initialized || gs_mem_ctx->gs_lib_ctx != mem->gs_lib_ctx) {
+        gp_global_unlock();     /* not ours to close */
+        return 0;
+    }
+#endif
     CGIFexit(FSA0);
 #if !UFST_REENTRANT
     ufst_initialized = FALSE;
     gs_mem_ctx = NULL;
+    gp_global_unlock();
 #endif
     return 0;
 }
@@ -68,7 +68,7 @@ fco_list_elem *gx_UFST_find_static_fco_handle(SW16 fcHandle);
 
 int gx_UFST_init(gs_memory_t * mem, const UB8 * ufst_root_dir);
 
-int gx_UFST_fini(void);
+int gx_UFST_fini(gs_memory_t * mem);
 
 void *FAPIU_fopen(char *path, char *mode);
 void *FAPIU_open(char *path, int mode);
@@ -2142,9 +2142,9 @@ image_render_interpolate_icc(gx_image_enum * penum, const byte * buffer,
                           1, width_in);
             /* Do the transformation */
             psrc = (byte*) (stream_r.ptr + 1);
-            (penum->icc_link->procs.map_buffer)(dev, penum->icc_link, &input_buff_desc,
-                                                &output_buff_desc, (void*) psrc,
-                                                (void*) p_cm_buff);
+            gsicc_transform_image_buffer(dev, penum->icc_link, &input_buff_desc,
+                                         &output_buff_desc, (void*) psrc,
+                                         (void*) p_cm_buff);
             /* Re-set the reading stream to use the cm data */
             stream_r.ptr = p_cm_buff - 1;
             stream_r.limit = stream_r.ptr + num_bytes_decode * width_in * spp_cm;
@@ -2200,11 +2200,11 @@ image_render_interpolate_icc(gx_image_enum * penum, const byte * buffer,
                     pinterp += (pss->params.LeftMarginOut / abs_interp_limit) * spp_decode;
                     p_cm_interp = (unsigned short *) p_cm_buff;
                     p_cm_interp += (pss->params.LeftMarginOut / abs_interp_limit) * spp_cm;
-                    (penum->icc_link->procs.map_buffer)(dev, penum->icc_link,
-                                                        &input_buff_desc,
-                                                        &output_buff_desc,
-                                                        (void*) pinterp,
-                                                        (void*) p_cm_interp);
+                    gsicc_transform_image_buffer(dev, penum->icc_link,
+                                                 &input_buff_desc,
+                                                 &output_buff_desc,
+                                                 (void*) pinterp,
+                                                 (void*) p_cm_interp);
                 }
                 code = irii_core(penum, xo, xe, spp_cm, p_cm_interp, dev, abs_interp_limit, bpp, raster, yo, dy, lop);
                 if (code < 0)
@@ -2622,9 +2622,9 @@ image_render_interpolate_landscape_icc(gx_image_enum * penum,
                           1, width_in);
             /* Do the transformation */
             psrc = (byte*) (stream_r.ptr + 1);
-            (penum->icc_link->procs.map_buffer)(dev, penum->icc_link, &input_buff_desc,
-                                                &output_buff_desc, (void*) psrc,
-                                                (void*) p_cm_buff);
+            gsicc_transform_image_buffer(dev, penum->icc_link, &input_buff_desc,
+                                         &output_buff_desc, (void*) psrc,
+                                         (void*) p_cm_buff);
             /* Re-set the reading stream to use the cm data */
             stream_r.ptr = p_cm_buff - 1;
             stream_r.limit = stream_r.ptr + num_bytes_decode * width_in * spp_cm;
@@ -2688,11 +2688,11 @@ image_render_interpolate_landscape_icc(gx_image_enum * penum,
                 } else {
                     /* Transform */
                     p_cm_interp = (unsigned short *) p_cm_buff;
-                    (penum->icc_link->procs.map_buffer)(dev, penum->icc_link,
-                                                        &input_buff_desc,
-                                                        &output_buff_desc,
-                                                        (void*) pinterp,
-                                                        (void*) p_cm_interp);
+                    gsicc_transform_image_buffer(dev, penum->icc_link,
+                                                 &input_buff_desc,
+                                                 &output_buff_desc,
+                                                 (void*) pinterp,
+                                                 (void*) p_cm_interp);
                 }
                 p_cm_interp += (pss->params.LeftMarginOut / abs_interp_limit) * spp_cm;
                 for (x = xo; x < xe;) {
@@ -35,6 +35,10 @@
 #include "gxscanc.h"
 #include "gxfill.h"
 #include "gxdcolor.h"
+#include "gxdevmem.h"
+#include "gsstate.h"
+#include "gxsync.h"
+#include "gslibctx.h"
 #include "assert_.h"
 #include <stdlib.h>             /* for qsort */
 #include <limits.h>             /* For INT_MAX */
@@ -504,6 +508,198 @@ static void mark_curve_top(fixed sx, fixed sy, fixed c1x, fixed c1y, fixed c2x,
         mark_curve(sx, sy, c1x, c1y, c2x, c2y, ex, ey, base_y, height, table, index, depth);
 }
 
+/* Stripe variants of the above, for splitting the marking of a big path
+ * between threads. Each records only the intersections on the scanlines
+ * y0 to y1 (relative to base_y) but otherwise steps through every line
+ * exactly as mark_line does, so the stripes together hold the same data
+ * as a single pass would. */
+static void mark_line_stripe(fixed sx, fixed sy, fixed ex, fixed ey, int base_y, int height, int *table, int *index, int y0, int y1)
+{
+    int64_t delta;
+    int iy, ih, k, kend;
+    fixed clip_sy, clip_ey;
+    int dirn = DIRN_UP;
+    int *row;
+
+    if (fixed2int(sy + fixed_half-1) == fixed2int(ey + fixed_half-1))
+        return;
+    if (sy > ey) {
+        int t;
+        t = sy; sy = ey; ey = t;
+        t = sx; sx = ex; ex = t;
+        dirn = DIRN_DOWN;
+    }
+    clip_sy = ((sy + fixed_half - 1) & ~(fixed_1-1)) | fixed_half;
+    clip_ey = ((ey - fixed_half - 1) & ~(fixed_1-1)) | fixed_half;
+    if (clip_sy < int2fixed(base_y) + fixed_half)
+        clip_sy = int2fixed(base_y) + fixed_half;
+    if (ey <= clip_sy)
+        return;
+    if (clip_ey > int2fixed(base_y + height - 1) + fixed_half)
+        clip_ey = int2fixed(base_y + height - 1) + fixed_half;
+    if (sy > clip_ey)
+        return;
+    delta = (int64_t)clip_sy - (int64_t)sy;
+    if (delta > 0)
+    {
+        int64_t dx = (int64_t)ex - (int64_t)sx;
+        int64_t dy = (int64_t)ey - (int64_t)sy;
+        int advance = (int)((dx * delta + (dy>>1)) / dy);
+        sx += advance;
+        sy += delta;
+    }
+    delta = (int64_t)ey - (int64_t)clip_ey;
+    if (delta > 0)
+    {
+        int64_t dx = (int64_t)ex - (int64_t)sx;
+        int64_t dy = (int64_t)ey - (int64_t)sy;
+        int advance = (int)((dx * delta + (dy>>1)) / dy);
+        ex -= advance;
+        ey -= delta;
+    }
+    ex -= sx;
+    ey -= sy;
+    ih = fixed2int(ey);
+    assert(ih >= 0);
+    iy = fixed2int(sy) - base_y;
+    if (iy >= y1 || iy + ih < y0)
+        return;
+    if (iy >= y0) {
+        row = &table[index[iy]];
+        *row = (*row)+1; /* Increment the count */
+        row[*row] = (sx&~1) | dirn;
+    }
+    if (ih == 0)
+        return;
+    /* Step k lands on scanline iy+k. Find the steps in our stripe. */
+    k    = (iy >= y0 ? 1 : y0 - iy);
+    kend = (iy + ih < y1 ? ih : y1 - 1 - iy);
+    if (ex >= 0) {
+        int x_inc, n_inc, f;
+        int64_t wraps;
+
+        x_inc = ex/ih;
+        n_inc = ex-(x_inc*ih);
+        f     = ih>>1;
+        /* Take the first k-1 steps in one go; f wraps (and sx gains 1)
+         * every time the accumulated n_inc's take it below 0. */
+        wraps = ((int64_t)(k-1) * n_inc - f + ih - 1) / ih;
+        sx += (k-1) * x_inc + (int)wraps;
+        f  += (int)(wraps * ih - (int64_t)(k-1) * n_inc);
+        for (; k <= kend; k++) {
+            int count;
+            sx += x_inc;
+            f  -= n_inc;
+            if (f < 0) {
+                f += ih;
+                sx++;
+            }
+            row = &table[index[iy+k]];
+            count = *row = (*row)+1; /* Increment the count */
+            row[count] = (sx&~1) | dirn;
+        }
+    } else {
+        int x_dec, n_dec, f;
+        int64_t wraps;
+
+        ex = -ex;
+        x_dec = ex/ih;
+        n_dec = ex-(x_dec*ih);
+        f     = ih>>1;
+        wraps = ((int64_t)(k-1) * n_dec - f + ih - 1) / ih;
+        sx -= (k-1) * x_dec + (int)wraps;
+        f  += (int)(wraps * ih - (int64_t)(k-1) * n_dec);
+        for (; k <= kend; k++) {
+            int count;
+            sx -= x_dec;
+            f  -= n_dec;
+            if (f < 0) {
+                f += ih;
+                sx--;
+            }
+            row = &table[index[iy+k]];
+            count = *row = (*row)+1; /* Increment the count */
+            row[count] = (sx&~1) | dirn;
+        }
+    }
+}
+
+/* Subdivision never takes a curve outside the y range of its control
+ * points, so we can skip any part of a curve that misses the stripe. */
+static inline int
+curve_misses_stripe(fixed64 sy, fixed64 c1y, fixed64 c2y, fixed64 ey, int base_y, int y0, int y1)
+{
+    fixed64 top = ((fixed64)(base_y + y0)) << _fixed_shift;
+    fixed64 bot = ((fixed64)(base_y + y1)) << _fixed_shift;
+
+    return ((sy < top && c1y < top && c2y < top && ey < top) ||
+            (sy > bot && c1y > bot && c2y > bot && ey > bot));
+}
+
+static void mark_curve_stripe(fixed sx, fixed sy, fixed c1x, fixed c1y, fixed c2x, fixed c2y, fixed ex, fixed ey, fixed base_y, fixed height, int *table, int *index, int depth, int y0, int y1)
+{
+    fixed ax = (sx + c1x)>>1;
+    fixed ay = (sy + c1y)>>1;
+    fixed bx = (c1x + c2x)>>1;
+    fixed by = (c1y + c2y)>>1;
+    fixed cx = (c2x + ex)>>1;
+    fixed cy = (c2y + ey)>>1;
+    fixed dx = (ax + bx)>>1;
+    fixed dy = (ay + by)>>1;
+    fixed fx = (bx + cx)>>1;
+    fixed fy = (by + cy)>>1;
+    fixed gx = (dx + fx)>>1;
+    fixed gy = (dy + fy)>>1;
+
+    assert(depth >= 0);
+    if (curve_misses_stripe(sy, c1y, c2y, ey, base_y, y0, y1))
+        return;
+    if (depth == 0)
+        mark_line_stripe(sx, sy, ex, ey, base_y, height, table, index, y0, y1);
+    else {
+        depth--;
+        mark_curve_stripe(sx, sy, ax, ay, dx, dy, gx, gy, base_y, height, table, index, depth, y0, y1);
+        mark_curve_stripe(gx, gy, fx, fy, cx, cy, ex, ey, base_y, height, table, index, depth, y0, y1);
+    }
+}
+
+static void mark_curve_big_stripe(fixed64 sx, fixed64 sy, fixed64 c1x, fixed64 c1y, fixed64 c2x, fixed64 c2y, fixed64 ex, fixed64 ey, fixed base_y, fixed height, int *table, int *index, int depth, int y0, int y1)
+{
+    fixed64 ax = (sx + c1x)>>1;
+    fixed64 ay = (sy + c1y)>>1;
+    fixed64 bx = (c1x + c2x)>>1;
+    fixed64 by = (c1y + c2y)>>1;
+    fixed64 cx = (c2x + ex)>>1;
+    fixed64 cy = (c2y + ey)>>1;
+    fixed64 dx = (ax + bx)>>1;
+    fixed64 dy = (ay + by)>>1;
+    fixed64 fx = (bx + cx)>>1;
+    fixed64 fy = (by + cy)>>1;
+    fixed64 gx = (dx + fx)>>1;
+    fixed64 gy = (dy + fy)>>1;
+
+    assert(depth >= 0);
+    if (curve_misses_stripe(sy, c1y, c2y, ey, base_y, y0, y1))
+        return;
+    if (depth == 0)
+        mark_line_stripe((fixed)sx, (fixed)sy, (fixed)ex, (fixed)ey, base_y, height, table, index, y0, y1);
+    else {
+        depth--;
+        mark_curve_big_stripe(sx, sy, ax, ay, dx, dy, gx, gy, base_y, height, table, index, depth, y0, y1);
+        mark_curve_big_stripe(gx, gy, fx, fy, cx, cy, ex, ey, base_y, height, table, index, depth, y0, y1);
+    }
+}
+
+static void mark_curve_top_stripe(fixed sx, fixed sy, fixed c1x, fixed c1y, fixed c2x, fixed c2y, fixed ex, fixed ey, fixed base_y, fixed height, int *table, int *index, int depth, int y0, int y1)
+{
+    fixed test = (sx^(sx<<1))|(sy^(sy<<1))|(c1x^(c1x<<1))|(c1y^(c1y<<1))|(c2x^(c2x<<1))|(c2y^(c2y<<1))|(ex^(ex<<1))|(ey^(ey<<1));
+
+    if (test < 0)
+        mark_curve_big_stripe(sx, sy, c1x, c1y, c2x, c2y, ex, ey, base_y, height, table, index, depth, y0, y1);
+    else
+        mark_curve_stripe(sx, sy, c1x, c1y, c2x, c2y, ex, ey, base_y, height, table, index, depth, y0, y1);
+}
+
 static int make_bbox(gx_path       * path,
                const gs_fixed_rect * clip,
                      gs_fixed_rect * bbox,
@@ -842,6 +1038,456 @@ fill_zero(int *row, const fixed *x)
     row[n  ] = (x[1]|1);
 }
 
+/* Step 3: Sort the intersects on x */
+static void
+sort_rows(int *table, int *index, int y0, int y1)
+{
+    int i;
+
+    for (i=y0; i < y1; i++) {
+        int *row = &table[index[i]];
+        int  rowlen = *row++;
+
+        /* Bubblesort short runs, qsort longer ones. */
+        /* FIXME: Check "6" below */
+        if (rowlen <= 6) {
+            int j, k;
+            for (j = 0; j < rowlen-1; j++) {
+                int t = row[j];
+                for (k = j+1; k < rowlen; k++) {
+                    int s = row[k];
+                    if (t > s)
+                         row[k] = t, t = row[j] = s;
+                }
+            }
+        } else
+            qsort(row, rowlen, sizeof(int), intcmp);
+    }
+}
+
+/* Step 5: Filter the intersections according to the rules */
+static void
+filter_rows(gx_edgebuffer * gs_restrict edgebuffer, int rule, int y0, int y1)
+{
+    int i;
+
+    for (i=y0; i < y1; i++) {
+        int *row      = &edgebuffer->table[edgebuffer->index[i]];
+        int *rowstart = row;
+        int  rowlen   = *row++;
+        int *rowout   = row;
+
+        while (rowlen > 0)
+        {
+            int left, right;
+
+            if (rule == gx_rule_even_odd) {
+                /* Even Odd */
+                left  = (*row++)&~1;
+                right = (*row++)&~1;
+                rowlen -= 2;
+            } else {
+                /* Non-Zero */
+                int w;
+
+                left = *row++;
+                w = ((left&1)-1) | (left&1);
+                rowlen--;
+                do {
+                    right  = *row++;
+                    rowlen--;
+                    w += ((right&1)-1) | (right&1);
+                } while (w != 0);
+                left &= ~1;
+                right &= ~1;
+            }
+
+            if (right > left) {
+                *rowout++ = left;
+                *rowout++ = right;
+            }
+        }
+        *rowstart = (rowout-rowstart)-1;
+    }
+}
+
+/* Step 6: Fill the edgebuffer */
+static int
+fill_rows(gx_device       * gs_restrict pdev,
+    const gx_device_color * gs_restrict pdevc,
+          gx_edgebuffer   * gs_restrict edgebuffer,
+          int                        log_op,
+          int                        y0,
+          int                        y1)
+{
+    int i, code;
+
+    for (i=y0; i < y1; i++) {
+        int *row    = &edgebuffer->table[edgebuffer->index[i]];
+        int  rowlen = *row++;
+
+        while (rowlen > 0) {
+            int left, right;
+
+            left  = *row++;
+            right = *row++;
+            rowlen -= 2;
+            left  = fixed2int(left + fixed_half);
+            right = fixed2int(right + fixed_half);
+            right -= left;
+            if (right > 0) {
+#ifdef DEBUG_OUTPUT_SC_AS_PS
+                dlprintf("0.001 setlinewidth 1 0.5 0 setrgbcolor %% orange %%PS\n");
+                coord("moveto", int2fixed(left), int2fixed(edgebuffer->base+i));
+                coord("lineto", int2fixed(left+right), int2fixed(edgebuffer->base+i));
+                coord("lineto", int2fixed(left+right), int2fixed(edgebuffer->base+i+1));
+                coord("lineto", int2fixed(left), int2fixed(edgebuffer->base+i+1));
+                dlprintf("closepath stroke %%PS\n");
+#endif
+                if (log_op < 0)
+                    code = dev_proc(pdev, fill_rectangle)(pdev, left, edgebuffer->base+i, right, 1, pdevc->colors.pure);
+                else
+                    code = gx_fill_rectangle_device_rop(left, edgebuffer->base+i, right, 1, pdevc, pdev, (gs_logical_operation_t)log_op);
+                if (code < 0)
+                    return code;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Splitting big paths between threads.
+ *
+ * Each stage (marking and sorting, filtering, filling) is independent
+ * from scanline to scanline once the index has been made, so for a
+ * path with at least the configured number of segments (see
+ * gs_setscanconverterthreads) we cut the edgebuffer into horizontal
+ * stripes, one per thread. Each thread runs through the whole path but
+ * only records the intersections in its own stripe, so no locking is
+ * needed and the table ends up exactly as the serial code would leave
+ * it. Filling is only split when the device is a plain (chunky) memory
+ * device; anything else may not cope with being called from more than
+ * one thread at once.
+ *
+ * The threads only ever touch the edgebuffer, the path and (when
+ * filling) the memory device's bitmap; nothing is allocated on them.
+ *
+ * The threads are kept in a pool hung off the gs_lib_ctx, so a fill
+ * doesn't have to start (and finish) its own for every stage. The pool
+ * is made when the threads are asked for (gs_setscanconverterthreads),
+ * only ever grows, and lasts until the gs_lib_ctx is finalised. Just one
+ * fill at a time can use it; any other (from another rendering thread)
+ * runs its stripes one after the other on its own thread.
+ */
+#define SCANC_MAX_THREADS 16
+
+typedef struct
+{
+    gx_device             *pdev;
+    gx_path               *path;
+    const gx_device_color *pdevc;
+    gx_edgebuffer         *edgebuffer;
+    fixed                  fixed_flat;
+    int                    rule;
+    int                    log_op;
+    int                    y0;
+    int                    y1;
+    int                    code;
+} scanc_stripe;
+
+typedef struct scanc_pool_s scanc_pool;
+
+typedef struct
+{
+    scanc_pool                   *pool;
+    gx_semaphore_t               *start;  /* Signalled when there's work */
+    gp_thread_id                  thread;
+    gp_thread_creation_callback_t fn;     /* The work: fn(stripe) */
+    scanc_stripe                 *stripe;
+} scanc_worker;
+
+struct scanc_pool_s
+{
+    gs_memory_t    *memory;
+    gx_monitor_t   *lock;                 /* Protects busy and workers */
+    bool            busy;
+    bool            quit;
+    int             workers;
+    gx_semaphore_t *done;                 /* Signalled as each finishes */
+    scanc_worker    worker[SCANC_MAX_THREADS-1];
+};
+
+/* How many stripes (if any) to split the marking of path into. */
+static int
+scanc_threads(gx_device *pdev, gx_path *path, int scanlines)
+{
+    int threshold;
+    int threads = gs_getscanconverterthreads(pdev->memory, &threshold);
+    const segment *pseg;
+    int n = 0;
+
+    if (threads > SCANC_MAX_THREADS)
+        threads = SCANC_MAX_THREADS;
+    if (threads > scanlines)
+        threads = scanlines;
+    if (threads < 2)
+        return 0;
+    for (pseg = (const segment *)path->first_subpath; pseg != NULL && n < threshold; pseg = pseg->next)
+        n++;
+    return (n >= threshold ? threads : 0);
+}
+
+static void
+scanc_mark_stripe(void *arg)
+{
+    scanc_stripe  *stripe = (scanc_stripe *)arg;
+    gx_edgebuffer *edgebuffer = stripe->edgebuffer;
+    int           *table = edgebuffer->table;
+    int           *index = edgebuffer->index;
+    int            base_y = edgebuffer->base;
+    int            scanlines = edgebuffer->height;
+    int            y0 = stripe->y0;
+    int            y1 = stripe->y1;
+    const subpath *psub;
+
+    for (psub = stripe->path->first_subpath; psub != 0;) {
+        const segment *pseg = (const segment *)psub;
+        fixed ex = pseg->pt.x;
+        fixed ey = pseg->pt.y;
+        fixed ix = ex;
+        fixed iy = ey;
+
+        while ((pseg = pseg->next) != 0 &&
+               pseg->type != s_start
+            ) {
+            fixed sx = ex;
+            fixed sy = ey;
+            ex = pseg->pt.x;
+            ey = pseg->pt.y;
+
+            switch (pseg->type) {
+                default:
+                case s_start: /* Should never happen */
+                case s_dash:  /* We should never be seeing a dash here */
+                    assert("This should never happen" == NULL);
+                    break;
+                case s_curve: {
+                    const curve_segment *const pcur = (const curve_segment *)pseg;
+                    int k = gx_curve_log2_samples(sx, sy, pcur, stripe->fixed_flat);
+
+                    mark_curve_top_stripe(sx, sy, pcur->p1.x, pcur->p1.y, pcur->p2.x, pcur->p2.y, ex, ey, base_y, scanlines, table, index, k, y0, y1);
+                    break;
+                }
+                case s_gap:
+                case s_line:
+                case s_line_close:
+                    if (sy != ey)
+                        mark_line_stripe(sx, sy, ex, ey, base_y, scanlines, table, index, y0, y1);
+                    break;
+            }
+        }
+        /* And close any open segments */
+        if (iy != ey)
+            mark_line_stripe(ex, ey, ix, iy, base_y, scanlines, table, index, y0, y1);
+        psub = (const subpath *)pseg;
+    }
+
+    sort_rows(table, index, y0, y1);
+}
+
+static void
+scanc_filter_stripe(void *arg)
+{
+    scanc_stripe *stripe = (scanc_stripe *)arg;
+
+    filter_rows(stripe->edgebuffer, stripe->rule, stripe->y0, stripe->y1);
+}
+
+static void
+scanc_fill_stripe(void *arg)
+{
+    scanc_stripe *stripe = (scanc_stripe *)arg;
+
+    stripe->code = fill_rows(stripe->pdev, stripe->pdevc, stripe->edgebuffer,
+                             stripe->log_op, stripe->y0, stripe->y1);
+}
+
+/* Only the memory devices' own fill_rectangle is known to be safe to
+ * call from several threads at once (on different scanlines). */
+static bool
+scanc_can_fill_in_stripes(gx_device *pdev)
+{
+    const gx_device_memory *mdproto;
+
+    if (pdev->is_planar)
+        return false;
+    mdproto = gdev_mem_device_for_bits(pdev->color_info.depth);
+    return (mdproto != NULL &&
+            dev_proc(pdev, fill_rectangle) == dev_proc(mdproto, fill_rectangle));
+}
+
+static void
+scanc_worker_main(void *arg)
+{
+    scanc_worker *worker = (scanc_worker *)arg;
+    scanc_pool   *pool = worker->pool;
+
+    for (;;) {
+        gx_semaphore_wait(worker->start);
+        if (pool->quit)
+            break;
+        worker->fn(worker->stripe);
+        gx_semaphore_signal(pool->done);
+    }
+}
+
+static void
+scanc_pool_free(gs_memory_t *mem, void *pool_)
+{
+    scanc_pool *pool = (scanc_pool *)pool_;
+    int         i;
+
+    if (pool == NULL)
+        return;
+    pool->quit = true;
+    for (i = 0; i < pool->workers; i++) {
+        gx_semaphore_signal(pool->worker[i].start);
+        gp_thread_finish(pool->worker[i].thread);
+    }
+    for (i = 0; i < SCANC_MAX_THREADS-1; i++)
+        if (pool->worker[i].start != NULL)
+            gx_semaphore_free(pool->worker[i].start);
+    if (pool->done != NULL)
+        gx_semaphore_free(pool->done);
+    if (pool->lock != NULL)
+        gx_monitor_free(pool->lock);
+    gs_free_object(pool->memory, pool, "scanc_pool_free");
+}
+
+/* Make sure there are workers enough for threads stripes (all but one of
+ * which go to the workers). Should that not be possible, we just make do
+ * with fewer. */
+void
+gx_scanc_pool_reserve(gs_memory_t *mem, int threads)
+{
+    gs_lib_ctx_t *ctx = mem->gs_lib_ctx;
+    scanc_pool   *pool = (scanc_pool *)ctx->scanconverter_pool;
+
+    if (threads > SCANC_MAX_THREADS)
+        threads = SCANC_MAX_THREADS;
+    if (threads < 2)
+        return;
+
+    if (pool == NULL) {
+        pool = (scanc_pool *)gs_alloc_bytes(ctx->memory, sizeof(*pool),
+                                            "gx_scanc_pool_reserve");
+        if (pool == NULL)
+            return;
+        memset(pool, 0, sizeof(*pool));
+        pool->memory = ctx->memory;
+        pool->lock = gx_monitor_label(gx_monitor_alloc(pool->memory),
+                                      "scanc pool lock");
+        pool->done = gx_semaphore_label(gx_semaphore_alloc(pool->memory),
+                                        "scanc pool done");
+        if (pool->lock == NULL || pool->done == NULL) {
+            scanc_pool_free(mem, pool);
+            return;
+        }
+        ctx->scanconverter_pool = pool;
+        ctx->scanconverter_pool_free = scanc_pool_free;
+    }
+
+    gx_monitor_enter(pool->lock);
+    if (!pool->busy) {
+        while (pool->workers < threads-1) {
+            scanc_worker *worker = &pool->worker[pool->workers];
+
+            if (worker->start == NULL)
+                worker->start = gx_semaphore_label(gx_semaphore_alloc(pool->memory),
+                                                   "scanc worker start");
+            if (worker->start == NULL)
+                break;
+            worker->pool = pool;
+            if (gp_thread_start(scanc_worker_main, worker, &worker->thread) < 0)
+                break;
+            pool->workers++;
+        }
+    }
+    gx_monitor_leave(pool->lock);
+}
+
+/* Run fn over each stripe of the edgebuffer, the first on this thread
+ * and as many of the others as we can on the pool's workers. Any left
+ * over are done here too. The stripes are cut so that each has about the
+ * same number of intersections. */
+static int
+scanc_run_stripes(gx_device               *pdev,
+                  gx_path                 *path,
+            const gx_device_color         *pdevc,
+                  gx_edgebuffer           *edgebuffer,
+                  fixed                    fixed_flat,
+                  int                      rule,
+                  int                      log_op,
+                  gp_thread_creation_callback_t fn)
+{
+    scanc_stripe stripe[SCANC_MAX_THREADS];
+    scanc_pool  *pool = (scanc_pool *)pdev->memory->gs_lib_ctx->scanconverter_pool;
+    int          n = edgebuffer->threads;
+    /* Where the last row's data starts: near enough the total size of the
+     * table to share it out by. */
+    int          last_row = edgebuffer->index[edgebuffer->height-1];
+    int          i, y, used = 0, code = 0;
+
+    y = 0;
+    for (i = 0; i < n; i++) {
+        int64_t target = (int64_t)last_row * (i+1) / n;
+
+        stripe[i].pdev       = pdev;
+        stripe[i].path       = path;
+        stripe[i].pdevc      = pdevc;
+        stripe[i].edgebuffer = edgebuffer;
+        stripe[i].fixed_flat = fixed_flat;
+        stripe[i].rule       = rule;
+        stripe[i].log_op     = log_op;
+        stripe[i].code       = 0;
+        stripe[i].y0         = y;
+        if (i == n-1)
+            y = edgebuffer->height;
+        else
+            while (y < edgebuffer->height && edgebuffer->index[y] < target)
+                y++;
+        stripe[i].y1         = y;
+    }
+
+    if (pool != NULL) {
+        gx_monitor_enter(pool->lock);
+        if (!pool->busy && pool->workers > 0) {
+            pool->busy = true;
+            used = min(pool->workers, n-1);
+        }
+        gx_monitor_leave(pool->lock);
+    }
+    for (i = 0; i < used; i++) {
+        pool->worker[i].fn = fn;
+        pool->worker[i].stripe = &stripe[i+1];
+        gx_semaphore_signal(pool->worker[i].start);
+    }
+    fn(&stripe[0]);
+    for (i = used+1; i < n; i++)
+        fn(&stripe[i]);
+    if (used > 0) {
+        for (i = 0; i < used; i++)
+            gx_semaphore_wait(pool->done);
+        gx_monitor_enter(pool->lock);
+        pool->busy = false;
+        gx_monitor_leave(pool->lock);
+    }
+
+    for (i = 0; i < n && code >= 0; i++)
+        code = stripe[i].code;
+    return code;
+}
+
 int gx_scan_convert(gx_device     * gs_restrict pdev,
                     gx_path       * gs_restrict path,
               const gs_fixed_rect * gs_restrict clip,
@@ -854,12 +1500,12 @@ int gx_scan_convert(gx_device     * gs_restrict pdev,
     const subpath *psub;
     int           *index;
     int           *table;
-    int            i;
     int            code;
     int            zero;
 
     edgebuffer->index = NULL;
     edgebuffer->table = NULL;
+    edgebuffer->threads = 0;
 
     /* Bale out if no actual path. We see this with the clist */
     if (path->first_subpath == NULL)
@@ -876,8 +1522,19 @@ int gx_scan_convert(gx_device     * gs_restrict pdev,
     if (code < 0)
         return code;
 
+    if (!zero)
+        edgebuffer->threads = scanc_threads(pdev, path, scanlines);
+
     if (zero) {
         code = zero_case(pdev, path, &ibox, index, table, fixed_flat, fill_zero);
+    } else if (edgebuffer->threads > 1) {
+        /* Steps 2 and 3 together, a stripe per thread. */
+        edgebuffer->base   = ibox.p.y;
+        edgebuffer->height = scanlines;
+        edgebuffer->index  = index;
+        edgebuffer->table  = table;
+        return scanc_run_stripes(pdev, path, NULL, edgebuffer, fixed_flat,
+                                 0, 0, scanc_mark_stripe);
     } else {
 
     /* Step 2 continued: Now we run through the path, filling in the real
@@ -943,37 +1600,16 @@ int gx_scan_convert(gx_device     * gs_restrict pdev,
 #endif
 
     /* Step 3: Sort the intersects on x */
-    for (i=0; i < scanlines; i++) {
-        int *row = &table[index[i]];
-        int  rowlen = *row++;
-
-        /* Bubblesort short runs, qsort longer ones. */
-        /* FIXME: Check "6" below */
-        if (rowlen <= 6) {
-            int j, k;
-            for (j = 0; j < rowlen-1; j++) {
-                int t = row[j];
-                for (k = j+1; k < rowlen; k++) {
-                    int s = row[k];
-                    if (t > s)
-                         row[k] = t, t = row[j] = s;
-                }
-            }
-        } else
-            qsort(row, rowlen, sizeof(int), intcmp);
-    }
+    sort_rows(table, index, 0, scanlines);
 
     return 0;
 }
 
-/* Step 5: Filter the intersections according to the rules */
 int
 gx_filter_edgebuffer(gx_device       * gs_restrict pdev,
                      gx_edgebuffer   * gs_restrict edgebuffer,
                      int                        rule)
 {
-    int i;
-
 #ifdef DEBUG_SCAN_CONVERTER
     if (debugging_scan_converter) {
         dlprintf("Before filtering:\n");
@@ -981,88 +1617,25 @@ gx_filter_edgebuffer(gx_device       * gs_restrict pdev,
     }
 #endif
 
-    for (i=0; i < edgebuffer->height; i++) {
-        int *row      = &edgebuffer->table[edgebuffer->index[i]];
-        int *rowstart = row;
-        int  rowlen   = *row++;
-        int *rowout   = row;
-
-        while (rowlen > 0)
-        {
-            int left, right;
-
-            if (rule == gx_rule_even_odd) {
-                /* Even Odd */
-                left  = (*row++)&~1;
-                right = (*row++)&~1;
-                rowlen -= 2;
-            } else {
-                /* Non-Zero */
-                int w;
-
-                left = *row++;
-                w = ((left&1)-1) | (left&1);
-                rowlen--;
-                do {
-                    right  = *row++;
-                    rowlen--;
-                    w += ((right&1)-1) | (right&1);
-                } while (w != 0);
-                left &= ~1;
-                right &= ~1;
-            }
+    if (edgebuffer->threads > 1)
+        return scanc_run_stripes(pdev, NULL, NULL, edgebuffer, 0, rule, 0,
+                                 scanc_filter_stripe);
 
-            if (right > left) {
-                *rowout++ = left;
-                *rowout++ = right;
-            }
-        }
-        *rowstart = (rowout-rowstart)-1;
-    }
+    filter_rows(edgebuffer, rule, 0, edgebuffer->height);
     return 0;
 }
 
-/* Step 6: Fill the edgebuffer */
 int
 gx_fill_edgebuffer(gx_device       * gs_restrict pdev,
              const gx_device_color * gs_restrict pdevc,
                    gx_edgebuffer   * gs_restrict edgebuffer,
                    int                        log_op)
 {
-    int i, code;
-
-    for (i=0; i < edgebuffer->height; i++) {
-        int *row    = &edgebuffer->table[edgebuffer->index[i]];
-        int  rowlen = *row++;
+    if (edgebuffer->threads > 1 && log_op < 0 && scanc_can_fill_in_stripes(pdev))
+        return scanc_run_stripes(pdev, NULL, pdevc, edgebuffer, 0, 0, log_op,
+                                 scanc_fill_stripe);
 
-        while (rowlen > 0) {
-            int left, right;
-
-            left  = *row++;
-            right = *row++;
-            rowlen -= 2;
-            left  = fixed2int(left + fixed_half);
-            right = fixed2int(right + fixed_half);
-            right -= left;
-            if (right > 0) {
-#ifdef DEBUG_OUTPUT_SC_AS_PS
-                dlprintf("0.001 setlinewidth 1 0.5 0 setrgbcolor %% orange %%PS\n");
-                coord("moveto", int2fixed(left), int2fixed(edgebuffer->base+i));
-                coord("lineto", int2fixed(left+right), int2fixed(edgebuffer->base+i));
-                coord("lineto", int2fixed(left+right), int2fixed(edgebuffer->base+i+1));
-                coord("lineto", int2fixed(left), int2fixed(edgebuffer->base+i+1));
-                dlprintf("closepath stroke %%PS\n");
-#endif
-                if (log_op < 0)
-                    code = dev_proc(pdev, fill_rectangle)(pdev, left, edgebuffer->base+i, right, 1, pdevc->colors.pure);
-                else
-                    code = gx_fill_rectangle_device_rop(left, edgebuffer->base+i, right, 1, pdevc, pdev, (gs_logical_operation_t)log_op);
-                if (code < 0)
-                    return code;
-            }
-        }
-    }
-    return 0;
+    return fill_rows(pdev, pdevc, edgebuffer, log_op, 0, edgebuffer->height);
 }
 
 /* Any part of a pixel routines */
@@ -4513,6 +5086,7 @@ gx_edgebuffer_init(gx_edgebuffer * edgebuffer)
     edgebuffer->height = 0;
     edgebuffer->index  = NULL;
     edgebuffer->table  = NULL;
+    edgebuffer->threads = 0;
 }
 
 void
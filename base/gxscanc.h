@@ -39,6 +39,9 @@ struct gx_edgebuffer_s {
     int  xmax;
     int *index;
     int *table;
+    int  threads; /* If > 1, the number of horizontal stripes the
+                   * centre of pixel scanline routines split this
+                   * edgebuffer into, to work on them in parallel. */
 };
 
 /* "Pixel centre" scanline routines */
@@ -118,6 +121,10 @@ gx_fill_edgebuffer_tr_app(gx_device       * gs_restrict pdev,
                           int                        log_op);
 
 /* Equivalent to filling it full of 0's */
+/* Start the threads that gx_scan_convert and friends split big paths
+ * between (see gs_setscanconverterthreads). */
+void gx_scanc_pool_reserve(gs_memory_t *mem, int threads);
+
 void gx_edgebuffer_init(gx_edgebuffer * edgebuffer);
 
 void gx_edgebuffer_fin(gx_device     * pdev,
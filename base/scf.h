@@ -102,11 +102,16 @@ typedef hcd_code cfd_node;
 #define run2_pass (-4)
 #define run2_horizontal (-5)
 
-#define cfd_white_initial_bits 8
+/*
+ * The white and black tables look up 12 bits at once, which decodes
+ * every white code, and every black code except the 13-bit make-up
+ * codes, with a single probe.  (scfdtab.c is generated by scfdgen.c.)
+ */
+#define cfd_white_initial_bits 12
 #define cfd_white_min_bits 4	/* shortest white run */
 extern const cfd_node cf_white_decode[];
 
-#define cfd_black_initial_bits 7
+#define cfd_black_initial_bits 12
 #define cfd_black_min_bits 2	/* shortest black run */
 extern const cfd_node cf_black_decode[];
 
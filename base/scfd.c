@@ -33,10 +33,10 @@ get_run(stream_CFD_state *ss, stream_cursor_read *pr, const cfd_node decode[],
     int initial_bits, int min_bits, int *runlen, const char *str);
 
 static inline int
-invert_data(stream_CFD_state *ss, stream_cursor_read *pr, int *rlen, byte black_byte);
+invert_data(stream_CFD_state *ss, byte **pq, int *pqbit, int *rlen, byte black_byte);
 
 static inline int
-skip_data(stream_CFD_state *ss, stream_cursor_read *pr, int rlen);
+skip_data(byte **pq, int *pqbit, int rlen);
 
 /* Set default parameter values. */
 static void
@@ -57,10 +57,11 @@ s_CFD_init(stream_state * st)
     byte white = (ss->BlackIs1 ? 0 : 0xff);
 
     s_hcd_init_inline(ss);
-    /* Because skip_white_pixels can look as many as 4 bytes ahead, */
-    /* we need to allow 4 extra bytes at the end of the row buffers. */
+    /* invert_data can run as many as 4 bytes over the end of the row */
+    /* on bad data, so we allow 4 extra bytes in the row buffers. */
     ss->lbuf = gs_alloc_bytes(st->memory, raster + CFD_BUFFER_SLOP, "CFD lbuf");
     ss->lprev = 0;
+    ss->ref_changes = ss->cur_changes = 0;
     if (ss->lbuf == 0)
         return ERRC;		/****** WRONG ******/
     memset(ss->lbuf, white, raster);
@@ -71,9 +72,18 @@ s_CFD_init(stream_state * st)
             return ERRC;	/****** WRONG ******/
         /* Clear the initial reference line for 2-D encoding. */
         memset(ss->lprev, white, raster);
-        /* Ensure that the scan of the reference line will stop. */
-        memset(ss->lprev + raster, 0xaa, CFD_BUFFER_SLOP);
+        memset(ss->lprev + raster, 0xaa, CFD_BUFFER_SLOP);  /* for Valgrind */
+        /* A row has at most one changing element per pixel. */
+        ss->ref_changes = (int *)gs_alloc_byte_array(st->memory, raster * 8 + 3,
+                                                     sizeof(int), "CFD ref_changes");
+        ss->cur_changes = (int *)gs_alloc_byte_array(st->memory, raster * 8 + 3,
+                                                     sizeof(int), "CFD cur_changes");
+        if (ss->ref_changes == 0 || ss->cur_changes == 0)
+            return ERRC;	/****** WRONG ******/
     }
+    ss->ref_row = -1;
+    ss->ref_index = 0;
+    ss->cur_count = 0;
     ss->k_left = min(ss->K, 0);
     ss->run_color = 0;
     ss->damaged_rows = 0;
@@ -95,6 +105,8 @@ s_CFD_release(stream_state * st)
 {
     stream_CFD_state *const ss = (stream_CFD_state *) st;
 
+    gs_free_object(st->memory, ss->cur_changes, "CFD cur_changes(close)");
+    gs_free_object(st->memory, ss->ref_changes, "CFD ref_changes(close)");
     gs_free_object(st->memory, ss->lprev, "CFD lprev(close)");
     gs_free_object(st->memory, ss->lbuf, "CFD lbuf(close)");
 }
@@ -102,7 +114,7 @@ s_CFD_release(stream_state * st)
 /* Declare the variables that hold the state. */
 #define cfd_declare_state\
         hcd_declare_state;\
-        register byte *q;\
+        byte *q;\
         int qbit
 /* Load the state from the stream. */
 #define cfd_load_state()\
@@ -138,14 +150,18 @@ static inline int get_run(stream_CFD_state *ss, stream_cursor_read *pr, const cf
     int clen;
     cfd_load_state();
 
-    HCD_ENSURE_BITS_ELSE(initial_bits) {
-        /* We might still have enough bits for the specific code. */
-        if (bits_left < min_bits)
-            goto outl;
-        np = &decode[hcd_peek_bits_left() << (initial_bits - bits_left)];
-        if ((clen = np->code_length) > bits_left)
-            goto outl;
-        goto locl;
+    /*
+     * The state was just loaded, so bits_left <= 7.  The white and black
+     * tables take more than 8 bits at a time, so near the end of the
+     * input we may have to top up a byte at a time.
+     */
+    if (bits_left < initial_bits) {
+        HCD_MORE_BITS_ELSE goto part;
+        if (bits_left < initial_bits) {
+            HCD_MORE_BITS_1_ELSE goto part;
+            if (bits_left < initial_bits)
+                goto part;
+        }
     }
     np = &decode[peek_bits(initial_bits)];
     if ((clen = np->code_length) > initial_bits) {
@@ -164,36 +180,46 @@ static inline int get_run(stream_CFD_state *ss, stream_cursor_read *pr, const cf
     } else {
 locl:
        if_debug4('W', "%s code=0x%x,%d rlen=%d\n", str,
-                      peek_var_bits(clen), clen, np->run_length);
+                      peek_bits(clen), clen, np->run_length);
        skip_bits(clen);
     }
     *runlen = np->run_length;
 
     cfd_store_state();
     return(0);
+part:
+    /* We might still have enough bits for the specific code. */
+    if (bits_left < min_bits)
+        goto outl;
+    np = &decode[(bits & ((1 << bits_left) - 1)) << (initial_bits - bits_left)];
+    if ((clen = np->code_length) > bits_left)
+        goto outl;
+    goto locl;
 outl:
     cfd_store_state();
     return(-1);
 }
 
 
-/* Skip data bits for a white run. */
+/*
+ * Skip data bits for a white run.  This and invert_data only move the
+ * caller's q and qbit, so the caller needn't store and reload the state.
+ */
 /* rlen is either less than 64, or a multiple of 64. */
-static inline int skip_data(stream_CFD_state *ss, stream_cursor_read *pr, int rlen)
+static inline int skip_data(byte **pq, int *pqbit, int rlen)
 {
-    cfd_declare_state;
-    cfd_load_state();
-    (void)rlimit;
+    byte *q = *pq;
+    int qbit = *pqbit;
 
     if ( (qbit -= rlen) < 0 )
     {
         q -= qbit >> 3, qbit &= 7;
         if ( rlen >= 64 ) {
-            cfd_store_state();
+            *pq = q, *pqbit = qbit;
             return(-1);
         }
     }
-    cfd_store_state();
+    *pq = q, *pqbit = qbit;
     return(0);
 }
 
@@ -202,11 +228,10 @@ static inline int skip_data(stream_CFD_state *ss, stream_cursor_read *pr, int rl
 /* If rlen >= 64, execute makeup_action: this is to handle */
 /* makeup codes efficiently, since these are always a multiple of 64. */
 
-static inline int invert_data(stream_CFD_state *ss, stream_cursor_read *pr, int *rlen, byte black_byte)
+static inline int invert_data(stream_CFD_state *ss, byte **pq, int *pqbit, int *rlen, byte black_byte)
 {
-    cfd_declare_state;
-    cfd_load_state();
-    (void)rlimit;
+    byte *q = *pq;
+    int qbit = *pqbit;
 
     if (q >= ss->lbuf + ss->raster + CFD_BUFFER_SLOP) {
         return(-1);
@@ -261,7 +286,7 @@ d:            memset(q, black_byte, (*rlen) >> 3);
                 qbit = 8 - (*rlen);
                 *q ^= 0xff << qbit;
               }
-              cfd_store_state();
+              *pq = q, *pqbit = qbit;
               return(-1);
           }
     }
@@ -270,7 +295,7 @@ d:            memset(q, black_byte, (*rlen) >> 3);
             *q ^= ((1 << (*rlen)) - 1) << qbit;
 
     }
-    cfd_store_state();
+    *pq = q, *pqbit = qbit;
     return(0);
 }
 
@@ -370,6 +395,20 @@ s_CFD_process(stream_state * st, stream_cursor_read * pr,
 
             ss->lprev = ss->lbuf;
             ss->lbuf = prev_bits;
+            if (ss->cur_count >= 0) {
+                /* 2-D decoding noted the new reference line's */
+                /* changing elements, so we needn't scan for them. */
+                int *prev_changes = ss->ref_changes;
+                int *rc = ss->ref_changes = ss->cur_changes;
+                int end = (wstop + 1) * 8 - (-ss->Columns & 7);
+
+                ss->cur_changes = prev_changes;
+                rc[ss->cur_count] = rc[ss->cur_count + 1] =
+                    rc[ss->cur_count + 2] = end;
+                ss->ref_row = ss->row;
+                ss->ref_index = 0;
+            }
+            ss->cur_count = 0;
             if (ss->K > 0)
                 k_left = (k_left == 0 ? ss->K : k_left) - 1;
         }
@@ -460,6 +499,7 @@ ck_eol:
                 ss->wpos = wstop;
                 ss->cbit = -ss->Columns & 7;
                 ss->run_color = 0;
+                ss->cur_count = -1;
             }
             ss->skipping_damage = true;
             goto top;
@@ -534,6 +574,7 @@ cf_decode_1d(stream_CFD_state * ss, stream_cursor_read * pr)
 
     cfd_load_state();
     if_debug1m('w', ss->memory, "[w1]entry run_color = %d\n", ss->run_color);
+    ss->cur_count = -1;		/* the next 2-D row must scan this one */
     if (ss->run_color > 0)
         goto db;
     else
@@ -572,9 +613,7 @@ cf_decode_1d(stream_CFD_state * ss, stream_cursor_read * pr)
         }
     }
 
-    cfd_store_state();
-    status = skip_data(ss, pr, bcnt);
-    cfd_load_state();
+    status = skip_data(&q, &qbit, bcnt);
     if (status < 0) {
         goto dwx;
     }
@@ -601,9 +640,7 @@ cf_decode_1d(stream_CFD_state * ss, stream_cursor_read * pr)
     }
 
     /* Invert bits designated by black run. */
-    cfd_store_state();
-    status = invert_data(ss, pr, &bcnt, black_byte);
-    cfd_load_state();
+    status = invert_data(ss, &q, &qbit, &bcnt, black_byte);
     if (status < 0) {
         goto dbx;
     }
@@ -633,6 +670,41 @@ cf_decode_1d(stream_CFD_state * ss, stream_cursor_read * pr)
     goto out;
 }
 
+/*
+ * Index the changing elements of the reference line below end, followed
+ * by 3 copies of end, so that b1 and b2 can be looked up rather than
+ * scanned for.  Even entries change to black, odd ones to white.
+ */
+static void
+cf_index_reference_line(stream_CFD_state * ss, int end)
+{
+    const byte *p0 = ss->lprev;
+    const byte *pend = p0 + ((end + 7) >> 3);
+    int *rc = ss->ref_changes;
+    byte flip = (ss->BlackIs1 ? 0 : 0xff);	/* current color -> 0s */
+    int x = 0;
+
+    while (x < end) {
+        const byte *p = p0 + (x >> 3);
+        uint data = (*p ^ flip) & byte_right_mask[8 - (x & 7)];
+
+        if (data == 0) {
+            /* Skip bytes of the current color. */
+            while (++p < pend && *p == flip)
+                DO_NOTHING;
+            if (p >= pend)
+                break;
+            data = *p ^ flip;
+        }
+        x = ((p - p0) << 3) + (byte_bit_run_length_0[data ^ 0xff] & 7);
+        if (x >= end)
+            break;
+        *rc++ = x;
+        flip = ~flip;
+    }
+    rc[0] = rc[1] = rc[2] = end;
+}
+
 /* Decode a 2-D scan line. */
 static int
 cf_decode_2d(stream_CFD_state * ss, stream_cursor_read * pr)
@@ -644,18 +716,44 @@ cf_decode_2d(stream_CFD_state * ss, stream_cursor_read * pr)
     int end_count = -ss->Columns & 7;
     uint raster = ss->raster;
     byte *q0 = ss->lbuf;
-    byte *prev_q01 = ss->lprev + 1;
     byte *endptr = q0 - 1 + raster;
     int init_count = raster << 3;
     register int count;
+    int ref_index;
+    int *cc = ss->cur_changes;
+    int nc = ss->cur_count;
+    int end = init_count - end_count;
     int rlen;
     int status;
 
     cfd_load_state();
     count = ((endptr - q) << 3) + qbit;
-    endptr[1] = 0xa0;		/* a byte with some 0s and some 1s, */
-    /* to ensure run scan will stop */
+    if (ss->ref_row != ss->row) {
+        cf_index_reference_line(ss, end);
+        ss->ref_row = ss->row;
+        ss->ref_index = 0;
+    }
+    ref_index = ss->ref_index;
     if_debug1m('W', ss->memory, "[w2]raster=%d\n", raster);
+    /*
+     * Note the changing elements of this row as we decode it, so that
+     * it can be the next reference line without being scanned.  If a0
+     * ever moves back (which only bad data can do), give up and let the
+     * next row scan it.
+     */
+#define note_change(x)\
+  BEGIN\
+    int x_ = (x);\
+\
+    if (nc >= 0 && x_ < end) {\
+        if (nc == 0 ? x_ >= 0 : cc[nc - 1] < x_)\
+            cc[nc++] = x_;\
+        else if (cc[nc - 1] == x_)\
+            nc--;		/* a 0-length run */\
+        else\
+            nc = -1;\
+    }\
+  END
     switch (ss->run_color) {
         case -2:
             ss->run_color = 0;
@@ -752,56 +850,39 @@ rlen_lt_zero:
                         goto out;
                 }
     }
-    /* Interpreting the run requires scanning the */
+    /* Interpreting the run requires the changing elements of the */
     /* previous ('reference') line. */
     {
-        int prev_count = count;
-        byte prev_data;
+        const int *rc = ss->ref_changes;
+        /* At the start of the row, a0 is an imaginary white pixel */
+        /* just before the first one. */
+        int a0 = (count == init_count && invert == invert_white ? -1 :
+                  init_count - count);
+        int i = ref_index;
+        int prev_count;
         int dlen;
-        static const byte count_bit[8] =
-        {0x80, 1, 2, 4, 8, 0x10, 0x20, 0x40};
-        byte *prev_q = prev_q01 + (q - q0);
-        int plen;
-
-        if (!(count & 7))
-            prev_q++;		/* because of skip macros */
-        prev_data = prev_q[-1] ^ invert;
-        /* Find the b1 transition. */
-        if ((prev_data & count_bit[prev_count & 7]) &&
-            (prev_count < init_count || invert != invert_white)
-            ) {			/* Look for changing white first. */
-            if_debug1m('W', ss->memory, " data=0x%x", prev_data);
-            skip_black_pixels(prev_data, prev_q,
-                              prev_count, invert, plen);
-            if (prev_count < end_count)		/* overshot */
-                prev_count = end_count;
-            if_debug1m('W', ss->memory, " b1 other=%d", prev_count);
-        }
-        if (prev_count != end_count) {
-            if_debug1m('W', ss->memory, " data=0x%x", prev_data);
-            skip_white_pixels(prev_data, prev_q,
-                              prev_count, invert, plen);
-            if (prev_count < end_count)		/* overshot */
-                prev_count = end_count;
-            if_debug1m('W', ss->memory, " b1 same=%d", prev_count);
-        }
-        /* b1 = prev_count; */
-        if (rlen == run2_pass) {	/* Pass mode.  Find b2. */
-            if (prev_count != end_count) {
-                if_debug1m('W', ss->memory, " data=0x%x", prev_data);
-                skip_black_pixels(prev_data, prev_q,
-                                  prev_count, invert, plen);
-                if (prev_count < end_count)	/* overshot */
-                    prev_count = end_count;
-            }
-            /* b2 = prev_count; */
-            if_debug2m('W', ss->memory, " b2=%d, pass %d\n",
-                      prev_count, count - prev_count);
+
+        /* Find b1, the first change after a0 to the other color. */
+        /* a1 can be left of b1, so a0 can move back. */
+        while (i > 0 && rc[i - 1] > a0)
+            i--;
+        while (rc[i] <= a0)
+            i++;
+        if ((i & 1) != (invert != invert_white))
+            i++;
+        ref_index = i;
+        if (rlen == run2_pass) {	/* Pass mode.  a0 moves to b2. */
+            prev_count = init_count - rc[i + 1];
+            if_debug3m('W', ss->memory, " b1=%d b2=%d, pass %d\n",
+                       rc[i], rc[i + 1], count - prev_count);
         } else {		/* Vertical coding. */
             /* Remember that count counts *down*. */
-            prev_count += rlen - vertical_0;	/* a1 */
-            if_debug2m('W', ss->memory, " vertical %d -> %d\n",
-                       (int)(rlen - vertical_0), prev_count);
+            prev_count = init_count - rc[i] + rlen - vertical_0;	/* a1 */
+            if_debug3m('W', ss->memory, " b1=%d, vertical %d -> %d\n",
+                       rc[i], (int)(rlen - vertical_0), prev_count);
+            if (prev_count > count)
+                nc = -1;
+            note_change(init_count - prev_count);
         }
         /* Now either invert or skip from count */
         /* to prev_count, and reset count. */
@@ -811,9 +892,7 @@ rlen_lt_zero:
         } else {		/* Invert data bits. */
             dlen = count - prev_count;
 
-            cfd_store_state();
-            (void)invert_data(ss, pr, &dlen, black_byte);
-            cfd_load_state();
+            (void)invert_data(ss, &q, &qbit, &dlen, black_byte);
         }
         count = prev_count;
         if (rlen >= 0)		/* vertical mode */
@@ -830,6 +909,8 @@ rlen_lt_zero:
     /* falls through */
   out:cfd_store_state();
     ss->invert = invert;
+    ss->ref_index = ref_index;
+    ss->cur_count = (status == ERRC ? -1 : nc);
     /* Ignore an error (missing EOFB/RTC when EndOfBlock == true) */
     /* if we have finished all rows. */
     if (status == ERRC && ss->Rows > 0 && ss->row > ss->Rows)
@@ -856,12 +937,11 @@ rlen_lt_zero:
     }
     if (rlen < 0) goto rlen_lt_zero;
 
-    cfd_store_state();
-    status = skip_data(ss, pr, rlen);
-    cfd_load_state();
+    status = skip_data(&q, &qbit, rlen);
     if (status < 0) {
         goto hww;
     }
+    note_change(init_count - count);
 
     /* Handle the second half of a white-black horizontal code. */
   hwb:
@@ -880,12 +960,11 @@ rlen_lt_zero:
     }
     if (rlen < 0) goto rlen_lt_zero;
 
-    cfd_store_state();
-    status = invert_data(ss, pr, &rlen, black_byte);
-    cfd_load_state();
+    status = invert_data(ss, &q, &qbit, &rlen, black_byte);
     if (status < 0) {
         goto hwb;
     }
+    note_change(init_count - count);
 
     goto top;
   outww:ss->run_color = -2;
@@ -909,12 +988,11 @@ rlen_lt_zero:
     }
     if (rlen < 0) goto rlen_lt_zero;
 
-    cfd_store_state();
-    status = invert_data(ss, pr, &rlen, black_byte);
-    cfd_load_state();
+    status = invert_data(ss, &q, &qbit, &rlen, black_byte);
     if (status < 0) {
         goto hbb;
     }
+    note_change(init_count - count);
 
     /* Handle the second half of a black-white horizontal code. */
   hbw:
@@ -933,18 +1011,18 @@ rlen_lt_zero:
     }
     if (rlen < 0) goto rlen_lt_zero;
 
-    cfd_store_state();
-    status = skip_data(ss, pr, rlen);
-    cfd_load_state();
+    status = skip_data(&q, &qbit, rlen);
     if (status < 0) {
         goto hbw;
     }
+    note_change(init_count - count);
 
     goto top;
   outbb:ss->run_color = 2;
     goto out0;
   outbw:ss->run_color = -1;
     goto out0;
+#undef note_change
 }
 
 #if 1				/*************** */
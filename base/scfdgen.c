@@ -190,7 +190,10 @@ cfd_build_tree(cfd_node * tree, cfd_enum_proc enum_proc, int initial_bits,
     int i, next;
     cfd_node *extn;
 
-    memset(tree, 0, sizeof(cfd_node) << initial_bits);
+    /* Bit patterns that start no code are errors. */
+    for (i = 0, np = tree; i < 1 << initial_bits; i++, np++)
+        np->run_length = run_error,
+            np->code_length = 0;
     /* Construct and write the first level of the tree. */
     (*enum_proc) (cfd_count_nodes, tree, (cfd_node *) 0, initial_bits);
     next = 0;
@@ -21,39 +21,519 @@
 /* Consult those files for the licensing terms and conditions. */
 
 #include "std.h"
-#include "scommon.h"		/* for scf.h */
+#include "scommon.h"            /* for scf.h */
 #include "scf.h"
 
 /* White decoding table. */
 const cfd_node cf_white_decode[] = {
-        { 256, 12 },
-        { 272, 12 },
+        { -2, 11 },
+        { -2, 11 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -3, 12 },
+        { 1792, 11 },
+        { 1792, 11 },
+        { 1984, 12 },
+        { 2048, 12 },
+        { 2112, 12 },
+        { 2176, 12 },
+        { 2240, 12 },
+        { 2304, 12 },
+        { 1856, 11 },
+        { 1856, 11 },
+        { 1920, 11 },
+        { 1920, 11 },
+        { 2368, 12 },
+        { 2432, 12 },
+        { 2496, 12 },
+        { 2560, 12 },
+        { 29, 8 },
+        { 29, 8 },
         { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 29, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
         { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 30, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
         { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 45, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
         { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 46, 8 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
         { 22, 7 },
         { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 22, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
         { 23, 7 },
         { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 23, 7 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
         { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 47, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
         { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 48, 8 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
+        { 13, 6 },
         { 13, 6 },
         { 13, 6 },
         { 13, 6 },
         { 13, 6 },
         { 20, 7 },
         { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
+        { 20, 7 },
         { 33, 8 },
-        { 34, 8 },
-        { 35, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 33, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 34, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 35, 8 },
+        { 36, 8 },
         { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 36, 8 },
+        { 37, 8 },
+        { 37, 8 },
         { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 37, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
         { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 38, 8 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
         { 19, 7 },
         { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 19, 7 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
         { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 31, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
         { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 32, 8 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
+        { 1, 6 },
         { 1, 6 },
         { 1, 6 },
         { 1, 6 },
@@ -62,82 +542,1501 @@ const cfd_node cf_white_decode[] = {
         { 12, 6 },
         { 12, 6 },
         { 12, 6 },
-        { 53, 8 },
-        { 54, 8 },
-        { 26, 7 },
-        { 26, 7 },
-        { 39, 8 },
-        { 40, 8 },
-        { 41, 8 },
-        { 42, 8 },
-        { 43, 8 },
-        { 44, 8 },
-        { 21, 7 },
-        { 21, 7 },
-        { 28, 7 },
-        { 28, 7 },
-        { 61, 8 },
-        { 62, 8 },
-        { 63, 8 },
-        { 0, 8 },
-        { 320, 8 },
-        { 384, 8 },
-        { 10, 5 },
-        { 10, 5 },
-        { 10, 5 },
-        { 10, 5 },
-        { 10, 5 },
-        { 10, 5 },
-        { 10, 5 },
-        { 10, 5 },
-        { 11, 5 },
-        { 11, 5 },
-        { 11, 5 },
-        { 11, 5 },
-        { 11, 5 },
-        { 11, 5 },
-        { 11, 5 },
-        { 11, 5 },
-        { 27, 7 },
-        { 27, 7 },
-        { 59, 8 },
-        { 60, 8 },
-        { 288, 9 },
-        { 290, 9 },
-        { 18, 7 },
-        { 18, 7 },
-        { 24, 7 },
-        { 24, 7 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 12, 6 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 53, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 54, 8 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 26, 7 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 39, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 40, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 41, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 42, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 43, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 44, 8 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 21, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 28, 7 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 61, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 62, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 63, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 0, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 320, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 384, 8 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 10, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 11, 5 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 27, 7 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 59, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 60, 8 },
+        { 1472, 9 },
+        { 1472, 9 },
+        { 1472, 9 },
+        { 1472, 9 },
+        { 1472, 9 },
+        { 1472, 9 },
+        { 1472, 9 },
+        { 1472, 9 },
+        { 1536, 9 },
+        { 1536, 9 },
+        { 1536, 9 },
+        { 1536, 9 },
+        { 1536, 9 },
+        { 1536, 9 },
+        { 1536, 9 },
+        { 1536, 9 },
+        { 1600, 9 },
+        { 1600, 9 },
+        { 1600, 9 },
+        { 1600, 9 },
+        { 1600, 9 },
+        { 1600, 9 },
+        { 1600, 9 },
+        { 1600, 9 },
+        { 1728, 9 },
+        { 1728, 9 },
+        { 1728, 9 },
+        { 1728, 9 },
+        { 1728, 9 },
+        { 1728, 9 },
+        { 1728, 9 },
+        { 1728, 9 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 18, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 24, 7 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
         { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 49, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
         { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 50, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
         { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 51, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
         { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 52, 8 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
         { 25, 7 },
         { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 25, 7 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
         { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 55, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
         { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 56, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
         { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 57, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
         { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 58, 8 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
         { 192, 6 },
         { 192, 6 },
         { 192, 6 },
         { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 192, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
         { 1664, 6 },
         { 1664, 6 },
         { 1664, 6 },
         { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 1664, 6 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
         { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 448, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
         { 512, 8 },
-        { 292, 9 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 512, 8 },
+        { 704, 9 },
+        { 704, 9 },
+        { 704, 9 },
+        { 704, 9 },
+        { 704, 9 },
+        { 704, 9 },
+        { 704, 9 },
+        { 704, 9 },
+        { 768, 9 },
+        { 768, 9 },
+        { 768, 9 },
+        { 768, 9 },
+        { 768, 9 },
+        { 768, 9 },
+        { 768, 9 },
+        { 768, 9 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
         { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 640, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
         { 576, 8 },
-        { 294, 9 },
-        { 296, 9 },
-        { 298, 9 },
-        { 300, 9 },
-        { 302, 9 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 576, 8 },
+        { 832, 9 },
+        { 832, 9 },
+        { 832, 9 },
+        { 832, 9 },
+        { 832, 9 },
+        { 832, 9 },
+        { 832, 9 },
+        { 832, 9 },
+        { 896, 9 },
+        { 896, 9 },
+        { 896, 9 },
+        { 896, 9 },
+        { 896, 9 },
+        { 896, 9 },
+        { 896, 9 },
+        { 896, 9 },
+        { 960, 9 },
+        { 960, 9 },
+        { 960, 9 },
+        { 960, 9 },
+        { 960, 9 },
+        { 960, 9 },
+        { 960, 9 },
+        { 960, 9 },
+        { 1024, 9 },
+        { 1024, 9 },
+        { 1024, 9 },
+        { 1024, 9 },
+        { 1024, 9 },
+        { 1024, 9 },
+        { 1024, 9 },
+        { 1024, 9 },
+        { 1088, 9 },
+        { 1088, 9 },
+        { 1088, 9 },
+        { 1088, 9 },
+        { 1088, 9 },
+        { 1088, 9 },
+        { 1088, 9 },
+        { 1088, 9 },
+        { 1152, 9 },
+        { 1152, 9 },
+        { 1152, 9 },
+        { 1152, 9 },
+        { 1152, 9 },
+        { 1152, 9 },
+        { 1152, 9 },
+        { 1152, 9 },
+        { 1216, 9 },
+        { 1216, 9 },
+        { 1216, 9 },
+        { 1216, 9 },
+        { 1216, 9 },
+        { 1216, 9 },
+        { 1216, 9 },
+        { 1216, 9 },
+        { 1280, 9 },
+        { 1280, 9 },
+        { 1280, 9 },
+        { 1280, 9 },
+        { 1280, 9 },
+        { 1280, 9 },
+        { 1280, 9 },
+        { 1280, 9 },
+        { 1344, 9 },
+        { 1344, 9 },
+        { 1344, 9 },
+        { 1344, 9 },
+        { 1344, 9 },
+        { 1344, 9 },
+        { 1344, 9 },
+        { 1344, 9 },
+        { 1408, 9 },
+        { 1408, 9 },
+        { 1408, 9 },
+        { 1408, 9 },
+        { 1408, 9 },
+        { 1408, 9 },
+        { 1408, 9 },
+        { 1408, 9 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
         { 256, 7 },
         { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 256, 7 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
         { 2, 4 },
         { 2, 4 },
         { 2, 4 },
@@ -154,6 +2053,262 @@ const cfd_node cf_white_decode[] = {
         { 2, 4 },
         { 2, 4 },
         { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 2, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
         { 3, 4 },
         { 3, 4 },
         { 3, 4 },
@@ -170,6 +2325,70 @@ const cfd_node cf_white_decode[] = {
         { 3, 4 },
         { 3, 4 },
         { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 3, 4 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
         { 128, 5 },
         { 128, 5 },
         { 128, 5 },
@@ -178,6 +2397,70 @@ const cfd_node cf_white_decode[] = {
         { 128, 5 },
         { 128, 5 },
         { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 128, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
         { 8, 5 },
         { 8, 5 },
         { 8, 5 },
@@ -186,6 +2469,134 @@ const cfd_node cf_white_decode[] = {
         { 8, 5 },
         { 8, 5 },
         { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 8, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
         { 9, 5 },
         { 9, 5 },
         { 9, 5 },
@@ -194,14 +2605,270 @@ const cfd_node cf_white_decode[] = {
         { 9, 5 },
         { 9, 5 },
         { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 9, 5 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
         { 16, 6 },
         { 16, 6 },
         { 16, 6 },
         { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 16, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
         { 17, 6 },
         { 17, 6 },
         { 17, 6 },
         { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 17, 6 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
         { 4, 4 },
         { 4, 4 },
         { 4, 4 },
@@ -218,6 +2885,262 @@ const cfd_node cf_white_decode[] = {
         { 4, 4 },
         { 4, 4 },
         { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 4, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
         { 5, 4 },
         { 5, 4 },
         { 5, 4 },
@@ -234,14 +3157,398 @@ const cfd_node cf_white_decode[] = {
         { 5, 4 },
         { 5, 4 },
         { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
+        { 14, 6 },
         { 14, 6 },
         { 14, 6 },
         { 14, 6 },
         { 14, 6 },
+        { 14, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
         { 15, 6 },
         { 15, 6 },
         { 15, 6 },
         { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 15, 6 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
         { 64, 5 },
         { 64, 5 },
         { 64, 5 },
@@ -250,6 +3557,1308 @@ const cfd_node cf_white_decode[] = {
         { 64, 5 },
         { 64, 5 },
         { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 64, 5 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 },
+        { 7, 4 }
+};
+
+/* Black decoding table. */
+const cfd_node cf_black_decode[] = {
+        { -2, 11 },
+        { -2, 11 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -1, 0 },
+        { -3, 12 },
+        { 1792, 11 },
+        { 1792, 11 },
+        { 1984, 12 },
+        { 2048, 12 },
+        { 2112, 12 },
+        { 2176, 12 },
+        { 2240, 12 },
+        { 2304, 12 },
+        { 1856, 11 },
+        { 1856, 11 },
+        { 1920, 11 },
+        { 1920, 11 },
+        { 2368, 12 },
+        { 2432, 12 },
+        { 2496, 12 },
+        { 2560, 12 },
+        { 18, 10 },
+        { 18, 10 },
+        { 18, 10 },
+        { 18, 10 },
+        { 52, 12 },
+        { 4096, 13 },
+        { 4098, 13 },
+        { 55, 12 },
+        { 56, 12 },
+        { 4100, 13 },
+        { 4102, 13 },
+        { 59, 12 },
+        { 60, 12 },
+        { 4104, 13 },
+        { 24, 11 },
+        { 24, 11 },
+        { 25, 11 },
+        { 25, 11 },
+        { 4106, 13 },
+        { 320, 12 },
+        { 384, 12 },
+        { 448, 12 },
+        { 4108, 13 },
+        { 53, 12 },
+        { 54, 12 },
+        { 4110, 13 },
+        { 4112, 13 },
+        { 4114, 13 },
+        { 64, 10 },
+        { 64, 10 },
+        { 64, 10 },
+        { 64, 10 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 13, 8 },
+        { 23, 11 },
+        { 23, 11 },
+        { 50, 12 },
+        { 51, 12 },
+        { 44, 12 },
+        { 45, 12 },
+        { 46, 12 },
+        { 47, 12 },
+        { 57, 12 },
+        { 58, 12 },
+        { 61, 12 },
+        { 256, 12 },
+        { 16, 10 },
+        { 16, 10 },
+        { 16, 10 },
+        { 16, 10 },
+        { 17, 10 },
+        { 17, 10 },
+        { 17, 10 },
+        { 17, 10 },
+        { 48, 12 },
+        { 49, 12 },
+        { 62, 12 },
+        { 63, 12 },
+        { 30, 12 },
+        { 31, 12 },
+        { 32, 12 },
+        { 33, 12 },
+        { 40, 12 },
+        { 41, 12 },
+        { 22, 11 },
+        { 22, 11 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 14, 8 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 10, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 11, 7 },
+        { 15, 9 },
+        { 15, 9 },
+        { 15, 9 },
+        { 15, 9 },
+        { 15, 9 },
+        { 15, 9 },
+        { 15, 9 },
+        { 15, 9 },
+        { 128, 12 },
+        { 192, 12 },
+        { 26, 12 },
+        { 27, 12 },
+        { 28, 12 },
+        { 29, 12 },
+        { 19, 11 },
+        { 19, 11 },
+        { 20, 11 },
+        { 20, 11 },
+        { 34, 12 },
+        { 35, 12 },
+        { 36, 12 },
+        { 37, 12 },
+        { 38, 12 },
+        { 39, 12 },
+        { 21, 11 },
+        { 21, 11 },
+        { 42, 12 },
+        { 43, 12 },
+        { 0, 10 },
+        { 0, 10 },
+        { 0, 10 },
+        { 0, 10 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 12, 7 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 9, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 8, 6 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 7, 5 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
         { 6, 4 },
         { 6, 4 },
         { 6, 4 },
@@ -266,90 +4875,6 @@ const cfd_node cf_white_decode[] = {
         { 6, 4 },
         { 6, 4 },
         { 6, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { 7, 4 },
-        { -2, 3 },
-        { -2, 3 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -3, 4 },
-        { 1792, 3 },
-        { 1792, 3 },
-        { 1984, 4 },
-        { 2048, 4 },
-        { 2112, 4 },
-        { 2176, 4 },
-        { 2240, 4 },
-        { 2304, 4 },
-        { 1856, 3 },
-        { 1856, 3 },
-        { 1920, 3 },
-        { 1920, 3 },
-        { 2368, 4 },
-        { 2432, 4 },
-        { 2496, 4 },
-        { 2560, 4 },
-        { 1472, 1 },
-        { 1536, 1 },
-        { 1600, 1 },
-        { 1728, 1 },
-        { 704, 1 },
-        { 768, 1 },
-        { 832, 1 },
-        { 896, 1 },
-        { 960, 1 },
-        { 1024, 1 },
-        { 1088, 1 },
-        { 1152, 1 },
-        { 1216, 1 },
-        { 1280, 1 },
-        { 1344, 1 },
-        { 1408, 1 }
-};
-
-/* Black decoding table. */
-const cfd_node cf_black_decode[] = {
-        { 128, 12 },
-        { 160, 13 },
-        { 224, 12 },
-        { 256, 12 },
-        { 10, 7 },
-        { 11, 7 },
-        { 288, 12 },
-        { 12, 7 },
-        { 9, 6 },
-        { 9, 6 },
-        { 8, 6 },
-        { 8, 6 },
-        { 7, 5 },
-        { 7, 5 },
-        { 7, 5 },
-        { 7, 5 },
         { 6, 4 },
         { 6, 4 },
         { 6, 4 },
@@ -358,6 +4883,198 @@ const cfd_node cf_black_decode[] = {
         { 6, 4 },
         { 6, 4 },
         { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 6, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
         { 5, 4 },
         { 5, 4 },
         { 5, 4 },
@@ -366,6 +5083,518 @@ const cfd_node cf_black_decode[] = {
         { 5, 4 },
         { 5, 4 },
         { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 5, 4 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
         { 1, 3 },
         { 1, 3 },
         { 1, 3 },
@@ -382,6 +5611,518 @@ const cfd_node cf_black_decode[] = {
         { 1, 3 },
         { 1, 3 },
         { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 1, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
         { 4, 3 },
         { 4, 3 },
         { 4, 3 },
@@ -398,6 +6139,1030 @@ const cfd_node cf_black_decode[] = {
         { 4, 3 },
         { 4, 3 },
         { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 4, 3 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
         { 3, 2 },
         { 3, 2 },
         { 3, 2 },
@@ -430,6 +7195,774 @@ const cfd_node cf_black_decode[] = {
         { 3, 2 },
         { 3, 2 },
         { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 3, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
         { 2, 2 },
         { 2, 2 },
         { 2, 2 },
@@ -462,198 +7995,253 @@ const cfd_node cf_black_decode[] = {
         { 2, 2 },
         { 2, 2 },
         { 2, 2 },
-        { -2, 4 },
-        { -2, 4 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -1, 0 },
-        { -3, 5 },
-        { 1792, 4 },
-        { 1792, 4 },
-        { 1984, 5 },
-        { 2048, 5 },
-        { 2112, 5 },
-        { 2176, 5 },
-        { 2240, 5 },
-        { 2304, 5 },
-        { 1856, 4 },
-        { 1856, 4 },
-        { 1920, 4 },
-        { 1920, 4 },
-        { 2368, 5 },
-        { 2432, 5 },
-        { 2496, 5 },
-        { 2560, 5 },
-        { 18, 3 },
-        { 18, 3 },
-        { 18, 3 },
-        { 18, 3 },
-        { 18, 3 },
-        { 18, 3 },
-        { 18, 3 },
-        { 18, 3 },
-        { 52, 5 },
-        { 52, 5 },
-        { 640, 6 },
-        { 704, 6 },
-        { 768, 6 },
-        { 832, 6 },
-        { 55, 5 },
-        { 55, 5 },
-        { 56, 5 },
-        { 56, 5 },
-        { 1280, 6 },
-        { 1344, 6 },
-        { 1408, 6 },
-        { 1472, 6 },
-        { 59, 5 },
-        { 59, 5 },
-        { 60, 5 },
-        { 60, 5 },
-        { 1536, 6 },
-        { 1600, 6 },
-        { 24, 4 },
-        { 24, 4 },
-        { 24, 4 },
-        { 24, 4 },
-        { 25, 4 },
-        { 25, 4 },
-        { 25, 4 },
-        { 25, 4 },
-        { 1664, 6 },
-        { 1728, 6 },
-        { 320, 5 },
-        { 320, 5 },
-        { 384, 5 },
-        { 384, 5 },
-        { 448, 5 },
-        { 448, 5 },
-        { 512, 6 },
-        { 576, 6 },
-        { 53, 5 },
-        { 53, 5 },
-        { 54, 5 },
-        { 54, 5 },
-        { 896, 6 },
-        { 960, 6 },
-        { 1024, 6 },
-        { 1088, 6 },
-        { 1152, 6 },
-        { 1216, 6 },
-        { 64, 3 },
-        { 64, 3 },
-        { 64, 3 },
-        { 64, 3 },
-        { 64, 3 },
-        { 64, 3 },
-        { 64, 3 },
-        { 64, 3 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 13, 1 },
-        { 23, 4 },
-        { 23, 4 },
-        { 50, 5 },
-        { 51, 5 },
-        { 44, 5 },
-        { 45, 5 },
-        { 46, 5 },
-        { 47, 5 },
-        { 57, 5 },
-        { 58, 5 },
-        { 61, 5 },
-        { 256, 5 },
-        { 16, 3 },
-        { 16, 3 },
-        { 16, 3 },
-        { 16, 3 },
-        { 17, 3 },
-        { 17, 3 },
-        { 17, 3 },
-        { 17, 3 },
-        { 48, 5 },
-        { 49, 5 },
-        { 62, 5 },
-        { 63, 5 },
-        { 30, 5 },
-        { 31, 5 },
-        { 32, 5 },
-        { 33, 5 },
-        { 40, 5 },
-        { 41, 5 },
-        { 22, 4 },
-        { 22, 4 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 14, 1 },
-        { 15, 2 },
-        { 15, 2 },
-        { 15, 2 },
-        { 15, 2 },
-        { 15, 2 },
-        { 15, 2 },
-        { 15, 2 },
-        { 15, 2 },
-        { 128, 5 },
-        { 192, 5 },
-        { 26, 5 },
-        { 27, 5 },
-        { 28, 5 },
-        { 29, 5 },
-        { 19, 4 },
-        { 19, 4 },
-        { 20, 4 },
-        { 20, 4 },
-        { 34, 5 },
-        { 35, 5 },
-        { 36, 5 },
-        { 37, 5 },
-        { 38, 5 },
-        { 39, 5 },
-        { 21, 4 },
-        { 21, 4 },
-        { 42, 5 },
-        { 43, 5 },
-        { 0, 3 },
-        { 0, 3 },
-        { 0, 3 },
-        { 0, 3 }
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 2, 2 },
+        { 640, 1 },
+        { 704, 1 },
+        { 768, 1 },
+        { 832, 1 },
+        { 1280, 1 },
+        { 1344, 1 },
+        { 1408, 1 },
+        { 1472, 1 },
+        { 1536, 1 },
+        { 1600, 1 },
+        { 1664, 1 },
+        { 1728, 1 },
+        { 512, 1 },
+        { 576, 1 },
+        { 896, 1 },
+        { 960, 1 },
+        { 1024, 1 },
+        { 1088, 1 },
+        { 1152, 1 },
+        { 1216, 1 }
 };
 
 /* 2-D decoding table. */
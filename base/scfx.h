@@ -108,6 +108,15 @@ typedef struct stream_CFD_state_s {
                                    the current row */
     bool skipping_damage;	/* true if skipping a damaged row looking
                                    for EOL */
+    int *ref_changes;		/* changing elements of lprev, followed by
+                                   3 copies of the row end (only if 2-D) */
+    int ref_row;		/* row whose reference line is in
+                                   ref_changes, -1 if none */
+    int ref_index;		/* ref_changes index of the last b1 */
+    int *cur_changes;		/* changing elements of lbuf so far, noted
+                                   by 2-D decoding (only if 2-D) */
+    int cur_count;		/* # of cur_changes, -1 if lbuf must be
+                                   scanned instead */
     /* The following are not used yet. */
     int uncomp_run;		/* non-0 iff we are in an uncompressed
                                    run straddling a scan line (-1 if white,
@@ -118,10 +127,10 @@ typedef struct stream_CFD_state_s {
 } stream_CFD_state;
 
 #define private_st_CFD_state()	/* in scfd.c */\
-  gs_private_st_ptrs2(st_CFD_state, stream_CFD_state, "CCITTFaxDecode state",\
-    cfd_enum_ptrs, cfd_reloc_ptrs, lbuf, lprev)
+  gs_private_st_ptrs4(st_CFD_state, stream_CFD_state, "CCITTFaxDecode state",\
+    cfd_enum_ptrs, cfd_reloc_ptrs, lbuf, lprev, ref_changes, cur_changes)
 #define s_CFD_set_defaults_inline(ss)\
-  s_CF_set_defaults_inline(ss)
+  (s_CF_set_defaults_inline(ss), (ss)->ref_changes = (ss)->cur_changes = 0)
 extern const stream_template s_CFD_template;
 
 #endif /* scfx_INCLUDED */
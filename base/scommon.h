@@ -139,6 +139,12 @@ typedef union stream_cursor_s {
 #define stream_proc_reinit(proc)\
   int proc(stream_state *)
 
+/* Ask an image decoding filter to deliver its image at a reduced size. */
+/* See strimpl.h for details. */
+typedef struct stream_reduce_request_s stream_reduce_request;
+#define stream_proc_reduce(proc)\
+  int proc(stream_state *, const stream_reduce_request *)
+
 /* Report an error.  Note that this procedure is stored in the state, */
 /* not in the main stream structure. */
 #define stream_proc_report_error(proc)\
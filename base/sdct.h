@@ -103,6 +103,13 @@ typedef struct jpeg_decompress_data_s {
                                          * so we use a function at the interpreter level
                                          */
     void *device;                       /* The device we need to send PassThrough data to */
+    /* Reduction requested through the template's reduce procedure. */
+    int reduce;                 /* 1, 2, 4 or 8 */
+    int reduce_width;           /* The image size the client expects */
+    int reduce_height;
+    int reduce_comps;
+    bool decimate;              /* true if the frame doesn't match that size, */
+    ulong decimate_pos;         /* and # of bytes of full size image so far */
 } jpeg_decompress_data;
 
 #define private_st_jpeg_decompress_data()	/* in zfdctd.c */\
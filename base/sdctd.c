@@ -106,10 +106,62 @@ s_DCTD_init(stream_state * st)
     ss->data.decompress->skip = 0;
     ss->data.decompress->input_eod = false;
     ss->data.decompress->faked_eoi = false;
+    ss->data.decompress->reduce = 1;
+    ss->data.decompress->decimate = false;
     ss->phase = 0;
     return 0;
 }
 
+/*
+ * Deliver the image at 1/2, 1/4 or 1/8 of its size, by having the IJG
+ * library scale it in the IDCT.  We can't check the frame header against
+ * the size the client expects until we've read it; if it doesn't match,
+ * we decode at full size and drop samples to produce the promised layout.
+ */
+static int
+s_DCTD_reduce(stream_state * st, const stream_reduce_request *req)
+{
+    stream_DCT_state *const ss = (stream_DCT_state *) st;
+    jpeg_decompress_data *jddp = ss->data.decompress;
+    int factor = 1;
+
+    if (ss->phase != 0 || jddp->PassThrough || req->max_factor < 2 ||
+        req->width <= 0 || req->height <= 0 ||
+        (req->num_comps != 1 && req->num_comps != 3 && req->num_comps != 4))
+        return 1;
+    while (factor < 8 && factor * 2 <= req->max_factor)
+        factor *= 2;
+    jddp->reduce = factor;
+    jddp->reduce_width = req->width;
+    jddp->reduce_height = req->height;
+    jddp->reduce_comps = req->num_comps;
+    return factor;
+}
+
+/*
+ * Keep just the bytes of a decoded scan line that belong to the reduced
+ * image, treating the full size data as rows of reduce_width samples, as
+ * the client would have.  The bytes kept are moved to the end of the line;
+ * returns the number kept.
+ */
+static uint
+dctd_decimate(jpeg_decompress_data *jddp, byte *line, uint size)
+{
+    ulong row_size = (ulong)jddp->reduce_width * jddp->reduce_comps;
+    byte *out = line + size;
+    uint i;
+
+    for (i = size; i-- > 0;) {
+        ulong pos = jddp->decimate_pos + i;
+
+        if ((pos / row_size) % jddp->reduce == 0 &&
+            (pos % row_size) / jddp->reduce_comps % jddp->reduce == 0)
+            *--out = line[i];
+    }
+    jddp->decimate_pos += size;
+    return line + size - out;
+}
+
 static int
 compact_jpeg_buffer(stream_cursor_read *pr)
 {
@@ -278,6 +330,35 @@ s_DCTD_process(stream_state * st, stream_cursor_read * pr,
                 /* out_color_space will default to JCS_CMYK */
                 break;
             }
+
+#if SHARE_JPEG == 0
+            /* Our build of the library has IDCT scaling so that we can
+             * reduce images (see gsjmorec.h). Don't let it use that to
+             * upsample the chroma of full size images, so that those
+             * decode exactly as they did without it. */
+            jddp->dinfo.do_fancy_upsampling = FALSE;
+#endif
+            if (jddp->reduce > 1) {
+                int r = jddp->reduce;
+
+                if (jddp->dinfo.image_width == jddp->reduce_width &&
+                    jddp->dinfo.image_height == jddp->reduce_height &&
+                    jddp->dinfo.num_components == jddp->reduce_comps) {
+                    jddp->dinfo.scale_num = 1;
+                    jddp->dinfo.scale_denom = r;
+                    if (gs_jpeg_calc_output_dimensions(ss) < 0)
+                        return ERRC;
+                }
+                /* If the frame isn't what the client expects, or the library
+                 * can't scale it (not built with IDCT_SCALING_SUPPORTED),
+                 * drop samples instead. */
+                if (jddp->dinfo.output_width != (jddp->reduce_width + r - 1) / r ||
+                    jddp->dinfo.output_height != (jddp->reduce_height + r - 1) / r) {
+                    jddp->dinfo.scale_denom = jddp->dinfo.scale_num;
+                    jddp->decimate = true;
+                    jddp->decimate_pos = 0;
+                }
+            }
             ss->phase = 2;
             /* falls through */
         case 2:		/* start_decompress */
@@ -296,8 +377,9 @@ s_DCTD_process(stream_state * st, stream_cursor_read * pr,
                        jddp->dinfo.output_width,
                        jddp->dinfo.output_components,
                        ss->scan_line_size, jddp->templat.min_out_size);
-            if (ss->scan_line_size > (uint) jddp->templat.min_out_size) {
-                /* Create a spare buffer for oversize scanline */
+            if (ss->scan_line_size > (uint) jddp->templat.min_out_size ||
+                jddp->decimate) {
+                /* Create a spare buffer for oversize (or decimated) scanline */
                 jddp->scanline_buffer =
                     gs_alloc_bytes_immovable(gs_memory_stable(jddp->memory),
                                              ss->scan_line_size,
@@ -389,6 +471,9 @@ s_DCTD_process(stream_state * st, stream_cursor_read * pr,
                 }
                 if (jddp->scanline_buffer != NULL) {
                     jddp->bytes_in_scanline = ss->scan_line_size;
+                    if (jddp->decimate)
+                        jddp->bytes_in_scanline =
+                            dctd_decimate(jddp, samples, ss->scan_line_size);
                     goto dumpbuffer;
                 }
                 pw->ptr += ss->scan_line_size;
@@ -416,5 +501,5 @@ s_DCTD_process(stream_state * st, stream_cursor_read * pr,
 /* Stream template */
 const stream_template s_DCTD_template =
 {&st_DCT_state, s_DCTD_init, s_DCTD_process, 2000, 4000, NULL,
- s_DCTD_set_defaults
+ s_DCTD_set_defaults, NULL, s_DCTD_reduce
 };
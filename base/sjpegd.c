@@ -56,6 +56,15 @@ gs_jpeg_read_header(stream_DCT_state * st,
     return jpeg_read_header(&st->data.decompress->dinfo, require_image);
 }
 
+int
+gs_jpeg_calc_output_dimensions(stream_DCT_state * st)
+{
+    if (setjmp(find_jmp_buf(st->data.common->exit_jmpbuf)))
+        return_error(gs_jpeg_log_error(st));
+    jpeg_calc_output_dimensions(&st->data.decompress->dinfo);
+    return 0;
+}
+
 int
 gs_jpeg_start_decompress(stream_DCT_state * st)
 {
@@ -22,83 +22,65 @@
 #include "gdebug.h"
 #include "strimpl.h"
 #include "sjpx_openjpeg.h"
-#include "gxsync.h"
+#include "gpsync.h"
+#include "gsmalloc.h"
 #include "assert_.h"
 #if !defined(SHARE_JPX) || (SHARE_JPX == 0)
 #include "opj_malloc.h"
 #endif
-/* Some locking to get around the criminal lack of context
- * in the openjpeg library. */
+/* The openjpeg library has no context to hang an allocator on, so
+ * opj_malloc and friends use a heap of their own.  It is a malloc heap,
+ * which does its own locking, so any number of instances and threads
+ * can decode at once; the process wide lock only covers creating and
+ * freeing it as the instances come and go. */
 #if !defined(SHARE_JPX) || (SHARE_JPX == 0)
 static gs_memory_t *opj_memory;
+static int opj_users;
 #endif
 
 int sjpxd_create(gs_memory_t *mem)
 {
 #if !defined(SHARE_JPX) || (SHARE_JPX == 0)
     gs_lib_ctx_t *ctx = mem->gs_lib_ctx;
+    int code = 0;
 
-#ifdef MEMENTO_SQUEEZE_BUILD
-    ctx->sjpxd_private = NULL;
-#else
-    ctx->sjpxd_private = gx_monitor_label(gx_monitor_alloc(mem), "sjpxd_monitor");
-    if (ctx->sjpxd_private == NULL)
-        return gs_error_VMerror;
-#endif
-#endif
-    return 0;
-}
-
-void sjpxd_destroy(gs_memory_t *mem)
-{
-#if (!defined(SHARE_JPX) || (SHARE_JPX == 0)) && !defined(MEMENTO_SQUEEZE_BUILD)
-    gs_lib_ctx_t *ctx = mem->gs_lib_ctx;
-
-    gx_monitor_free((gx_monitor_t *)ctx->sjpxd_private);
-    ctx->sjpxd_private = NULL;
-#endif
-}
-
-static int opj_lock(gs_memory_t *mem)
-{
-#if !defined(SHARE_JPX) || (SHARE_JPX == 0)
-    int ret;
-
-#ifdef MEMENTO_SQUEEZE_BUILD
-    ret = 0;
-#else
-    gs_lib_ctx_t *ctx = mem->gs_lib_ctx;
-
-    ret = gx_monitor_enter((gx_monitor_t *)ctx->sjpxd_private);
-#endif
-    assert(opj_memory == NULL);
-    opj_memory = mem->non_gc_memory;
-    return ret;
+    gp_global_lock();
+    if (opj_users == 0) {
+        opj_memory = (gs_memory_t *)gs_malloc_memory_init();
+        if (opj_memory == NULL)
+            code = gs_note_error(gs_error_VMerror);
+    }
+    if (code == 0) {
+        opj_users++;
+        /* Note that this instance holds a reference */
+        ctx->sjpxd_private = opj_memory;
+    }
+    gp_global_unlock();
+    return code;
 #else
     return 0;
 #endif
 }
 
-static int opj_unlock(gs_memory_t *mem)
+void sjpxd_destroy(gs_memory_t *mem)
 {
 #if !defined(SHARE_JPX) || (SHARE_JPX == 0)
     gs_lib_ctx_t *ctx = mem->gs_lib_ctx;
 
-    assert(opj_memory != NULL);
-    opj_memory = NULL;
-#ifdef MEMENTO_SQUEEZE_BUILD
-    (void)ctx;
-    return 0;
-#else
-    return gx_monitor_leave((gx_monitor_t *)ctx->sjpxd_private);
-#endif
-#else
-    return 0;
+    if (ctx->sjpxd_private == NULL)
+        return;
+    ctx->sjpxd_private = NULL;
+    gp_global_lock();
+    if (--opj_users == 0) {
+        gs_malloc_memory_release((gs_malloc_memory_t *)opj_memory);
+        opj_memory = NULL;
+    }
+    gp_global_unlock();
 #endif
 }
 
 #if !defined(SHARE_JPX) || (SHARE_JPX == 0)
-/* Allocation routines that use the memory pointer given above */
+/* Allocation routines that use the heap given above */
 void *opj_malloc(size_t size)
 {
     if (size == 0)
@@ -269,59 +251,87 @@ s_opjd_init(stream_state * ss)
     state->sign_comps = NULL;
     state->stream = NULL;
     state->row_data = NULL;
+    state->reduce = 0;
+    state->placed = false;
+    state->num_parts = 0;
+    state->parts = NULL;
+    state->decimate = false;
+    state->decimate_pos = 0;
 
     return 0;
 }
 
-/* setting the codec format,
-   allocating the stream and image structures, and
-   initializing the decoder.
- */
+/* create a decoder and a byte stream to feed it */
 static int
-s_opjd_set_codec_format(stream_state * ss, OPJ_CODEC_FORMAT format)
+jpxd_create_decoder(OPJ_CODEC_FORMAT format, OPJ_UINT32 flags,
+                    opj_codec_t **pcodec, opj_stream_t **pstream)
 {
-    stream_jpxd_state *const state = (stream_jpxd_state *) ss;
     opj_dparameters_t parameters;	/* decompression parameters */
 
     /* set decoding parameters to default values */
     opj_set_default_decoder_parameters(&parameters);
+    parameters.flags |= flags;
 
     /* get a decoder handle */
-    state->codec = opj_create_decompress(format);
-    if (state->codec == NULL)
+    *pcodec = opj_create_decompress(format);
+    if (*pcodec == NULL)
         return_error(gs_error_VMerror);
 
     /* catch events using our callbacks */
-    opj_set_error_handler(state->codec, sjpx_error_callback, stderr);
-    opj_set_info_handler(state->codec, sjpx_info_callback, stderr);
-    opj_set_warning_handler(state->codec, sjpx_warning_callback, stderr);
-
-    if (state->colorspace == gs_jpx_cs_indexed) {
-        parameters.flags |= OPJ_DPARAMETERS_IGNORE_PCLR_CMAP_CDEF_FLAG;
-    }
+    opj_set_error_handler(*pcodec, sjpx_error_callback, stderr);
+    opj_set_info_handler(*pcodec, sjpx_info_callback, stderr);
+    opj_set_warning_handler(*pcodec, sjpx_warning_callback, stderr);
 
     /* setup the decoder decoding parameters using user parameters */
-    if (!opj_setup_decoder(state->codec, &parameters))
+    if (!opj_setup_decoder(*pcodec, &parameters))
     {
         dlprintf("openjpeg: failed to setup the decoder!\n");
         return ERRC;
     }
 
     /* open a byte stream */
-    state->stream = opj_stream_default_create(OPJ_TRUE);
-    if (state->stream == NULL)
+    *pstream = opj_stream_default_create(OPJ_TRUE);
+    if (*pstream == NULL)
     {
         dlprintf("openjpeg: failed to open a byte stream!\n");
         return ERRC;
     }
 
-    opj_stream_set_read_function(state->stream, sjpx_stream_read);
-    opj_stream_set_skip_function(state->stream, sjpx_stream_skip);
-    opj_stream_set_seek_function(state->stream, sjpx_stream_seek);
+    opj_stream_set_read_function(*pstream, sjpx_stream_read);
+    opj_stream_set_skip_function(*pstream, sjpx_stream_skip);
+    opj_stream_set_seek_function(*pstream, sjpx_stream_seek);
 
     return 0;
 }
 
+/* point a byte stream at (a copy of) the accumulated input */
+static void
+jpxd_set_stream_input(opj_stream_t *stream, stream_block *sb)
+{
+#if OPJ_VERSION_MAJOR >= 2 && OPJ_VERSION_MINOR >= 1
+    opj_stream_set_user_data(stream, sb, NULL);
+#else
+    opj_stream_set_user_data(stream, sb);
+#endif
+    opj_stream_set_user_data_length(stream, sb->size);
+}
+
+/* setting the codec format,
+   allocating the stream and image structures, and
+   initializing the decoder.
+ */
+static int
+s_opjd_set_codec_format(stream_state * ss, OPJ_CODEC_FORMAT format)
+{
+    stream_jpxd_state *const state = (stream_jpxd_state *) ss;
+
+    state->format = format;
+    return jpxd_create_decoder(format,
+                               state->colorspace == gs_jpx_cs_indexed ?
+                                   OPJ_DPARAMETERS_IGNORE_PCLR_CMAP_CDEF_FLAG : 0,
+                               &state->codec, &state->stream);
+}
+
 static void
 ycc_to_rgb_8(unsigned char *row, unsigned long row_size)
 {
@@ -395,44 +405,11 @@ ycc_to_rgb_16(unsigned char *row, unsigned long row_size)
     while (row_size);
 }
 
-static int decode_image(stream_jpxd_state * const state)
+/* find the colour components and the alpha component of the decoded image */
+static void
+jpxd_find_components(stream_jpxd_state * const state)
 {
-    int numprimcomp = 0, alpha_comp = -1, compno, rowbytes;
-
-    /* read header */
-    if (!opj_read_header(state->stream, state->codec, &(state->image)))
-    {
-    	dlprintf("openjpeg: failed to read header\n");
-    	return ERRC;
-    }
-
-    /* decode the stream and fill the image structure */
-    if (!opj_decode(state->codec, state->stream, state->image))
-    {
-        dlprintf("openjpeg: failed to decode image!\n");
-        return ERRC;
-    }
-
-    /* check dimension and prec */
-    if (state->image->numcomps == 0)
-        return ERRC;
-
-    state->width = state->image->comps[0].w;
-    state->height = state->image->comps[0].h;
-    state->bpp = state->image->comps[0].prec;
-    state->samescale = true;
-    for(compno = 1; compno < state->image->numcomps; compno++)
-    {
-        if (state->bpp != state->image->comps[compno].prec)
-            return ERRC; /* Not supported. */
-        if (state->width < state->image->comps[compno].w)
-            state->width = state->image->comps[compno].w;
-        if (state->height < state->image->comps[compno].h)
-            state->height = state->image->comps[compno].h;
-        if (state->image->comps[compno].dx != state->image->comps[0].dx ||
-                state->image->comps[compno].dy != state->image->comps[0].dy)
-            state->samescale = false;
-    }
+    int numprimcomp = 0, alpha_comp = -1, compno;
 
     /* find alpha component and regular colour component by channel definition */
     for (compno = 0; compno < state->image->numcomps; compno++)
@@ -477,6 +454,350 @@ static int decode_image(stream_jpxd_state * const state)
     }
     else
         state->out_numcomps = numprimcomp;
+}
+
+/* compensate for signed data (signed => unsigned) */
+static int
+jpxd_find_signs(stream_jpxd_state * const state)
+{
+    int compno;
+
+    state->sign_comps = (int *)gs_alloc_byte_array(state->memory->non_gc_memory, sizeof(int)*state->image->numcomps, 1, "decode_image(sign_comps)");
+    if (!state->sign_comps)
+        return_error(gs_error_VMerror);
+
+    for(compno = 0; compno < state->image->numcomps; compno++)
+    {
+        if (state->image->comps[compno].sgnd)
+            state->sign_comps[compno] = ((state->bpp%8)==0) ? 0x80 : (1<<(state->bpp-1));
+        else
+            state->sign_comps[compno] = 0;
+    }
+    return 0;
+}
+
+/*
+ * An area of the image decoded by its own codec.  When the reduce procedure
+ * allows us more threads, the tiles of the visible area are shared out
+ * between a few of these, each decoded on a thread of its own; the first
+ * uses the stream's codec, on the calling thread.  The input is only read,
+ * so each just keeps its own position in it.
+ */
+typedef struct jpxd_part_s {
+    OPJ_CODEC_FORMAT format;
+    opj_codec_t *codec;
+    opj_stream_t *stream;
+    opj_image_t *image;
+    stream_block sb;
+    int levels;			/* Resolution levels to discard */
+    int x0, y0, x1, y1;		/* The area, on the reference grid */
+    bool ok;
+    gp_thread_id thread;
+} jpxd_part;
+
+static bool
+jpxd_decode_area(jpxd_part *part)
+{
+    return opj_set_decoded_resolution_factor(part->codec, part->levels) &&
+           opj_set_decode_area(part->codec, part->image,
+                               part->x0, part->y0, part->x1, part->y1) &&
+           opj_decode(part->codec, part->stream, part->image);
+}
+
+static void
+jpxd_decode_part(void *arg)
+{
+    jpxd_part *part = (jpxd_part *)arg;
+
+    part->ok = false;
+    if (jpxd_create_decoder(part->format, 0, &part->codec, &part->stream) < 0)
+        return;
+    jpxd_set_stream_input(part->stream, &part->sb);
+    part->ok = opj_read_header(part->stream, part->codec, &part->image) &&
+               jpxd_decode_area(part);
+}
+
+/* free the separately decoded areas, except for the stream's own */
+static void
+jpxd_free_parts(stream_jpxd_state * const state)
+{
+    int i;
+
+    for (i = 1; i < state->num_parts; i++)
+    {
+        jpxd_part *part = &state->parts[i];
+
+        if (part->image)
+            opj_image_destroy(part->image);
+        if (part->stream)
+            opj_stream_destroy(part->stream);
+        if (part->codec)
+            opj_destroy_codec(part->codec);
+    }
+    if (state->parts)
+        gs_free_object(state->memory->non_gc_memory, state->parts, "jpxd_free_parts");
+    state->parts = NULL;
+    state->num_parts = 0;
+}
+
+static inline int
+jpxd_ceildivpow2(OPJ_UINT32 a, int b)
+{
+    return (int)((a + (1U << b) - 1) >> b);
+}
+
+/*
+ * Decode the image the way the client asked through the reduce procedure:
+ * discarding as many resolution levels as we can (then dropping samples
+ * for any factor left over), and only the area the client can see, on
+ * several threads if it allows.  Returns 1 without decoding anything if the
+ * header doesn't match what the client expects, or < 0 if we decoded
+ * something that turns out not to be usable this way.
+ */
+static int
+decode_placed(stream_jpxd_state * const state)
+{
+    opj_image_t *image = state->image;
+    opj_codestream_info_v2_t *info;
+    int factor = state->reduce;
+    int levels = 0, compno, i;
+    int x0, y0, x1, y1, t0, t1;
+    OPJ_UINT32 tx0, ty0, tdx, tdy;
+    bool by_rows;
+
+    if (image->numcomps < state->reduce_comps ||
+        image->x1 - image->x0 != state->reduce_width ||
+        image->y1 - image->y0 != state->reduce_height)
+        return 1;
+    for (compno = 0; compno < image->numcomps; compno++)
+    {
+        if (image->comps[compno].prec != 8 ||
+            image->comps[compno].dx != 1 || image->comps[compno].dy != 1)
+            return 1;
+    }
+
+    /* Discard at most the levels every component has. */
+    info = opj_get_cstr_info(state->codec);
+    if (info == NULL || info->m_default_tile_info.tccp_info == NULL ||
+        info->tdx == 0 || info->tdy == 0)
+    {
+        if (info != NULL)
+            opj_destroy_cstr_info(&info);
+        return 1;
+    }
+    while ((2 << levels) <= factor)
+        levels++;
+    for (compno = 0; compno < info->nbcomps; compno++)
+    {
+        int numres = info->m_default_tile_info.tccp_info[compno].numresolutions;
+
+        if (levels > numres - 1)
+            levels = max(numres - 1, 0);
+    }
+    tx0 = info->tx0;
+    ty0 = info->ty0;
+    tdx = info->tdx;
+    tdy = info->tdy;
+    opj_destroy_cstr_info(&info);
+
+    state->levels = levels;
+    state->step = factor >> levels;
+    state->image_x0 = jpxd_ceildivpow2(image->x0, levels);
+    state->image_y0 = jpxd_ceildivpow2(image->y0, levels);
+    state->placed = true;
+    state->bpp = 8;
+    state->out_numcomps = state->reduce_comps;
+    state->width = (state->reduce_width + factor - 1) / factor;
+    state->height = (state->reduce_height + factor - 1) / factor;
+    state->totalbytes = (unsigned long)state->width * state->out_numcomps * state->height;
+
+    x0 = image->x0 + state->visible.p.x;
+    y0 = image->y0 + state->visible.p.y;
+    x1 = image->x0 + state->visible.q.x;
+    y1 = image->y0 + state->visible.q.y;
+    if (x0 >= x1 || y0 >= y1)
+        return 0; /* Nothing can be seen, so there's nothing to decode. */
+
+    /* Share out the rows (or columns) of tiles in the area. */
+    if ((y1 - 1 - ty0) / tdy - (y0 - ty0) / tdy >=
+        (x1 - 1 - tx0) / tdx - (x0 - tx0) / tdx)
+    {
+        by_rows = true;
+        t0 = (y0 - ty0) / tdy;
+        t1 = (y1 - 1 - ty0) / tdy + 1;
+    }
+    else
+    {
+        by_rows = false;
+        t0 = (x0 - tx0) / tdx;
+        t1 = (x1 - 1 - tx0) / tdx + 1;
+    }
+    state->num_parts = min(state->num_threads + 1, t1 - t0);
+    state->parts = (jpxd_part *)gs_alloc_byte_array(state->memory->non_gc_memory, state->num_parts, sizeof(jpxd_part), "decode_placed(parts)");
+    if (state->parts == NULL)
+    {
+        state->num_parts = 0;
+        return_error(gs_error_VMerror);
+    }
+    memset(state->parts, 0, state->num_parts * sizeof(jpxd_part));
+    for (i = 0; i < state->num_parts; i++)
+    {
+        jpxd_part *part = &state->parts[i];
+        int p0 = t0 + (t1 - t0) * i / state->num_parts;
+        int p1 = t0 + (t1 - t0) * (i + 1) / state->num_parts;
+
+        part->format = state->format;
+        part->sb = state->sb;
+        part->sb.pos = 0;
+        part->levels = levels;
+        part->x0 = x0;
+        part->y0 = y0;
+        part->x1 = x1;
+        part->y1 = y1;
+        if (by_rows)
+        {
+            part->y0 = max(y0, (int)(ty0 + p0 * tdy));
+            part->y1 = min(y1, (int)(ty0 + p1 * tdy));
+        }
+        else
+        {
+            part->x0 = max(x0, (int)(tx0 + p0 * tdx));
+            part->x1 = min(x1, (int)(tx0 + p1 * tdx));
+        }
+    }
+    for (i = 1; i < state->num_parts; i++)
+    {
+        if (gp_thread_start(jpxd_decode_part, &state->parts[i], &state->parts[i].thread) < 0)
+        {
+            state->parts[i].thread = NULL;
+            jpxd_decode_part(&state->parts[i]);
+        }
+    }
+    state->parts[0].codec = state->codec;
+    state->parts[0].stream = state->stream;
+    state->parts[0].image = image;
+    state->parts[0].ok = jpxd_decode_area(&state->parts[0]);
+    for (i = 1; i < state->num_parts; i++)
+    {
+        if (state->parts[i].thread != NULL)
+            gp_thread_finish(state->parts[i].thread);
+    }
+
+    /* Check we got what the client expects (a palette or channel
+       definitions are only applied by the decode). */
+    for (i = 0; i < state->num_parts; i++)
+    {
+        opj_image_t *pimage = state->parts[i].image;
+
+        if (!state->parts[i].ok || pimage->numcomps != image->numcomps)
+            return ERRC;
+        for (compno = 0; compno < pimage->numcomps; compno++)
+        {
+            opj_image_comp_t *comp = &pimage->comps[compno];
+
+            if (comp->prec != 8 || comp->dx != 1 || comp->dy != 1 ||
+                comp->factor != levels || comp->data == NULL ||
+                comp->x0 != pimage->comps[0].x0 || comp->y0 != pimage->comps[0].y0 ||
+                comp->w != pimage->comps[0].w || comp->h != pimage->comps[0].h)
+                return ERRC;
+        }
+    }
+    jpxd_find_components(state);
+    if (state->out_numcomps != state->reduce_comps ||
+        ((image->color_space == OPJ_CLRSPC_SYCC || image->color_space == OPJ_CLRSPC_EYCC) &&
+         state->out_numcomps != 3))
+        return ERRC;
+
+    return jpxd_find_signs(state);
+}
+
+/* start again with a fresh decoder, for decoding the whole image */
+static int
+jpxd_restart(stream_jpxd_state * const state)
+{
+    int code;
+
+    jpxd_free_parts(state);
+    if (state->sign_comps)
+        gs_free_object(state->memory->non_gc_memory, state->sign_comps, "jpxd_restart(sign_comps)");
+    state->sign_comps = NULL;
+    opj_image_destroy(state->image);
+    state->image = NULL;
+    opj_stream_destroy(state->stream);
+    state->stream = NULL;
+    opj_destroy_codec(state->codec);
+    state->codec = NULL;
+    state->placed = false;
+
+    code = s_opjd_set_codec_format((stream_state *)state, state->format);
+    if (code < 0)
+        return code;
+    state->sb.pos = 0;
+    jpxd_set_stream_input(state->stream, &state->sb);
+    if (!opj_read_header(state->stream, state->codec, &(state->image)))
+    {
+        dlprintf("openjpeg: failed to read header\n");
+        return ERRC;
+    }
+    return 0;
+}
+
+static int decode_image(stream_jpxd_state * const state)
+{
+    int compno, rowbytes;
+
+    /* read header */
+    if (!opj_read_header(state->stream, state->codec, &(state->image)))
+    {
+    	dlprintf("openjpeg: failed to read header\n");
+    	return ERRC;
+    }
+
+    if (state->reduce)
+    {
+        int code = decode_placed(state);
+
+        if (code == 0)
+            return 0;
+        if (code < 0)
+        {
+            code = jpxd_restart(state);
+            if (code < 0)
+                return code;
+        }
+        /* We have to deliver the reduced layout we promised. */
+        state->decimate = state->reduce > 1;
+    }
+
+    /* decode the stream and fill the image structure */
+    if (!opj_decode(state->codec, state->stream, state->image))
+    {
+        dlprintf("openjpeg: failed to decode image!\n");
+        return ERRC;
+    }
+
+    /* check dimension and prec */
+    if (state->image->numcomps == 0)
+        return ERRC;
+
+    state->width = state->image->comps[0].w;
+    state->height = state->image->comps[0].h;
+    state->bpp = state->image->comps[0].prec;
+    state->samescale = true;
+    for(compno = 1; compno < state->image->numcomps; compno++)
+    {
+        if (state->bpp != state->image->comps[compno].prec)
+            return ERRC; /* Not supported. */
+        if (state->width < state->image->comps[compno].w)
+            state->width = state->image->comps[compno].w;
+        if (state->height < state->image->comps[compno].h)
+            state->height = state->image->comps[compno].h;
+        if (state->image->comps[compno].dx != state->image->comps[0].dx ||
+                state->image->comps[compno].dy != state->image->comps[0].dy)
+            state->samescale = false;
+    }
+
+    jpxd_find_components(state);
 
     /* round up bpp 12->16 */
     if (state->bpp == 12)
@@ -490,35 +811,201 @@ static int decode_image(stream_jpxd_state * const state)
     if (!state->pdata)
         return_error(gs_error_VMerror);
 
-    /* compensate for signed data (signed => unsigned) */
-    state->sign_comps = (int *)gs_alloc_byte_array(state->memory->non_gc_memory, sizeof(int)*state->image->numcomps, 1, "decode_image(sign_comps)");
-    if (!state->sign_comps)
-        return_error(gs_error_VMerror);
+    return jpxd_find_signs(state);
+}
 
-    for(compno = 0; compno < state->image->numcomps; compno++)
+/* fill row_data with a row of the image decoded by decode_placed */
+static void
+jpxd_fill_placed_row(stream_jpxd_state * const state, unsigned int y_offset)
+{
+    int ncomps = state->out_numcomps;
+    unsigned int row_size = state->width * ncomps;
+    int step = state->step;
+    int y = state->image_y0 + y_offset * step;
+    int i, compno;
+
+    memset(state->row_data, 0, row_size);
+    for (i = 0; i < state->num_parts; i++)
     {
-        if (state->image->comps[compno].sgnd)
-            state->sign_comps[compno] = ((state->bpp%8)==0) ? 0x80 : (1<<(state->bpp-1));
+        opj_image_t *image = state->parts[i].image;
+        int cx0 = jpxd_ceildivpow2(image->comps[0].x0, state->levels);
+        int cy0 = jpxd_ceildivpow2(image->comps[0].y0, state->levels);
+        int w = image->comps[0].w;
+        int x, x1;
+
+        if (y < cy0 || y >= cy0 + (int)image->comps[0].h)
+            continue;
+        /* The output samples that fall in this part */
+        x = cx0 > state->image_x0 ? (cx0 - state->image_x0 + step - 1) / step : 0;
+        x1 = cx0 + w > state->image_x0 ? (cx0 + w - state->image_x0 + step - 1) / step : 0;
+        if (x1 > state->width)
+            x1 = state->width;
+        for (compno = 0; compno < ncomps; compno++)
+        {
+            const OPJ_INT32 *src = image->comps[compno].data +
+                    (y - cy0) * w + state->image_x0 + x * step - cx0;
+            byte *row = state->row_data + x * ncomps + compno;
+            int sign = state->sign_comps[compno];
+            int n;
+
+            for (n = x1 - x; n > 0; n--)
+            {
+                *row = *src + sign;
+                row += ncomps;
+                src += step;
+            }
+        }
+    }
+
+    if (state->num_parts > 0 &&
+        (state->image->color_space == OPJ_CLRSPC_SYCC || state->image->color_space == OPJ_CLRSPC_EYCC))
+        ycc_to_rgb_8(state->row_data, row_size);
+}
+
+/* fill row_data with a row of the decoded image */
+static void
+jpxd_fill_row(stream_jpxd_state * const state, unsigned int y_offset)
+{
+    int bytepp1 = state->bpp/8; /* bytes / pixel for one output component */
+    int shift_bit = state->bpp-state->image->comps[0].prec; /*difference between input and output bit-depth*/
+    int img_numcomps = min(state->out_numcomps, state->image->numcomps); /* the actual number of channel data used */
+    unsigned int row_size = (state->width * state->out_numcomps * state->bpp + 7)>>3;
+    int compno;
+    unsigned long i;
+    int b;
+    byte *row = state->row_data;
+
+    if (state->placed)
+    {
+        jpxd_fill_placed_row(state, y_offset);
+        return;
+    }
+
+    if (state->alpha && state->alpha_comp == -1)
+    {
+        /* return 0xff for all */
+        memset(row, 0xff, row_size);
+    }
+    else if (state->samescale)
+    {
+        if (state->alpha)
+            state->pdata[0] = &(state->image->comps[state->alpha_comp].data[y_offset * state->width]);
         else
-            state->sign_comps[compno] = 0;
+        {
+            for (compno=0; compno<img_numcomps; compno++)
+                state->pdata[compno] = &(state->image->comps[compno].data[y_offset * state->width]);
+        }
+        if (shift_bit == 0 && state->bpp == 8) /* optimized for the most common case */
+        {
+            for (i = state->width; i > 0; i--)
+                for (compno=0; compno<img_numcomps; compno++)
+                    *row++ = *(state->pdata[compno]++) + state->sign_comps[compno]; /* copy input buffer to output */
+        }
+        else if ((state->bpp%8)==0)
+        {
+            for (i = state->width; i > 0; i--)
+            {
+                for (compno=0; compno<img_numcomps; compno++)
+                {
+                    for (b=0; b<bytepp1; b++)
+                        *row++ = (((*(state->pdata[compno]) << shift_bit) >> (8*(bytepp1-b-1))))
+                                                + (b==0 ? state->sign_comps[compno] : 0); /* split and shift input int to output bytes */
+                    state->pdata[compno]++; 
+                }
+            }
+        }
+        else
+        {   
+            /* shift_bit = 0, bpp < 8 */
+            int bt=0;
+            int bit_pos = 0;
+            for (i = state->width; i > 0; i--)
+            {
+                for (compno=0; compno<img_numcomps; compno++)
+                {
+                    bt <<= state->bpp;
+                    bt += *(state->pdata[compno]++) + state->sign_comps[compno];
+                    bit_pos += state->bpp;
+                    if (bit_pos >= 8)
+                    {
+                        *row++ = bt >> (bit_pos-8);
+                        bit_pos -= 8;
+                        bt &= (1<<bit_pos)-1;
+                    }
+                }
+            }
+            if (bit_pos != 0)
+            {
+                /* row padding */
+                *row++ = bt << (8 - bit_pos);
+                bit_pos = 0;
+                bt = 0;
+            }
+        }
+    }
+    else if ((state->bpp%8)==0)
+    {
+        /* sampling required */
+        if (state->alpha)
+        {
+            for (i = 0; i < state->width; i++)
+            {
+                int in_offset_scaled = (y_offset/state->image->comps[state->alpha_comp].dy*state->width + i)/state->image->comps[state->alpha_comp].dx;
+                for (b=0; b<bytepp1; b++)
+                    *row++ = (((state->image->comps[state->alpha_comp].data[in_offset_scaled] << shift_bit) >> (8*(bytepp1-b-1))))
+                                                             + (b==0 ? state->sign_comps[state->alpha_comp] : 0);
+            }
+        }
+        else
+        {
+            for (i = 0; i < state->width; i++)
+            {
+                for (compno=0; compno<img_numcomps; compno++)
+                {
+                    int in_offset_scaled = (y_offset/state->image->comps[compno].dy*state->width + i)/state->image->comps[compno].dx;
+                    for (b=0; b<bytepp1; b++)
+                        *row++ = (((state->image->comps[compno].data[in_offset_scaled] << shift_bit) >> (8*(bytepp1-b-1))))
+                                                                        + (b==0 ? state->sign_comps[compno] : 0);
+                }
+            }
+        }
+    }
+    else
+    {
+        int compno = state->alpha ? state->alpha_comp : 0;
+        int bt=0;
+        int ppbyte1 = 8/state->bpp;
+        /* sampling required */
+        /* only grayscale can have such bit-depth, also shift_bit = 0, bpp < 8 */
+        for (i = 0; i < state->width; i++)
+        {
+            for (b=0; b<ppbyte1; b++)
+            {
+                int in_offset_scaled = (y_offset/state->image->comps[compno].dy*state->width + i)/state->image->comps[compno].dx;
+                bt = bt<<state->bpp;
+                bt += state->image->comps[compno].data[in_offset_scaled] + state->sign_comps[compno];
+            }
+            *row++ = bt;
+        }
     }
 
-    return 0;
+    if (state->image->color_space == OPJ_CLRSPC_SYCC || state->image->color_space == OPJ_CLRSPC_EYCC)
+    {
+        /* bpp >= 8 always, as bpp < 8 only for grayscale */
+        if (state->bpp == 8)
+            ycc_to_rgb_8(state->row_data, row_size);
+        else
+            ycc_to_rgb_16(state->row_data, row_size);
+    }
 }
 
 static int process_one_trunk(stream_jpxd_state * const state, stream_cursor_write * pw)
 {
     /* read data from image to pw */
     unsigned long out_size = pw->limit - pw->ptr;
-    int bytepp1 = state->bpp/8; /* bytes / pixel for one output component */
     int bytepp = state->out_numcomps*state->bpp/8; /* bytes / pixel all components */
     unsigned long write_size = min(out_size-(bytepp?(out_size%bytepp):0), state->totalbytes-state->out_offset);
-    int shift_bit = state->bpp-state->image->comps[0].prec; /*difference between input and output bit-depth*/
-    int img_numcomps = min(state->out_numcomps, state->image->numcomps); /* the actual number of channel data used */
-    int compno;
     unsigned long i;
-    int b;
-    byte *row;
     unsigned int x_offset;
     unsigned int y_offset;
     unsigned int row_size = (state->width * state->out_numcomps * state->bpp + 7)>>3;
@@ -542,123 +1029,7 @@ static int process_one_trunk(stream_jpxd_state * const state, stream_cursor_writ
         if (x_offset == 0)
         {
             /* Decode another rows worth */
-            row = state->row_data;
-            if (state->alpha && state->alpha_comp == -1)
-            {
-                /* return 0xff for all */
-                memset(row, 0xff, row_size);
-            }
-            else if (state->samescale)
-            {
-                if (state->alpha)
-                    state->pdata[0] = &(state->image->comps[state->alpha_comp].data[y_offset * state->width]);
-                else
-                {
-                    for (compno=0; compno<img_numcomps; compno++)
-                        state->pdata[compno] = &(state->image->comps[compno].data[y_offset * state->width]);
-                }
-                if (shift_bit == 0 && state->bpp == 8) /* optimized for the most common case */
-                {
-                    for (i = state->width; i > 0; i--)
-                        for (compno=0; compno<img_numcomps; compno++)
-                            *row++ = *(state->pdata[compno]++) + state->sign_comps[compno]; /* copy input buffer to output */
-                }
-                else if ((state->bpp%8)==0)
-                {
-                    for (i = state->width; i > 0; i--)
-                    {
-                        for (compno=0; compno<img_numcomps; compno++)
-                        {
-                            for (b=0; b<bytepp1; b++)
-                                *row++ = (((*(state->pdata[compno]) << shift_bit) >> (8*(bytepp1-b-1))))
-                                                        + (b==0 ? state->sign_comps[compno] : 0); /* split and shift input int to output bytes */
-                            state->pdata[compno]++; 
-                        }
-                    }
-                }
-                else
-                {   
-                    /* shift_bit = 0, bpp < 8 */
-                    int bt=0;
-                    int bit_pos = 0;
-                    for (i = state->width; i > 0; i--)
-                    {
-                        for (compno=0; compno<img_numcomps; compno++)
-                        {
-                            bt <<= state->bpp;
-                            bt += *(state->pdata[compno]++) + state->sign_comps[compno];
-                            bit_pos += state->bpp;
-                            if (bit_pos >= 8)
-                            {
-                                *row++ = bt >> (bit_pos-8);
-                                bit_pos -= 8;
-                                bt &= (1<<bit_pos)-1;
-                            }
-                        }
-                    }
-                    if (bit_pos != 0)
-                    {
-                        /* row padding */
-                        *row++ = bt << (8 - bit_pos);
-                        bit_pos = 0;
-                        bt = 0;
-                    }
-                }
-            }
-            else if ((state->bpp%8)==0)
-            {
-                /* sampling required */
-                if (state->alpha)
-                {
-                    for (i = 0; i < state->width; i++)
-                    {
-                        int in_offset_scaled = (y_offset/state->image->comps[state->alpha_comp].dy*state->width + i)/state->image->comps[state->alpha_comp].dx;
-                        for (b=0; b<bytepp1; b++)
-                            *row++ = (((state->image->comps[state->alpha_comp].data[in_offset_scaled] << shift_bit) >> (8*(bytepp1-b-1))))
-                                                                     + (b==0 ? state->sign_comps[state->alpha_comp] : 0);
-                    }
-                }
-                else
-                {
-                    for (i = 0; i < state->width; i++)
-                    {
-                        for (compno=0; compno<img_numcomps; compno++)
-                        {
-                            int in_offset_scaled = (y_offset/state->image->comps[compno].dy*state->width + i)/state->image->comps[compno].dx;
-                            for (b=0; b<bytepp1; b++)
-                                *row++ = (((state->image->comps[compno].data[in_offset_scaled] << shift_bit) >> (8*(bytepp1-b-1))))
-                                                                                + (b==0 ? state->sign_comps[compno] : 0);
-                        }
-                    }
-                }
-            }
-            else
-            {
-                int compno = state->alpha ? state->alpha_comp : 0;
-                int bt=0;
-                int ppbyte1 = 8/state->bpp;
-                /* sampling required */
-                /* only grayscale can have such bit-depth, also shift_bit = 0, bpp < 8 */
-                for (i = 0; i < state->width; i++)
-                {
-                    for (b=0; b<ppbyte1; b++)
-                    {
-                        int in_offset_scaled = (y_offset/state->image->comps[compno].dy*state->width + i)/state->image->comps[compno].dx;
-                        bt = bt<<state->bpp;
-                        bt += state->image->comps[compno].data[in_offset_scaled] + state->sign_comps[compno];
-                    }
-                    *row++ = bt;
-                }
-            }
-
-            if (state->image->color_space == OPJ_CLRSPC_SYCC || state->image->color_space == OPJ_CLRSPC_EYCC)
-            {
-                /* bpp >= 8 always, as bpp < 8 only for grayscale */
-                if (state->bpp == 8)
-                    ycc_to_rgb_8(state->row_data, row_size);
-                else
-                    ycc_to_rgb_16(state->row_data, row_size);
-            }
+            jpxd_fill_row(state, y_offset);
         }
 
         pw->ptr++;
@@ -678,6 +1049,50 @@ static int process_one_trunk(stream_jpxd_state * const state, stream_cursor_writ
         return 1; /* need more calls */
 }
 
+/*
+ * Like process_one_trunk, but keeping only the bytes of the reduced image
+ * we promised, treating the data as rows of reduce_width samples (as the
+ * client does), whatever the decoded image actually looks like.
+ */
+static int process_decimated(stream_jpxd_state * const state, stream_cursor_write * pw)
+{
+    unsigned int row_size = (state->width * state->out_numcomps * state->bpp + 7)>>3;
+    unsigned long client_row = (unsigned long)state->reduce_width * state->reduce_comps;
+    unsigned long end = client_row * ((state->reduce_height - 1) / state->reduce * state->reduce + 1);
+    unsigned int x_offset;
+
+    if (row_size == 0)
+        return EOFC;
+    if (state->row_data == NULL)
+    {
+        state->row_data = gs_alloc_byte_array(state->memory->non_gc_memory, row_size, 1, "jpxd_openjpeg(row_data)");
+        if (state->row_data == NULL)
+            return gs_error_VMerror;
+    }
+
+    while (state->out_offset != state->totalbytes && state->decimate_pos < end)
+    {
+        x_offset = state->out_offset % row_size;
+        if (x_offset == 0)
+            jpxd_fill_row(state, state->out_offset / row_size);
+        for (; x_offset < row_size && state->decimate_pos < end; x_offset++)
+        {
+            unsigned long pos = state->decimate_pos;
+
+            if ((pos / client_row) % state->reduce == 0 &&
+                (pos % client_row) / state->reduce_comps % state->reduce == 0)
+            {
+                if (pw->ptr == pw->limit)
+                    return 1; /* need more calls */
+                *++(pw->ptr) = state->row_data[x_offset];
+            }
+            state->decimate_pos++;
+            state->out_offset++;
+        }
+    }
+    return EOFC;
+}
+
 /* process a section of the input and return any decoded data.
    see strimpl.h for return codes.
  */
@@ -687,16 +1102,11 @@ s_opjd_process(stream_state * ss, stream_cursor_read * pr,
 {
     stream_jpxd_state *const state = (stream_jpxd_state *) ss;
     long in_size = pr->limit - pr->ptr;
-    int locked = 0;
     int code;
 
     if (in_size > 0) 
     {
         /* buffer available data */
-        code = opj_lock(ss->memory);
-        if (code < 0) return code;
-        locked = 1;
-
         code = s_opjd_accumulate_input(state, pr);
         if (code < 0) return code;
 
@@ -708,10 +1118,7 @@ s_opjd_process(stream_state * ss, stream_cursor_read * pr,
             else
                 code = s_opjd_set_codec_format(ss, OPJ_CODEC_JP2);
             if (code < 0)
-            {
-                (void)opj_unlock(ss->memory);
                 return code;
-            }
         }
     }
 
@@ -721,41 +1128,19 @@ s_opjd_process(stream_state * ss, stream_cursor_read * pr,
         {
             int ret;
 
-            if (locked == 0)
-            {
-                ret = opj_lock(ss->memory);
-                if (ret < 0) return ret;
-                locked = 1;
-            }
-
-#if OPJ_VERSION_MAJOR >= 2 && OPJ_VERSION_MINOR >= 1
-            opj_stream_set_user_data(state->stream, &(state->sb), NULL);
-#else
-            opj_stream_set_user_data(state->stream, &(state->sb));
-#endif
-            opj_stream_set_user_data_length(state->stream, state->sb.size);
+            jpxd_set_stream_input(state->stream, &(state->sb));
             ret = decode_image(state);
             if (ret != 0)
-            {
-                (void)opj_unlock(ss->memory);
                 return ret;
-            }
-        }
-
-        if (locked)
-        {
-            code = opj_unlock(ss->memory);
-            if (code < 0) return code;
         }
 
         /* copy out available data */
+        if (state->decimate)
+            return process_decimated(state, pw);
         return process_one_trunk(state, pw);
 
     }
 
-    if (locked)
-        return opj_unlock(ss->memory);
-
     /* ask for more data */
     return 0;
 }
@@ -781,7 +1166,8 @@ s_opjd_release(stream_state *ss)
     if (state->codec == NULL)
         return;
 
-    (void)opj_lock(ss->memory);
+    /* free the areas decoded on other threads */
+    jpxd_free_parts(state);
 
     /* free image data structure */
     if (state->image)
@@ -795,8 +1181,6 @@ s_opjd_release(stream_state *ss)
     if (state->codec)
 	opj_destroy_codec(state->codec);
 
-    (void)opj_unlock(ss->memory);
-
     /* free input buffer */
     if (state->sb.data)
         gs_free_object(state->memory->non_gc_memory, state->sb.data, "s_opjd_release(sb.data)");
@@ -848,6 +1232,42 @@ s_opjd_accumulate_input(stream_jpxd_state *state, stream_cursor_read * pr)
     return 0;
 }
 
+/*
+ * Deliver the image reduced (see strimpl.h), by discarding resolution
+ * levels, and decode only the visible area, on several threads if we may.
+ * We can't check the codestream against what the client expects until we
+ * have all of it; if it doesn't match, we decode it all and drop samples
+ * to produce the promised layout.
+ */
+static int
+s_opjd_reduce(stream_state * ss, const stream_reduce_request *req)
+{
+    stream_jpxd_state *const state = (stream_jpxd_state *) ss;
+    int factor = 1;
+
+    if (state->codec != NULL || state->sb.fill != 0 || state->alpha ||
+        state->colorspace == gs_jpx_cs_indexed ||
+        req->width <= 0 || req->height <= 0 ||
+        (req->num_comps != 1 && req->num_comps != 3 && req->num_comps != 4))
+        return 1;
+    while (factor < 32 && factor * 2 <= req->max_factor)
+        factor *= 2;
+    if (factor == 1 && req->num_threads == 0 &&
+        req->visible.p.x <= 0 && req->visible.p.y <= 0 &&
+        req->visible.q.x >= req->width && req->visible.q.y >= req->height)
+        return 1; /* Nothing to gain. */
+    state->reduce = factor;
+    state->reduce_width = req->width;
+    state->reduce_height = req->height;
+    state->reduce_comps = req->num_comps;
+    state->visible.p.x = max(req->visible.p.x, 0);
+    state->visible.p.y = max(req->visible.p.y, 0);
+    state->visible.q.x = min(req->visible.q.x, req->width);
+    state->visible.q.y = min(req->visible.q.y, req->height);
+    state->num_threads = max(req->num_threads, 0);
+    return factor;
+}
+
 /* stream template */
 const stream_template s_jpxd_template = {
     &st_jpxd_state,
@@ -856,5 +1276,7 @@ const stream_template s_jpxd_template = {
     1024, 1024,   /* min in and out buffer sizes we can handle
                      should be ~32k,64k for efficiency? */
     s_opjd_release,
-    s_opjd_set_defaults
+    s_opjd_set_defaults,
+    NULL,
+    s_opjd_reduce
 };
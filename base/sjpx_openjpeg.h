@@ -68,6 +68,24 @@ typedef struct stream_jpxd_state_s
     int *sign_comps; /* compensate for signed data (signed => unsigned) */
 
     unsigned char *row_data;
+
+    /* Reduction requested through the template's reduce procedure */
+    int reduce;			/* 0 if none, else the factor promised */
+    int reduce_width;		/* The image size the client expects */
+    int reduce_height;
+    int reduce_comps;
+    gs_int_rect visible;	/* The samples the client can see */
+    int num_threads;		/* Threads we may use besides our own */
+
+    OPJ_CODEC_FORMAT format;
+    bool placed;		/* Decoded as the client asked, see decode_placed */
+    int levels;			/* Resolution levels discarded, */
+    int step;			/* then samples kept in each direction */
+    int image_x0, image_y0;	/* Image origin at the decoded resolution */
+    int num_parts;
+    struct jpxd_part_s *parts;	/* Areas decoded separately */
+    bool decimate;		/* Sample the full size image ourselves */
+    unsigned long decimate_pos;	/* Offset in the full size image */
 } stream_jpxd_state;
 
 extern const stream_template s_jpxd_template;
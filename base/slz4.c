@@ -0,0 +1,344 @@
+/* Copyright (C) 2001-2018 Artifex Software, Inc.
+   All Rights Reserved.
+
+   This software is provided AS-IS with no warranty, either express or
+   implied.
+
+   This software is distributed under license and may not be copied,
+   modified or distributed except as expressly authorized under the terms
+   of the license contained in the file LICENSE in this distribution.
+
+   Refer to licensing information at http://www.artifex.com or contact
+   Artifex Software, Inc.,  1305 Grant Avenue - Suite 200, Novato,
+   CA 94945, U.S.A., +1(415)492-9861, for further information.
+*/
+
+
+/* LZ4 block compression filters */
+#include "memory_.h"
+#include "stdint_.h"
+#include "strimpl.h"
+#include "slz4x.h"
+
+/*
+ * The block format is the one described by the LZ4 project: a sequence of
+ * (literals, match) pairs, each introduced by a token byte holding the
+ * literal count in the high nibble and the match length - 4 in the low
+ * nibble, with 15 meaning "more length bytes follow".  Each literal run is
+ * followed by a 2 byte offset (low byte first) back to the match.  The
+ * last sequence has literals only.  Matches must end at least
+ * LZ4_LAST_LITERALS bytes before the end of the block, and must start at
+ * least LZ4_MF_LIMIT bytes before it.
+ *
+ * The encoder is a single pass greedy matcher using a hash of the next 4
+ * bytes.  Blocks never exceed 64K, so the hash table can hold 16 bit
+ * positions relative to the start of the block.
+ */
+
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5
+#define LZ4_MF_LIMIT 12
+
+private_st_LZ4_state();
+
+static inline uint32_t
+lz4_read32(const byte *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+        ((uint32_t)p[3] << 24);
+}
+
+static inline uint
+lz4_hash(const byte *p)
+{
+    return (uint)(((lz4_read32(p) * 2654435761U) & 0xffffffff) >>
+                  (32 - LZ4_HASH_LOG));
+}
+
+/* Write the continuation bytes of a literal or match length. */
+static inline byte *
+lz4_put_length(byte *op, uint len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (byte)len;
+    return op;
+}
+
+/* Compress n bytes from src to dst, returning the compressed size. */
+/* dst must have room for LZ4_COMPRESS_BOUND(n) bytes. */
+static uint
+lz4_compress_block(ushort *table, const byte *src, uint n, byte *dst)
+{
+    const byte *ip = src;
+    const byte *anchor = src;
+    const byte *const iend = src + n;
+    const byte *const mflimit = iend - LZ4_MF_LIMIT;
+    const byte *const matchlimit = iend - LZ4_LAST_LITERALS;
+    byte *op = dst;
+    uint lit;
+
+    if (n > LZ4_MF_LIMIT) {
+        memset(table, 0, sizeof(ushort) << LZ4_HASH_LOG);
+        ip++;
+        while (ip < mflimit) {
+            uint h = lz4_hash(ip);
+            const byte *ref = src + table[h];
+            const byte *mp;
+            uint mlen;
+            byte *token;
+
+            table[h] = (ushort)(ip - src);
+            if (lz4_read32(ref) != lz4_read32(ip)) {
+                /* Skip faster through data that doesn't match. */
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+            while (ip > anchor && ref > src && ip[-1] == ref[-1])
+                ip--, ref--;
+            mp = ip + LZ4_MIN_MATCH;
+            ref += LZ4_MIN_MATCH;
+            while (mp < matchlimit && *mp == *ref)
+                mp++, ref++;
+            lit = ip - anchor;
+            mlen = mp - ip - LZ4_MIN_MATCH;
+            token = op++;
+            if (lit >= 15) {
+                *token = 15 << 4;
+                op = lz4_put_length(op, lit - 15);
+            } else
+                *token = (byte)(lit << 4);
+            memcpy(op, anchor, lit);
+            op += lit;
+            *op++ = (byte)(mp - ref);
+            *op++ = (byte)((mp - ref) >> 8);
+            if (mlen >= 15) {
+                *token |= 15;
+                op = lz4_put_length(op, mlen - 15);
+            } else
+                *token |= (byte)mlen;
+            ip = anchor = mp;
+            if (ip < mflimit)
+                table[lz4_hash(ip - 2)] = (ushort)(ip - 2 - src);
+        }
+    }
+    lit = iend - anchor;
+    if (lit >= 15) {
+        *op++ = 15 << 4;
+        op = lz4_put_length(op, lit - 15);
+    } else
+        *op++ = (byte)(lit << 4);
+    memcpy(op, anchor, lit);
+    op += lit;
+    return op - dst;
+}
+
+/* Decompress n bytes from src to dst, returning the decompressed size, */
+/* or -1 if the data is malformed or would overflow dst_size. */
+static int
+lz4_decompress_block(const byte *src, uint n, byte *dst, uint dst_size)
+{
+    const byte *ip = src;
+    const byte *const iend = src + n;
+    byte *op = dst;
+    byte *const oend = dst + dst_size;
+
+    for (;;) {
+        uint token, len, offset;
+        const byte *ref;
+
+        if (ip >= iend)
+            return -1;
+        token = *ip++;
+        len = token >> 4;
+        if (len == 15) {
+            uint b;
+
+            do {
+                if (ip >= iend)
+                    return -1;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        if (len > iend - ip || len > oend - op)
+            return -1;
+        memcpy(op, ip, len);
+        op += len;
+        ip += len;
+        if (ip == iend)
+            break;
+        if (iend - ip < 2)
+            return -1;
+        offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op - dst)
+            return -1;
+        len = token & 15;
+        if (len == 15) {
+            uint b;
+
+            do {
+                if (ip >= iend)
+                    return -1;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += LZ4_MIN_MATCH;
+        if (len > oend - op)
+            return -1;
+        ref = op - offset;
+        if (offset >= len) {
+            memcpy(op, ref, len);
+            op += len;
+        } else {
+            /* Overlapping copy: replicate the pattern byte by byte. */
+            while (len--)
+                *op++ = *ref++;
+        }
+    }
+    return op - dst;
+}
+
+/* Deliver as much of out_buf as will fit.  Return 1 if some is left. */
+static int
+s_LZ4_flush(stream_LZ4_state *ss, stream_cursor_write *pw)
+{
+    uint count = ss->out_count - ss->out_pos;
+    uint wcount = pw->limit - pw->ptr;
+
+    if (count > wcount)
+        count = wcount;
+    memcpy(pw->ptr + 1, ss->out_buf + ss->out_pos, count);
+    pw->ptr += count;
+    ss->out_pos += count;
+    return ss->out_pos < ss->out_count;
+}
+
+/* ------ LZ4Encode ------ */
+
+static int
+s_LZ4_init(stream_state * st)
+{
+    stream_LZ4_state *const ss = (stream_LZ4_state *)st;
+
+    ss->in_count = 0;
+    ss->out_pos = ss->out_count = 0;
+    ss->finished = false;
+    return 0;
+}
+
+/* Compress the contents of in_buf into out_buf. */
+static void
+s_LZ4E_block(stream_LZ4_state *ss, bool last)
+{
+    byte *header = ss->out_buf;
+    uint count = lz4_compress_block(ss->table, ss->in_buf, ss->in_count,
+                                    header + LZ4_HEADER_SIZE);
+
+    header[0] = (last ? LZ4_BLOCK_LAST : 0);
+    if (count >= ss->in_count) {
+        header[0] |= LZ4_BLOCK_STORED;
+        count = ss->in_count;
+        memcpy(header + LZ4_HEADER_SIZE, ss->in_buf, count);
+    }
+    header[1] = (byte)count;
+    header[2] = (byte)(count >> 8);
+    ss->out_pos = 0;
+    ss->out_count = LZ4_HEADER_SIZE + count;
+    ss->in_count = 0;
+    ss->finished = last;
+}
+
+static int
+s_LZ4E_process(stream_state * st, stream_cursor_read * pr,
+               stream_cursor_write * pw, bool last)
+{
+    stream_LZ4_state *const ss = (stream_LZ4_state *)st;
+
+    for (;;) {
+        uint count;
+
+        if (s_LZ4_flush(ss, pw))
+            return 1;
+        if (ss->finished)
+            return 0;
+        count = pr->limit - pr->ptr;
+        if (count > LZ4_BLOCK_SIZE - ss->in_count)
+            count = LZ4_BLOCK_SIZE - ss->in_count;
+        memcpy(ss->in_buf + ss->in_count, pr->ptr + 1, count);
+        pr->ptr += count;
+        ss->in_count += count;
+        if (ss->in_count == LZ4_BLOCK_SIZE)
+            s_LZ4E_block(ss, last && pr->ptr == pr->limit);
+        else if (last)
+            s_LZ4E_block(ss, true);
+        else
+            return 0;
+    }
+}
+
+const stream_template s_LZ4E_template = {
+    &st_LZ4_state, s_LZ4_init, s_LZ4E_process, 1, 1, NULL,
+    NULL, s_LZ4_init
+};
+
+/* ------ LZ4Decode ------ */
+
+static int
+s_LZ4D_process(stream_state * st, stream_cursor_read * pr,
+               stream_cursor_write * pw, bool last)
+{
+    stream_LZ4_state *const ss = (stream_LZ4_state *)st;
+
+    for (;;) {
+        uint need, count, length;
+        const byte *header = ss->in_buf;
+        bool have_header = ss->in_count >= LZ4_HEADER_SIZE;
+
+        if (s_LZ4_flush(ss, pw))
+            return 1;
+        if (ss->finished)
+            return EOFC;
+        /* Collect the header, then the payload it describes. */
+        need = LZ4_HEADER_SIZE;
+        if (have_header) {
+            length = header[1] | (header[2] << 8);
+            if (length > LZ4_COMPRESS_BOUND(LZ4_BLOCK_SIZE) ||
+                ((header[0] & LZ4_BLOCK_STORED) && length > LZ4_BLOCK_SIZE))
+                return ERRC;
+            need += length;
+        }
+        count = pr->limit - pr->ptr;
+        if (count > need - ss->in_count)
+            count = need - ss->in_count;
+        memcpy(ss->in_buf + ss->in_count, pr->ptr + 1, count);
+        pr->ptr += count;
+        ss->in_count += count;
+        if (ss->in_count < need)
+            return 0;		/* need more input */
+        if (!have_header)
+            continue;		/* header complete, now the payload */
+        length = need - LZ4_HEADER_SIZE;
+        if (header[0] & LZ4_BLOCK_STORED) {
+            memcpy(ss->out_buf, header + LZ4_HEADER_SIZE, length);
+            ss->out_count = length;
+        } else {
+            int code = lz4_decompress_block(header + LZ4_HEADER_SIZE, length,
+                                            ss->out_buf, LZ4_BLOCK_SIZE);
+
+            if (code < 0)
+                return ERRC;
+            ss->out_count = code;
+        }
+        ss->out_pos = 0;
+        ss->in_count = 0;
+        ss->finished = (header[0] & LZ4_BLOCK_LAST) != 0;
+    }
+}
+
+const stream_template s_LZ4D_template = {
+    &st_LZ4_state, s_LZ4_init, s_LZ4D_process, 1, 1, NULL,
+    NULL, s_LZ4_init
+};
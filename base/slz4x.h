@@ -0,0 +1,59 @@
+/* Copyright (C) 2001-2018 Artifex Software, Inc.
+   All Rights Reserved.
+
+   This software is provided AS-IS with no warranty, either express or
+   implied.
+
+   This software is distributed under license and may not be copied,
+   modified or distributed except as expressly authorized under the terms
+   of the license contained in the file LICENSE in this distribution.
+
+   Refer to licensing information at http://www.artifex.com or contact
+   Artifex Software, Inc.,  1305 Grant Avenue - Suite 200, Novato,
+   CA 94945, U.S.A., +1(415)492-9861, for further information.
+*/
+
+
+/* Definitions for LZ4 filters */
+/* Requires strimpl.h */
+
+#ifndef slz4x_INCLUDED
+#  define slz4x_INCLUDED
+
+/*
+ * These filters are used for compressing band lists in memory, where
+ * speed matters much more than ratio.  The data is cut into blocks of
+ * at most LZ4_BLOCK_SIZE bytes, each compressed independently in the LZ4
+ * block format.  Every block is preceded by a 3 byte header: a flags byte
+ * and the payload length (low byte first).  A block that does not
+ * compress is stored as is.  The last block of the data carries
+ * LZ4_BLOCK_LAST, so the decoder knows where the data ends without any
+ * help from its caller.
+ */
+#define LZ4_BLOCK_SIZE 16384
+#define LZ4_HASH_LOG 12
+#define LZ4_HEADER_SIZE 3
+#define LZ4_BLOCK_STORED 1
+#define LZ4_BLOCK_LAST 2
+/* The worst case size of a compressed block of n bytes. */
+#define LZ4_COMPRESS_BOUND(n) ((n) + (n) / 255 + 16)
+#define LZ4_BUFFER_SIZE (LZ4_HEADER_SIZE + LZ4_COMPRESS_BOUND(LZ4_BLOCK_SIZE))
+
+typedef struct stream_LZ4_state_s {
+    stream_state_common;
+    /* The following are updated dynamically. */
+    uint in_count;		/* # of bytes in in_buf */
+    uint out_pos;		/* # of bytes of out_buf already delivered */
+    uint out_count;		/* # of bytes in out_buf */
+    bool finished;		/* last block is in out_buf */
+    ushort table[1 << LZ4_HASH_LOG];	/* encoding only */
+    byte in_buf[LZ4_BUFFER_SIZE];	/* encode: raw; decode: header + payload */
+    byte out_buf[LZ4_BUFFER_SIZE];	/* encode: header + payload; decode: raw */
+} stream_LZ4_state;
+
+#define private_st_LZ4_state()	/* in slz4.c */\
+  gs_private_st_simple(st_LZ4_state, stream_LZ4_state, "LZ4 state")
+extern const stream_template s_LZ4E_template;
+extern const stream_template s_LZ4D_template;
+
+#endif /* slz4x_INCLUDED */
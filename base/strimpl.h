@@ -113,6 +113,30 @@
  * the last byte of data" (per Adobe specification), as noted above.
  */
 
+/*
+ * The optional reduce procedure lets the client of a filter that decodes
+ * an image ask for that image at a reduced size, when the filter can
+ * produce it more cheaply than the full size image.  The request gives the
+ * width and height (in samples) and the number of (8-bit) components the
+ * client expects the full size image to have, and the largest power of 2
+ * by which the client can accept the image being reduced.  The procedure
+ * returns the factor it will actually reduce the image by (1 if it won't);
+ * a width x height image then comes out as
+ * (width + factor - 1) / factor x (height + factor - 1) / factor samples.
+ * The request also says which samples of the full size image can actually
+ * be seen (the filter may return anything for the others), and how many
+ * threads besides its own the filter may use to decode the image; filters
+ * are free to ignore both.  The procedure may only be called before any
+ * data has been read from the stream.
+ */
+struct stream_reduce_request_s {
+    int width, height;		/* full size image, in samples */
+    int num_comps;
+    int max_factor;
+    gs_int_rect visible;	/* in full size image samples */
+    int num_threads;
+};
+
 /*
  * Define a template for creating a stream.
  *
@@ -149,6 +173,9 @@ struct stream_template_s {
     /* Define an optional reinitialization procedure. */
     stream_proc_reinit((*reinit));
 
+    /* Define an optional image reduction procedure. */
+    stream_proc_reduce((*reduce));
+
 };
 
 /* Utility procedures */
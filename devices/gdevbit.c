@@ -313,6 +313,7 @@ const gx_device_bit gs_bitrgbtags_device =
         0,  /*band_offset_x*/
         0,  /*band_offset_y*/
         false, /*BLS_force_memory*/
+        false, /*BLC_lz4*/
         {false}, /*sgr*/
         0, /*MaxPatternBitmap*/
         0, /*page_uses_transparency*/
@@ -354,6 +355,8 @@ const gx_device_bit gs_bitrgbtags_device =
         NULL,  /* bandlist_memory */
         0,     /* clist_disable_mask */
         false, /* bg_print_requested */
+        1,     /* bg_print_pages_requested */
+        PRN_BG_PRINT_MEMORY, /* bg_print_memory_requested */
         {0},   /* bg_print */
         0,     /* num_render_threads_requested */
         NULL,  /* saved_pages_list */
@@ -49,12 +49,14 @@
  */
 /*#define PNG_NO_STDIO*/
 #include "png_.h"
+#include "zlib.h"
 
 #include "gdevprn.h"
 #include "gdevmem.h"
 #include "gdevpccm.h"
 #include "gscdefs.h"
 #include "gxdownscale.h"
+#include "gxdevsop.h"
 
 /* ------ The device descriptors ------ */
 
@@ -66,6 +68,8 @@
 
 static dev_proc_print_page(png_print_page);
 static dev_proc_print_page(png_print_page_monod);
+static dev_proc_open_device(png_open_downscale);
+static dev_proc_dev_spec_op(png_dev_spec_op);
 static dev_proc_open_device(pngalpha_open);
 static dev_proc_encode_color(pngalpha_encode_color);
 static dev_proc_decode_color(pngalpha_decode_color);
@@ -135,7 +139,7 @@ const gx_device_png gs_png256_device = {
 
 /* Since the print_page doesn't alter the device, this device can print in the background */
 static const gx_device_procs pnggray_procs =
-prn_color_params_procs(gdev_prn_open, gdev_prn_bg_output_page, gdev_prn_close,
+prn_color_params_procs(png_open_downscale, gdev_prn_bg_output_page, gdev_prn_close,
                        gx_default_gray_map_rgb_color,
                        gx_default_gray_map_color_rgb,
                        png_get_params_downscale, png_put_params_downscale);
@@ -170,7 +174,7 @@ const gx_device_png gs_pngmonod_device =
 
 /* Since the print_page doesn't alter the device, this device can print in the background */
 static const gx_device_procs png16m_procs =
-prn_color_params_procs(gdev_prn_open, gdev_prn_bg_output_page, gdev_prn_close,
+prn_color_params_procs(png_open_downscale, gdev_prn_bg_output_page, gdev_prn_close,
                        gx_default_rgb_map_rgb_color,
                        gx_default_rgb_map_color_rgb,
                        png_get_params_downscale, png_put_params_downscale);
@@ -280,7 +284,8 @@ static const gx_device_procs pngalpha_procs =
         pngalpha_fillpage,
         NULL,	/* push_transparency_state */
         NULL,	/* pop_transparency_state */
-        pngalpha_put_image
+        pngalpha_put_image,
+        png_dev_spec_op
 };
 
 const gx_device_pngalpha gs_pngalpha_device = {
@@ -383,6 +388,27 @@ png_put_params_downscale_mfs(gx_device *dev, gs_param_list *plist)
     return ecode;
 }
 
+/* The banded output (see below) needs every band to hold a whole number of
+ * downscaled lines. */
+static int
+png_dev_spec_op(gx_device *pdev, int dev_spec_op, void *data, int size)
+{
+    gx_device_png *ppdev = (gx_device_png *)pdev;
+
+    if (dev_spec_op == gxdso_adjust_bandheight &&
+        ppdev->downscale.downscale_factor > 1)
+        return gx_downscaler_adjust_bandheight(ppdev->downscale.downscale_factor, size);
+
+    return gdev_prn_dev_spec_op(pdev, dev_spec_op, data, size);
+}
+
+static int
+png_open_downscale(gx_device *pdev)
+{
+    set_dev_proc(pdev, dev_spec_op, png_dev_spec_op);
+    return gdev_prn_open(pdev);
+}
+
 #define PNG_MEM_ALIGN 16
 static png_voidp
 gdevpng_malloc(png_structp png, png_size_t size)
@@ -414,6 +440,290 @@ gdevpng_free(png_structp png, png_voidp ptr)
 }
 
 
+/* ------ Banded output ------ */
+
+/*
+ * For 8 bit gray, RGB and RGBA output we don't feed libpng a line at a
+ * time; instead (as in gdevfpng.c) each band is filtered and deflated by
+ * the process_page process_fn, on the rendering threads if we have any.
+ * libpng still writes the header chunks. Each band is compressed as a raw
+ * deflate stream ending in a sync flush, so the bands can simply be
+ * concatenated; the output_fn prefixes the zlib header to the first one,
+ * adds an empty final block and the Adler-32 of the whole image to the
+ * last one, and writes each out as an IDAT chunk.
+ */
+typedef struct png_band_arg_s {
+    FILE *file;
+    int width;              /* Image size; the bands we are given may be */
+    int height;             /* wider, and run further, than this. */
+    int ncomps;
+    bool invert_alpha;
+    int y;                  /* Lines written so far */
+    uLong adler;            /* Checksum of the filtered lines so far */
+} png_band_arg_t;
+
+typedef struct png_band_buffer_s {
+    uint size;              /* Space at data */
+    uint compressed;        /* Bytes of deflated data, at data + 2 */
+    int lines;              /* Lines of the image held */
+    uLong adler;            /* Checksum of those lines, once filtered */
+    byte *line;             /* The filtered line, then 2 lines of scratch
+                             * space for the inverted alpha. */
+    byte data[1];
+} png_band_buffer_t;
+
+/* Room for the zlib header, and for the final block and checksum. */
+#define PNG_BAND_HEAD 2
+#define PNG_BAND_TAIL 6
+
+static int
+png_band_init_buffer(void *arg_, gx_device *dev, gs_memory_t *mem, int w, int h, void **pbuffer)
+{
+    png_band_arg_t *arg = (png_band_arg_t *)arg_;
+    png_band_buffer_t *buffer;
+    ulong linesize = (ulong)w * arg->ncomps + 1;
+    ulong size = deflateBound(NULL, linesize * h) + 5 + PNG_BAND_HEAD + PNG_BAND_TAIL;
+    ulong total = sizeof(png_band_buffer_t) + size + linesize * 3;
+
+    *pbuffer = NULL;
+    if (total > max_uint)
+        return_error(gs_error_VMerror);
+    buffer = (png_band_buffer_t *)gs_alloc_bytes(mem, total, "png_band_init_buffer");
+    if (buffer == NULL)
+        return_error(gs_error_VMerror);
+    buffer->size = size;
+    buffer->compressed = 0;
+    buffer->lines = 0;
+    buffer->line = buffer->data + size;
+    *pbuffer = buffer;
+    return 0;
+}
+
+static void
+png_band_free_buffer(void *arg, gx_device *dev, gs_memory_t *mem, void *buffer)
+{
+    gs_free_object(mem, buffer, "png_band_init_buffer");
+}
+
+static void *
+png_zalloc(void *mem_, unsigned int items, unsigned int size)
+{
+    gs_memory_t *mem = (gs_memory_t *)mem_;
+
+    return gs_alloc_bytes(mem, items * size, "png_zalloc");
+}
+
+static void
+png_zfree(void *mem_, void *address)
+{
+    gs_memory_t *mem = (gs_memory_t *)mem_;
+
+    gs_free_object(mem, address, "png_zalloc");
+}
+
+static inline int
+png_paeth_predict(int a, int b, int c)
+{
+    int pa = any_abs(b - c);
+    int pb = any_abs(a - c);
+    int pc = any_abs(a + b - c - c);
+
+    if (pa <= pb && pa <= pc)
+        return a;
+    if (pb <= pc)
+        return b;
+    return c;
+}
+
+/* Filter n bytes of cur (with bpp bytes per pixel) into out, prefixed by
+ * the filter type: Paeth if we have the line above, otherwise Sub. */
+static void
+png_filter_line(byte *out, const byte *cur, const byte *prev, int n, int bpp)
+{
+    int x;
+
+    if (prev == NULL) {
+        *out++ = 1;
+        for (x = 0; x < bpp; x++)
+            out[x] = cur[x];
+        for (; x < n; x++)
+            out[x] = cur[x] - cur[x - bpp];
+        return;
+    }
+    *out++ = 4;
+    for (x = 0; x < bpp; x++)
+        out[x] = cur[x] - prev[x];
+    for (; x < n; x++)
+        out[x] = cur[x] - png_paeth_predict(cur[x - bpp], prev[x], prev[x - bpp]);
+}
+
+static int
+png_band_process(void *arg_, gx_device *dev, gx_device *bdev, const gs_int_rect *rect, void *buffer_)
+{
+    png_band_arg_t *arg = (png_band_arg_t *)arg_;
+    png_band_buffer_t *buffer = (png_band_buffer_t *)buffer_;
+    int ncomps = arg->ncomps;
+    int w = min(rect->q.x - rect->p.x, arg->width);
+    int h = min(rect->q.y, arg->height) - rect->p.y;
+    int n = w * ncomps;
+    int raster = bitmap_raster(bdev->width * bdev->color_info.depth);
+    gs_get_bits_params_t params;
+    gs_int_rect my_rect;
+    z_stream stream;
+    const byte *src, *prev = NULL;
+    uLong adler = adler32(0L, NULL, 0);
+    int x, y, code, err;
+
+    buffer->compressed = 0;
+    buffer->lines = 0;
+    if (w <= 0 || h <= 0)
+        return 0;
+
+    params.options = GB_COLORS_NATIVE | GB_ALPHA_NONE | GB_PACKING_CHUNKY | GB_RETURN_POINTER | GB_ALIGN_ANY | GB_OFFSET_0 | GB_RASTER_ANY;
+    my_rect.p.x = 0;
+    my_rect.p.y = 0;
+    my_rect.q.x = w;
+    my_rect.q.y = h;
+    code = dev_proc(bdev, get_bits_rectangle)(bdev, &my_rect, &params, NULL);
+    if (code < 0)
+        return code;
+    src = params.data[0];
+
+    stream.zalloc = png_zalloc;
+    stream.zfree = png_zfree;
+    stream.opaque = bdev->memory;
+    /* As libpng would, but without the zlib wrapper. */
+    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8,
+                       Z_FILTERED);
+    if (err != Z_OK)
+        return_error(gs_error_VMerror);
+    stream.next_out = buffer->data + PNG_BAND_HEAD;
+    stream.avail_out = buffer->size - PNG_BAND_HEAD - PNG_BAND_TAIL;
+
+    /* We filter into a separate line, rather than in place, as (when not
+     * banding) the data is the page itself, which we may be asked to print
+     * again. */
+    for (y = 0; y < h; y++, src += raster) {
+        const byte *cur = src;
+
+        if (arg->invert_alpha) {
+            byte *inv = buffer->line + n + 1 + (y & 1) * n;
+
+            for (x = 0; x < n; x += 4) {
+                inv[x] = src[x];
+                inv[x + 1] = src[x + 1];
+                inv[x + 2] = src[x + 2];
+                inv[x + 3] = 0xff - src[x + 3];
+            }
+            cur = inv;
+        }
+        png_filter_line(buffer->line, cur, prev, n, ncomps);
+        adler = adler32(adler, buffer->line, n + 1);
+        stream.next_in = buffer->line;
+        stream.avail_in = n + 1;
+        err = deflate(&stream, (y == h - 1 ? Z_SYNC_FLUSH : Z_NO_FLUSH));
+        if (err != Z_OK || stream.avail_in != 0 || stream.avail_out == 0)
+            break;
+        prev = cur;
+    }
+    deflateEnd(&stream);
+    if (y < h)
+        return_error(gs_error_ioerror);
+
+    buffer->compressed = stream.total_out;
+    buffer->lines = h;
+    buffer->adler = adler;
+    return 0;
+}
+
+static void
+png_put_big32(byte *p, ulong v)
+{
+    p[0] = (byte)(v >> 24);
+    p[1] = (byte)(v >> 16);
+    p[2] = (byte)(v >> 8);
+    p[3] = (byte)v;
+}
+
+static void
+png_putchunk(const char *tag, const byte *data, uint size, FILE *file)
+{
+    byte buf[4];
+    uLong sum = crc32(0L, NULL, 0);
+
+    png_put_big32(buf, size);
+    fwrite(buf, 1, 4, file);
+    fwrite(tag, 1, 4, file);
+    sum = crc32(sum, (const byte *)tag, 4);
+    if (size > 0) {
+        fwrite(data, 1, size, file);
+        sum = crc32(sum, data, size);
+    }
+    png_put_big32(buf, sum);
+    fwrite(buf, 1, 4, file);
+}
+
+static int
+png_band_output(void *arg_, gx_device *dev, void *buffer_)
+{
+    png_band_arg_t *arg = (png_band_arg_t *)arg_;
+    png_band_buffer_t *buffer = (png_band_buffer_t *)buffer_;
+    byte *data = buffer->data + PNG_BAND_HEAD;
+    uint size = buffer->compressed;
+
+    if (buffer->lines == 0)
+        return 0;
+    if (arg->y == 0) {
+        /* Deflate, 32K window, default compression level */
+        data -= 2;
+        data[0] = 0x78;
+        data[1] = 0x9c;
+        size += 2;
+    }
+    arg->adler = adler32_combine(arg->adler, buffer->adler,
+                      (z_off_t)buffer->lines * (arg->width * arg->ncomps + 1));
+    arg->y += buffer->lines;
+    if (arg->y == arg->height) {
+        /* An empty final (fixed Huffman) block, then the checksum */
+        data[size++] = 0x03;
+        data[size++] = 0x00;
+        png_put_big32(data + size, arg->adler);
+        size += 4;
+    }
+    png_putchunk("IDAT", data, size, arg->file);
+    return 0;
+}
+
+static int
+png_print_bands(gx_device_png *pdev, FILE *file, int width, int height,
+                int ncomps, bool invert_alpha, int factor)
+{
+    gx_process_page_options_t process = { 0 };
+    png_band_arg_t arg;
+    int code;
+
+    arg.file = file;
+    arg.width = width;
+    arg.height = height;
+    arg.ncomps = ncomps;
+    arg.invert_alpha = invert_alpha;
+    arg.y = 0;
+    arg.adler = adler32(0L, NULL, 0);
+
+    process.init_buffer_fn = png_band_init_buffer;
+    process.free_buffer_fn = png_band_free_buffer;
+    process.process_fn = png_band_process;
+    process.output_fn = png_band_output;
+    process.arg = &arg;
+
+    code = gx_downscaler_process_page((gx_device *)pdev, &process, factor);
+    if (code >= 0 && arg.y != height)
+        code = gs_note_error(gs_error_unknownerror);
+    if (code >= 0)
+        png_putchunk("IEND", NULL, 0, file);
+    return code;
+}
+
 /* Write out a page in PNG format. */
 /* This routine is used for all formats. */
 static int
@@ -677,24 +987,31 @@ do_png_print_page(gx_device_png * pdev, FILE * file, bool monod)
     info_ptr->text = NULL;
 #endif
 
-    /* For simplicity of code, we always go through the downscaler. For
-     * non-supported depths, it will pass through with minimal performance
-     * hit. So ensure that we only trigger downscales when we need them.
-     */
-    code = gx_downscaler_init(&ds, (gx_device *)pdev, src_bpc, dst_bpc,
-                              depth/dst_bpc, factor, mfs, NULL, 0);
-    if (code >= 0)
-    {
-        /* Write the contents of the image. */
-        for (y = 0; y < height; y++) {
-            gx_downscaler_getbits(&ds, row, y);
-            png_write_rows(png_ptr, &row, 1);
+    if (bit_depth == 8 && color_type != PNG_COLOR_TYPE_PALETTE &&
+        factor <= 8 && height > 0) {
+        /* The image data and the end of the file are all ours. */
+        code = png_print_bands(pdev, file, width, height, depth/8,
+                               depth == 32, factor);
+    } else {
+        /* For simplicity of code, we always go through the downscaler. For
+         * non-supported depths, it will pass through with minimal performance
+         * hit. So ensure that we only trigger downscales when we need them.
+         */
+        code = gx_downscaler_init(&ds, (gx_device *)pdev, src_bpc, dst_bpc,
+                                  depth/dst_bpc, factor, mfs, NULL, 0);
+        if (code >= 0)
+        {
+            /* Write the contents of the image. */
+            for (y = 0; y < height; y++) {
+                gx_downscaler_getbits(&ds, row, y);
+                png_write_rows(png_ptr, &row, 1);
+            }
+            gx_downscaler_fin(&ds);
         }
-        gx_downscaler_fin(&ds);
-    }
 
-    /* write the rest of the file */
-    png_write_end(png_ptr, info_ptr);
+        /* write the rest of the file */
+        png_write_end(png_ptr, info_ptr);
+    }
 
 #if PNG_LIBPNG_VER_MINOR >= 5
 #else
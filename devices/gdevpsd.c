@@ -117,6 +117,8 @@ typedef struct psd_device_s {
 
     bool warning_given;  /* Used to notify the user that max colorants reached */
 
+    int compression;     /* 0 for none, 1 for RLE */
+
 } psd_device;
 
 /* GC procedures */
@@ -695,6 +697,7 @@ static int
 psd_get_params_generic(gx_device * pdev, gs_param_list * plist, int cmyk)
 {
     psd_device *xdev = (psd_device *)pdev;
+    gs_param_string compr;
     int code;
 
     code = gx_devn_prn_get_params(pdev, plist);
@@ -709,6 +712,10 @@ psd_get_params_generic(gx_device * pdev, gs_param_list * plist, int cmyk)
     if (code < 0)
         return code;
     code = param_write_bool(plist, "LockColorants", &xdev->lock_colorants);
+    if (code < 0)
+        return code;
+    param_string_from_string(compr, xdev->compression ? "rle" : "none");
+    code = param_write_string(plist, "Compression", &compr);
     return code;
 }
 
@@ -772,6 +779,7 @@ psd_put_params_generic(gx_device * pdev, gs_param_list * plist, int cmyk)
     psd_device * const pdevn = (psd_device *) pdev;
     int code = 0;
     gs_param_string pcm;
+    gs_param_string compr;
     psd_color_model color_model = pdevn->color_model;
     gx_device_color_info save_info = pdevn->color_info;
 
@@ -807,6 +815,26 @@ psd_put_params_generic(gx_device * pdev, gs_param_list * plist, int cmyk)
             break;
     }
 
+    switch (code = param_read_string(plist, "Compression", &compr)) {
+        case 0:
+            if (param_string_eq(&compr, "none"))
+                pdevn->compression = 0;
+            else if (param_string_eq(&compr, "rle"))
+                pdevn->compression = 1;
+            else {
+                emprintf(pdevn->memory, "Compression must be none or rle\n");
+                code = gs_note_error(gs_error_rangecheck);
+                param_signal_error(plist, "Compression", code);
+                return code;
+            }
+            break;
+        case 1:
+            break;
+        default:
+            param_signal_error(plist, "Compression", code);
+            return code;
+    }
+
     if (code >= 0)
         code = param_read_name(plist, "ProcessColorModel", &pcm);
     if (code == 0) {
@@ -935,6 +963,7 @@ psd_setup(psd_write_ctx *xc, gx_devn_prn_device *dev, FILE *file, int w, int h)
     }
     xc->width = w;
     xc->height = h;
+    xc->compression = 0;
     /*
      * Determine the order of the output components.  This is based upon
      * the SeparationOrder parameter.  This parameter can be used to select
@@ -1136,7 +1165,7 @@ psd_write_header(psd_write_ctx *xc, gx_devn_prn_device *pdev)
     /* Layer and Mask information */
     psd_write_32(xc, 0); 	/* No layer or mask information */
 
-    psd_write_16(xc, 0); /* Compression */
+    psd_write_16(xc, (bits16)xc->compression); /* Compression */
 
     return code;
 }
@@ -1167,6 +1196,423 @@ psd_prn_close(gx_device *dev)
     return gdev_prn_close(dev);
 }
 
+/*
+ * RLE image data is the PackBits rows of each channel in turn, preceded by
+ * a table of the compressed length of every row, as a 16 bit big endian
+ * count. We don't know those lengths until we've compressed the rows, so if
+ * we can seek on the output we leave room for the table and come back to it
+ * at the end; otherwise we hold the rows in a scratch file until then.
+ */
+typedef struct psd_rle_s {
+    byte *counts;               /* 2 bytes per row of each channel */
+    uint counts_size;
+    byte *line;                 /* one compressed row, for psd_rle_write_row */
+    int64_t counts_pos;         /* offset of the table in the output, or -1 */
+    FILE *f;                    /* where the rows go until the end */
+    char fname[gp_file_name_sizeof];
+} psd_rle_t;
+
+/* The most a row of width bytes can grow by, PackBits encoded. */
+#define PSD_RLE_MAX_ROW(width) ((width) + ((width) + 127) / 128)
+
+/* PackBits encode a row of n bytes; return the length of the result. */
+static int
+psd_packbits_row(byte *dest, const byte *src, int n)
+{
+    byte *d = dest;
+    int i = 0;
+
+    while (i < n) {
+        int run = 1;
+
+        while (i + run < n && run < 128 && src[i + run] == src[i])
+            run++;
+        if (run >= 3) {
+            *d++ = (byte)(257 - run);
+            *d++ = src[i];
+            i += run;
+        } else {
+            /* Copy literally, up to the next run of 3 or more. */
+            int lit = 0;
+
+            while (i + lit < n && lit < 128 &&
+                   !(i + lit + 2 < n && src[i + lit] == src[i + lit + 1] &&
+                     src[i + lit] == src[i + lit + 2]))
+                lit++;
+            *d++ = (byte)(lit - 1);
+            memcpy(d, src + i, lit);
+            d += lit;
+            i += lit;
+        }
+    }
+    return d - dest;
+}
+
+static int
+psd_copy_file(FILE *from, FILE *to, byte *buf, int size)
+{
+    size_t n;
+
+    if (fseek(from, 0, SEEK_SET) != 0)
+        return_error(gs_error_ioerror);
+    while ((n = fread(buf, 1, size, from)) > 0) {
+        if (fwrite(buf, 1, n, to) != n)
+            return_error(gs_error_ioerror);
+    }
+    return 0;
+}
+
+static void
+psd_rle_free(psd_write_ctx *xc, gs_memory_t *mem, psd_rle_t *rle)
+{
+    if (rle->f != NULL && rle->f != xc->f)
+        fclose(rle->f);
+    rle->f = NULL;
+    gs_free_object(mem, rle->line, "psd_rle_begin(line)");
+    gs_free_object(mem, rle->counts, "psd_rle_begin(counts)");
+    rle->line = rle->counts = NULL;
+}
+
+/* Get ready to write RLE data for num_channels channels. */
+static int
+psd_rle_begin(psd_write_ctx *xc, gs_memory_t *mem, psd_rle_t *rle, int num_channels)
+{
+    ulong size = (ulong)num_channels * xc->height * 2;
+
+    memset(rle, 0, sizeof(*rle));
+    if (size > max_uint)
+        return_error(gs_error_VMerror);
+    rle->counts_size = (uint)size;
+    rle->counts = gs_alloc_bytes(mem, rle->counts_size, "psd_rle_begin(counts)");
+    rle->line = gs_alloc_bytes(mem, PSD_RLE_MAX_ROW(xc->width), "psd_rle_begin(line)");
+    if (rle->counts == NULL || rle->line == NULL) {
+        psd_rle_free(xc, mem, rle);
+        return_error(gs_error_VMerror);
+    }
+    memset(rle->counts, 0, rle->counts_size);
+    rle->counts_pos = gp_ftell_64(xc->f);
+    if (rle->counts_pos >= 0 && gp_fseek_64(xc->f, rle->counts_pos, SEEK_SET) == 0) {
+        rle->f = xc->f;
+        if (fwrite(rle->counts, 1, rle->counts_size, xc->f) != rle->counts_size) {
+            psd_rle_free(xc, mem, rle);
+            return_error(gs_error_ioerror);
+        }
+    } else {
+        rle->counts_pos = -1;
+        rle->f = gp_open_scratch_file_rm(mem, gp_scratch_file_name_prefix,
+                                         rle->fname, "w+b");
+        if (rle->f == NULL) {
+            psd_rle_free(xc, mem, rle);
+            return_error(gs_error_invalidfileaccess);
+        }
+    }
+    return 0;
+}
+
+/* Compress and write row number row (counting through all the channels). */
+static int
+psd_rle_write_row(psd_write_ctx *xc, psd_rle_t *rle, int row, const byte *src)
+{
+    int len = psd_packbits_row(rle->line, src, xc->width);
+
+    rle->counts[row * 2] = (byte)(len >> 8);
+    rle->counts[row * 2 + 1] = (byte)len;
+    if (fwrite(rle->line, 1, len, rle->f) != len)
+        return_error(gs_error_ioerror);
+    return 0;
+}
+
+/* Write the table of row lengths, and the rows if they aren't there yet. */
+static int
+psd_rle_end(psd_write_ctx *xc, psd_rle_t *rle, byte *buf, int size)
+{
+    if (rle->counts_pos >= 0) {
+        if (gp_fseek_64(xc->f, rle->counts_pos, SEEK_SET) != 0 ||
+            fwrite(rle->counts, 1, rle->counts_size, xc->f) != rle->counts_size ||
+            gp_fseek_64(xc->f, 0, SEEK_END) != 0)
+            return_error(gs_error_ioerror);
+        return 0;
+    }
+    if (fwrite(rle->counts, 1, rle->counts_size, xc->f) != rle->counts_size)
+        return_error(gs_error_ioerror);
+    return psd_copy_file(rle->f, xc->f, buf, size);
+}
+
+/*
+ * With the page held as a clist, going through the page a channel at a
+ * time would render the whole of it once for each channel. Instead, we
+ * have process_page render each band once (on the rendering threads, if
+ * there are any), and unpack all its channels there, compressing them too
+ * for RLE. output_fn then puts each channel's rows where they belong. For
+ * raw data on an output we can seek on, that is straight into place. Other
+ * than that, the first channel goes straight to the output (or with RLE,
+ * wherever psd_rle_begin says), and the rest to scratch files that we copy
+ * onto the end of it afterwards (much as gdevcmykog.c does). We only do
+ * this for 8 bit planar data with no downscaling or trapping, and with
+ * every channel imaged.
+ */
+typedef struct psd_band_arg_s {
+    psd_write_ctx *xc;
+    int64_t data_pos;           /* offset of raw data to seek to, or -1 */
+    psd_rle_t rle;
+    FILE *chan_file[GX_DEVICE_COLOR_MAX_COMPONENTS];
+    char chan_name[GX_DEVICE_COLOR_MAX_COMPONENTS][gp_file_name_sizeof];
+} psd_band_arg_t;
+
+typedef struct psd_band_buffer_s {
+    gs_memory_t *memory;
+    int y, h;
+    /*
+     * h rows of each channel in turn. For RLE, this starts with the 2 byte
+     * length of each of those rows, and ends with a row to invert into.
+     */
+    byte *data;
+    uint size;
+    ulong chan_size[GX_DEVICE_COLOR_MAX_COMPONENTS];
+} psd_band_buffer_t;
+
+static int
+psd_band_init_buffer(void *arg, gx_device *dev, gs_memory_t *mem, int w, int h, void **pbuffer)
+{
+    psd_band_buffer_t *buffer;
+
+    buffer = (psd_band_buffer_t *)gs_alloc_bytes(mem, sizeof(*buffer),
+                                                 "psd_band_init_buffer");
+    *pbuffer = buffer;
+    if (buffer == NULL)
+        return_error(gs_error_VMerror);
+    memset(buffer, 0, sizeof(*buffer));
+    buffer->memory = mem;
+    return 0;
+}
+
+static void
+psd_band_free_buffer(void *arg, gx_device *dev, gs_memory_t *mem, void *buffer_)
+{
+    psd_band_buffer_t *buffer = (psd_band_buffer_t *)buffer_;
+
+    if (buffer == NULL)
+        return;
+    gs_free_object(mem, buffer->data, "psd_band_process(data)");
+    gs_free_object(mem, buffer, "psd_band_init_buffer");
+}
+
+static int
+psd_band_process(void *arg_, gx_device *dev, gx_device *bdev, const gs_int_rect *rect, void *buffer_)
+{
+    psd_band_arg_t *arg = (psd_band_arg_t *)arg_;
+    psd_band_buffer_t *buffer = (psd_band_buffer_t *)buffer_;
+    psd_write_ctx *xc = arg->xc;
+    int width = xc->width;
+    int h = min(rect->q.y, xc->height) - rect->p.y;
+    int raster = gx_device_raster_plane(bdev, NULL);
+    int rows = max(h, 0) * xc->num_channels;
+    ulong size;
+    gs_get_bits_params_t params;
+    gs_int_rect my_rect;
+    int chan_idx, i, y, code;
+    byte *dest, *counts = NULL, *line = NULL;
+
+    buffer->h = 0;
+    if (h <= 0)
+        return 0;
+    if (xc->compression)
+        size = (ulong)rows * (2 + PSD_RLE_MAX_ROW(width)) + width;
+    else
+        size = (ulong)rows * width;
+    if (size > buffer->size) {
+        if (size > max_uint)
+            return_error(gs_error_VMerror);
+        gs_free_object(buffer->memory, buffer->data, "psd_band_process(data)");
+        buffer->size = 0;
+        buffer->data = gs_alloc_bytes(buffer->memory, (uint)size, "psd_band_process(data)");
+        if (buffer->data == NULL)
+            return_error(gs_error_VMerror);
+        buffer->size = (uint)size;
+    }
+
+    params.options = GB_COLORS_NATIVE | GB_ALPHA_NONE | GB_PACKING_PLANAR | GB_RETURN_POINTER | GB_ALIGN_ANY | GB_OFFSET_0 | GB_RASTER_ANY;
+    my_rect.p.x = 0;
+    my_rect.p.y = 0;
+    my_rect.q.x = rect->q.x - rect->p.x;
+    my_rect.q.y = h;
+    code = dev_proc(bdev, get_bits_rectangle)(bdev, &my_rect, &params, NULL);
+    if (code < 0)
+        return code;
+
+    dest = buffer->data;
+    if (xc->compression) {
+        counts = dest;
+        dest += rows * 2;
+        line = buffer->data + buffer->size - width;
+    }
+    for (chan_idx = 0; chan_idx < xc->num_channels; chan_idx++) {
+        int data_pos = xc->chnl_to_position[chan_idx];
+        byte *chan_start = dest;
+
+        for (y = 0; y < h; y++) {
+            const byte *src = params.data[data_pos] + (ulong)y * raster;
+            byte *row = (line != NULL ? line : dest);
+
+            if (xc->base_bytes_pp == 3) {
+                /* RGB */
+                if (line != NULL)
+                    row = (byte *)src;
+                else
+                    memcpy(row, src, width);
+            } else {
+                /* CMYK + spots*/
+                for (i = 0; i < width; ++i)
+                    row[i] = 255 - src[i];
+            }
+            if (line != NULL) {
+                int len = psd_packbits_row(dest, row, width);
+
+                *counts++ = (byte)(len >> 8);
+                *counts++ = (byte)len;
+                dest += len;
+            } else
+                dest += width;
+        }
+        buffer->chan_size[chan_idx] = dest - chan_start;
+    }
+    buffer->y = rect->p.y;
+    buffer->h = h;
+    return 0;
+}
+
+static int
+psd_band_output(void *arg_, gx_device *dev, void *buffer_)
+{
+    psd_band_arg_t *arg = (psd_band_arg_t *)arg_;
+    psd_band_buffer_t *buffer = (psd_band_buffer_t *)buffer_;
+    psd_write_ctx *xc = arg->xc;
+    const byte *data = buffer->data;
+    int chan_idx;
+
+    if (buffer->h == 0)
+        return 0;
+    if (xc->compression)
+        data += buffer->h * xc->num_channels * 2;
+    for (chan_idx = 0; chan_idx < xc->num_channels; chan_idx++) {
+        ulong size = buffer->chan_size[chan_idx];
+        FILE *f = arg->chan_file[chan_idx];
+
+        if (xc->compression) {
+            memcpy(arg->rle.counts + ((ulong)chan_idx * xc->height + buffer->y) * 2,
+                   buffer->data + (ulong)chan_idx * buffer->h * 2, buffer->h * 2);
+        } else if (arg->data_pos >= 0) {
+            f = xc->f;
+            if (gp_fseek_64(f, arg->data_pos + ((int64_t)chan_idx * xc->height +
+                                                buffer->y) * xc->width,
+                            SEEK_SET) != 0)
+                return_error(gs_error_ioerror);
+        }
+        if (fwrite(data, 1, size, f) != size)
+            return_error(gs_error_ioerror);
+        data += size;
+    }
+    return 0;
+}
+
+/* Write the image data as above, if we can; return 1 if not. */
+static int
+psd_write_image_bands(psd_write_ctx *xc, gx_device_printer *pdev)
+{
+    psd_device *psd_dev = (psd_device *)pdev;
+    gx_process_page_options_t process = { 0 };
+    psd_band_arg_t *arg;
+    byte *copy_buf = NULL;
+    int chan_idx, code = 0;
+
+    if (!PRINTER_IS_CLIST(pdev) || psd_dev->downscale.downscale_factor != 1 ||
+        psd_dev->downscale.trap_w != 0 || psd_dev->downscale.trap_h != 0 ||
+        !pdev->is_planar ||
+        pdev->color_info.depth != 8 * pdev->color_info.num_components)
+        return 1;
+    for (chan_idx = 0; chan_idx < xc->num_channels; chan_idx++) {
+        int data_pos = xc->chnl_to_position[chan_idx];
+
+        if (data_pos < 0 || data_pos >= pdev->color_info.num_components)
+            return 1;
+    }
+
+    arg = (psd_band_arg_t *)gs_alloc_bytes(pdev->memory, sizeof(*arg),
+                                           "psd_write_image_bands");
+    if (arg == NULL)
+        return_error(gs_error_VMerror);
+    memset(arg, 0, sizeof(*arg));
+    arg->xc = xc;
+    arg->data_pos = -1;
+    if (xc->compression) {
+        code = psd_rle_begin(xc, pdev->memory, &arg->rle, xc->num_channels);
+        if (code < 0)
+            goto done;
+        arg->chan_file[0] = arg->rle.f;
+    } else {
+        arg->data_pos = gp_ftell_64(xc->f);
+        if (arg->data_pos >= 0 && gp_fseek_64(xc->f, arg->data_pos, SEEK_SET) != 0)
+            arg->data_pos = -1;
+        arg->chan_file[0] = xc->f;
+    }
+    if (arg->data_pos < 0) {
+        for (chan_idx = 1; chan_idx < xc->num_channels; chan_idx++) {
+            arg->chan_file[chan_idx] = gp_open_scratch_file_rm(pdev->memory,
+                                                               gp_scratch_file_name_prefix,
+                                                               arg->chan_name[chan_idx], "w+b");
+            if (arg->chan_file[chan_idx] == NULL) {
+                code = gs_note_error(gs_error_invalidfileaccess);
+                goto done;
+            }
+        }
+    }
+
+    process.init_buffer_fn = psd_band_init_buffer;
+    process.free_buffer_fn = psd_band_free_buffer;
+    process.process_fn = psd_band_process;
+    process.output_fn = psd_band_output;
+    process.arg = arg;
+    code = dev_proc(pdev, process_page)((gx_device *)pdev, &process);
+    if (code < 0)
+        goto done;
+
+    if (arg->data_pos >= 0) {
+        /* Leave the output at the end of the data. */
+        if (gp_fseek_64(xc->f, arg->data_pos + (int64_t)xc->num_channels *
+                        xc->height * xc->width, SEEK_SET) != 0)
+            code = gs_note_error(gs_error_ioerror);
+        goto done;
+    }
+
+    /* Now collate the channels into the output. */
+    copy_buf = gs_alloc_bytes(pdev->memory, 65536, "psd_write_image_bands(copy)");
+    if (copy_buf == NULL) {
+        code = gs_note_error(gs_error_VMerror);
+        goto done;
+    }
+    if (xc->compression) {
+        code = psd_rle_end(xc, &arg->rle, copy_buf, 65536);
+        if (code < 0)
+            goto done;
+    }
+    for (chan_idx = 1; chan_idx < xc->num_channels; chan_idx++) {
+        code = psd_copy_file(arg->chan_file[chan_idx], xc->f, copy_buf, 65536);
+        if (code < 0)
+            goto done;
+    }
+
+done:
+    for (chan_idx = 1; chan_idx < xc->num_channels; chan_idx++) {
+        if (arg->chan_file[chan_idx] != NULL)
+            fclose(arg->chan_file[chan_idx]);
+    }
+    if (xc->compression)
+        psd_rle_free(xc, pdev->memory, &arg->rle);
+    gs_free_object(pdev->memory, copy_buf, "psd_write_image_bands(copy)");
+    gs_free_object(pdev->memory, arg, "psd_write_image_bands");
+    return code;
+}
+
 /*
  * Output the image data for the PSD device.  The data for the PSD is
  * written in separate planes.  If the device is psdrgb then we simply
@@ -1204,6 +1650,14 @@ psd_write_image_data(psd_write_ctx *xc, gx_device_printer *pdev)
     gs_get_bits_params_t params;
     gx_downscaler_t ds = { NULL };
     psd_device *psd_dev = (psd_device *)pdev;
+    psd_rle_t rle;
+    int row = 0;
+
+    memset(&rle, 0, sizeof(rle));
+    code = psd_write_image_bands(xc, pdev);
+    if (code <= 0)
+        return code;
+    code = 0;
 
     /* Return planar data */
     params.options = (GB_RETURN_POINTER | GB_RETURN_COPY |
@@ -1225,6 +1679,17 @@ psd_write_image_data(psd_write_ctx *xc, gx_device_printer *pdev)
     if (sep_line == NULL)
         return_error(gs_error_VMerror);
 
+    if (xc->compression) {
+        int written = 0;
+
+        for (chan_idx = 0; chan_idx < num_comp; chan_idx++)
+            if (xc->chnl_to_position[chan_idx] >= 0 || chan_idx < NUM_CMYK_COMPONENTS)
+                written++;
+        code = psd_rle_begin(xc, pdev->memory, &rle, written);
+        if (code < 0)
+            goto cleanup;
+    }
+
     code = gx_downscaler_init_planar_trapped(&ds, (gx_device *)pdev, &params, num_comp,
                                              psd_dev->downscale.downscale_factor, 0, 8, 8,
                                              psd_dev->downscale.trap_w,
@@ -1259,18 +1724,36 @@ psd_write_image_data(psd_write_ctx *xc, gx_device_printer *pdev)
                         link, xdev->output_profile->num_comps,
                         xdev->output_profile->num_comps_out);
                 } */
-                psd_write(xc, sep_line, xc->width);
+                if (xc->compression) {
+                    code = psd_rle_write_row(xc, &rle, row++, sep_line);
+                    if (code < 0)
+                        goto cleanup;
+                } else
+                    psd_write(xc, sep_line, xc->width);
             }
         } else {
             if (chan_idx < NUM_CMYK_COMPONENTS) {
                 /* Write empty process color in the area */
                 memset(sep_line,255,xc->width);
-                psd_write(xc, sep_line, xc->width);
+                if (xc->compression) {
+                    for (j = 0; j < xc->height; ++j) {
+                        code = psd_rle_write_row(xc, &rle, row++, sep_line);
+                        if (code < 0)
+                            goto cleanup;
+                    }
+                } else
+                    psd_write(xc, sep_line, xc->width);
             }
         }
     }
+    if (xc->compression) {
+        /* Reuse the first plane buffer to copy through. */
+        code = psd_rle_end(xc, &rle, planes[0], raster_plane);
+    }
 
 cleanup:
+    if (xc->compression)
+        psd_rle_free(xc, pdev->memory, &rle);
     gx_downscaler_fin(&ds);
     gs_free_object(pdev->memory, sep_line, "psd_write_sep_line");
     for (chan_idx = 0; chan_idx < num_comp; chan_idx++) {
@@ -1321,6 +1804,12 @@ psd_print_page(gx_device_printer *pdev, FILE *file)
         code = psd_setup(&xc, devn_dev, file,
                   gx_downscaler_scale(pdev->width, psd_dev->downscale.downscale_factor),
                   gx_downscaler_scale(pdev->height, psd_dev->downscale.downscale_factor));
+        if (code >= 0 && psd_dev->compression) {
+            /* RLE row lengths are 16 bit. */
+            if (PSD_RLE_MAX_ROW(xc.width) > 0xffff)
+                code = gs_note_error(gs_error_rangecheck);
+            xc.compression = 1;
+        }
         if (code >= 0)
             code = psd_write_header(&xc, devn_dev);
         if (code >= 0)
@@ -32,6 +32,9 @@ typedef struct {
 
     /* byte offset of image data */
     int image_data_off;
+
+    /* Image data compression: 0 for raw, 1 for RLE (PackBits) */
+    int compression;
 } psd_write_ctx;
 
 int psd_setup(psd_write_ctx *xc, gx_devn_prn_device *dev, FILE *file, int w, int h);
@@ -440,6 +440,462 @@ int tiff_set_fields_for_printer(gx_device_printer *pdev,
     return 0;
 }
 
+/* ------ Banded output ------ */
+
+/*
+ * When the page is held as a clist, we have process_page render the bands
+ * (on the rendering threads, if we have any) and compress them there too:
+ * each band's whole strips go through a TIFF in memory with the same
+ * settings as the real one. TIFF strips are compressed independently, so
+ * output_fn can then copy them into the file, in order, with
+ * TIFFWriteRawStrip. The lines of the strips that straddle band boundaries
+ * are passed through to output_fn, which gathers and compresses those
+ * itself. The file comes out just as it would line by line.
+ *
+ * The tiff_band_writer_t for each TIFF being written holds what the
+ * rendering threads need to know about it, and the tiff_band_strips_t
+ * holds one band's compressed strips for it.
+ */
+
+/* Set up w for writing tif, of the given height and line_size bytes to a
+ * line. Returns 1 (with nothing to free) if the TIFF has a single strip,
+ * leaving nothing to do in parallel. */
+int
+tiff_band_writer_init(tiff_band_writer_t *w, gx_device_printer *dev, TIFF *tif,
+                      int height, int line_size)
+{
+    uint32 rows = 0;
+
+    memset(w, 0, sizeof(*w));
+    w->dev = dev;
+    w->tif = tif;
+    w->big_endian = TIFFIsBigEndian(tif);
+    w->height = height;
+    w->line_size = line_size;
+    w->scan_size = TIFFScanlineSize(tif);
+    TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &w->width);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_BITSPERSAMPLE, &w->bps);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &w->spp);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_FILLORDER, &w->fillorder);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_COMPRESSION, &w->compression);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_ROWSPERSTRIP, &rows);
+    if (!TIFFGetField(tif, TIFFTAG_PHOTOMETRIC, &w->photometric))
+        return 1;
+    if (w->compression == COMPRESSION_CCITTFAX3)
+        TIFFGetFieldDefaulted(tif, TIFFTAG_GROUP3OPTIONS, &w->fax_options);
+    else if (w->compression == COMPRESSION_CCITTFAX4)
+        TIFFGetFieldDefaulted(tif, TIFFTAG_GROUP4OPTIONS, &w->fax_options);
+    if (rows == 0 || rows >= height)
+        return 1;
+    w->rows_per_strip = rows;
+
+    if ((ulong)rows * line_size > max_uint)
+        return_error(gs_error_VMerror);
+    w->line = gs_alloc_bytes(dev->memory, max(line_size, w->scan_size),
+                             "tiff_band_writer_init(line)");
+    w->carry = gs_alloc_bytes(dev->memory, rows * line_size,
+                              "tiff_band_writer_init(carry)");
+    if (w->line == NULL || w->carry == NULL) {
+        tiff_band_writer_fin(w);
+        return_error(gs_error_VMerror);
+    }
+    return 0;
+}
+
+/* Returns an error if the lines written didn't fill the last strip. */
+int
+tiff_band_writer_fin(tiff_band_writer_t *w)
+{
+    int code = (w->carry_lines != 0 ? gs_note_error(gs_error_unknownerror) : 0);
+
+    if (w->dev != NULL) {
+        gs_free_object(w->dev->memory, w->carry, "tiff_band_writer_init(carry)");
+        gs_free_object(w->dev->memory, w->line, "tiff_band_writer_init(line)");
+    }
+    w->carry = w->line = NULL;
+    w->carry_lines = 0;
+    return code;
+}
+
+void
+tiff_band_strips_free(tiff_band_strips_t *s)
+{
+    if (s->memory == NULL)
+        return;
+    gs_free_object(s->memory, s->line, "tiff_band_strips_encode(line)");
+    gs_free_object(s->memory, s->lines, "tiff_band_strips_encode(lines)");
+    gs_free_object(s->memory, s->data, "tiff_band_strips_encode(data)");
+    gs_free_object(s->memory, s->strip_size, "tiff_band_strips_encode(strip_size)");
+    memset(s, 0, sizeof(*s));
+}
+
+/* Make sure *pdata has room for size bytes, discarding the contents. */
+static int
+tiff_band_reserve(gs_memory_t *mem, byte **pdata, uint *psize, ulong size)
+{
+    if (size <= *psize)
+        return 0;
+    if (size > max_uint)
+        return_error(gs_error_VMerror);
+    gs_free_object(mem, *pdata, "tiff_band_reserve");
+    *psize = 0;
+    *pdata = gs_alloc_bytes(mem, (uint)size, "tiff_band_reserve");
+    if (*pdata == NULL)
+        return_error(gs_error_VMerror);
+    *psize = (uint)size;
+    return 0;
+}
+
+/* Compress lines whole strips' worth of lines, raster bytes apart, into a
+ * new TIFF in memory. That has the full height of the page, even though
+ * we only write its first few strips, as libtiff sizes its output buffer
+ * (and so where the codecs flush, which affects the packbits output) by
+ * the strip size. */
+static int
+tiff_band_encode(tiff_band_writer_t *w, gs_memory_t *mem, byte *line,
+                 const byte *data, int raster, int lines, TIFF **pt)
+{
+    TIFF *t = tiff_from_memory(w->dev, mem, w->dev->dname, w->big_endian);
+    /* The bits past the right hand edge aren't necessarily clear in the
+     * band buffer (they are in the lines we get otherwise). */
+    int pad = (int)((w->width * w->bps * w->spp) & 7);
+    int y;
+
+    *pt = t;
+    if (t == NULL)
+        return_error(gs_error_VMerror);
+    TIFFSetField(t, TIFFTAG_IMAGEWIDTH, w->width);
+    TIFFSetField(t, TIFFTAG_IMAGELENGTH, (uint32)w->height);
+    TIFFSetField(t, TIFFTAG_BITSPERSAMPLE, w->bps);
+    TIFFSetField(t, TIFFTAG_SAMPLESPERPIXEL, w->spp);
+    TIFFSetField(t, TIFFTAG_PHOTOMETRIC, w->photometric);
+    TIFFSetField(t, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+    TIFFSetField(t, TIFFTAG_FILLORDER, w->fillorder);
+    TIFFSetField(t, TIFFTAG_COMPRESSION, w->compression);
+    if (w->compression == COMPRESSION_CCITTFAX3)
+        TIFFSetField(t, TIFFTAG_GROUP3OPTIONS, w->fax_options);
+    else if (w->compression == COMPRESSION_CCITTFAX4)
+        TIFFSetField(t, TIFFTAG_GROUP4OPTIONS, w->fax_options);
+    TIFFSetField(t, TIFFTAG_ROWSPERSTRIP, (uint32)w->rows_per_strip);
+
+    for (y = 0; y < lines; y++, data += raster) {
+        memcpy(line, data, w->line_size);
+        if (pad != 0)
+            line[w->scan_size - 1] &= 0xff << (8 - pad);
+#if defined(ARCH_IS_BIG_ENDIAN) && (!ARCH_IS_BIG_ENDIAN)
+        if (w->bps == 16)
+            TIFFSwabArrayOfShort((uint16 *)line, w->width * (long)w->spp);
+#endif
+        if (TIFFWriteScanline(t, line, y, 0) < 0)
+            return_error(gs_error_ioerror);
+    }
+    if (!TIFFFlushData(t))
+        return_error(gs_error_ioerror);
+    return 0;
+}
+
+/* Find the compressed strips in a TIFF from tiff_band_encode. */
+static int
+tiff_band_find_strips(TIFF *t, const byte **pdata, uint64 **poffsets, uint64 **psizes)
+{
+    uint64 size;
+
+    *pdata = tiff_memory_data(t, &size);
+    if (!TIFFGetField(t, TIFFTAG_STRIPOFFSETS, poffsets) ||
+        !TIFFGetField(t, TIFFTAG_STRIPBYTECOUNTS, psizes))
+        return_error(gs_error_ioerror);
+    return 0;
+}
+
+/* Compress the whole strips among lines y0 to y1 of the page (raster bytes
+ * apart, from data), and keep the rest, in s (with its allocations from
+ * mem). Called on the rendering threads. */
+int
+tiff_band_strips_encode(tiff_band_writer_t *w, tiff_band_strips_t *s, gs_memory_t *mem,
+                        const byte *data, int raster, int y0, int y1)
+{
+    int rows = w->rows_per_strip;
+    int s0, s1, i, code;
+    const byte *strips;
+    byte *p;
+    uint64 *offsets, *sizes;
+    ulong total;
+    TIFF *t;
+
+    s->memory = mem;
+    s->y = y0;
+    s->head_lines = s->nstrips = s->tail_lines = 0;
+    y1 = min(y1, w->height);
+    if (y1 <= y0)
+        return 0;
+
+    /* The whole strips run from s0 to s1; the last strip of the page is
+     * whole however short it is. */
+    s0 = min((y0 + rows - 1) / rows * rows, y1);
+    s1 = (y1 == w->height ? y1 : y1 / rows * rows);
+    if (s1 <= s0)
+        s0 = s1 = y1;
+    s->head_lines = s0 - y0;
+    s->strip = s0 / rows;
+    s->nstrips = (s1 - s0 + rows - 1) / rows;
+    s->tail_y = s1;
+    s->tail_lines = y1 - s1;
+
+    /* Keep the lines of any straddling strips. */
+    code = tiff_band_reserve(mem, &s->lines, &s->lines_size,
+                             (ulong)(s->head_lines + s->tail_lines) * w->line_size);
+    if (code < 0)
+        return code;
+    p = s->lines;
+    for (i = 0; i < s->head_lines; i++, p += w->line_size)
+        memcpy(p, data + (ulong)i * raster, w->line_size);
+    for (i = 0; i < s->tail_lines; i++, p += w->line_size)
+        memcpy(p, data + (ulong)(s1 - y0 + i) * raster, w->line_size);
+    if (s->nstrips == 0)
+        return 0;
+
+    /* Compress the whole ones. */
+    code = tiff_band_reserve(mem, &s->line, &s->line_size,
+                             max(w->line_size, w->scan_size));
+    if (code < 0)
+        return code;
+    code = tiff_band_encode(w, mem, s->line, data + (ulong)(s0 - y0) * raster,
+                            raster, s1 - s0, &t);
+    if (code >= 0)
+        code = tiff_band_find_strips(t, &strips, &offsets, &sizes);
+    if (code >= 0 && s->nstrips > s->max_strips) {
+        gs_free_object(mem, s->strip_size, "tiff_band_strips_encode(strip_size)");
+        s->max_strips = 0;
+        s->strip_size = (uint *)gs_alloc_byte_array(mem, s->nstrips, sizeof(uint),
+                                                    "tiff_band_strips_encode(strip_size)");
+        if (s->strip_size == NULL)
+            code = gs_note_error(gs_error_VMerror);
+        else
+            s->max_strips = s->nstrips;
+    }
+    if (code >= 0) {
+        for (total = 0, i = 0; i < s->nstrips; i++)
+            total += sizes[i];
+        code = tiff_band_reserve(mem, &s->data, &s->data_size, total);
+    }
+    if (code >= 0) {
+        for (p = s->data, i = 0; i < s->nstrips; i++) {
+            memcpy(p, strips + offsets[i], (size_t)sizes[i]);
+            s->strip_size[i] = (uint)sizes[i];
+            p += sizes[i];
+        }
+    }
+    if (t != NULL)
+        TIFFClose(t);
+    return code;
+}
+
+/* Add lines to those of the straddling strips, and write each of those out
+ * once it's complete. */
+static int
+tiff_band_carry(tiff_band_writer_t *w, const byte *lines, int y, int count)
+{
+    int rows = w->rows_per_strip;
+    int code = 0;
+
+    while (code >= 0 && count > 0) {
+        int n, end;
+
+        if (w->carry_lines == 0)
+            w->carry_y = y;
+        end = min(w->carry_y + rows, w->height);
+        n = min(count, end - (w->carry_y + w->carry_lines));
+        memcpy(w->carry + (ulong)w->carry_lines * w->line_size, lines,
+               (ulong)n * w->line_size);
+        w->carry_lines += n;
+        lines += (ulong)n * w->line_size;
+        y += n;
+        count -= n;
+
+        if (w->carry_y + w->carry_lines == end) {
+            const byte *strips;
+            uint64 *offsets, *sizes;
+            TIFF *t;
+
+            code = tiff_band_encode(w, w->dev->memory, w->line, w->carry,
+                                    w->line_size, w->carry_lines, &t);
+            if (code >= 0)
+                code = tiff_band_find_strips(t, &strips, &offsets, &sizes);
+            if (code >= 0 &&
+                TIFFWriteRawStrip(w->tif, w->carry_y / rows,
+                                  (void *)(strips + offsets[0]), (tmsize_t)sizes[0]) < 0)
+                code = gs_note_error(gs_error_ioerror);
+            if (t != NULL)
+                TIFFClose(t);
+            w->carry_lines = 0;
+        }
+    }
+    return code;
+}
+
+/* Write out a band from tiff_band_strips_encode. The bands must come in
+ * order, on the thread that owns the TIFF. */
+int
+tiff_band_strips_write(tiff_band_writer_t *w, tiff_band_strips_t *s)
+{
+    const byte *p = s->data;
+    int i, code;
+
+    code = tiff_band_carry(w, s->lines, s->y, s->head_lines);
+    for (i = 0; code >= 0 && i < s->nstrips; i++) {
+        if (TIFFWriteRawStrip(w->tif, s->strip + i, (void *)p,
+                              (tmsize_t)s->strip_size[i]) < 0)
+            code = gs_note_error(gs_error_ioerror);
+        p += s->strip_size[i];
+    }
+    if (code >= 0)
+        code = tiff_band_carry(w, s->lines + (ulong)s->head_lines * w->line_size,
+                               s->tail_y, s->tail_lines);
+    return code;
+}
+
+/* Banded output of a single (chunky) TIFF: process_page's arg is the
+ * tiff_band_writer_t, and each buffer a tiff_band_strips_t. */
+static int
+tiff_band_init_buffer(void *arg, gx_device *dev, gs_memory_t *mem, int w, int h, void **pbuffer)
+{
+    tiff_band_strips_t *buffer;
+
+    buffer = (tiff_band_strips_t *)gs_alloc_bytes(mem, sizeof(*buffer),
+                                                  "tiff_band_init_buffer");
+    *pbuffer = buffer;
+    if (buffer == NULL)
+        return_error(gs_error_VMerror);
+    memset(buffer, 0, sizeof(*buffer));
+    buffer->memory = mem;
+    return 0;
+}
+
+static void
+tiff_band_free_buffer(void *arg, gx_device *dev, gs_memory_t *mem, void *buffer_)
+{
+    tiff_band_strips_t *buffer = (tiff_band_strips_t *)buffer_;
+
+    if (buffer == NULL)
+        return;
+    tiff_band_strips_free(buffer);
+    gs_free_object(mem, buffer, "tiff_band_init_buffer");
+}
+
+static int
+tiff_band_process(void *arg, gx_device *dev, gx_device *bdev, const gs_int_rect *rect, void *buffer_)
+{
+    tiff_band_writer_t *w = (tiff_band_writer_t *)arg;
+    tiff_band_strips_t *buffer = (tiff_band_strips_t *)buffer_;
+    int y0 = rect->p.y;
+    int y1 = min(rect->q.y, w->height);
+    gs_get_bits_params_t params;
+    gs_int_rect my_rect;
+    int code;
+
+    if (y1 <= y0) {
+        buffer->head_lines = buffer->nstrips = buffer->tail_lines = 0;
+        return 0;
+    }
+    params.options = GB_COLORS_NATIVE | GB_ALPHA_NONE | GB_PACKING_CHUNKY | GB_RETURN_POINTER | GB_ALIGN_ANY | GB_OFFSET_0 | GB_RASTER_ANY;
+    my_rect.p.x = 0;
+    my_rect.p.y = 0;
+    my_rect.q.x = rect->q.x - rect->p.x;
+    my_rect.q.y = y1 - y0;
+    code = dev_proc(bdev, get_bits_rectangle)(bdev, &my_rect, &params, NULL);
+    if (code < 0)
+        return code;
+    return tiff_band_strips_encode(w, buffer, buffer->memory, params.data[0],
+                                   bitmap_raster(bdev->width * bdev->color_info.depth),
+                                   y0, y1);
+}
+
+static int
+tiff_band_output(void *arg, gx_device *dev, void *buffer)
+{
+    return tiff_band_strips_write((tiff_band_writer_t *)arg, (tiff_band_strips_t *)buffer);
+}
+
+/* Write the page as above, if we can; return 1 if not. line_size bytes of
+ * each (downscaled) line are used. */
+static int
+tiff_print_bands(gx_device_printer *dev, TIFF *tif, int factor, int line_size)
+{
+    gx_device_clist_common *cdev = (gx_device_clist_common *)dev;
+    gx_process_page_options_t process = { 0 };
+    tiff_band_writer_t writer;
+    int code, code1;
+
+    if (!PRINTER_IS_CLIST(dev) || factor > 8 ||
+        cdev->page_info.band_params.BandHeight % factor != 0)
+        return 1;
+
+    code = tiff_band_writer_init(&writer, dev, tif,
+                                 gx_downscaler_scale(dev->height, factor), line_size);
+    if (code != 0)
+        return code;
+
+    code = TIFFCheckpointDirectory(tif);
+    if (code >= 0) {
+        process.init_buffer_fn = tiff_band_init_buffer;
+        process.free_buffer_fn = tiff_band_free_buffer;
+        process.process_fn = tiff_band_process;
+        process.output_fn = tiff_band_output;
+        process.arg = &writer;
+        if (factor == 1)
+            code = dev_proc(dev, process_page)((gx_device *)dev, &process);
+        else
+            code = gx_downscaler_process_page((gx_device *)dev, &process, factor);
+    }
+    code1 = tiff_band_writer_fin(&writer);
+    if (code >= 0)
+        code = code1;
+    if (code >= 0)
+        code = (TIFFWriteDirectory(tif) ? 0 : gs_note_error(gs_error_ioerror));
+    return code;
+}
+
+/* For 1 bit output, process_page does the rendering, box filtering and
+ * error diffusion on the rendering threads, and hands us the finished
+ * lines in order (though not necessarily on this thread). */
+typedef struct tiff_ed_arg_s {
+    TIFF *tif;
+    byte *data;
+    int line_size;
+    int height;
+} tiff_ed_arg_t;
+
+static int
+tiff_ed_process(void *arg_, gx_device *dev, gx_device *bdev, const gs_int_rect *rect, void *buffer)
+{
+    tiff_ed_arg_t *arg = (tiff_ed_arg_t *)arg_;
+    int raster = gx_device_raster(bdev, true);
+    gs_get_bits_params_t params;
+    gs_int_rect my_rect;
+    const byte *p;
+    int y, code;
+
+    if (rect->q.y <= rect->p.y)
+        return 0;
+    params.options = GB_COLORS_NATIVE | GB_ALPHA_NONE | GB_PACKING_CHUNKY | GB_RETURN_POINTER | GB_ALIGN_ANY | GB_OFFSET_0 | GB_RASTER_ANY;
+    my_rect.p.x = 0;
+    my_rect.p.y = 0;
+    my_rect.q.x = rect->q.x - rect->p.x;
+    my_rect.q.y = rect->q.y - rect->p.y;
+    code = dev_proc(bdev, get_bits_rectangle)(bdev, &my_rect, &params, NULL);
+    if (code < 0)
+        return code;
+    p = params.data[0];
+
+    for (y = rect->p.y; y < rect->q.y && y < arg->height; y++, p += raster) {
+        memcpy(arg->data, p, arg->line_size);
+        code = TIFFWriteScanline(arg->tif, arg->data, y, 0);
+        if (code < 0)
+            return code;
+    }
+    return 0;
+}
+
 int
 tiff_print_page(gx_device_printer *dev, TIFF *tif, int min_feature_size)
 {
@@ -453,11 +909,18 @@ tiff_print_page(gx_device_printer *dev, TIFF *tif, int min_feature_size)
     int line_lag = 0;
     int filtered_count;
 
+    if (bpc != 1)
+        min_feature_size = 1;
+    if (min_feature_size <= 1) {
+        code = tiff_print_bands(dev, tif, 1, size);
+        if (code <= 0)
+            return code;
+        code = 0;
+    }
+
     data = gs_alloc_bytes(dev->memory, max_size, "tiff_print_page(data)");
     if (data == NULL)
         return_error(gs_error_VMerror);
-    if (bpc != 1)
-        min_feature_size = 1;
     if (min_feature_size > 1) {
         code = min_feature_size_init(dev->memory, min_feature_size,
                                      dev->width, dev->height,
@@ -542,6 +1005,47 @@ tiff_downscale_and_print_page(gx_device_printer *dev, TIFF *tif, int factor,
     int height = dev->height/factor;
     gx_downscaler_t ds;
 
+    /* Contone output (with no color management or trapping) can be
+     * banded, as can 1 bit gray or CMYK, including min feature size and
+     * ETS (see tiff_ed_process). */
+    if (tfdev->icclink == NULL && trap_w == 0 && trap_h == 0 &&
+        fax_adjusted_width(gx_downscaler_scale(dev->width, factor), aw) ==
+            gx_downscaler_scale(dev->width, factor)) {
+        int width = gx_downscaler_scale(dev->width, factor);
+
+        if (bpc == 8) {
+            code = tiff_print_bands(dev, tif, factor, width * num_comps);
+            if (code <= 0)
+                return code;
+        } else if (bpc == 1 && (num_comps == 1 || num_comps == 4) &&
+                   PRINTER_IS_CLIST(dev) &&
+                   factor <= 8 && ((gx_device_clist_common *)dev)->
+                       page_info.band_params.BandHeight % factor == 0) {
+            gx_process_page_options_t process = { 0 };
+            tiff_ed_arg_t arg;
+
+            arg.tif = tif;
+            arg.line_size = (width * num_comps + 7) >> 3;
+            arg.height = height;
+            arg.data = gs_alloc_bytes(dev->memory, max(max_size, arg.line_size),
+                                      "tiff_print_page(data)");
+            if (arg.data == NULL)
+                return_error(gs_error_VMerror);
+            memset(arg.data, 0, max(max_size, arg.line_size));
+            code = TIFFCheckpointDirectory(tif);
+            if (code >= 0) {
+                process.process_fn = tiff_ed_process;
+                process.arg = &arg;
+                code = gx_downscaler_process_page_ets((gx_device *)dev, &process,
+                                                      factor, mfs, 1, ets);
+            }
+            if (code >= 0)
+                code = TIFFWriteDirectory(tif);
+            gs_free_object(dev->memory, arg.data, "tiff_print_page(data)");
+            return code;
+        }
+    }
+
     code = TIFFCheckpointDirectory(tif);
     if (code < 0)
         return code;
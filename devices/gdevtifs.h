@@ -61,6 +61,58 @@ int tiff_downscale_and_print_page(gx_device_printer *dev, TIFF *tif,
                                   int ets);
 void tiff_set_handlers (void);
 
+/*
+ * Writing a TIFF a band at a time, with the whole strips of each band
+ * compressed on the rendering threads, and copied into the file in band
+ * order (see gdevtifs.c).
+ */
+typedef struct tiff_band_writer_s {
+    gx_device_printer *dev;
+    TIFF *tif;
+    int big_endian;
+    uint32 width;
+    uint16 bps;
+    uint16 spp;
+    uint16 photometric;
+    uint16 compression;
+    uint16 fillorder;
+    uint32 fax_options;         /* Group 3 or 4 options, for those */
+    int rows_per_strip;
+    int height;
+    int line_size;              /* Bytes we take from each line */
+    int scan_size;              /* Bytes libtiff wants for each line */
+    byte *line;                 /* Line buffer for the straddling strips */
+    byte *carry;                /* The lines of the current straddling */
+    int carry_y;                /* strip so far */
+    int carry_lines;
+} tiff_band_writer_t;
+
+typedef struct tiff_band_strips_s {
+    gs_memory_t *memory;
+    int y;                      /* First line of the band */
+    int head_lines;             /* Lines before the first whole strip, */
+    int strip;                  /* then the first whole strip, */
+    int nstrips;                /* the number of whole strips, */
+    int tail_y;                 /* and where the remaining lines start, */
+    int tail_lines;             /* and how many there are. */
+    byte *lines;                /* The head and tail lines */
+    uint lines_size;
+    byte *data;                 /* The compressed whole strips, */
+    uint data_size;
+    uint *strip_size;           /* and their sizes */
+    uint max_strips;
+    byte *line;                 /* Line buffer for the encoder */
+    uint line_size;
+} tiff_band_strips_t;
+
+int tiff_band_writer_init(tiff_band_writer_t *w, gx_device_printer *dev, TIFF *tif,
+                          int height, int line_size);
+int tiff_band_writer_fin(tiff_band_writer_t *w);
+int tiff_band_strips_encode(tiff_band_writer_t *w, tiff_band_strips_t *s, gs_memory_t *mem,
+                            const byte *data, int raster, int y0, int y1);
+int tiff_band_strips_write(tiff_band_writer_t *w, tiff_band_strips_t *s);
+void tiff_band_strips_free(tiff_band_strips_t *s);
+
 /*
  * Sets the compression tag for TIFF and updates the rows_per_strip tag to
  * reflect max_strip_size under the new compression scheme.
@@ -2270,6 +2270,208 @@ print_cmyk_equivalent_colors(tiffsep_device *tfdev, int num_comp, cmyk_composite
     return 0;
 }
 
+/*
+ * With the page held as a clist, we can have process_page render the
+ * bands on the rendering threads, and unpack and compress each of the
+ * separations, and the composite, there too. Each file has its own
+ * tiff_band_writer_t (see gdevtifs.c), and output_fn copies each band's
+ * strips into them all in turn. This only covers the straightforward
+ * cases: 8 bits per component, with no downscaling, trapping,
+ * SeparationOrder or post rendering color management.
+ */
+typedef struct tiffsep_band_arg_s {
+    tiffsep_device *tfdev;
+    int num_comp;
+    int num_sep_files;          /* num_comp, or 0 for NoSeparationFiles */
+    int width;
+    int height;
+    cmyk_composite_map *cmyk_map;
+    tiff_band_writer_t comp;
+    tiff_band_writer_t sep[GX_DEVICE_COLOR_MAX_COMPONENTS];
+} tiffsep_band_arg_t;
+
+typedef struct tiffsep_band_buffer_s {
+    gs_memory_t *memory;
+    byte *lines;                /* A band of one file's lines */
+    uint lines_size;
+    tiff_band_strips_t comp;
+    tiff_band_strips_t sep[GX_DEVICE_COLOR_MAX_COMPONENTS];
+} tiffsep_band_buffer_t;
+
+static int
+tiffsep_band_init_buffer(void *arg, gx_device *dev, gs_memory_t *mem, int w, int h, void **pbuffer)
+{
+    tiffsep_band_buffer_t *buffer;
+
+    buffer = (tiffsep_band_buffer_t *)gs_alloc_bytes(mem, sizeof(*buffer),
+                                                     "tiffsep_band_init_buffer");
+    *pbuffer = buffer;
+    if (buffer == NULL)
+        return_error(gs_error_VMerror);
+    memset(buffer, 0, sizeof(*buffer));
+    buffer->memory = mem;
+    return 0;
+}
+
+static void
+tiffsep_band_free_buffer(void *arg, gx_device *dev, gs_memory_t *mem, void *buffer_)
+{
+    tiffsep_band_buffer_t *buffer = (tiffsep_band_buffer_t *)buffer_;
+    int comp_num;
+
+    if (buffer == NULL)
+        return;
+    tiff_band_strips_free(&buffer->comp);
+    for (comp_num = 0; comp_num < GX_DEVICE_COLOR_MAX_COMPONENTS; comp_num++)
+        tiff_band_strips_free(&buffer->sep[comp_num]);
+    gs_free_object(mem, buffer->lines, "tiffsep_band_process(lines)");
+    gs_free_object(mem, buffer, "tiffsep_band_init_buffer");
+}
+
+static int
+tiffsep_band_process(void *arg_, gx_device *dev, gx_device *bdev, const gs_int_rect *rect, void *buffer_)
+{
+    tiffsep_band_arg_t *arg = (tiffsep_band_arg_t *)arg_;
+    tiffsep_band_buffer_t *buffer = (tiffsep_band_buffer_t *)buffer_;
+    gs_memory_t *mem = buffer->memory;
+    int width = arg->width;
+    int y0 = rect->p.y;
+    int y1 = min(rect->q.y, arg->height);
+    int raster = gx_device_raster_plane(bdev, NULL);
+    int comp_num, i, y, code;
+    ulong size = (ulong)max(y1 - y0, 0) * width * NUM_CMYK_COMPONENTS;
+    gs_get_bits_params_t params, row_params;
+    gs_int_rect my_rect;
+    byte *dest;
+
+    if (y1 <= y0) {
+        buffer->comp.head_lines = buffer->comp.nstrips = buffer->comp.tail_lines = 0;
+        for (comp_num = 0; comp_num < arg->num_sep_files; comp_num++) {
+            buffer->sep[comp_num].head_lines = buffer->sep[comp_num].nstrips =
+                buffer->sep[comp_num].tail_lines = 0;
+        }
+        return 0;
+    }
+
+    if (size > buffer->lines_size) {
+        if (size > max_uint)
+            return_error(gs_error_VMerror);
+        gs_free_object(mem, buffer->lines, "tiffsep_band_process(lines)");
+        buffer->lines_size = 0;
+        buffer->lines = gs_alloc_bytes(mem, (uint)size, "tiffsep_band_process(lines)");
+        if (buffer->lines == NULL)
+            return_error(gs_error_VMerror);
+        buffer->lines_size = (uint)size;
+    }
+
+    params.options = GB_COLORS_NATIVE | GB_ALPHA_NONE | GB_PACKING_PLANAR | GB_RETURN_POINTER | GB_ALIGN_ANY | GB_OFFSET_0 | GB_RASTER_ANY;
+    my_rect.p.x = 0;
+    my_rect.p.y = 0;
+    my_rect.q.x = rect->q.x - rect->p.x;
+    my_rect.q.y = y1 - y0;
+    code = dev_proc(bdev, get_bits_rectangle)(bdev, &my_rect, &params, NULL);
+    if (code < 0)
+        return code;
+
+    /* The separations (tiffgray format) */
+    for (comp_num = 0; comp_num < arg->num_sep_files; comp_num++) {
+        for (dest = buffer->lines, y = 0; y < y1 - y0; y++) {
+            const byte *src = params.data[comp_num] + (ulong)y * raster;
+
+            for (i = 0; i < width; i++)
+                *dest++ = MAX_COLOR_VALUE - *src++;    /* Gray is additive */
+        }
+        code = tiff_band_strips_encode(&arg->sep[comp_num], &buffer->sep[comp_num],
+                                       mem, buffer->lines, width, y0, y1);
+        if (code < 0)
+            return code;
+    }
+
+    /* The CMYK equivalent */
+    for (dest = buffer->lines, y = 0; y < y1 - y0; y++) {
+        for (comp_num = 0; comp_num < arg->num_comp; comp_num++)
+            row_params.data[comp_num] = params.data[comp_num] + (ulong)y * raster;
+        build_cmyk_raster_line_fromplanar(&row_params, dest, width, arg->num_comp,
+                                          arg->cmyk_map, 0, arg->tfdev);
+        dest += width * NUM_CMYK_COMPONENTS;
+    }
+    return tiff_band_strips_encode(&arg->comp, &buffer->comp, mem, buffer->lines,
+                                   width * NUM_CMYK_COMPONENTS, y0, y1);
+}
+
+static int
+tiffsep_band_output(void *arg_, gx_device *dev, void *buffer_)
+{
+    tiffsep_band_arg_t *arg = (tiffsep_band_arg_t *)arg_;
+    tiffsep_band_buffer_t *buffer = (tiffsep_band_buffer_t *)buffer_;
+    int comp_num, code = 0;
+
+    for (comp_num = 0; code >= 0 && comp_num < arg->num_sep_files; comp_num++)
+        code = tiff_band_strips_write(&arg->sep[comp_num], &buffer->sep[comp_num]);
+    if (code >= 0)
+        code = tiff_band_strips_write(&arg->comp, &buffer->comp);
+    return code;
+}
+
+/* Write the page data as above, if we can; return 1 if not. */
+static int
+tiffsep_print_bands(tiffsep_device *tfdev, int num_comp, cmyk_composite_map *cmyk_map,
+                    int width, int height)
+{
+    gx_device_printer *pdev = (gx_device_printer *)tfdev;
+    gx_process_page_options_t process = { 0 };
+    tiffsep_band_arg_t *arg;
+    int comp_num, inited = 0, code = 0, code1;
+
+    if (!PRINTER_IS_CLIST(pdev) || tfdev->BitsPerComponent != 8 ||
+        tfdev->downscale.downscale_factor != 1 ||
+        tfdev->downscale.trap_w != 0 || tfdev->downscale.trap_h != 0 ||
+        tfdev->devn_params.num_separation_order_names != 0 ||
+        tfdev->icclink != NULL ||
+        tfdev->color_info.depth != 8 * tfdev->color_info.num_components ||
+        num_comp > tfdev->color_info.num_components)
+        return 1;
+
+    arg = (tiffsep_band_arg_t *)gs_alloc_bytes(pdev->memory, sizeof(*arg),
+                                               "tiffsep_print_bands");
+    if (arg == NULL)
+        return_error(gs_error_VMerror);
+    memset(arg, 0, sizeof(*arg));
+    arg->tfdev = tfdev;
+    arg->num_comp = num_comp;
+    arg->num_sep_files = (tfdev->NoSeparationFiles ? 0 : num_comp);
+    arg->width = width;
+    arg->height = height;
+    arg->cmyk_map = cmyk_map;
+
+    /* Any single strip file leaves us with the whole page to hold, so we
+     * may as well do it line by line. */
+    code = tiff_band_writer_init(&arg->comp, pdev, tfdev->tiff_comp, height,
+                                 width * NUM_CMYK_COMPONENTS);
+    for (; code == 0 && inited < arg->num_sep_files; inited++)
+        code = tiff_band_writer_init(&arg->sep[inited], pdev, tfdev->tiff[inited],
+                                     height, width);
+    if (code == 0) {
+        process.init_buffer_fn = tiffsep_band_init_buffer;
+        process.free_buffer_fn = tiffsep_band_free_buffer;
+        process.process_fn = tiffsep_band_process;
+        process.output_fn = tiffsep_band_output;
+        process.arg = arg;
+        code = dev_proc(pdev, process_page)((gx_device *)pdev, &process);
+    }
+
+    code1 = tiff_band_writer_fin(&arg->comp);
+    if (code == 0)
+        code = code1;
+    for (comp_num = 0; comp_num < inited; comp_num++) {
+        code1 = tiff_band_writer_fin(&arg->sep[comp_num]);
+        if (code == 0)
+            code = code1;
+    }
+    gs_free_object(pdev->memory, arg, "tiffsep_print_bands");
+    return code;
+}
+
 /*
  * Output the image data for the tiff separation (tiffsep) device.  The data
  * for the tiffsep device is written in separate planes to separate files.
@@ -2457,6 +2659,13 @@ tiffsep_print_page(gx_device_printer * pdev, FILE * file)
                 TIFFCheckpointDirectory(tfdev->tiff[comp_num]);
         TIFFCheckpointDirectory(tfdev->tiff_comp);
 
+        code = tiffsep_print_bands(tfdev, num_comp, cmyk_map, width, height);
+        if (code <= 0) {
+            gs_free_object(pdev->memory, sep_line, "tiffsep_print_page");
+            goto written;
+        }
+        code = 0;
+
         /* Write the page data. */
         {
             gs_get_bits_params_t params;
@@ -2600,6 +2809,7 @@ cleanup:
             gx_downscaler_fin(&ds);
             gs_free_object(pdev->memory, sep_line, "tiffsep_print_page");
         }
+written:
         code1 = code;
         if (!tfdev->NoSeparationFiles) {
             for (comp_num = 0; comp_num < num_comp; comp_num++) {
@@ -68,6 +68,9 @@ ENUM_PTRS_WITH(device_pdfwrite_enum_ptrs, gx_device_pdf *pdev)
     if (index < NUM_RESOURCE_TYPES * NUM_RESOURCE_CHAINS)
         ENUM_RETURN(pdev->resources[index / NUM_RESOURCE_CHAINS].chains[index % NUM_RESOURCE_CHAINS]);
     index -= NUM_RESOURCE_TYPES * NUM_RESOURCE_CHAINS;
+    if (index < pdev->resource_index.num_entries)
+        ENUM_RETURN(pdev->resource_index.entries[index].pres);
+    index -= pdev->resource_index.num_entries;
     if (index <= pdev->outline_depth && pdev->outline_levels)
         ENUM_RETURN(pdev->outline_levels[index].first.action);
     index -= pdev->outline_depth + 1;
@@ -184,6 +187,8 @@ static RELOC_PTRS_WITH(device_pdfwrite_reloc_ptrs, gx_device_pdf *pdev)
         for (i = 0; i < NUM_RESOURCE_TYPES; ++i)
             for (j = 0; j < NUM_RESOURCE_CHAINS; ++j)
                 RELOC_PTR(gx_device_pdf, resources[i].chains[j]);
+        for (i = 0; i < pdev->resource_index.num_entries; ++i)
+            RELOC_PTR(gx_device_pdf, resource_index.entries[i].pres);
         if (pdev->outline_levels) {
             for (i = 0; i <= pdev->outline_depth; ++i) {
                 RELOC_PTR(gx_device_pdf, outline_levels[i].first.action);
@@ -815,6 +820,7 @@ pdf_open(gx_device * dev)
         for (i = 0; i < NUM_RESOURCE_TYPES; ++i)
             for (j = 0; j < NUM_RESOURCE_CHAINS; ++j)
                 pdev->resources[i].chains[j] = 0;
+        pdf_init_resource_index(pdev);
     }
     pdev->outline_levels = (pdf_outline_level_t *)gs_alloc_bytes(mem, INITIAL_MAX_OUTLINE_DEPTH * sizeof(pdf_outline_level_t), "outline_levels array");
     memset(pdev->outline_levels, 0x00, INITIAL_MAX_OUTLINE_DEPTH * sizeof(pdf_outline_level_t));
@@ -3293,6 +3299,8 @@ pdf_close(gx_device * dev)
         }
     }
 
+    pdf_free_resource_index(pdev);
+
     /* Release the resource records. */
     /* So what exactly is stored in this list ? I believe the following types of resource:
      *
@@ -285,5 +285,6 @@ const gx_device_pdf PDF_DEVICE_IDENT =
  -1,                    /* Last Form ID, start with -1 which means 'none' */
  0,                     /* ExtensionMetadata */
  0,                     /* PDFFormName */
- 0                      /* PassThroughWriter */
+ 0,                     /* PassThroughWriter */
+ {0}                    /* resource_index */
 };
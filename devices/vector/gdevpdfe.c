@@ -895,6 +895,7 @@ pdf_document_metadata(gx_device_pdf *pdev)
          * it before we free the global named resources. So remove the Metadata cos_stream
          * object from the resourceOther resource type chains.
          */
+        pdf_unindex_resource(pdev, pres);
         for (j = 0; j < NUM_RESOURCE_CHAINS; ++j) {
             pdf_resource_t *pres1, *head = pdev->resources[resourceOther].chains[j];
 
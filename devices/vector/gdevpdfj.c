@@ -542,6 +542,7 @@ pdf_end_write_image(gx_device_pdf * pdev, pdf_image_writer * piw)
              * Instead, overwrite the latter with the former's contents,
              * and change the only relevant pointer.
              */
+            cos_hash_changed(pco);
             *(cos_object_t *)named = *pco;
             pres->object = COS_OBJECT(named);
         } else if (!pres->named) { /* named objects are written at the end */
@@ -666,7 +667,7 @@ pdf_choose_compression_cos(pdf_image_writer *piw, cos_stream_t *s[2], bool force
     }
     k1 = 1 - k0;
     s_close_filters(&piw->binary[k0].strm, piw->binary[k0].target);
-    s[k0]->cos_procs->release((cos_object_t *)s[k0], "pdf_image_choose_filter");
+    cos_release((cos_object_t *)s[k0], "pdf_image_choose_filter");
     s[k0]->written = 1;
     piw->binary[0].strm = piw->binary[k1].strm;
     s_close_filters(&piw->binary[2].strm, piw->binary[2].target);
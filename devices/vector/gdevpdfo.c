@@ -179,6 +179,7 @@ cos_object_init(cos_object_t *pco, gx_device_pdf *pdev,
         pco->md5_valid = 0;
         pco->stream_md5_valid = 0;
         memset(&pco->hash, 0x00, 16);
+        pco->indexed_by = 0;
     }
 }
 
@@ -204,6 +205,7 @@ cos_proc_release(cos_release);	/* check prototype */
 void
 cos_release(cos_object_t *pco, client_name_t cname)
 {
+    cos_hash_changed(pco);
     pco->cos_procs->release(pco, cname);
 }
 
@@ -215,6 +217,17 @@ cos_free(cos_object_t *pco, client_name_t cname)
     gs_free_object(cos_object_memory(pco), pco, cname);
 }
 
+/*
+ * Note that the hash of a cos object is no longer valid. If the hash keys
+ * an entry in the resource index, the index must check it again.
+ */
+void
+cos_hash_changed(const cos_object_t *pco)
+{
+    if (pco->indexed_by != NULL)
+        pco->indexed_by->resource_index.stale = true;
+}
+
 /* Write a cos object on the output. */
 cos_proc_write(cos_write);	/* check prototype */
 int
@@ -640,6 +653,7 @@ cos_array_put(cos_array_t *pca, long index, const cos_value_t *pvalue)
             cos_uncopy_element_value(&value, mem, true);
     }
     pca->md5_valid = false;
+    cos_hash_changed(COS_OBJECT(pca));
     return code;
 }
 int
@@ -669,6 +683,7 @@ cos_array_put_no_copy(cos_array_t *pca, long index, const cos_value_t *pvalue)
     }
     pcae->value = *pvalue;
     pca->md5_valid = false;
+    cos_hash_changed(COS_OBJECT(pca));
     return 0;
 }
 static long
@@ -680,12 +695,14 @@ int
 cos_array_add(cos_array_t *pca, const cos_value_t *pvalue)
 {
     pca->md5_valid = false;
+    cos_hash_changed(COS_OBJECT(pca));
     return cos_array_put(pca, cos_array_next_index(pca), pvalue);
 }
 int
 cos_array_add_no_copy(cos_array_t *pca, const cos_value_t *pvalue)
 {
     pca->md5_valid = false;
+    cos_hash_changed(COS_OBJECT(pca));
     return cos_array_put_no_copy(pca, cos_array_next_index(pca), pvalue);
 }
 int
@@ -743,6 +760,7 @@ cos_array_unadd(cos_array_t *pca, cos_value_t *pvalue)
     pca->elements = pcae->next;
     gs_free_object(COS_OBJECT_MEMORY(pca), pcae, "cos_array_unadd");
     pca->md5_valid = false;
+    cos_hash_changed(COS_OBJECT(pca));
     return 0;
 }
 
@@ -1344,6 +1362,7 @@ cos_dict_put_copy(cos_dict_t *pcd, const byte *key_data, uint key_size,
     }
     pcde->value = value;
     pcd->md5_valid = false;
+    cos_hash_changed(COS_OBJECT(pcd));
     return 0;
 }
 int
@@ -1467,6 +1486,7 @@ cos_dict_move_all(cos_dict_t *pcdto, cos_dict_t *pcdfrom)
     pcdto->elements = head;
     pcdfrom->elements = 0;
     pcdto->md5_valid = false;
+    cos_hash_changed(COS_OBJECT(pcdto));
     return 0;
 }
 
@@ -1782,6 +1802,41 @@ cos_stream_equal(const cos_object_t *pco0, const cos_object_t *pco1, gx_device_p
     return true;
 }
 
+/* Get the hash that the equal procedure compares first. */
+int
+cos_object_equal_hash(const cos_object_t *pco, gx_device_pdf *pdev,
+                      const byte **phash)
+{
+    int code;
+
+    if (cos_type(pco) == cos_type_stream) {
+        if (!pco->stream_md5_valid) {
+            gs_md5_state_t md5;
+            gs_md5_byte_t hash[16];
+
+            /* As cos_stream_equal, which treats errors as inequality. */
+            gs_md5_init(&md5);
+            code = cos_stream_hash(pco, &md5, hash, pdev);
+            if (code < 0 || !pco->stream_md5_valid)
+                return 0;
+        }
+        *phash = pco->stream_hash;
+        return 1;
+    }
+    if (cos_type(pco) != cos_type_dict && cos_type(pco) != cos_type_array)
+        return 0;
+    if (!pco->md5_valid) {
+        gs_md5_init((gs_md5_state_t *)&pco->md5);
+        code = pco->cos_procs->hash(pco, (gs_md5_state_t *)&pco->md5, (gs_md5_byte_t *)pco->hash, pdev);
+        if (code < 0)
+            return code;
+        gs_md5_finish((gs_md5_state_t *)&pco->md5, (gs_md5_byte_t *)pco->hash);
+        ((cos_object_t *)pco)->md5_valid = true;
+    }
+    *phash = pco->hash;
+    return 1;
+}
+
 /* Find the total length of a stream. */
 long
 cos_stream_length(const cos_stream_t *pcs)
@@ -2046,6 +2101,7 @@ cos_write_stream_alloc(cos_stream_t *pcs, gx_device_pdf *pdev,
     ss->templat = &cos_write_stream_template;
     ss->pcs = pcs;
     ss->pcs->stream_md5_valid = 0;
+    cos_hash_changed(COS_OBJECT(ss->pcs));
     gs_md5_init(&ss->pcs->md5);
     memset(&ss->pcs->hash, 0x00, 16);
     ss->pdev = pdev;
@@ -126,6 +126,7 @@ struct otype_s {\
     byte hash[16];		/* MD5 hash value */\
     int stream_md5_valid;       /* (for streams) 1 if hash created, 0 otherwise */\
     byte stream_hash[16];	/* MD5 hash value (if stream) */\
+    gx_device_pdf *indexed_by;  /* device whose resource index holds hash */\
     /* input_strm is introduced recently for pdfmark. */\
     /* Using this field, psdf_binary_writer_s may be simplified. */\
 }
@@ -358,4 +359,15 @@ void cos_value_free(const cos_value_t *, const cos_object_t *, client_name_t);
 void cos_free(cos_object_t *pco, client_name_t cname);
 #define COS_FREE(pc, cname) cos_free(COS_OBJECT(pc), cname)
 
+/*
+ * Get the hash that the equal procedure compares first (for streams, the
+ * hash of the data), computing it the same way. Return 1 and set *phash
+ * if there is one, 0 if the object can't be hashed, or <0 on error.
+ */
+int cos_object_equal_hash(const cos_object_t *pco, gx_device_pdf *pdev,
+                          const byte **phash);
+
+/* Note that the hash of an object is no longer valid. */
+void cos_hash_changed(const cos_object_t *pco);
+
 #endif /* gdevpdfo_INCLUDED */
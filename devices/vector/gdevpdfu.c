@@ -1158,6 +1158,7 @@ pdf_cancel_resource(gx_device_pdf * pdev, pdf_resource_t *pres, pdf_resource_typ
 {
     /* fixme : Remove *pres from resource chain. */
     pres->where_used = 0;
+    pdf_unindex_resource(pdev, pres);
     if (pres->object) {
         pres->object->written = true;
         if (rtype == resourceXObject || rtype == resourceCharProc || rtype == resourceOther
@@ -1208,6 +1209,7 @@ pdf_forget_resource(gx_device_pdf * pdev, pdf_resource_t *pres1, pdf_resource_ty
         pprev = pchain + i;
         for (; (pres = *pprev) != 0; pprev = &pres->next)
             if (pres == pres1) {
+                pdf_unindex_resource(pdev, pres);
                 *pprev = pres->next;
                 if (pres->object) {
                     COS_RELEASE(pres->object, "pdf_forget_resource");
@@ -1302,9 +1304,351 @@ pdf_find_resource_by_resource_id(gx_device_pdf * pdev, pdf_resource_type_t rtype
     return 0;
 }
 
-/* Find same resource. */
-int
-pdf_find_same_resource(gx_device_pdf * pdev, pdf_resource_type_t rtype, pdf_resource_t **ppres,
+/* ------ Resource index ------ */
+
+/*
+ * pdf_find_same_resource must give the same result as comparing the
+ * resource with every other resource of the type, in chain order, and so
+ * must call the equal and eq procedures on the same resources in the same
+ * order. The index is only used when it can: that is, when the objects of
+ * all the other resources of the same cos type have been hashed (equal
+ * only compares the hashes then, and otherwise hashes them as a side
+ * effect). The 'order' of an entry records its position in its chain,
+ * so that resources with the same hash are tried in chain order.
+ */
+
+#define RESOURCE_INDEX_MIN_ENTRIES 64
+#define RESOURCE_INDEX_MIN_BUCKETS 256
+#define RESOURCE_INDEX_MAX_SAME 8
+
+/* Return 0, 1 or 2 for dicts, arrays and streams, or -1 if not indexed. */
+static int
+resource_index_class(cos_type_t type)
+{
+    return (type == cos_type_dict ? 0 : type == cos_type_array ? 1 :
+            type == cos_type_stream ? 2 : -1);
+}
+
+/* The hash that cos_object_equal_hash returns, if it is valid. */
+static const byte *
+resource_index_hash(const cos_object_t *pco)
+{
+    if (cos_type(pco) == cos_type_stream)
+        return (pco->stream_md5_valid ? pco->stream_hash : NULL);
+    return (pco->md5_valid ? pco->hash : NULL);
+}
+
+static int *
+resource_index_bucket(pdf_resource_index_t *pri, int rtype, const byte *key)
+{
+    uint h = key[0] + (key[1] << 8) + (key[2] << 16) + ((uint)key[3] << 24);
+
+    h ^= (uint)rtype * 0x9e3779b9;
+    return &pri->buckets[h & (pri->num_buckets - 1)];
+}
+
+/* The list (bucket or pending) that holds an entry. */
+static int *
+resource_index_list(pdf_resource_index_t *pri, int slot)
+{
+    pdf_resource_index_entry_t *pe = &pri->entries[slot];
+
+    return (pe->hashed ? resource_index_bucket(pri, pe->rtype, pe->key) :
+            &pri->pending[pe->rtype]);
+}
+
+static void
+resource_index_link(pdf_resource_index_t *pri, int *phead, int slot)
+{
+    pdf_resource_index_entry_t *pe = &pri->entries[slot];
+
+    pe->prev = -1;
+    pe->next = *phead;
+    if (*phead >= 0)
+        pri->entries[*phead].prev = slot;
+    *phead = slot;
+}
+
+static void
+resource_index_unlink(pdf_resource_index_t *pri, int *phead, int slot)
+{
+    pdf_resource_index_entry_t *pe = &pri->entries[slot];
+
+    if (pe->prev >= 0)
+        pri->entries[pe->prev].next = pe->next;
+    else
+        *phead = pe->next;
+    if (pe->next >= 0)
+        pri->entries[pe->next].prev = pe->prev;
+}
+
+void
+pdf_init_resource_index(gx_device_pdf * pdev)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    int i, j;
+
+    memset(pri, 0, sizeof(*pri));
+    pri->free = -1;
+    for (i = 0; i < NUM_RESOURCE_TYPES; i++) {
+        pri->pending[i] = -1;
+        for (j = 0; j < NUM_RESOURCE_CHAINS; j++)
+            pri->heads[i][j] = -1;
+    }
+}
+
+void
+pdf_free_resource_index(gx_device_pdf * pdev)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    gs_memory_t *mem = pdev->pdf_memory->non_gc_memory;
+    int i;
+
+    for (i = 0; i < pri->num_entries; i++) {
+        pdf_resource_t *pres = pri->entries[i].pres;
+
+        if (pres != NULL)
+            pres->index_slot = -1;
+    }
+    gs_free_object(mem, pri->entries, "pdf_free_resource_index(entries)");
+    gs_free_object(mem, pri->buckets, "pdf_free_resource_index(buckets)");
+    pdf_init_resource_index(pdev);
+}
+
+/* Add a pending entry for a resource. */
+static int
+resource_index_add(gx_device_pdf * pdev, pdf_resource_t *pres,
+                   pdf_resource_type_t rtype, int chain)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    pdf_resource_index_entry_t *pe;
+    int slot;
+
+    if (pri->free < 0) {
+        gs_memory_t *mem = pdev->pdf_memory->non_gc_memory;
+        int num_entries = max(pri->num_entries * 2, RESOURCE_INDEX_MIN_ENTRIES);
+        pdf_resource_index_entry_t *entries = (pdf_resource_index_entry_t *)
+            gs_alloc_byte_array(mem, num_entries, sizeof(*entries),
+                                "resource_index_add");
+        int i;
+
+        if (entries == NULL)
+            return_error(gs_error_VMerror);
+        if (pri->num_entries > 0)
+            memcpy(entries, pri->entries, pri->num_entries * sizeof(*entries));
+        for (i = pri->num_entries; i < num_entries; i++) {
+            entries[i].pres = NULL;
+            entries[i].next = i + 1;
+        }
+        entries[num_entries - 1].next = -1;
+        gs_free_object(mem, pri->entries, "resource_index_add");
+        pri->free = pri->num_entries;
+        pri->entries = entries;
+        pri->num_entries = num_entries;
+    }
+    slot = pri->free;
+    pe = &pri->entries[slot];
+    pri->free = pe->next;
+    pe->pres = pres;
+    pe->type = NULL;
+    pe->order = 0;
+    pe->rtype = rtype;
+    pe->chain = chain;
+    pe->hashed = false;
+    resource_index_link(pri, &pri->pending[rtype], slot);
+    pres->index_slot = slot;
+    return 0;
+}
+
+/* Move a pending entry into its bucket, once its object is hashed. */
+static int
+resource_index_hash_entry(gx_device_pdf * pdev, int slot, const byte *key)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    pdf_resource_index_entry_t *pe;
+    cos_object_t *pco;
+    int i;
+
+    if (pri->num_hashed >= pri->num_buckets) {
+        gs_memory_t *mem = pdev->pdf_memory->non_gc_memory;
+        int num_buckets = max(pri->num_buckets * 2, RESOURCE_INDEX_MIN_BUCKETS);
+        int *buckets = (int *)gs_alloc_byte_array(mem, num_buckets, sizeof(int),
+                                                  "resource_index_hash_entry");
+
+        if (buckets == NULL)
+            return_error(gs_error_VMerror);
+        for (i = 0; i < num_buckets; i++)
+            buckets[i] = -1;
+        gs_free_object(mem, pri->buckets, "resource_index_hash_entry");
+        pri->buckets = buckets;
+        pri->num_buckets = num_buckets;
+        for (i = 0; i < pri->num_entries; i++) {
+            pe = &pri->entries[i];
+            if (pe->pres != NULL && pe->hashed)
+                resource_index_link(pri, resource_index_bucket(pri, pe->rtype, pe->key), i);
+        }
+    }
+    pe = &pri->entries[slot];
+    pco = pe->pres->object;
+    resource_index_unlink(pri, &pri->pending[pe->rtype], slot);
+    memcpy(pe->key, key, sizeof(pe->key));
+    pe->type = cos_type(pco);
+    pe->hashed = true;
+    resource_index_link(pri, resource_index_bucket(pri, pe->rtype, pe->key), slot);
+    pri->num_hashed++;
+    pri->num_typed[pe->rtype][resource_index_class(pe->type)]++;
+    pco->indexed_by = pdev;
+    return 0;
+}
+
+/* Move an entry from its bucket back to the pending list. */
+static void
+resource_index_unhash_entry(pdf_resource_index_t *pri, int slot)
+{
+    pdf_resource_index_entry_t *pe = &pri->entries[slot];
+
+    resource_index_unlink(pri, resource_index_list(pri, slot), slot);
+    pe->hashed = false;
+    pri->num_hashed--;
+    pri->num_typed[pe->rtype][resource_index_class(pe->type)]--;
+    resource_index_link(pri, &pri->pending[pe->rtype], slot);
+}
+
+/* Remove a resource from the index. */
+void
+pdf_unindex_resource(gx_device_pdf * pdev, pdf_resource_t *pres)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    int slot = pres->index_slot;
+    pdf_resource_index_entry_t *pe;
+
+    if (slot < 0)
+        return;
+    pe = &pri->entries[slot];
+    if (pe->hashed) {
+        if (pres->object != NULL && pres->object->indexed_by == pdev)
+            pres->object->indexed_by = NULL;
+        resource_index_unhash_entry(pri, slot);
+    }
+    resource_index_unlink(pri, &pri->pending[pe->rtype], slot);
+    /*
+     * Everything after the recorded head has been scanned, so when the
+     * resource is still linked, the next one can take its place.
+     */
+    if (pri->heads[pe->rtype][pe->chain] == slot)
+        pri->heads[pe->rtype][pe->chain] =
+            (pres->next != NULL ? pres->next->index_slot : -1);
+    pe->pres = NULL;
+    pe->next = pri->free;
+    pri->free = slot;
+    pres->index_slot = -1;
+}
+
+/*
+ * Some hashed object has changed (or been released): move any entry whose
+ * key is no longer the hash of its object back to the pending list.
+ */
+static void
+resource_index_recheck(gx_device_pdf * pdev)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    int i;
+
+    for (i = 0; i < pri->num_entries; i++) {
+        pdf_resource_index_entry_t *pe = &pri->entries[i];
+        cos_object_t *pco;
+        const byte *hash;
+
+        if (pe->pres == NULL || !pe->hashed)
+            continue;
+        pco = pe->pres->object;
+        if (pco != NULL && pco->indexed_by == pdev && cos_type(pco) == pe->type &&
+            (hash = resource_index_hash(pco)) != NULL &&
+            !memcmp(hash, pe->key, sizeof(pe->key)))
+            continue;
+        if (pco != NULL && pco->indexed_by == pdev)
+            pco->indexed_by = NULL;
+        resource_index_unhash_entry(pri, i);
+    }
+    pri->stale = false;
+}
+
+/*
+ * Add entries for resources inserted at the heads of the chains since the
+ * last scan, and renumber the entries that were moved to the heads.
+ */
+static int
+resource_index_scan(gx_device_pdf * pdev, pdf_resource_type_t rtype)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    int j, code;
+
+    for (j = 0; j < NUM_RESOURCE_CHAINS; j++) {
+        pdf_resource_t *head = pdev->resources[rtype].chains[j], *pres;
+        int last = pri->heads[rtype][j];
+        ulong n = 0, order;
+
+        if (head == NULL || (last >= 0 && head->index_slot == last))
+            continue;
+        for (pres = head; pres != NULL; pres = pres->next, n++)
+            if (last >= 0 && pres->index_slot == last)
+                break;
+        order = pri->order += n;
+        for (pres = head; n > 0; pres = pres->next, n--) {
+            if (pres->index_slot < 0) {
+                code = resource_index_add(pdev, pres, rtype, j);
+                if (code < 0)
+                    return code;
+            }
+            pri->entries[pres->index_slot].order = order--;
+        }
+        pri->heads[rtype][j] = head->index_slot;
+    }
+    return 0;
+}
+
+/*
+ * Hash the pending entries whose objects now have a hash. Return 1 if
+ * some other resource's object of the given type still has to be hashed.
+ */
+static int
+resource_index_update_pending(gx_device_pdf * pdev, pdf_resource_type_t rtype,
+                              const pdf_resource_t *pres0, cos_type_t type)
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    int slot, next, unhashed = 0;
+
+    for (slot = pri->pending[rtype]; slot >= 0; slot = next) {
+        pdf_resource_index_entry_t *pe = &pri->entries[slot];
+        const cos_object_t *pco = pe->pres->object;
+        const byte *hash;
+
+        next = pe->next;
+        if (pco == NULL || resource_index_class(cos_type(pco)) < 0)
+            continue;
+        hash = resource_index_hash(pco);
+        if (hash != NULL) {
+            int code = resource_index_hash_entry(pdev, slot, hash);
+
+            if (code < 0)
+                return code;
+            continue;
+        }
+        /*
+         * A stream with no data can't be hashed, and cos_stream_equal
+         * fails on it without changing anything, so it doesn't count.
+         */
+        if (pe->pres != pres0 && cos_type(pco) == type &&
+            !(type == cos_type_stream && pco->pieces == NULL))
+            unhashed = 1;
+    }
+    return unhashed;
+}
+
+/* Find same resource by comparing against every resource of the type. */
+static int
+pdf_find_same_resource_in_chains(gx_device_pdf * pdev, pdf_resource_type_t rtype,
+        pdf_resource_t **ppres,
         int (*eq)(gx_device_pdf * pdev, pdf_resource_t *pres0, pdf_resource_t *pres1))
 {
     pdf_resource_t **pchain = pdev->resources[rtype].chains;
@@ -1338,6 +1682,94 @@ pdf_find_same_resource(gx_device_pdf * pdev, pdf_resource_type_t rtype, pdf_reso
     return 0;
 }
 
+/* Find same resource using the index, or return 2 if it can't be used. */
+static int
+pdf_find_same_resource_in_index(gx_device_pdf * pdev, pdf_resource_type_t rtype,
+        pdf_resource_t **ppres,
+        int (*eq)(gx_device_pdf * pdev, pdf_resource_t *pres0, pdf_resource_t *pres1))
+{
+    pdf_resource_index_t *pri = &pdev->resource_index;
+    pdf_resource_t *pres0 = *ppres;
+    cos_object_t *pco0 = pres0->object;
+    cos_type_t type = cos_type(pco0);
+    int class = resource_index_class(type);
+    pdf_resource_index_entry_t *same[RESOURCE_INDEX_MAX_SAME];
+    int num_same = 0, num_others, slot, i, code;
+    const byte *key;
+
+    if (class < 0)
+        return 2;
+    if (pri->stale)
+        resource_index_recheck(pdev);
+    code = resource_index_scan(pdev, rtype);
+    if (code < 0)
+        return code;
+    code = resource_index_update_pending(pdev, rtype, pres0, type);
+    if (code != 0)
+        return (code < 0 ? code : 2);
+    num_others = pri->num_typed[rtype][class];
+    slot = pres0->index_slot;
+    if (slot >= 0 && pri->entries[slot].hashed && pri->entries[slot].type == type)
+        num_others--;
+    if (num_others == 0)
+        return 0;		/* nothing to compare, so pco0 isn't hashed */
+    code = cos_object_equal_hash(pco0, pdev, &key);
+    if (code <= 0)
+        return (code < 0 ? code : 2);
+    for (slot = *resource_index_bucket(pri, rtype, key); slot >= 0;
+         slot = pri->entries[slot].next) {
+        pdf_resource_index_entry_t *pe = &pri->entries[slot];
+
+        if (pe->rtype != rtype || pe->type != type || pe->pres == pres0 ||
+            memcmp(pe->key, key, sizeof(pe->key)))
+            continue;
+        if (num_same == RESOURCE_INDEX_MAX_SAME)
+            return 2;
+        /* Insert in chain order. */
+        for (i = num_same++; i > 0; i--) {
+            pdf_resource_index_entry_t *pe1 = same[i - 1];
+
+            if (pe1->chain < pe->chain ||
+                (pe1->chain == pe->chain && pe1->order > pe->order))
+                break;
+            same[i] = pe1;
+        }
+        same[i] = pe;
+    }
+    for (i = 0; i < num_same; i++) {
+        pdf_resource_t *pres = same[i]->pres;
+        cos_object_t *pco1 = pres->object;
+
+        code = pco0->cos_procs->equal(pco0, pco1, pdev);
+        if (code < 0)
+            return code;
+        if (code > 0) {
+            code = eq(pdev, pres0, pres);
+            if (code < 0)
+                return code;
+            if (code > 0) {
+                *ppres = pres;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Find same resource. */
+int
+pdf_find_same_resource(gx_device_pdf * pdev, pdf_resource_type_t rtype, pdf_resource_t **ppres,
+        int (*eq)(gx_device_pdf * pdev, pdf_resource_t *pres0, pdf_resource_t *pres1))
+{
+    int code = pdf_find_same_resource_in_index(pdev, rtype, ppres, eq);
+
+    if (code == 2)
+        code = pdf_find_same_resource_in_chains(pdev, rtype, ppres, eq);
+    if (code > 0)
+        pdev->resource_index.same_found[rtype]++;
+    return code;
+}
+
 void
 pdf_drop_resource_from_chain(gx_device_pdf * pdev, pdf_resource_t *pres1, pdf_resource_type_t rtype)
 {
@@ -1371,6 +1803,7 @@ pdf_drop_resource_from_chain(gx_device_pdf * pdev, pdf_resource_t *pres1, pdf_re
         pprev = pchain + i;
         for (; (pres = *pprev) != 0; pprev = &pres->next)
             if (pres == pres1) {
+                pdf_unindex_resource(pdev, pres);
                 *pprev = pres->next;
 #if 0
                 if (pres->object) {
@@ -1399,6 +1832,7 @@ pdf_drop_resources(gx_device_pdf * pdev, pdf_resource_type_t rtype,
         pprev = pchain + i;
         for (; (pres = *pprev) != 0; ) {
             if (cond(pdev, pres)) {
+                pdf_unindex_resource(pdev, pres);
                 *pprev = pres->next;
                 pres->next = pres; /* A temporary mark - see below */
             } else
@@ -1435,8 +1869,8 @@ pdf_print_resource_statistics(gx_device_pdf * pdev)
         for (i = 0; i < NUM_RESOURCE_CHAINS; i++) {
             for (pres = pchain[i]; pres != 0; pres = pres->next, n++);
         }
-        dmprintf3(pdev->pdf_memory, "Resource type %d (%s) has %d instances.\n", rtype,
-                (name ? name : ""), n);
+        dmprintf4(pdev->pdf_memory, "Resource type %d (%s) has %d instances, %ld duplicates found.\n", rtype,
+                (name ? name : ""), n, pdev->resource_index.same_found[rtype]);
     }
 }
 
@@ -1492,6 +1926,7 @@ pdf_alloc_aside(gx_device_pdf * pdev, pdf_resource_t ** plist,
         pdf_reserve_object_id(pdev, pres, id);
     pres->next = *plist;
     pres->rid = 0;
+    pres->index_slot = -1;
     *plist = pres;
     pres->prev = pdev->last_resource;
     pdev->last_resource = pres;
@@ -1655,6 +2090,8 @@ pdf_reverse_resource_chain(gx_device_pdf *pdev, pdf_resource_type_t rtype)
     }
     pres0->next = NULL;
     pdev->resources[rtype].chains[0] = pres;
+    /* Entries are renumbered in the new order by the next scan. */
+    pdev->resource_index.heads[rtype][0] = -1;
 }
 
 /*
@@ -1674,6 +2111,7 @@ pdf_free_resource_objects(gx_device_pdf *pdev, pdf_resource_type_t rtype)
             if (pres->named) {	/* named, don't free */
                 prev = &pres->next;
             } else {
+                pdf_unindex_resource(pdev, pres);
                 if (pres->object) {
                     cos_free(pres->object, "pdf_free_resource_objects");
                     pres->object = 0;
@@ -2638,8 +3076,10 @@ pdf_function(gx_device_pdf *pdev, const gs_function_t *pfn, cos_value_t *pvalue)
 
     if (code < 0)
         return code;
-    if (pres->object->md5_valid)
+    if (pres->object->md5_valid) {
         pres->object->md5_valid = 0;
+        cos_hash_changed(pres->object);
+    }
 
     code = pdf_substitute_resource(pdev, &pres, resourceFunction, functions_equal, false);
     if (code < 0)
@@ -188,6 +188,7 @@ typedef enum {
     bool global;                /* ps2write only */\
     char rname[1/*R*/ + (sizeof(long) * 8 / 3 + 1) + 1/*\0*/];\
     ulong where_used;                /* 1 bit per level of content stream */\
+    int index_slot;                /* entry in the resource index, or -1 */\
     cos_object_t *object
 typedef struct pdf_resource_s pdf_resource_t;
 struct pdf_resource_s {
@@ -280,6 +281,44 @@ typedef struct pdf_resource_list_s {
     pdf_resource_t *chains[NUM_RESOURCE_CHAINS];
 } pdf_resource_list_t;
 
+/*
+ * The resource index lets pdf_find_same_resource look up resources by the
+ * hash of their objects, rather than comparing against every resource of
+ * the type. Each resource found in the chains has an entry. An entry is
+ * 'pending' until the hash of its object is known, and then it is linked
+ * into a bucket. Cos objects whose hash keys an entry point back to the
+ * device (indexed_by), so that changing them can mark the index stale.
+ * The entries are allocated in non-GC memory; the device enumerates
+ * the resource pointers in them. The index is the last member of the
+ * device, since the offsets of the device parameters must fit in a short.
+ */
+typedef struct pdf_resource_index_entry_s {
+    pdf_resource_t *pres;        /* 0 if the entry is free */
+    cos_type_t type;                /* type of the object when hashed */
+    ulong order;                /* greater is nearer the head of the chain */
+    int next, prev;                /* bucket, pending or free list */
+    byte rtype;
+    byte chain;
+    bool hashed;                /* key is valid, entry is in a bucket */
+    byte key[16];                /* hash (of the data, for streams) */
+} pdf_resource_index_entry_t;
+
+typedef struct pdf_resource_index_s {
+    pdf_resource_index_entry_t *entries;
+    int num_entries;                /* allocated */
+    int free;                        /* first free entry, or -1 */
+    int *buckets;
+    int num_buckets;                /* a power of 2, or 0 */
+    int num_hashed;
+    int pending[NUM_RESOURCE_TYPES];        /* entries not yet hashed */
+    int num_typed[NUM_RESOURCE_TYPES][3];   /* hashed dicts, arrays, streams */
+    /* Entries of the chain heads when the chains were last scanned. */
+    int heads[NUM_RESOURCE_TYPES][NUM_RESOURCE_CHAINS];
+    ulong order;
+    bool stale;                        /* a hashed object has changed */
+    long same_found[NUM_RESOURCE_TYPES];    /* for PrintStatistics */
+} pdf_resource_index_t;
+
 /* Define the hash function for gs_ids. */
 #define gs_id_hash(rid) ((rid) + ((rid) / NUM_RESOURCE_CHAINS))
 /* Define the accessor for the proper hash chain. */
@@ -893,6 +932,7 @@ struct gx_device_pdf_s {
                                      * doing JPEG pass through we write the JPEG data here, and don't write
                                      * anything in the image processing routines.
                                      */
+    pdf_resource_index_t resource_index;    /* see above */
 };
 
 #define is_in_page(pdev)\
@@ -1094,6 +1134,13 @@ pdf_drop_resource_from_chain(gx_device_pdf * pdev, pdf_resource_t *pres1, pdf_re
 void pdf_drop_resources(gx_device_pdf * pdev, pdf_resource_type_t rtype,
         int (*cond)(gx_device_pdf * pdev, pdf_resource_t *pres));
 
+/* Set up or free the resource index (see pdf_find_same_resource). */
+void pdf_init_resource_index(gx_device_pdf * pdev);
+void pdf_free_resource_index(gx_device_pdf * pdev);
+
+/* Remove a resource from the index, before removing it from its chain. */
+void pdf_unindex_resource(gx_device_pdf * pdev, pdf_resource_t *pres);
+
 /* Print resource statistics. */
 void pdf_print_resource_statistics(gx_device_pdf * pdev);
 
@@ -249,7 +249,7 @@ pl_load_built_in_fonts(const char *pathname, gs_memory_t * mem,
                        pl_dict_t * pfontdict, gs_font_dir * pdir, int storage,
                        bool use_unicode_names_for_keys)
 {
-    int i, k;
+    int i, k, code;
     UW16 bSize, status = 0;
     byte key[3];
     UB8 pthnm[1024];
@@ -263,7 +263,10 @@ pl_load_built_in_fonts(const char *pathname, gs_memory_t * mem,
 
     pl_ufst_root_dir(ufst_root_dir, sizeof(ufst_root_dir));
 
-    status = gx_UFST_init(mem, ufst_root_dir);
+    /* Fails if another instance has the UFST. */
+    code = gx_UFST_init(mem, ufst_root_dir);
+    if (code < 0)
+        return FALSE;
 
     if (!plugins_opened) {
 
@@ -517,6 +520,10 @@ pl_close_built_in_fonts(pl_dict_t * builtinfonts)
 {
     int i;
 
+    /* Nothing was loaded if another instance has the UFST. */
+    if (pl_dict_length(builtinfonts, true) == 0)
+        return;
+
     /* close fco's */
     gx_UFST_close_static_fcos();
 
@@ -525,7 +532,7 @@ pl_close_built_in_fonts(pl_dict_t * builtinfonts)
         CGIFfco_Close(FSA fcHndlPlAry[i]);
         dprintf1("closing handle %d\n", fcHndlPlAry[i]);
     }
-    gx_UFST_fini();
+    gx_UFST_fini(builtinfonts->memory);
 }
 
 /* These are not implemented */
@@ -1,13 +1,24 @@
+/* Stress test for running several gsapi instances concurrently.
+ *
+ * Usage: apitest [-T<threads>] [-I<iterations>] <gs args> -o <file> ...
+ *
+ * Each thread runs <iterations> complete instances one after another,
+ * writing to <file><threadnum>. Once all threads are done, every output
+ * file is compared with that of thread 0.
+ */
 #include <pthread.h>
+#include "std.h"
 #include "ierrors.h"
 #include "iapi.h"
-#include <gp.h>
+#include "gp.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define NUM_THREADS 10
+#define MAX_THREADS 64
 
+static int num_threads = 10;
+static int num_iterations = 1;
 static int my_argc;
 static char **my_argv;
 static int my_argv_file;
@@ -47,8 +58,8 @@ my_stderr(void *instance, const char *str, int len)
 
 static void *gs_main(void *arg)
 {
-    int threadnum = (int)(void *)arg;
-    int code, code1;
+    int threadnum = (int)(size_t)arg;
+    int code = 0, code1, iter;
     char text[256];
     void *minst;
     char **gsargv;
@@ -79,22 +90,28 @@ static void *gs_main(void *arg)
     len = sizeof(text)+1-pos;
     snprintf(text+pos, len, "%d", threadnum);
 
-    code = gsapi_new_instance(&minst, &stdio);
-    if (code < 0)
+    for (iter = 0; iter < num_iterations; iter++)
     {
-        fprintf(stdio.stderr, "gsapi_new_instance failure in thread %d\n", threadnum);
-        free(gsargv);
-        return (void *)-1;
-    }
+        code = gsapi_new_instance(&minst, &stdio);
+        if (code < 0)
+        {
+            fprintf(stdio.stderr, "gsapi_new_instance failure in thread %d\n", threadnum);
+            free(gsargv);
+            return (void *)-1;
+        }
 
-    gsapi_set_stdio(minst, my_stdin, my_stdout, my_stderr);
+        gsapi_set_stdio(minst, my_stdin, my_stdout, my_stderr);
 
-    code = gsapi_init_with_args(minst, gsargc, gsargv);
-    code1 = gsapi_exit(minst);
-    if ((code == 0) || (code == gs_error_Quit))
-        code = code1;
+        code = gsapi_init_with_args(minst, gsargc, gsargv);
+        code1 = gsapi_exit(minst);
+        if ((code == 0) || (code == gs_error_Quit))
+            code = code1;
+
+        gsapi_delete_instance(minst);
 
-    gsapi_delete_instance(minst);
+        if ((code != 0) && (code != gs_error_Quit))
+            break;
+    }
 
     free(gsargv);
 
@@ -104,18 +121,62 @@ static void *gs_main(void *arg)
     return (void *)1;
 }
 
+/* Returns 0 if the two files have identical contents. */
+static int
+compare_files(const char *name0, const char *name1)
+{
+    FILE *f0 = gp_fopen(name0, "rb");
+    FILE *f1 = gp_fopen(name1, "rb");
+    int c0, c1, code = 1;
+
+    if (f0 && f1) {
+        do {
+            c0 = getc(f0);
+            c1 = getc(f1);
+        } while (c0 == c1 && c0 != EOF);
+        code = (c0 != c1);
+    }
+    if (f0)
+        fclose(f0);
+    if (f1)
+        fclose(f1);
+    return code;
+}
+
 int main(int argc, char *argv[])
 {
-    int i;
-    pthread_t thread[NUM_THREADS];
+    int i, failed = 0;
+    pthread_t thread[MAX_THREADS];
+    void *result;
+    char name0[256], name[256];
+
+    /* Strip our own leading switches; the rest go to Ghostscript. */
+    while (argc > 1)
+    {
+        if (!strncmp(argv[1], "-T", 2))
+            num_threads = atoi(argv[1] + 2);
+        else if (!strncmp(argv[1], "-I", 2))
+            num_iterations = atoi(argv[1] + 2);
+        else
+            break;
+        argv[1] = argv[0];
+        argv++;
+        argc--;
+    }
+    if (num_threads < 1 || num_threads > MAX_THREADS || num_iterations < 1)
+    {
+        fprintf(stderr, "Threads must be 1..%d and iterations at least 1\n",
+                MAX_THREADS);
+        exit(EXIT_FAILURE);
+    }
 
     my_argc = argc;
     my_argv = argv;
-    
+
     for (i=0; i < argc; i++)
         if (!strcmp(argv[i], "-o"))
             break;
-    
+
     if (i >= argc-1)
     {
         fprintf(stderr, "Expected a -o argument to rewrite!\n");
@@ -123,22 +184,39 @@ int main(int argc, char *argv[])
     }
     my_argv_file = i+1;
 
-    for (i=0; i < NUM_THREADS; i++)
+    for (i=0; i < num_threads; i++)
     {
-        if (pthread_create(&thread[i], NULL, gs_main, (void *)i) != 0)
+        if (pthread_create(&thread[i], NULL, gs_main, (void *)(size_t)i) != 0)
         {
             fprintf(stderr, "Thread %d creation failed\n", i);
             exit(EXIT_FAILURE);
         }
     }
 
-    for (i=0; i < NUM_THREADS; i++)
+    for (i=0; i < num_threads; i++)
     {
-        if (pthread_join(thread[i], NULL) != 0)
+        if (pthread_join(thread[i], &result) != 0)
         {
             fprintf(stderr, "Thread %d join failed\n", i);
             exit(EXIT_FAILURE);
         }
+        if (result != NULL)
+        {
+            fprintf(stderr, "Thread %d failed; see stderr.%d\n", i, i);
+            failed = 1;
+        }
+    }
+
+    /* Every thread rendered the same job, so the outputs should match. */
+    snprintf(name0, sizeof(name0), "%s0", argv[my_argv_file]);
+    for (i=1; i < num_threads; i++)
+    {
+        snprintf(name, sizeof(name), "%s%d", argv[my_argv_file], i);
+        if (compare_files(name0, name))
+        {
+            fprintf(stderr, "Output %s differs from %s\n", name, name0);
+            failed = 1;
+        }
     }
-    return EXIT_SUCCESS;
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
 }
@@ -33,14 +33,6 @@
 #include "gp.h"
 #include "gsargs.h"
 
-#ifndef GS_THREADSAFE
-/* Number of threads to allow per process. Unless GS_THREADSAFE is defined
- * more than 1 is guaranteed to fail.
- */
-static int gsapi_instance_counter = 0;
-static const int gsapi_instance_max = 1;
-#endif
-
 
 /* Return revision numbers and strings of Ghostscript. */
 /* Used for determining if wrong GSDLL loaded. */
@@ -91,13 +83,6 @@ gsapi_new_instance(void **pinstance, void *caller_handle)
     if (pinstance == NULL)
         return gs_error_Fatal;
 
-#ifndef GS_THREADSAFE
-    /* limited to 1 instance, till it works :) */
-    if ( gsapi_instance_counter >= gsapi_instance_max )
-        return gs_error_Fatal;
-    ++gsapi_instance_counter;
-#endif
-
     if (*pinstance == NULL)
         /* first instance in this process */
         mem = gs_malloc_init();
@@ -134,9 +119,6 @@ gsapi_new_instance(void **pinstance, void *caller_handle)
 }
 
 /* Destroy an instance of Ghostscript */
-/* We do not support multiple instances, so make sure
- * we use the default instance only once.
- */
 GSDLLEXPORT void GSDLLAPI
 gsapi_delete_instance(void *instance)
 {
@@ -156,10 +138,6 @@ gsapi_delete_instance(void *instance)
 
         /* Release the memory (frees up everything) */
         gs_malloc_release(mem);
-
-#ifndef GS_THREADSAFE
-        --gsapi_instance_counter;
-#endif
     }
 }
 
@@ -520,6 +498,21 @@ gsapi_run_fileA(void *instance, const char *file_name,
 }
 #endif
 
+/* Put the VM back to the snapshot taken after initialisation */
+GSDLLEXPORT int GSDLLAPI
+gsapi_restore_snapshot(void *instance)
+{
+    gs_lib_ctx_t *ctx = (gs_lib_ctx_t *)instance;
+    int exit_code;
+
+    if (instance == NULL)
+        return gs_error_Fatal;
+
+    return gs_main_restore_snapshot(get_minst_from_memory(ctx->memory),
+                                    &exit_code,
+                                    &(get_minst_from_memory(ctx->memory)->error_object));
+}
+
 /* Exit the interpreter */
 GSDLLEXPORT int GSDLLAPI
 gsapi_exit(void *instance)
@@ -24,10 +24,10 @@
  * DLL exported functions should be as similar as possible to imain.c
  * You will need to include "ierrors.h".
  *
- * Current problems:
- * 1. Ghostscript does not support multiple instances.
- * 2. Global variables in gs_main_instance_default()
- *    and gsapi_instance_counter
+ * Several instances may exist at once, each used from one thread at a
+ * time.  They share only process wide state: the C stdio streams, the
+ * debugging flags set with -Z, and third party libraries without a
+ * context of their own, which are serialised with gp_global_lock().
  */
 
 /* Exported functions may need different prefix
@@ -132,30 +132,16 @@ typedef struct gsapi_revision_s {
 GSDLLEXPORT int GSDLLAPI
 gsapi_revision(gsapi_revision_t *pr, int len);
 
-/*
- * WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
- *  Ghostscript supports only one instance.
- *  The current implementation uses a global static instance
- *  counter to make sure that only a single instance is used.
- *  If you try to create two instances, the second attempt
- *  will return < 0 and set pinstance to NULL.
- * WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
- */
 /* Create a new instance of Ghostscript.
  * This instance is passed to most other API functions.
  * The caller_handle will be provided to callback functions.
+ * Any number of instances may be created; each must only be used by
+ * one thread at a time.
  */
 
 GSDLLEXPORT int GSDLLAPI
 gsapi_new_instance(void **pinstance, void *caller_handle);
 
-/*
- * WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
- *  Ghostscript supports only one instance.
- *  The current implementation uses a global static instance
- *  counter to make sure that only a single instance is used.
- * WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
- */
 /* Destroy an instance of Ghostscript
  * Before you call this, Ghostscript must have finished.
  * If Ghostscript has been initialised, you must call gsapi_exit()
@@ -296,6 +282,16 @@ gsapi_run_fileW(void *instance,
     const wchar_t *file_name, int user_errors, int *pexit_code);
 #endif
 
+/* Undo everything done in VM since initialization, to start a new job.
+ * The stacks are cleared, local and global VM are restored to the save
+ * taken at the end of gsapi_init_with_args(), and files opened since
+ * are closed; see gs_main_restore_snapshot() in imain.h.
+ * Returns gs_error_undefined with -dJOBSERVER (use ^D instead) or
+ * -dNOOUTERSAVE, when there is no snapshot.
+ */
+GSDLLEXPORT int GSDLLAPI
+gsapi_restore_snapshot(void *instance);
+
 /* Exit the interpreter.
  * This must be called on shutdown if gsapi_init_with_args()
  * has been called, and just before gsapi_delete_instance().
@@ -353,6 +349,7 @@ typedef int (GSDLLAPIPTR PFN_gsapi_run_fileA)(void *instance,
 typedef int (GSDLLAPIPTR PFN_gsapi_run_fileW)(void *instance,
     const wchar_t *file_name, int user_errors, int *pexit_code);
 #endif
+typedef int (GSDLLAPIPTR PFN_gsapi_restore_snapshot)(void *instance);
 typedef int (GSDLLAPIPTR PFN_gsapi_exit)(void *instance);
 
 #ifdef __MACOS__
@@ -117,6 +117,8 @@ get_local_op_array(const gs_memory_t *mem)
 /* ------ Forward references ------ */
 
 static int gs_run_init_file(gs_main_instance *, int *, ref *);
+static int push_value(gs_main_instance *, ref *);
+static int pop_snapshot(gs_main_instance *);
 void print_resource_usage(const gs_main_instance *,
                                   gs_dual_memory_t *, const char *);
 
@@ -293,11 +295,14 @@ int gs_main_init2aux(gs_main_instance * minst) {
 
         if ((code = gs_main_run_string(minst,
                 "JOBSERVER "
-                " { false 0 .startnewjob } "
-                " { NOOUTERSAVE not { save pop } if } "
+                " { false 0 .startnewjob null } "
+                " { NOOUTERSAVE { null } { save } ifelse } "
                 "ifelse", 0, &exit_code,
                 &error_object)) < 0)
            return code;
+        /* The outer save, if any, is the snapshot. */
+        if ((code = pop_snapshot(minst)) < 0)
+           return code;
     }
     return 0;
 }
@@ -659,6 +664,36 @@ gs_main_run_string_end(gs_main_instance * minst, int user_errors,
                         perror_object);
 }
 
+/* ------ VM snapshot ------ */
+
+/* Restore the VM to the snapshot taken after initialization, and retake it. */
+int
+gs_main_restore_snapshot(gs_main_instance * minst, int *pexit_code,
+                         ref * perror_object)
+{
+    i_ctx_t *i_ctx_p = minst->i_ctx_p;
+    ref vref;
+    int code;
+
+    if (minst->init_done < 2 || minst->snapshot == 0)
+        return_error(gs_error_undefined);
+    if (alloc_find_save(idmemory, minst->snapshot) == 0)
+        return_error(gs_error_invalidrestore);
+    /* The stacks may refer to objects created since the snapshot, and */
+    /* are left as they were by a job that failed. */
+    gs_interp_reset(i_ctx_p);
+    make_tav(&vref, t_save, 0, saveid, minst->snapshot);
+    code = push_value(minst, &vref);
+    if (code < 0)
+        return code;
+    minst->snapshot = 0;
+    code = gs_main_run_string(minst, "restore save", 0,
+                              pexit_code, perror_object);
+    if (code < 0)
+        return code;
+    return pop_snapshot(minst);
+}
+
 /* ------ Operand stack access ------ */
 
 /* These are built for comfort, not for speed. */
@@ -722,6 +757,21 @@ pop_value(i_ctx_t *i_ctx_p, ref * pvalue)
     return 0;
 }
 
+/* Pop the snapshot, a save or null, from the operand stack. */
+static int
+pop_snapshot(gs_main_instance * minst)
+{
+    i_ctx_t *i_ctx_p = minst->i_ctx_p;
+    ref vref;
+    int code = pop_value(i_ctx_p, &vref);
+
+    if (code < 0)
+        return code;
+    minst->snapshot = (r_has_type(&vref, t_save) ? vref.value.saveid : 0);
+    ref_stack_pop(&o_stack, 1);
+    return 0;
+}
+
 int
 gs_pop_boolean(gs_main_instance * minst, bool * result)
 {
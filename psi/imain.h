@@ -198,6 +198,17 @@ int gs_main_run_string_continue(gs_main_instance * minst,
 int gs_main_run_string_end(gs_main_instance * minst, int user_errors,
                            int *pexit_code, ref * perror_object);
 
+/*
+ * Unless -dJOBSERVER or -dNOOUTERSAVE was given, initialization ends with
+ * a save of local and global VM, the snapshot.  gs_main_restore_snapshot
+ * resets the stacks, restores that save, so everything the jobs run since
+ * then did in VM is undone and the files they opened are closed, and takes
+ * the snapshot again.  This is much cheaper than initializing a new
+ * instance.  It returns gs_error_undefined if there is no snapshot.
+ */
+int gs_main_restore_snapshot(gs_main_instance * minst, int *pexit_code,
+                             ref * perror_object);
+
 /* ---------------- Operand stack access ---------------- */
 
 /*
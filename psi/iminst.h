@@ -77,6 +77,8 @@ struct gs_main_instance_s {
     i_ctx_t *i_ctx_p;		/* current interpreter context state */
     char *saved_pages_initial_arg;	/* used to defer processing of --saved-pages=begin... */
     bool saved_pages_test_mode;	/* for regression testing of saved-pages */
+    ulong snapshot;		/* save id of the VM after initialization, */
+                                /* 0 if none (see gs_main_restore_snapshot) */
 };
 
 /*
@@ -511,10 +511,11 @@ $(PSOBJ)zht.$(OBJ) : $(PSSRC)zht.c $(OP) $(memory__h)\
 	$(PSCC) $(PSO_)zht.$(OBJ) $(C_) $(PSSRC)zht.c
 
 $(PSOBJ)zimage.$(OBJ) : $(PSSRC)zimage.c $(OP) $(math__h) $(memory__h) $(stat__h)\
- $(gscspace_h) $(gscssub_h) $(gsimage_h) $(gsmatrix_h) $(gsstruct_h)\
- $(gxiparam_h)\
+ $(gscspace_h) $(gscssub_h) $(gsimage_h) $(gsmatrix_h) $(gscoord_h) $(gsstruct_h)\
+ $(gxiparam_h) $(gxpath_h)\
  $(estack_h) $(ialloc_h) $(ifilter_h) $(igstate_h) $(iimage_h) $(ilevel_h)\
- $(store_h) $(stream_h) $(gxcspace_h)\
+ $(store_h) $(stream_h) $(gxcspace_h) $(gsparam_h) $(gxdevsop_h)\
+ $(strimpl_h) $(files_h)\
  $(INT_MAK) $(MAKEDIRS)
 	$(PSCC) $(PSO_)zimage.$(OBJ) $(C_) $(PSSRC)zimage.c
 
@@ -1910,7 +1911,7 @@ $(PSOBJ)gs.$(OBJ) : $(PSSRC)gs.c $(GH)\
 
 $(PSOBJ)apitest.$(OBJ) : $(PSSRC)apitest.c $(GH)\
  $(ierrors_h) $(iapi_h) $(imain_h) $(imainarg_h) $(iminst_h) $(gsmalloc_h)\
- $(locale__h) $(gp_h) $(INT_MAK) $(MAKEDIRS)
+ $(locale__h) $(gp_h) $(std_h) $(INT_MAK) $(MAKEDIRS)
 	$(PSCC) $(PSO_)apitest.$(OBJ) $(C_) $(PSSRC)apitest.c
 
 $(PSOBJ)iapi.$(OBJ) : $(PSSRC)iapi.c $(AK)\
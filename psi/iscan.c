@@ -47,16 +47,6 @@
 #define recognize_btokens()\
   (ref_binary_object_format.value.intval != 0 && level2_enabled)
 
-/* Procedure for handling DSC comments if desired. */
-/* Set at initialization if a DSC handling module is included. */
-int (*gs_scan_dsc_proc) (const byte *, uint) = NULL;
-
-/* Procedure for handling all comments if desired. */
-/* Set at initialization if a comment handling module is included. */
-/* If both gs_scan_comment_proc and gs_scan_dsc_proc are set, */
-/* scan_comment_proc is called only for non-DSC comments. */
-int (*gs_scan_comment_proc) (const byte *, uint) = NULL;
-
 /*
  * Level 2 includes some changes in the scanner:
  *      - \ is always recognized in strings, regardless of the data source;
@@ -346,6 +336,7 @@ scan_comment(i_ctx_t *i_ctx_p, ref *pref, scanner_state *pstate,
              const byte * base, const byte * end, bool saved)
 {
     uint len = (uint) (end - base);
+    gs_lib_ctx_t *ctx = imemory->gs_lib_ctx;
     int code;
 #ifdef DEBUG
     const char *sstr = (saved ? ">" : "");
@@ -360,8 +351,8 @@ scan_comment(i_ctx_t *i_ctx_p, ref *pref, scanner_state *pstate,
             dmputs(imemory, "\n");
         }
 #endif
-        if (gs_scan_dsc_proc != NULL) {
-            code = gs_scan_dsc_proc(base, len);
+        if (ctx->scan_dsc_proc != NULL) {
+            code = ctx->scan_dsc_proc(base, len);
             return (code < 0 ? code : 0);
         }
         if (pstate->s_options & SCAN_PROCESS_DSC_COMMENTS) {
@@ -379,8 +370,8 @@ scan_comment(i_ctx_t *i_ctx_p, ref *pref, scanner_state *pstate,
         }
     }
 #endif
-    if (gs_scan_comment_proc != NULL) {
-        code = gs_scan_comment_proc(base, len);
+    if (ctx->scan_comment_proc != NULL) {
+        code = ctx->scan_comment_proc(base, len);
         return (code < 0 ? code : 0);
     }
     if (pstate->s_options & SCAN_PROCESS_COMMENTS) {
@@ -191,17 +191,11 @@ int gs_scan_handle_refill(i_ctx_t *i_ctx_p, scanner_state * pstate,
                           bool save, op_proc_t cont);
 
 /*
- * Define the procedure "hook" for parsing DSC comments.  If not NULL,
- * this procedure is called for every DSC comment seen by the scanner.
+ * The procedure "hooks" for parsing DSC comments and general comments
+ * are scan_dsc_proc and scan_comment_proc in the instance's gs_lib_ctx.
+ * If not NULL, scan_dsc_proc is called for every DSC comment seen by the
+ * scanner, and scan_comment_proc for every comment.  If both are set,
+ * scan_comment_proc is called only for non-DSC comments.
  */
-extern int (*gs_scan_dsc_proc) (const byte *, uint);
-
-/*
- * Define the procedure "hook" for parsing general comments.  If not NULL,
- * this procedure is called for every comment seen by the scanner.
- * If both gs_scan_dsc_proc and gs_scan_comment_proc are set,
- * gs_scan_comment_proc is called only for non-DSC comments.
- */
-extern int (*gs_scan_comment_proc) (const byte *, uint);
 
 #endif /* iscan_INCLUDED */
@@ -24,8 +24,10 @@
 #include "gscspace.h"
 #include "gscolor2.h"
 #include "gsmatrix.h"
+#include "gscoord.h"
 #include "gsimage.h"
 #include "gxfixed.h"
+#include "gxpath.h"
 #include "gsstruct.h"
 #include "gxiparam.h"
 #include "idict.h"
@@ -39,6 +41,10 @@
 #include "ifilter.h"		/* for stream exception handling */
 #include "iimage.h"
 #include "gxcspace.h"
+#include "gsparam.h"
+#include "gxdevsop.h"
+#include "strimpl.h"
+#include "files.h"
 
 /* Forward references */
 static int zimage_data_setup(i_ctx_t *i_ctx_p, const gs_pixel_image_t * pim,
@@ -190,6 +196,151 @@ zimage_setup(i_ctx_t *i_ctx_p, const gs_pixel_image_t * pim,
                              sources, npop);
 }
 
+/* Read a device parameter into list, which the caller must release. */
+static int
+image_device_param(gx_device *dev, const char *name, gs_c_param_list *list)
+{
+    dev_param_req_t request;
+    int code;
+
+    gs_c_param_list_write(list, dev->memory);
+    request.Param = (char *)name;
+    request.list = list;
+    code = dev_proc(dev, dev_spec_op)(dev, gxdso_get_dev_param, &request, sizeof(dev_param_req_t));
+    if (code < 0 && code != gs_error_undefined)
+        return code;
+    gs_c_param_list_read(list);
+    return 0;
+}
+
+static bool
+image_device_is_high_level(gx_device *dev)
+{
+    gs_c_param_list list;
+    bool highlevel = false;
+    int code = image_device_param(dev, "HighLevelDevice", &list);
+
+    if (code >= 0)
+        code = param_read_bool((gs_param_list *)&list, "HighLevelDevice", &highlevel);
+    gs_c_param_list_release(&list);
+    return code == 0 && highlevel;
+}
+
+/* The number of threads the device renders with, besides the main one. */
+static int
+image_device_rendering_threads(gx_device *dev)
+{
+    gs_c_param_list list;
+    int nthreads = 0;
+    int code = image_device_param(dev, "NumRenderingThreads", &list);
+
+    if (code >= 0)
+        code = param_read_int((gs_param_list *)&list, "NumRenderingThreads", &nthreads);
+    gs_c_param_list_release(&list);
+    return code == 0 && nthreads > 0 ? nthreads : 0;
+}
+
+/*
+ * Find the samples of an image that can fall inside the clipping region,
+ * given the mapping mat from image space to device space, with a margin
+ * of a few samples for interpolation and rounding.
+ */
+static void
+image_visible_samples(i_ctx_t *i_ctx_p, const gs_image_t *pim,
+                      const gs_matrix *mat, int margin, gs_int_rect *visible)
+{
+    gx_clip_path *pcpath;
+    gs_fixed_rect cbox;
+    gs_rect dbox, ibox;
+    gs_matrix dmat;
+
+    visible->p.x = visible->p.y = 0;
+    visible->q.x = pim->Width;
+    visible->q.y = pim->Height;
+    if (gx_effective_clip_path(igs, &pcpath) < 0 ||
+        gs_matrix_invert(mat, &dmat) < 0)
+        return;
+    gx_cpath_outer_box(pcpath, &cbox);
+    dbox.p.x = fixed2float(cbox.p.x);
+    dbox.p.y = fixed2float(cbox.p.y);
+    dbox.q.x = fixed2float(cbox.q.x);
+    dbox.q.y = fixed2float(cbox.q.y);
+    if (gs_bbox_transform(&dbox, &dmat, &ibox) < 0 ||
+        ibox.p.x > max_int / 2 || ibox.p.y > max_int / 2 ||
+        ibox.q.x < min_int / 2 || ibox.q.y < min_int / 2)
+        return;
+    if (ibox.p.x - margin > 0)
+        visible->p.x = (int)min(floor(ibox.p.x) - margin, pim->Width);
+    if (ibox.p.y - margin > 0)
+        visible->p.y = (int)min(floor(ibox.p.y) - margin, pim->Height);
+    if (ibox.q.x + margin < pim->Width)
+        visible->q.x = (int)max(ceil(ibox.q.x) + margin, visible->p.x);
+    if (ibox.q.y + margin < pim->Height)
+        visible->q.y = (int)max(ceil(ibox.q.y) + margin, visible->p.y);
+}
+
+/*
+ * If the samples of an image come straight from a filter that can decode
+ * the image at a reduced size (such as DCTDecode or JPXDecode), tell it
+ * how much the current transformation shrinks the image, which part of it
+ * can be seen through the clip, and how many threads the device renders
+ * with.  If the filter does reduce the image, adjust the image to match.
+ * Indexed images are left alone, since the reduction averages the
+ * samples, and so are images for high level devices, which want the
+ * original data.
+ */
+static void
+image1_reduce_source(i_ctx_t *i_ctx_p, gs_image_t *pim, const image_params *pip)
+{
+    const ref *pds = &pip->DataSource[0];
+    gx_device *dev = gs_currentdevice(igs);
+    stream *s;
+    gs_matrix mat, ctm;
+    stream_reduce_request req;
+    double scale, sx, sy;
+    int factor, width, height;
+
+    if (pip->MultipleDataSources || !r_has_type(pds, t_file) ||
+        pim->BitsPerComponent != 8 || pim->Alpha != gs_image_alpha_none ||
+        pim->Width <= 1 || pim->Height <= 1 ||
+        gs_color_space_get_index(pim->ColorSpace) == gs_color_space_index_Indexed)
+        return;
+    s = fptr(pds);
+    if (s->read_id != r_size(pds) || s->state == NULL ||
+        s->state->templat->reduce == NULL)
+        return;
+    gs_currentmatrix(igs, &ctm);
+    if (gs_matrix_invert(&pim->ImageMatrix, &mat) < 0 ||
+        gs_matrix_multiply(&mat, &ctm, &mat) < 0 ||
+        image_device_is_high_level(dev))
+        return;
+    /* Device pixels per image sample, in the direction that has the most. */
+    scale = max(hypot(mat.xx, mat.xy), hypot(mat.yx, mat.yy));
+    req.width = pim->Width;
+    req.height = pim->Height;
+    req.num_comps = gs_color_space_num_components(pim->ColorSpace);
+    for (req.max_factor = 1; req.max_factor < 32 && scale * req.max_factor * 2 <= 1;)
+        req.max_factor *= 2;
+    image_visible_samples(i_ctx_p, pim, &mat, 2 * req.max_factor, &req.visible);
+    req.num_threads = image_device_rendering_threads(dev);
+    factor = s->state->templat->reduce(s->state, &req);
+    if (factor <= 1)
+        return;
+    width = (pim->Width + factor - 1) / factor;
+    height = (pim->Height + factor - 1) / factor;
+    /* Scale image space so the reduced image covers the same area. */
+    sx = (double)width / pim->Width;
+    sy = (double)height / pim->Height;
+    pim->ImageMatrix.xx *= sx;
+    pim->ImageMatrix.yx *= sx;
+    pim->ImageMatrix.tx *= sx;
+    pim->ImageMatrix.xy *= sy;
+    pim->ImageMatrix.yy *= sy;
+    pim->ImageMatrix.ty *= sy;
+    pim->Width = width;
+    pim->Height = height;
+}
+
 /* Common code for .image1 and .alphaimage operators */
 int
 image1_setup(i_ctx_t * i_ctx_p, bool has_alpha)
@@ -223,6 +374,7 @@ image1_setup(i_ctx_t * i_ctx_p, bool has_alpha)
         return code;
 
     image.Alpha = (has_alpha ? gs_image_alpha_last : gs_image_alpha_none);
+    image1_reduce_source(i_ctx_p, &image, &ip);
         /* swap Width, Height, and ImageMatrix so that it comes out the same */
         /* This is only for performance, so only do it for non-skew cases */
     if (image.Width == 1 && image.Height > 1 && image.BitsPerComponent == 8 &&
@@ -455,6 +455,35 @@ zgetscanconverter(i_ctx_t *i_ctx_p)
     make_int(op, gs_getscanconverter(imemory));
     return 0;
 }
+
+/* <threads> <threshold> .setscanconverterthreads - */
+static int
+zsetscanconverterthreads(i_ctx_t *i_ctx_p)
+{
+    os_ptr op = osp;
+
+    check_type(op[-1], t_integer);
+    check_type(*op, t_integer);
+    if (op[-1].value.intval < 0 || op->value.intval < 0)
+        return_error(gs_error_rangecheck);
+    gs_setscanconverterthreads(igs, op[-1].value.intval, op->value.intval);
+    pop(2);
+    return 0;
+}
+
+/* - .getscanconverterthreads <threads> <threshold> */
+static int
+zgetscanconverterthreads(i_ctx_t *i_ctx_p)
+{
+    os_ptr op = osp;
+    int threshold;
+    int threads = gs_getscanconverterthreads(imemory, &threshold);
+
+    push(2);
+    make_int(op - 1, threads);
+    make_int(op, threshold);
+    return 0;
+}
 /* ------ Initialization procedure ------ */
 
 const op_def zmisc_a_op_defs[] =
@@ -480,5 +509,7 @@ const op_def zmisc_b_op_defs[] =
     {"0.getCPSImode", zgetCPSImode},
     {"1.setscanconverter", zsetscanconverter},
     {"0.getscanconverter", zgetscanconverter},
+    {"2.setscanconverterthreads", zsetscanconverterthreads},
+    {"0.getscanconverterthreads", zgetscanconverterthreads},
     op_def_end(0)
 };
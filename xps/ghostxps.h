@@ -145,6 +145,7 @@ typedef struct xps_hash_table_s xps_hash_table_t;
 xps_hash_table_t *xps_hash_new(xps_context_t *ctx);
 void *xps_hash_lookup(xps_hash_table_t *table, char *key);
 int xps_hash_insert(xps_context_t *ctx, xps_hash_table_t *table, char *key, void *value);
+void *xps_hash_remove(xps_hash_table_t *table, char *key);
 void xps_hash_free(xps_context_t *ctx, xps_hash_table_t *table,
     void (*free_key)(xps_context_t *ctx, void *),
     void (*free_value)(xps_context_t *ctx, void *));
@@ -162,9 +163,11 @@ struct xps_part_s
     int size;
     int cap;
     byte *data;
+    int borrowed; /* data belongs to the package reader; do not modify or keep it */
 };
 
 xps_part_t *xps_new_part(xps_context_t *ctx, const char *name, int size);
+int xps_own_part_data(xps_context_t *ctx, xps_part_t *part);
 xps_part_t *xps_read_part(xps_context_t *ctx, const char *partname);
 void xps_free_part(xps_context_t *ctx, xps_part_t *part);
 
@@ -230,6 +233,13 @@ int xps_jpegxr_has_alpha(xps_context_t *ctx, byte *buf, int len);
 
 void xps_free_image(xps_context_t *ctx, xps_image_t *image);
 
+/* Decoded images kept across pages, least recently used dropped first */
+
+typedef struct xps_image_cache_s xps_image_cache_t;
+
+xps_image_cache_t *xps_image_cache_new(xps_context_t *ctx);
+void xps_image_cache_free(xps_context_t *ctx, xps_image_cache_t *cache);
+
 /*
  * Fonts.
  */
@@ -373,6 +383,8 @@ int xps_image_brush_has_transparency(xps_context_t *ctx, char *base_uri, xps_ite
  */
 
 typedef struct xps_entry_s xps_entry_t;
+typedef struct xps_zip_job_s xps_zip_job_t;
+typedef struct xps_zip_pool_s xps_zip_pool_t;
 
 struct xps_entry_s
 {
@@ -380,6 +392,8 @@ struct xps_entry_s
     int offset;
     int csize;
     int usize;
+    int method;
+    xps_zip_job_t *job; /* inflated ahead of time, if not NULL */
 };
 
 struct xps_context_s
@@ -400,6 +414,9 @@ struct xps_context_s
     FILE *file;
     int zip_count;
     xps_entry_t *zip_table;
+    const byte *zip_map; /* whole package mapped into memory, or NULL */
+    int64_t zip_map_size;
+    xps_zip_pool_t *zip_pool; /* threads inflating parts for coming pages */
 
     char *start_part; /* fixed document sequence */
     xps_document_t *first_fixdoc; /* first fixed document */
@@ -410,9 +427,10 @@ struct xps_context_s
     char *base_uri; /* base uri for parsing XML and resolving relative paths */
     char *part_uri; /* part uri for parsing metadata relations */
 
-    /* We cache font and colorspace resources */
+    /* We cache font, colorspace and decoded image resources */
     xps_hash_table_t *font_table;
     xps_hash_table_t *colorspace_table;
+    xps_image_cache_t *image_cache;
 
     /* Global toggle for transparency */
     bool use_transparency;
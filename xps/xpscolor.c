@@ -193,6 +193,10 @@ xps_read_icc_colorspace(xps_context_t *ctx, char *base_uri, char *profilename)
             gs_warn1("cannot find icc profile part: %s", partname);
             return NULL;
         }
+        if (xps_own_part_data(ctx, part) < 0) {
+            xps_free_part(ctx, part);
+            return NULL;
+        }
 
         /* Create the profile */
         profile = gsicc_profile_new(NULL, ctx->memory, NULL, 0);
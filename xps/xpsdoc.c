@@ -32,6 +32,7 @@ xps_new_part(xps_context_t *ctx, const char *name, int size)
     }
     part->name = xps_strdup(ctx, name);
     part->size = size;
+    part->borrowed = 0;
     part->data = xps_alloc(ctx, size);
     if (!part->data) {
         xps_free(ctx, part);
@@ -46,10 +47,35 @@ void
 xps_free_part(xps_context_t *ctx, xps_part_t *part)
 {
     xps_free(ctx, part->name);
-    xps_free(ctx, part->data);
+    if (!part->borrowed)
+        xps_free(ctx, part->data);
     xps_free(ctx, part);
 }
 
+/*
+ * Parts read from a mapped package may point straight at the package
+ * data. Anything that wants to write to, or hold on to, the data after
+ * the part is freed must take a copy of its own first.
+ */
+
+int
+xps_own_part_data(xps_context_t *ctx, xps_part_t *part)
+{
+    byte *data;
+
+    if (!part->borrowed)
+        return 0;
+
+    data = xps_alloc(ctx, part->size);
+    if (!data)
+        return gs_throw(gs_error_VMerror, "out of memory: part data");
+    memcpy(data, part->data, part->size);
+    part->data = data;
+    part->borrowed = 0;
+
+    return 0;
+}
+
 /*
  * The FixedDocumentSequence and FixedDocument parts determine
  * which parts correspond to actual pages, and the page order.
@@ -702,6 +702,13 @@ xps_parse_glyphs(xps_context_t *ctx,
         if (!part)
             return gs_throw1(-1, "cannot find font resource part '%s'", partname);
 
+        /* The font keeps the data, and deobfuscation rewrites it */
+        if (xps_own_part_data(ctx, part) < 0)
+        {
+            xps_free_part(ctx, part);
+            return gs_rethrow1(-1, "cannot load font resource '%s'", partname);
+        }
+
         /* deobfuscate if necessary */
         if (strstr(part->name, ".odttf"))
             xps_deobfuscate_font_resource(ctx, part);
@@ -18,7 +18,8 @@
  *
  * Simple hashtable with open adressing linear probe.
  * Does not manage memory of key/value pointers.
- * Does not support deleting entries.
+ * Deleting moves later entries of a probe run back into the hole,
+ * so lookups never need tombstones.
  */
 
 #include "ghostxps.h"
@@ -202,6 +203,53 @@ xps_hash_insert(xps_context_t *ctx, xps_hash_table_t *table, char *key, void *va
     }
 }
 
+void *
+xps_hash_remove(xps_hash_table_t *table, char *key)
+{
+    xps_hash_entry_t *entries = table->entries;
+    unsigned int size = table->size;
+    unsigned int pos = xps_hash(key) % size;
+    unsigned int hole, home;
+    void *value;
+
+    while (1)
+    {
+        if (!entries[pos].value)
+            return NULL;
+
+        if (xps_strcasecmp(key, entries[pos].key) == 0)
+            break;
+
+        pos = (pos + 1) % size;
+    }
+
+    value = entries[pos].value;
+    entries[pos].key = NULL;
+    entries[pos].value = NULL;
+    table->load --;
+
+    /* Refill the hole with any entry further along the run that
+     * would otherwise become unreachable from its home slot. */
+    hole = pos;
+    while (1)
+    {
+        pos = (pos + 1) % size;
+        if (!entries[pos].value)
+            break;
+
+        home = xps_hash(entries[pos].key) % size;
+        if (hole <= pos ? (home <= hole || home > pos) : (home <= hole && home > pos))
+        {
+            entries[hole] = entries[pos];
+            entries[pos].key = NULL;
+            entries[pos].value = NULL;
+            hole = pos;
+        }
+    }
+
+    return value;
+}
+
 void
 xps_hash_debug(xps_hash_table_t *table)
 {
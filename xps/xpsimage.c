@@ -357,14 +357,212 @@ xps_paint_image_brush(xps_context_t *ctx, char *base_uri, xps_resource_t *dict,
     return 0;
 }
 
+/*
+ * Cache of decoded images.
+ *
+ * An ImageBrush is often repeated many times, both within a page and
+ * across pages, and decoding the part each time costs far more than
+ * drawing it. Decoded images are kept in a table keyed by part name
+ * (plus the override profile if any), and chained in most recently used
+ * order so that the oldest can be dropped when the total size of the
+ * samples would go over XPS_IMAGE_CACHE_SIZE.
+ */
+
+#ifndef XPS_IMAGE_CACHE_SIZE
+#define XPS_IMAGE_CACHE_SIZE (32 * 1024 * 1024)
+#endif
+
+typedef struct xps_image_cache_entry_s xps_image_cache_entry_t;
+
+struct xps_image_cache_entry_s
+{
+    char *key;
+    xps_image_t *image;
+    int has_alpha; /* as reported by the image file header */
+    size_t size;
+    xps_image_cache_entry_t *prev; /* more recently used */
+    xps_image_cache_entry_t *next; /* less recently used */
+};
+
+struct xps_image_cache_s
+{
+    xps_hash_table_t *table;
+    xps_image_cache_entry_t *head;
+    xps_image_cache_entry_t *tail;
+    size_t size;
+    size_t max_size;
+    int hits;
+    int misses;
+    int evictions;
+};
+
+xps_image_cache_t *
+xps_image_cache_new(xps_context_t *ctx)
+{
+    xps_image_cache_t *cache;
+
+    cache = xps_alloc(ctx, sizeof(xps_image_cache_t));
+    if (!cache)
+    {
+        gs_throw(gs_error_VMerror, "out of memory: image cache struct");
+        return NULL;
+    }
+
+    memset(cache, 0, sizeof(xps_image_cache_t));
+    cache->max_size = XPS_IMAGE_CACHE_SIZE;
+
+    cache->table = xps_hash_new(ctx);
+    if (!cache->table)
+    {
+        xps_free(ctx, cache);
+        gs_rethrow(gs_error_VMerror, "cannot create image cache table");
+        return NULL;
+    }
+
+    return cache;
+}
+
+static void
+xps_image_cache_unlink(xps_image_cache_t *cache, xps_image_cache_entry_t *entry)
+{
+    if (entry->prev)
+        entry->prev->next = entry->next;
+    else
+        cache->head = entry->next;
+    if (entry->next)
+        entry->next->prev = entry->prev;
+    else
+        cache->tail = entry->prev;
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+static void
+xps_image_cache_link(xps_image_cache_t *cache, xps_image_cache_entry_t *entry)
+{
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if (cache->head)
+        cache->head->prev = entry;
+    else
+        cache->tail = entry;
+    cache->head = entry;
+}
+
+static void
+xps_image_cache_drop(xps_context_t *ctx, xps_image_cache_t *cache, xps_image_cache_entry_t *entry)
+{
+    xps_image_cache_unlink(cache, entry);
+    xps_hash_remove(cache->table, entry->key);
+    cache->size -= entry->size;
+    xps_free_image(ctx, entry->image);
+    xps_free(ctx, entry->key);
+    xps_free(ctx, entry);
+}
+
+void
+xps_image_cache_free(xps_context_t *ctx, xps_image_cache_t *cache)
+{
+    if (!cache)
+        return;
+
+    if (gs_debug_c('|'))
+        dmprintf4(ctx->memory, "image cache: %d hits, %d misses, %d evictions, %ld bytes held\n",
+                  cache->hits, cache->misses, cache->evictions, (long)cache->size);
+
+    while (cache->head)
+        xps_image_cache_drop(ctx, cache, cache->head);
+
+    xps_hash_free(ctx, cache->table, NULL, NULL);
+    xps_free(ctx, cache);
+}
+
+/* Find a decoded image. When 'use' is set the entry counts as used:
+ * it moves to the front and the lookup is recorded in the statistics. */
+static xps_image_cache_entry_t *
+xps_image_cache_lookup(xps_image_cache_t *cache, char *key, int use)
+{
+    xps_image_cache_entry_t *entry;
+
+    if (!cache)
+        return NULL;
+
+    entry = xps_hash_lookup(cache->table, key);
+    if (use)
+    {
+        if (entry)
+        {
+            cache->hits ++;
+            xps_image_cache_unlink(cache, entry);
+            xps_image_cache_link(cache, entry);
+        }
+        else
+            cache->misses ++;
+    }
+
+    return entry;
+}
+
+/* Hand a decoded image over to the cache, dropping the least recently
+ * used images to make room. Returns 1 if the cache now owns the image,
+ * or 0 if the caller must free it (image too big, or out of memory). */
 static int
-xps_find_image_brush_source_part(xps_context_t *ctx, char *base_uri, xps_item_t *root,
-    xps_part_t **partp, char **profilep)
+xps_image_cache_insert(xps_context_t *ctx, xps_image_cache_t *cache, char *key,
+    xps_image_t *image, int has_alpha)
+{
+    xps_image_cache_entry_t *entry;
+    size_t size;
+
+    if (!cache)
+        return 0;
+
+    size = sizeof(xps_image_t) + (size_t)image->stride * image->height + image->profilesize;
+    if (image->alpha)
+        size += (size_t)image->width * image->height * (image->bits / 8);
+    if (size > cache->max_size)
+        return 0;
+
+    while (cache->tail && cache->size + size > cache->max_size)
+    {
+        xps_image_cache_drop(ctx, cache, cache->tail);
+        cache->evictions ++;
+    }
+
+    entry = xps_alloc(ctx, sizeof(xps_image_cache_entry_t));
+    if (!entry)
+        return 0;
+    entry->key = xps_strdup(ctx, key);
+    if (!entry->key)
+    {
+        xps_free(ctx, entry);
+        return 0;
+    }
+    entry->image = image;
+    entry->has_alpha = has_alpha;
+    entry->size = size;
+
+    if (xps_hash_insert(ctx, cache->table, entry->key, entry) < 0)
+    {
+        gs_catch(-1, "cannot add image to cache");
+        xps_free(ctx, entry->key);
+        xps_free(ctx, entry);
+        return 0;
+    }
+
+    xps_image_cache_link(cache, entry);
+    cache->size += size;
+
+    return 1;
+}
+
+/* Resolve the ImageSource attribute into an absolute image part name and
+ * the (relative) name of the override profile, if there is one. */
+static int
+xps_find_image_brush_source(xps_context_t *ctx, char *base_uri, xps_item_t *root,
+    char *partname, int partsize, char **profilep)
 {
-    xps_part_t *part;
     char *image_source_att;
     char buf[1024];
-    char partname[1024];
     char *image_name;
     char *profile_name;
     char *p;
@@ -404,30 +602,69 @@ xps_find_image_brush_source_part(xps_context_t *ctx, char *base_uri, xps_item_t
     if (!image_name)
         return gs_throw1(-1, "cannot parse image resource name '%s'", image_source_att);
 
-    xps_absolute_path(partname, base_uri, image_name, sizeof partname);
-    part = xps_read_part(ctx, partname);
-    if (!part)
-        return gs_rethrow1(-1, "cannot find image resource part '%s'", partname);
-
-    *partp = part;
+    xps_absolute_path(partname, base_uri, image_name, partsize);
     *profilep = xps_strdup(ctx, profile_name);
 
     return 0;
 }
 
+/* The same image converted with different profiles must not share an
+ * entry, so the absolute profile name is part of the cache key. Part
+ * names cannot contain spaces, which makes a space a safe separator. */
+static void
+xps_image_cache_key(char *key, int size, char *base_uri, char *partname, char *profilename)
+{
+    char profpart[1024];
+
+    gs_strlcpy(key, partname, size);
+    if (profilename)
+    {
+        xps_absolute_path(profpart, base_uri, profilename, sizeof profpart);
+        gs_strlcat(key, " ", size);
+        gs_strlcat(key, profpart, size);
+    }
+}
+
 int
 xps_parse_image_brush(xps_context_t *ctx, char *base_uri, xps_resource_t *dict, xps_item_t *root)
 {
+    xps_image_cache_entry_t *entry;
     xps_part_t *part;
     xps_image_t *image;
     gs_color_space *colorspace;
+    char partname[1024];
+    char key[2048];
     char *profilename;
+    int has_alpha;
     int code;
 
-    code = xps_find_image_brush_source_part(ctx, base_uri, root, &part, &profilename);
+    code = xps_find_image_brush_source(ctx, base_uri, root, partname, sizeof partname, &profilename);
     if (code < 0)
         return gs_rethrow(code, "cannot find image source");
 
+    xps_image_cache_key(key, sizeof key, base_uri, partname, profilename);
+
+    entry = xps_image_cache_lookup(ctx->image_cache, key, 1);
+    if (entry)
+    {
+        if (profilename)
+            xps_free(ctx, profilename);
+
+        code = xps_parse_tiling_brush(ctx, base_uri, dict, root, xps_paint_image_brush, entry->image);
+        if (code < 0)
+            return gs_rethrow(-1, "cannot parse tiling brush");
+
+        return 0;
+    }
+
+    part = xps_read_part(ctx, partname);
+    if (!part)
+    {
+        if (profilename)
+            xps_free(ctx, profilename);
+        return gs_rethrow1(-1, "cannot find image resource part '%s'", partname);
+    }
+
     image = xps_alloc(ctx, sizeof(xps_image_t));
     if (!image)
         return gs_throw(-1, "out of memory: image struct");
@@ -436,6 +673,8 @@ xps_parse_image_brush(xps_context_t *ctx, char *base_uri, xps_resource_t *dict,
     if (code < 0)
         return gs_rethrow1(code, "cannot decode image '%s'", part->name);
 
+    has_alpha = xps_image_has_alpha(ctx, part);
+
     /* Override any embedded colorspace profiles if the external one matches. */
     if (profilename)
     {
@@ -447,33 +686,57 @@ xps_parse_image_brush(xps_context_t *ctx, char *base_uri, xps_resource_t *dict,
         }
     }
 
-    code = xps_parse_tiling_brush(ctx, base_uri, dict, root, xps_paint_image_brush, image);
-    if (code < 0)
-        return gs_rethrow(-1, "cannot parse tiling brush");
-
     if (profilename)
         xps_free(ctx, profilename);
-    xps_free_image(ctx, image);
     xps_free_part(ctx, part);
 
+    /* Only add the image once it has been drawn, so that making room
+     * in the cache can never free an image that is still in use. */
+    code = xps_parse_tiling_brush(ctx, base_uri, dict, root, xps_paint_image_brush, image);
+
+    if (!xps_image_cache_insert(ctx, ctx->image_cache, key, image, has_alpha))
+        xps_free_image(ctx, image);
+
+    if (code < 0)
+        return gs_rethrow(-1, "cannot parse tiling brush");
+
     return 0;
 }
 
 int
 xps_image_brush_has_transparency(xps_context_t *ctx, char *base_uri, xps_item_t *root)
 {
+    xps_image_cache_entry_t *entry;
     xps_part_t *imagepart;
+    char partname[1024];
+    char key[2048];
+    char *profilename;
     int code;
     int has_alpha;
-    char *profilename;
 
-    code = xps_find_image_brush_source_part(ctx, base_uri, root, &imagepart, &profilename);
+    code = xps_find_image_brush_source(ctx, base_uri, root, partname, sizeof partname, &profilename);
     if (code < 0)
     {
         gs_catch(code, "cannot find image source");
         return 0;
     }
 
+    /* Answer from the cache if we have decoded this image before */
+    xps_image_cache_key(key, sizeof key, base_uri, partname, profilename);
+    if (profilename)
+        xps_free(ctx, profilename);
+
+    entry = xps_image_cache_lookup(ctx->image_cache, key, 0);
+    if (entry)
+        return entry->has_alpha;
+
+    imagepart = xps_read_part(ctx, partname);
+    if (!imagepart)
+    {
+        gs_catch1(-1, "cannot find image resource part '%s'", partname);
+        return 0;
+    }
+
     has_alpha = xps_image_has_alpha(ctx, imagepart);
 
     xps_free_part(ctx, imagepart);
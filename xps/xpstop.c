@@ -133,6 +133,8 @@ xps_imp_allocate_interp_instance(pl_interp_implementation_t *impl,
     ctx->file = NULL;
     ctx->zip_count = 0;
     ctx->zip_table = NULL;
+    ctx->zip_map = NULL;
+    ctx->zip_pool = NULL;
 
     /* Gray, RGB and CMYK profiles set when color spaces installed in graphics lib */
     ctx->gray_lin = gs_cspace_new_ICC(ctx->memory, ctx->pgs, -1);
@@ -326,6 +328,7 @@ xps_imp_init_job(pl_interp_implementation_t *impl)
 
     ctx->font_table = xps_hash_new(ctx);
     ctx->colorspace_table = xps_hash_new(ctx);
+    ctx->image_cache = xps_image_cache_new(ctx);
 
     ctx->start_part = NULL;
 
@@ -365,6 +368,8 @@ xps_imp_dnit_job(pl_interp_implementation_t *impl)
     xps_free(ctx, ctx->zip_table);
 
     /* TODO: free resources too */
+    xps_image_cache_free(ctx, ctx->image_cache);
+    ctx->image_cache = NULL;
     xps_hash_free(ctx, ctx->font_table, xps_free_key_func, xps_free_font_func);
     xps_hash_free(ctx, ctx->colorspace_table, xps_free_key_func, NULL);
 
@@ -17,6 +17,64 @@
 /* XPS interpreter - zip container parsing */
 
 #include "ghostxps.h"
+#include "gxsync.h"
+
+/*
+ * When the package can be mapped into memory, stored parts are handed
+ * out without copying, and deflated parts that the next page refers to
+ * are inflated ahead of time by a few threads while the current page
+ * is drawn. XPS_ZIP_THREADS sets the number of threads (0 turns this
+ * off) and XPS_ZIP_PREFETCH_MAX bounds the inflated data held for pages
+ * not yet finished.
+ */
+
+#ifndef XPS_ZIP_THREADS
+#define XPS_ZIP_THREADS 3
+#endif
+
+#define XPS_ZIP_MAX_THREADS 16
+
+#ifndef XPS_ZIP_PREFETCH_MAX
+#define XPS_ZIP_PREFETCH_MAX (64 * 1024 * 1024)
+#endif
+
+enum { XPS_JOB_QUEUED, XPS_JOB_RUNNING, XPS_JOB_DONE };
+
+struct xps_zip_job_s
+{
+    xps_entry_t *ent;
+    const byte *src; /* compressed data, in the mapped package */
+    byte *data;
+    int state;
+    int code;
+    int page; /* last page that refers to the part */
+    xps_zip_job_t *next; /* next in the queue */
+    xps_zip_job_t *next_live; /* next in the list of unreleased jobs */
+};
+
+/* Each thread waits on a semaphore of its own, as a gx_semaphore does
+ * not promise to wake more than one of several waiting threads. */
+typedef struct xps_zip_thread_s
+{
+    xps_zip_pool_t *pool;
+    gx_semaphore_t *work; /* signalled when there may be jobs, or to quit */
+    gp_thread_id id;
+} xps_zip_thread_t;
+
+struct xps_zip_pool_s
+{
+    gs_memory_t *memory; /* thread safe allocator, for zlib */
+    gx_monitor_t *lock; /* guards the queue and the job states */
+    gx_semaphore_t *done; /* signalled for each job a thread finishes */
+    xps_zip_job_t *head;
+    xps_zip_job_t *tail;
+    xps_zip_job_t *live; /* only used by the interpreter thread */
+    int64_t live_size;
+    int quit;
+    int nthreads;
+    int next_thread; /* to wake for the next queued job */
+    xps_zip_thread_t threads[XPS_ZIP_MAX_THREADS];
+};
 
 static int isfile(char *path)
 {
@@ -45,21 +103,29 @@ static inline int getlong(FILE *file)
     return a | (b << 8) | (c << 16) | (d << 24);
 }
 
+static inline int getshort_map(const byte *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static inline int getlong_map(const byte *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24);
+}
+
+/* zlib may be running on one of the prefetch threads, so allocate
+ * from the memory passed as the opaque pointer and do not throw. */
+
 static void *
-xps_zip_alloc_items(xps_context_t *ctx, int items, int size)
+xps_zip_alloc_items(gs_memory_t *mem, int items, int size)
 {
-    void *item = xps_alloc(ctx, items * size);
-    if (!item) {
-        gs_throw(gs_error_VMerror, "out of memory: item.\n");
-        return NULL;
-    }
-    return item;
+    return gs_alloc_bytes(mem, items * size, "xps_zip_alloc_items");
 }
 
 static void
-xps_zip_free(xps_context_t *ctx, void *ptr)
+xps_zip_free(gs_memory_t *mem, void *ptr)
 {
-    xps_free(ctx, ptr);
+    gs_free_object(mem, ptr, "xps_zip_free");
 }
 
 static int
@@ -90,13 +156,93 @@ xps_find_zip_entry(xps_context_t *ctx, const char *name)
 }
 
 /*
- * Inflate the data in a zip entry.
+ * Inflate the data in a zip entry. Returns 1 if the data was short (the
+ * rest of outbuf is zeroed), or a negative code with *msgp set.
  */
 
 static int
-xps_read_zip_entry(xps_context_t *ctx, xps_entry_t *ent, unsigned char *outbuf)
+xps_inflate_entry(gs_memory_t *mem, const byte *inbuf, int csize,
+    byte *outbuf, int usize, const char **msgp)
 {
     z_stream stream;
+    int code;
+
+    memset(&stream, 0, sizeof(z_stream));
+    stream.zalloc = (alloc_func) xps_zip_alloc_items;
+    stream.zfree = (free_func) xps_zip_free;
+    stream.opaque = mem;
+    stream.next_in = (Bytef *)inbuf;
+    stream.avail_in = csize;
+    stream.next_out = outbuf;
+    stream.avail_out = usize;
+
+    code = inflateInit2(&stream, -15);
+    if (code != Z_OK)
+    {
+        *msgp = stream.msg ? stream.msg : "inflateInit2 failed";
+        return -1;
+    }
+    code = inflate(&stream, Z_FINISH);
+    if (code != Z_STREAM_END)
+    {
+        *msgp = stream.msg ? stream.msg : "inflate failed";
+        inflateEnd(&stream);
+        return -1;
+    }
+    code = inflateEnd(&stream);
+    if (code != Z_OK)
+    {
+        *msgp = stream.msg ? stream.msg : "inflateEnd failed";
+        return -1;
+    }
+
+    /* If the stream has less data than advertised, then zero the remainder. */
+    if (stream.avail_out > 0)
+    {
+        memset(stream.next_out, 0, stream.avail_out);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+ * Find the data of a zip entry in the mapped package. Returns NULL, or
+ * a description of what is wrong with the entry.
+ */
+
+static const char *
+xps_map_zip_entry(xps_context_t *ctx, xps_entry_t *ent, const byte **datap, int *methodp)
+{
+    const byte *p;
+    int64_t start;
+    int size;
+
+    if (ent->offset < 0 || (int64_t)ent->offset + 30 > ctx->zip_map_size)
+        return "zip entry offset out of range";
+
+    p = ctx->zip_map + ent->offset;
+    if (getlong_map(p) != ZIP_LOCAL_FILE_SIG)
+        return "wrong zip local file signature";
+    if (getshort_map(p + 6) & ZIP_ENCRYPTED_FLAG)
+        return "zip file content is encrypted";
+    *methodp = getshort_map(p + 8);
+
+    /* skip the name and extra field */
+    start = (int64_t)ent->offset + 30 + getshort_map(p + 26) + getshort_map(p + 28);
+    size = *methodp == 0 ? ent->usize : ent->csize;
+    if (size < 0 || start + size > ctx->zip_map_size)
+        return "zip entry data out of range";
+
+    *datap = ctx->zip_map + start;
+    return NULL;
+}
+
+static int
+xps_read_zip_entry(xps_context_t *ctx, xps_entry_t *ent, unsigned char *outbuf)
+{
+    const byte *src;
+    const char *msg;
     unsigned char *inbuf;
     int sig;
     int version, general, method;
@@ -105,6 +251,28 @@ xps_read_zip_entry(xps_context_t *ctx, xps_entry_t *ent, unsigned char *outbuf)
 
     if_debug1m('|', ctx->memory, "zip: inflating entry '%s'\n", ent->name);
 
+    if (ctx->zip_map)
+    {
+        msg = xps_map_zip_entry(ctx, ent, &src, &method);
+        if (msg)
+            return gs_throw2(-1, "%s: '%s'", msg, ent->name);
+
+        if (method == 0)
+        {
+            memcpy(outbuf, src, ent->usize);
+            return gs_okay;
+        }
+        if (method != 8)
+            return gs_throw1(-1, "unknown compression method (%d)", method);
+
+        code = xps_inflate_entry(ctx->memory, src, ent->csize, outbuf, ent->usize, &msg);
+        if (code < 0)
+            return gs_throw1(-1, "zlib inflate error: %s", msg);
+        if (code > 0)
+            gs_warn("truncated zipfile entry; possibly corrupt data");
+        return gs_okay;
+    }
+
     if (xps_fseek(ctx->file, ent->offset, 0) < 0)
         return gs_throw1(-1, "seek to offset %d failed.", ent->offset);
 
@@ -153,50 +321,301 @@ xps_read_zip_entry(xps_context_t *ctx, xps_entry_t *ent, unsigned char *outbuf)
             return gs_throw1(gs_error_ioerror, "Failed to read %d bytes", ent->csize);
         }
 
-        memset(&stream, 0, sizeof(z_stream));
-        stream.zalloc = (alloc_func) xps_zip_alloc_items;
-        stream.zfree = (free_func) xps_zip_free;
-        stream.opaque = ctx;
-        stream.next_in = inbuf;
-        stream.avail_in = ent->csize;
-        stream.next_out = outbuf;
-        stream.avail_out = ent->usize;
-
-        code = inflateInit2(&stream, -15);
-        if (code != Z_OK)
+        code = xps_inflate_entry(ctx->memory, inbuf, ent->csize, outbuf, ent->usize, &msg);
+
+        xps_free(ctx, inbuf);
+
+        if (code < 0)
+            return gs_throw1(-1, "zlib inflate error: %s", msg);
+        if (code > 0)
+            gs_warn("truncated zipfile entry; possibly corrupt data");
+    }
+    else
+    {
+        return gs_throw1(-1, "unknown compression method (%d)", method);
+    }
+
+    return gs_okay;
+}
+
+/*
+ * Inflate parts on other threads ahead of the page that needs them.
+ */
+
+static void
+xps_zip_worker(void *arg)
+{
+    xps_zip_thread_t *thread = arg;
+    xps_zip_pool_t *pool = thread->pool;
+    xps_zip_job_t *job;
+    const char *msg;
+
+    while (1)
+    {
+        gx_monitor_enter(pool->lock);
+        job = pool->head;
+        if (job)
         {
-            xps_free(ctx, inbuf);
-            return gs_throw1(-1, "zlib inflateInit2 error: %s", stream.msg);
+            pool->head = job->next;
+            if (!pool->head)
+                pool->tail = NULL;
+            job->state = XPS_JOB_RUNNING;
         }
-        code = inflate(&stream, Z_FINISH);
-        if (code != Z_STREAM_END)
+        else if (pool->quit)
         {
-            inflateEnd(&stream);
-            xps_free(ctx, inbuf);
-            return gs_throw1(-1, "zlib inflate error: %s", stream.msg);
+            gx_monitor_leave(pool->lock);
+            return;
         }
-        code = inflateEnd(&stream);
-        if (code != Z_OK)
+        gx_monitor_leave(pool->lock);
+
+        if (!job)
         {
-            xps_free(ctx, inbuf);
-            return gs_throw1(-1, "zlib inflateEnd error: %s", stream.msg);
+            gx_semaphore_wait(thread->work);
+            continue;
         }
 
-        xps_free(ctx, inbuf);
+        job->code = xps_inflate_entry(pool->memory, job->src, job->ent->csize,
+                                      job->data, job->ent->usize, &msg);
 
-        /* If the stream has less data than advertised, then zero the remainder. */
-        if (stream.avail_out > 0)
+        gx_monitor_enter(pool->lock);
+        job->state = XPS_JOB_DONE;
+        gx_monitor_leave(pool->lock);
+        gx_semaphore_signal(pool->done);
+    }
+}
+
+static void
+xps_zip_start_threads(xps_context_t *ctx)
+{
+    xps_zip_pool_t *pool;
+    gs_memory_t *mem = ctx->memory->thread_safe_memory;
+    int i;
+
+    if (XPS_ZIP_THREADS <= 0 || !mem || !ctx->zip_map)
+        return;
+
+    pool = xps_alloc(ctx, sizeof(xps_zip_pool_t));
+    if (!pool)
+        return;
+    memset(pool, 0, sizeof(xps_zip_pool_t));
+    pool->memory = mem;
+
+    pool->lock = gx_monitor_label(gx_monitor_alloc(mem), "xps_zip_pool");
+    pool->done = gx_semaphore_label(gx_semaphore_alloc(mem), "xps_zip_done");
+
+    if (pool->lock && pool->done)
+    {
+        for (i = 0; i < XPS_ZIP_THREADS && i < XPS_ZIP_MAX_THREADS; i++)
         {
-            gs_warn("truncated zipfile entry; possibly corrupt data");
-            memset(stream.next_out, 0, stream.avail_out);
+            xps_zip_thread_t *thread = &pool->threads[i];
+
+            thread->pool = pool;
+            thread->work = gx_semaphore_label(gx_semaphore_alloc(mem), "xps_zip_work");
+            if (!thread->work)
+                break;
+            if (gp_thread_start(xps_zip_worker, thread, &thread->id) < 0)
+            {
+                gx_semaphore_free(thread->work);
+                break;
+            }
         }
+        pool->nthreads = i;
     }
-    else
+
+    if (pool->nthreads == 0)
     {
-        return gs_throw1(-1, "unknown compression method (%d)", method);
+        if (pool->lock)
+            gx_monitor_free(pool->lock);
+        if (pool->done)
+            gx_semaphore_free(pool->done);
+        xps_free(ctx, pool);
+        return;
     }
 
-    return gs_okay;
+    if_debug1m('|', ctx->memory, "zip: inflating ahead on %d threads\n", pool->nthreads);
+
+    ctx->zip_pool = pool;
+}
+
+/* Make sure a job is finished: do it here if no thread has picked it up
+ * yet (or drop it, if 'run' is not set), else wait for the thread. */
+static void
+xps_zip_finish_job(xps_context_t *ctx, xps_zip_job_t *job, int run)
+{
+    xps_zip_pool_t *pool = ctx->zip_pool;
+    xps_zip_job_t **pp, *prev;
+    const char *msg;
+    int state;
+
+    gx_monitor_enter(pool->lock);
+    state = job->state;
+    if (state == XPS_JOB_QUEUED)
+    {
+        prev = NULL;
+        for (pp = &pool->head; *pp != job; pp = &(*pp)->next)
+            prev = *pp;
+        *pp = job->next;
+        if (pool->tail == job)
+            pool->tail = prev;
+        job->state = XPS_JOB_DONE;
+    }
+    gx_monitor_leave(pool->lock);
+
+    if (state == XPS_JOB_QUEUED)
+    {
+        if (run)
+            job->code = xps_inflate_entry(ctx->memory, job->src, job->ent->csize,
+                                          job->data, job->ent->usize, &msg);
+        else
+            job->code = -1;
+        return;
+    }
+
+    /* Other jobs finishing wake us too, so check again each time */
+    while (state != XPS_JOB_DONE)
+    {
+        gx_semaphore_wait(pool->done);
+        gx_monitor_enter(pool->lock);
+        state = job->state;
+        gx_monitor_leave(pool->lock);
+    }
+}
+
+static void
+xps_zip_free_job(xps_context_t *ctx, xps_zip_job_t *job)
+{
+    ctx->zip_pool->live_size -= job->ent->usize;
+    job->ent->job = NULL;
+    xps_free(ctx, job->data);
+    xps_free(ctx, job);
+}
+
+static void
+xps_zip_stop_threads(xps_context_t *ctx)
+{
+    xps_zip_pool_t *pool = ctx->zip_pool;
+    xps_zip_job_t *job;
+    int i;
+
+    if (!pool)
+        return;
+
+    /* Drop the jobs no thread has started, and let the threads run out */
+    gx_monitor_enter(pool->lock);
+    pool->head = NULL;
+    pool->tail = NULL;
+    pool->quit = 1;
+    gx_monitor_leave(pool->lock);
+
+    for (i = 0; i < pool->nthreads; i++)
+        gx_semaphore_signal(pool->threads[i].work);
+    for (i = 0; i < pool->nthreads; i++)
+    {
+        gp_thread_finish(pool->threads[i].id);
+        gx_semaphore_free(pool->threads[i].work);
+    }
+
+    while (pool->live)
+    {
+        job = pool->live;
+        pool->live = job->next_live;
+        xps_zip_free_job(ctx, job);
+    }
+
+    gx_monitor_free(pool->lock);
+    gx_semaphore_free(pool->done);
+    xps_free(ctx, pool);
+    ctx->zip_pool = NULL;
+}
+
+/* Queue a deflated part to be inflated for the given page. */
+static void
+xps_zip_queue_part(xps_context_t *ctx, const char *partname, int page)
+{
+    xps_zip_pool_t *pool = ctx->zip_pool;
+    xps_entry_t *ent;
+    xps_zip_job_t *job;
+    const byte *src;
+    int method;
+
+    if (partname[0] == '/')
+        partname ++;
+
+    /* Parts split into pieces are left to be read when needed */
+    ent = xps_find_zip_entry(ctx, partname);
+    if (!ent)
+        return;
+
+    if (ent->job)
+    {
+        ent->job->page = page;
+        return;
+    }
+
+    if (ent->method != 8 || ent->usize <= 0)
+        return;
+    if (pool->live_size + ent->usize > XPS_ZIP_PREFETCH_MAX)
+        return;
+    if (xps_map_zip_entry(ctx, ent, &src, &method) || method != 8)
+        return;
+
+    job = xps_alloc(ctx, sizeof(xps_zip_job_t));
+    if (!job)
+        return;
+    job->data = xps_alloc(ctx, ent->usize);
+    if (!job->data)
+    {
+        xps_free(ctx, job);
+        return;
+    }
+    job->ent = ent;
+    job->src = src;
+    job->state = XPS_JOB_QUEUED;
+    job->code = 0;
+    job->page = page;
+    job->next = NULL;
+
+    job->next_live = pool->live;
+    pool->live = job;
+    pool->live_size += ent->usize;
+    ent->job = job;
+
+    gx_monitor_enter(pool->lock);
+    if (pool->tail)
+        pool->tail->next = job;
+    else
+        pool->head = job;
+    pool->tail = job;
+    gx_monitor_leave(pool->lock);
+
+    /* A thread that is busy picks the job up when it is done */
+    gx_semaphore_signal(pool->threads[pool->next_thread].work);
+    pool->next_thread = (pool->next_thread + 1) % pool->nthreads;
+}
+
+/* Free the inflated parts that no page after this one refers to. */
+static void
+xps_zip_release_page(xps_context_t *ctx, int page)
+{
+    xps_zip_pool_t *pool = ctx->zip_pool;
+    xps_zip_job_t **pp, *job;
+
+    if (!pool)
+        return;
+
+    pp = &pool->live;
+    while (*pp)
+    {
+        job = *pp;
+        if (job->page > page)
+        {
+            pp = &job->next_live;
+            continue;
+        }
+        xps_zip_finish_job(ctx, job, 0);
+        *pp = job->next_live;
+        xps_zip_free_job(ctx, job);
+    }
 }
 
 /*
@@ -247,7 +666,7 @@ xps_read_zip_dir(xps_context_t *ctx, int start_offset)
         (void) getshort(ctx->file); /* version made by */
         (void) getshort(ctx->file); /* version to extract */
         (void) getshort(ctx->file); /* general */
-        (void) getshort(ctx->file); /* method */
+        ctx->zip_table[i].method = getshort(ctx->file);
         (void) getshort(ctx->file); /* last mod file time */
         (void) getshort(ctx->file); /* last mod file date */
         (void) getlong(ctx->file); /* crc-32 */
@@ -323,6 +742,29 @@ xps_find_and_read_zip_dir(xps_context_t *ctx)
     return gs_throw(-1, "cannot find end of central directory");
 }
 
+/*
+ * A part whose data belongs to the package reader, either the mapped
+ * package itself or the buffer of an inflate job.
+ */
+
+static xps_part_t *
+xps_new_borrowed_part(xps_context_t *ctx, const char *name, const byte *data, int size)
+{
+    xps_part_t *part;
+
+    part = xps_alloc(ctx, sizeof(xps_part_t));
+    if (!part) {
+        gs_throw(gs_error_VMerror, "out of memory: xps_new_borrowed_part\n");
+        return NULL;
+    }
+    part->name = xps_strdup(ctx, name);
+    part->size = size;
+    part->data = (byte *)data;
+    part->borrowed = 1;
+
+    return part;
+}
+
 /*
  * Read and interleave split parts from a ZIP file.
  */
@@ -346,6 +788,27 @@ xps_read_zip_part(xps_context_t *ctx, const char *partname)
     ent = xps_find_zip_entry(ctx, name);
     if (ent)
     {
+        if (ent->job)
+        {
+            xps_zip_finish_job(ctx, ent->job, 1);
+            if (ent->job->code >= 0)
+            {
+                if (ent->job->code > 0)
+                    gs_warn("truncated zipfile entry; possibly corrupt data");
+                return xps_new_borrowed_part(ctx, partname, ent->job->data, ent->usize);
+            }
+            /* else read it again below, to report the error */
+        }
+
+        if (ctx->zip_map && ent->method == 0)
+        {
+            const byte *src;
+            int method;
+
+            if (!xps_map_zip_entry(ctx, ent, &src, &method) && method == 0)
+                return xps_new_borrowed_part(ctx, partname, src, ent->usize);
+        }
+
         part = xps_new_part(ctx, partname, ent->usize);
         if (part != NULL)
             code = xps_read_zip_entry(ctx, ent, part->data);
@@ -558,6 +1021,94 @@ xps_read_and_process_page_part(xps_context_t *ctx, char *name)
     return gs_okay;
 }
 
+/*
+ * Queue the parts a page refers to (images, fonts and remote resource
+ * dictionaries), and the page itself. This is only a text scan of the
+ * Source, ImageSource and FontUri attribute values, so it may queue the
+ * odd part that is never used; that costs a little time on another
+ * thread, whereas parsing the page twice would cost it on this one.
+ */
+
+static void
+xps_zip_queue_page_value(xps_context_t *ctx, char *base_uri, char *value, int page)
+{
+    char partname[1024];
+    char *p;
+
+    p = strchr(value, '#');
+    if (p)
+        *p = 0;
+    if (!*value)
+        return;
+
+    xps_absolute_path(partname, base_uri, value, sizeof partname);
+
+    /* Fonts stay loaded once they have been used */
+    if (xps_hash_lookup(ctx->font_table, partname))
+        return;
+
+    xps_zip_queue_part(ctx, partname, page);
+}
+
+static void
+xps_zip_prefetch_page(xps_context_t *ctx, char *pagename, int page)
+{
+    xps_part_t *part;
+    char base_uri[1024];
+    char value[1024];
+    char *s, *p, *t;
+    int i, k;
+
+    if (!ctx->zip_pool)
+        return;
+
+    xps_zip_queue_part(ctx, pagename, page);
+    part = xps_read_part(ctx, pagename);
+    if (!part)
+        return; /* reported when the page is processed */
+
+    gs_strlcpy(base_uri, pagename, sizeof base_uri);
+    s = strrchr(base_uri, '/');
+    if (s)
+        s[1] = 0;
+
+    for (i = 7; i + 1 < part->size; i++)
+    {
+        if (part->data[i] != '=' || part->data[i + 1] != '"')
+            continue;
+        if (memcmp(part->data + i - 6, "Source", 6) && memcmp(part->data + i - 7, "FontUri", 7))
+            continue;
+
+        for (k = 0; k < sizeof value - 1 && i + 2 + k < part->size; k++)
+        {
+            if (part->data[i + 2 + k] == '"')
+                break;
+            value[k] = part->data[i + 2 + k];
+        }
+        value[k] = 0;
+
+        /* "{ColorConvertedBitmap /Resources/Image.tiff /Resources/Profile.icc}" */
+        if (strstr(value, "{ColorConvertedBitmap") == value)
+        {
+            p = strchr(value, ' ');
+            while (p)
+            {
+                t = p + 1;
+                p = strchr(t, ' ');
+                if (p)
+                    *p = 0;
+                else if ((s = strchr(t, '}')) != NULL)
+                    *s = 0;
+                xps_zip_queue_page_value(ctx, base_uri, t, page);
+            }
+        }
+        else if (value[0] != '{') /* markup extensions name resources, not parts */
+            xps_zip_queue_page_value(ctx, base_uri, value, page);
+    }
+
+    xps_free_part(ctx, part);
+}
+
 /*
  * Called by xpstop.c
  */
@@ -568,6 +1119,7 @@ xps_process_file(xps_context_t *ctx, char *filename)
     char buf[2048];
     xps_document_t *doc;
     xps_page_t *page;
+    int pageno;
     int code;
     char *p;
 
@@ -661,6 +1213,15 @@ xps_process_file(xps_context_t *ctx, char *filename)
             code = gs_rethrow(code, "cannot read zip central directory");
             goto cleanup;
         }
+
+#ifndef XPS_INDIRECTED_FILE_ACCESS
+        if (xps_fseek(ctx->file, 0, SEEK_END) == 0)
+        {
+            ctx->zip_map_size = xps_ftell(ctx->file);
+            ctx->zip_map = gp_fmap(ctx->file, ctx->zip_map_size);
+        }
+#endif
+        xps_zip_start_threads(ctx);
     }
 
     code = xps_read_and_process_metadata_part(ctx, "/_rels/.rels");
@@ -693,9 +1254,16 @@ xps_process_file(xps_context_t *ctx, char *filename)
         }
     }
 
-    for (page = ctx->first_page; page; page = page->next)
+    for (page = ctx->first_page, pageno = 0; page; page = page->next, pageno++)
     {
+        /* Have the parts of this page and the next inflated while we work */
+        if (page == ctx->first_page)
+            xps_zip_prefetch_page(ctx, page->name, pageno);
+        if (page->next)
+            xps_zip_prefetch_page(ctx, page->next->name, pageno + 1);
+
         code = xps_read_and_process_page_part(ctx, page->name);
+        xps_zip_release_page(ctx, pageno);
         if (code)
         {
             code = gs_rethrow(code, "cannot process FixedPage part");
@@ -706,6 +1274,12 @@ xps_process_file(xps_context_t *ctx, char *filename)
     code = gs_okay;
 
 cleanup:
+    xps_zip_stop_threads(ctx);
+    if (ctx->zip_map)
+    {
+        gp_funmap(ctx->zip_map, ctx->zip_map_size);
+        ctx->zip_map = NULL;
+    }
     if (ctx->directory)
         xps_free(ctx, ctx->directory);
     if (ctx->file)